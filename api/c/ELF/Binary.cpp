@@ -34,7 +34,7 @@ using namespace LIEF::ELF;
 
 namespace LIEF {
 namespace ELF {
-void init_c_binary(Elf_Binary_t* c_binary, Binary* binary) {
+void init_c_binary_lazy(Elf_Binary_t* c_binary, Binary* binary) {
   c_binary->handler     = reinterpret_cast<void*>(binary);
   c_binary->type        = static_cast<enum LIEF_ELF_ELF_CLASS>(binary->type());
   c_binary->interpreter = nullptr;
@@ -50,13 +50,19 @@ void init_c_binary(Elf_Binary_t* c_binary, Binary* binary) {
 
 
   init_c_header(c_binary, binary);
+}
+
+void init_c_binary(Elf_Binary_t* c_binary, Binary* binary) {
+  init_c_binary_lazy(c_binary, binary);
   init_c_sections(c_binary, binary);
   init_c_segments(c_binary, binary);
   init_c_dynamic_symbols(c_binary, binary);
   init_c_static_symbols(c_binary, binary);
   init_c_dynamic_entries(c_binary, binary);
+}
 
-
+inline const Binary& get_binary(const Elf_Binary_t* c_binary) {
+  return *reinterpret_cast<const Binary*>(c_binary->handler);
 }
 
 }
@@ -75,6 +81,19 @@ Elf_Binary_t* elf_parse(const char *file) {
   return c_binary;
 }
 
+Elf_Binary_t* elf_parse_lazy(const char *file) {
+  Binary* binary = Parser::parse(file).release();
+
+  if (binary == nullptr) {
+    return nullptr;
+  }
+
+  auto* c_binary = static_cast<Elf_Binary_t*>(malloc(sizeof(Elf_Binary_t)));
+  memset(c_binary, 0, sizeof(Elf_Binary_t));
+  init_c_binary_lazy(c_binary, binary);
+  return c_binary;
+}
+
 // Binary Methods
 // ==============
 
@@ -115,4 +134,110 @@ void elf_binary_destroy(Elf_Binary_t* binary) {
   free(binary);
 
 }
+
+size_t elf_binary_nb_sections(const Elf_Binary_t* binary) {
+  return get_binary(binary).sections().size();
+}
+
+int elf_binary_get_section(const Elf_Binary_t* binary, size_t idx,
+                           Elf_Section_t* section) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  init_c_section(section, sections[idx]);
+  return 1;
+}
+
+const char* elf_binary_get_section_name(const Elf_Binary_t* binary, size_t idx) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return nullptr;
+  }
+  return sections[idx].fullname().c_str();
+}
+
+int elf_binary_get_section_entropy(const Elf_Binary_t* binary, size_t idx,
+                                   double* entropy) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  *entropy = sections[idx].entropy();
+  return 1;
+}
+
+size_t elf_binary_nb_segments(const Elf_Binary_t* binary) {
+  return get_binary(binary).segments().size();
+}
+
+int elf_binary_get_segment(const Elf_Binary_t* binary, size_t idx,
+                           Elf_Segment_t* segment) {
+  Binary::it_const_segments segments = get_binary(binary).segments();
+  if (idx >= segments.size()) {
+    return 0;
+  }
+  init_c_segment(segment, segments[idx]);
+  return 1;
+}
+
+size_t elf_binary_nb_dynamic_entries(const Elf_Binary_t* binary) {
+  return get_binary(binary).dynamic_entries().size();
+}
+
+int elf_binary_get_dynamic_entry(const Elf_Binary_t* binary, size_t idx,
+                                 Elf_DynamicEntry_t* entry) {
+  Binary::it_const_dynamic_entries entries = get_binary(binary).dynamic_entries();
+  if (idx >= entries.size()) {
+    return 0;
+  }
+  const DynamicEntry& dt = entries[idx];
+  entry->tag   = static_cast<uint64_t>(dt.tag());
+  entry->value = dt.value();
+  return 1;
+}
+
+size_t elf_binary_nb_dynamic_symbols(const Elf_Binary_t* binary) {
+  return get_binary(binary).dynamic_symbols().size();
+}
+
+int elf_binary_get_dynamic_symbol(const Elf_Binary_t* binary, size_t idx,
+                                  Elf_Symbol_t* symbol) {
+  Binary::it_const_dynamic_symbols symbols = get_binary(binary).dynamic_symbols();
+  if (idx >= symbols.size()) {
+    return 0;
+  }
+  init_c_symbol(symbol, symbols[idx]);
+  return 1;
+}
+
+const char* elf_binary_get_dynamic_symbol_name(const Elf_Binary_t* binary, size_t idx) {
+  Binary::it_const_dynamic_symbols symbols = get_binary(binary).dynamic_symbols();
+  if (idx >= symbols.size()) {
+    return nullptr;
+  }
+  return symbols[idx].name().c_str();
+}
+
+size_t elf_binary_nb_static_symbols(const Elf_Binary_t* binary) {
+  return get_binary(binary).static_symbols().size();
+}
+
+int elf_binary_get_static_symbol(const Elf_Binary_t* binary, size_t idx,
+                                 Elf_Symbol_t* symbol) {
+  Binary::it_const_static_symbols symbols = get_binary(binary).static_symbols();
+  if (idx >= symbols.size()) {
+    return 0;
+  }
+  init_c_symbol(symbol, symbols[idx]);
+  return 1;
+}
+
+const char* elf_binary_get_static_symbol_name(const Elf_Binary_t* binary, size_t idx) {
+  Binary::it_const_static_symbols symbols = get_binary(binary).static_symbols();
+  if (idx >= symbols.size()) {
+    return nullptr;
+  }
+  return symbols[idx].name().c_str();
+}
 //}
@@ -178,6 +178,9 @@ void init_c_dynamic_entries(Elf_Binary_t* c_binary, Binary* binary) {
 void destroy_dynamic_entries(Elf_Binary_t* c_binary) {
 
   Elf_DynamicEntry_t **dynamic_entries = c_binary->dynamic_entries;
+  if (dynamic_entries == nullptr) {
+    return;
+  }
   for (size_t idx = 0; dynamic_entries[idx] != nullptr; ++idx) {
     switch(static_cast<DYNAMIC_TAGS>(dynamic_entries[idx]->tag)) {
       case DYNAMIC_TAGS::DT_NEEDED:
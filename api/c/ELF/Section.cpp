@@ -17,6 +17,25 @@
 
 namespace LIEF {
 namespace ELF {
+void init_c_section(Elf_Section_t* c_section, const Section& section) {
+  span<const uint8_t> section_content = section.content();
+
+  c_section->name            = section.fullname().c_str();
+  c_section->flags           = section.flags();
+  c_section->type            = static_cast<enum LIEF_ELF_ELF_SECTION_TYPES>(section.type());
+  c_section->virtual_address = section.virtual_address();
+  c_section->offset          = section.file_offset();
+  c_section->original_size   = section.original_size();
+  c_section->link            = section.link();
+  c_section->info            = section.information();
+  c_section->alignment       = section.alignment();
+  c_section->entry_size      = section.entry_size();
+  c_section->size            = section_content.size();
+  c_section->entropy         = 0;
+  c_section->content         = !section_content.empty() ?
+                               const_cast<uint8_t*>(section_content.data()) : nullptr;
+}
+
 void init_c_sections(Elf_Binary_t* c_binary, Binary* binary) {
 
   Binary::it_sections sections = binary->sections();
@@ -25,24 +44,9 @@ void init_c_sections(Elf_Binary_t* c_binary, Binary* binary) {
       malloc((sections.size() + 1) * sizeof(Elf_Section_t**)));
 
   for (size_t i = 0; i < sections.size(); ++i) {
-    Section& b_section = sections[i];
     c_binary->sections[i] = static_cast<Elf_Section_t*>(malloc(sizeof(Elf_Section_t)));
-    span<const uint8_t> section_content = b_section.content();
-
-    c_binary->sections[i]->name            = b_section.fullname().c_str();
-    c_binary->sections[i]->flags           = b_section.flags();
-    c_binary->sections[i]->type            = static_cast<enum LIEF_ELF_ELF_SECTION_TYPES>(b_section.type());
-    c_binary->sections[i]->virtual_address = b_section.virtual_address();
-    c_binary->sections[i]->offset          = b_section.file_offset();
-    c_binary->sections[i]->original_size   = b_section.original_size();
-    c_binary->sections[i]->link            = b_section.link();
-    c_binary->sections[i]->info            = b_section.information();
-    c_binary->sections[i]->alignment       = b_section.alignment();
-    c_binary->sections[i]->entry_size      = b_section.entry_size();
-    c_binary->sections[i]->size            = section_content.size();
-    c_binary->sections[i]->entropy         = b_section.entropy();
-    c_binary->sections[i]->content         = !section_content.empty() ?
-                                             const_cast<uint8_t*>(section_content.data()) : nullptr;
+    init_c_section(c_binary->sections[i], sections[i]);
+    c_binary->sections[i]->entropy = sections[i].entropy();
   }
   c_binary->sections[sections.size()] = nullptr;
 
@@ -53,6 +57,9 @@ void init_c_sections(Elf_Binary_t* c_binary, Binary* binary) {
 void destroy_sections(Elf_Binary_t* c_binary) {
 
   Elf_Section_t **sections = c_binary->sections;
+  if (sections == nullptr) {
+    return;
+  }
   for (size_t idx = 0; sections[idx] != nullptr; ++idx) {
     free(sections[idx]);
   }
@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace ELF {
 
+void init_c_section(Elf_Section_t* c_section, const Section& section);
 void init_c_sections(Elf_Binary_t* c_binary, Binary* binary);
 void destroy_sections(Elf_Binary_t* c_binary);
 
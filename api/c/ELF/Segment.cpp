@@ -18,26 +18,28 @@
 namespace LIEF {
 namespace ELF {
 
+void init_c_segment(Elf_Segment_t* c_segment, const Segment& segment) {
+  span<const uint8_t> segment_content = segment.content();
+
+  c_segment->type            = static_cast<enum LIEF_ELF_SEGMENT_TYPES>(segment.type());
+  c_segment->flags           = static_cast<uint32_t>(segment.flags());
+  c_segment->virtual_address = segment.virtual_address();
+  c_segment->virtual_size    = segment.virtual_size();
+  c_segment->offset          = segment.file_offset();
+  c_segment->alignment       = segment.alignment();
+  c_segment->size            = segment_content.size();
+  c_segment->content         = !segment_content.empty() ?
+                               const_cast<uint8_t*>(segment_content.data()) : nullptr;
+}
+
 void init_c_segments(Elf_Binary_t* c_binary, Binary* binary) {
 
   Binary::it_segments segments = binary->segments();
   c_binary->segments = static_cast<Elf_Segment_t**>(
       malloc((segments.size() + 1) * sizeof(Elf_Segment_t**)));
   for (size_t i = 0; i < segments.size(); ++i) {
-    Segment& segment = segments[i];
-
-    span<const uint8_t> segment_content = segment.content();
-
     c_binary->segments[i] = static_cast<Elf_Segment_t*>(malloc(sizeof(Elf_Segment_t)));
-    c_binary->segments[i]->type            = static_cast<enum LIEF_ELF_SEGMENT_TYPES>(segment.type());
-    c_binary->segments[i]->flags           = static_cast<uint32_t>(segment.flags());
-    c_binary->segments[i]->virtual_address = segment.virtual_address();
-    c_binary->segments[i]->virtual_size    = segment.virtual_size();
-    c_binary->segments[i]->offset          = segment.file_offset();
-    c_binary->segments[i]->alignment       = segment.alignment();
-    c_binary->segments[i]->size            = segment_content.size();
-    c_binary->segments[i]->content         = !segment_content.empty() ?
-                                             const_cast<uint8_t*>(segment_content.data()) : nullptr;
+    init_c_segment(c_binary->segments[i], segments[i]);
   }
 
   c_binary->segments[segments.size()] = nullptr;
@@ -49,6 +51,9 @@ void init_c_segments(Elf_Binary_t* c_binary, Binary* binary) {
 void destroy_segments(Elf_Binary_t* c_binary) {
 
   Elf_Segment_t **segments = c_binary->segments;
+  if (segments == nullptr) {
+    return;
+  }
   for (size_t idx = 0; segments[idx] != nullptr; ++idx) {
     free(segments[idx]);
   }
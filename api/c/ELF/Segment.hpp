@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace ELF {
 
+void init_c_segment(Elf_Segment_t* c_segment, const Segment& segment);
 void init_c_segments(Elf_Binary_t* c_binary, Binary* binary);
 void destroy_segments(Elf_Binary_t* c_binary);
 
@@ -18,6 +18,19 @@
 namespace LIEF {
 namespace ELF {
 
+void init_c_symbol(Elf_Symbol_t* c_symbol, const Symbol& symbol) {
+  c_symbol->name        = symbol.name().c_str();
+  c_symbol->type        = static_cast<enum LIEF_ELF_ELF_SYMBOL_TYPES>(symbol.type());
+  c_symbol->binding     = static_cast<enum LIEF_ELF_SYMBOL_BINDINGS>(symbol.binding());
+  c_symbol->other       = symbol.other();
+  c_symbol->shndx       = symbol.shndx();
+  c_symbol->value       = symbol.value();
+  c_symbol->size        = symbol.size();
+  c_symbol->information = symbol.information();
+  c_symbol->is_exported = symbol.is_exported();
+  c_symbol->is_imported = symbol.is_imported();
+}
+
 void init_c_dynamic_symbols(Elf_Binary_t* c_binary, Binary* binary) {
   Binary::it_dynamic_symbols dyn_symb = binary->dynamic_symbols();
 
@@ -25,18 +38,8 @@ void init_c_dynamic_symbols(Elf_Binary_t* c_binary, Binary* binary) {
       malloc((dyn_symb.size() + 1) * sizeof(Elf_Symbol_t**)));
 
   for (size_t i = 0; i < dyn_symb.size(); ++i) {
-    Symbol& b_sym = dyn_symb[i];
     c_binary->dynamic_symbols[i] = static_cast<Elf_Symbol_t*>(malloc(sizeof(Elf_Symbol_t)));
-    c_binary->dynamic_symbols[i]->name        = b_sym.name().c_str();
-    c_binary->dynamic_symbols[i]->type        = static_cast<enum LIEF_ELF_ELF_SYMBOL_TYPES>(b_sym.type());
-    c_binary->dynamic_symbols[i]->binding     = static_cast<enum LIEF_ELF_SYMBOL_BINDINGS>(b_sym.binding());
-    c_binary->dynamic_symbols[i]->other       = b_sym.other();
-    c_binary->dynamic_symbols[i]->shndx       = b_sym.shndx();
-    c_binary->dynamic_symbols[i]->value       = b_sym.value();
-    c_binary->dynamic_symbols[i]->size        = b_sym.size();
-    c_binary->dynamic_symbols[i]->information = b_sym.information();
-    c_binary->dynamic_symbols[i]->is_exported = b_sym.is_exported();
-    c_binary->dynamic_symbols[i]->is_imported = b_sym.is_imported();
+    init_c_symbol(c_binary->dynamic_symbols[i], dyn_symb[i]);
   }
   c_binary->dynamic_symbols[dyn_symb.size()] = nullptr;
 
@@ -52,18 +55,8 @@ void init_c_static_symbols(Elf_Binary_t* c_binary, Binary* binary) {
       malloc((static_symb.size() + 1) * sizeof(Elf_Symbol_t**)));
 
   for (size_t i = 0; i < static_symb.size(); ++i) {
-    Symbol& b_sym = static_symb[i];
-    c_binary->static_symbols[i]              = static_cast<Elf_Symbol_t*>(malloc(sizeof(Elf_Symbol_t)));
-    c_binary->static_symbols[i]->name        = b_sym.name().c_str();
-    c_binary->static_symbols[i]->type        = static_cast<enum LIEF_ELF_ELF_SYMBOL_TYPES>(b_sym.type());
-    c_binary->static_symbols[i]->binding     = static_cast<enum LIEF_ELF_SYMBOL_BINDINGS>(b_sym.binding());
-    c_binary->static_symbols[i]->other       = b_sym.other();
-    c_binary->static_symbols[i]->shndx       = b_sym.shndx();
-    c_binary->static_symbols[i]->value       = b_sym.value();
-    c_binary->static_symbols[i]->size        = b_sym.size();
-    c_binary->static_symbols[i]->information = b_sym.information();
-    c_binary->static_symbols[i]->is_exported = b_sym.is_exported();
-    c_binary->static_symbols[i]->is_imported = b_sym.is_imported();
+    c_binary->static_symbols[i] = static_cast<Elf_Symbol_t*>(malloc(sizeof(Elf_Symbol_t)));
+    init_c_symbol(c_binary->static_symbols[i], static_symb[i]);
   }
   c_binary->static_symbols[static_symb.size()] = nullptr;
 
@@ -73,6 +66,9 @@ void init_c_static_symbols(Elf_Binary_t* c_binary, Binary* binary) {
 
 void destroy_dynamic_symbols(Elf_Binary_t* c_binary) {
   Elf_Symbol_t **dynamic_symbols = c_binary->dynamic_symbols;
+  if (dynamic_symbols == nullptr) {
+    return;
+  }
   for (size_t idx = 0; dynamic_symbols[idx] != nullptr; ++idx) {
     free(dynamic_symbols[idx]);
   }
@@ -82,6 +78,9 @@ void destroy_dynamic_symbols(Elf_Binary_t* c_binary) {
 
 void destroy_static_symbols(Elf_Binary_t* c_binary) {
   Elf_Symbol_t **static_symbols = c_binary->static_symbols;
+  if (static_symbols == nullptr) {
+    return;
+  }
   for (size_t idx = 0; static_symbols[idx] != nullptr; ++idx) {
     free(static_symbols[idx]);
   }
@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace ELF {
 
+void init_c_symbol(Elf_Symbol_t* c_symbol, const Symbol& symbol);
 void init_c_dynamic_symbols(Elf_Binary_t* c_binary, Binary* binary);
 void init_c_static_symbols(Elf_Binary_t* c_binary, Binary* binary);
 
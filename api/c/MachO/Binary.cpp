@@ -29,16 +29,29 @@ using namespace LIEF::MachO;
 
 namespace LIEF {
 namespace MachO {
-void init_c_binary(Macho_Binary_t* c_binary, Binary* binary) {
-
-  c_binary->handler = reinterpret_cast<void*>(binary);
+void init_c_binary_lazy(Macho_Binary_t* c_binary, Binary* binary) {
+  c_binary->handler   = reinterpret_cast<void*>(binary);
+  c_binary->name      = nullptr;
   c_binary->imagebase = binary->imagebase();
+  c_binary->commands  = nullptr;
+  c_binary->symbols   = nullptr;
+  c_binary->sections  = nullptr;
+  c_binary->segments  = nullptr;
   init_c_header(c_binary, binary);
+}
+
+void init_c_binary(Macho_Binary_t* c_binary, Binary* binary) {
+  init_c_binary_lazy(c_binary, binary);
   init_c_commands(c_binary, binary);
   init_c_symbols(c_binary, binary);
   init_c_sections(c_binary, binary);
   init_c_segments(c_binary, binary);
 }
+
+inline const Binary& get_binary(const Macho_Binary_t* c_binary) {
+  return *reinterpret_cast<const Binary*>(c_binary->handler);
+}
+
 }
 }
 
@@ -55,3 +68,88 @@ void macho_binaries_destroy(Macho_Binary_t** binaries) {
   free(binaries);
 
 }
+
+// On-demand accessors
+// ===================
+
+size_t macho_binary_nb_commands(const Macho_Binary_t* binary) {
+  return get_binary(binary).commands().size();
+}
+
+int macho_binary_get_command(const Macho_Binary_t* binary, size_t idx,
+                             Macho_Command_t* command) {
+  Binary::it_const_commands commands = get_binary(binary).commands();
+  if (idx >= commands.size()) {
+    return 0;
+  }
+  init_c_command(command, commands[idx]);
+  return 1;
+}
+
+size_t macho_binary_nb_symbols(const Macho_Binary_t* binary) {
+  return get_binary(binary).symbols().size();
+}
+
+int macho_binary_get_symbol(const Macho_Binary_t* binary, size_t idx,
+                            Macho_Symbol_t* symbol) {
+  Binary::it_const_symbols symbols = get_binary(binary).symbols();
+  if (idx >= symbols.size()) {
+    return 0;
+  }
+  init_c_symbol(symbol, symbols[idx]);
+  return 1;
+}
+
+const char* macho_binary_get_symbol_name(const Macho_Binary_t* binary, size_t idx) {
+  Binary::it_const_symbols symbols = get_binary(binary).symbols();
+  if (idx >= symbols.size()) {
+    return nullptr;
+  }
+  return symbols[idx].name().c_str();
+}
+
+size_t macho_binary_nb_sections(const Macho_Binary_t* binary) {
+  return get_binary(binary).sections().size();
+}
+
+int macho_binary_get_section(const Macho_Binary_t* binary, size_t idx,
+                             Macho_Section_t* section) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  init_c_section(section, sections[idx]);
+  return 1;
+}
+
+const char* macho_binary_get_section_name(const Macho_Binary_t* binary, size_t idx) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return nullptr;
+  }
+  return sections[idx].fullname().c_str();
+}
+
+int macho_binary_get_section_entropy(const Macho_Binary_t* binary, size_t idx,
+                                     double* entropy) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  *entropy = sections[idx].entropy();
+  return 1;
+}
+
+size_t macho_binary_nb_segments(const Macho_Binary_t* binary) {
+  return get_binary(binary).segments().size();
+}
+
+int macho_binary_get_segment(const Macho_Binary_t* binary, size_t idx,
+                             Macho_Segment_t* segment) {
+  Binary::it_const_segments segments = get_binary(binary).segments();
+  if (idx >= segments.size()) {
+    return 0;
+  }
+  init_c_segment(segment, segments[idx]);
+  return 1;
+}
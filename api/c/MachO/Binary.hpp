@@ -23,6 +23,7 @@ namespace LIEF {
 namespace MachO {
 
 void init_c_binary(Macho_Binary_t* c_binary, Binary* binary);
+void init_c_binary_lazy(Macho_Binary_t* c_binary, Binary* binary);
 
 }
 }
@@ -17,6 +17,15 @@
 
 namespace LIEF {
 namespace MachO {
+void init_c_command(Macho_Command_t* c_command, const LoadCommand& cmd) {
+  const std::vector<uint8_t>& cmd_content = cmd.data();
+
+  c_command->command = static_cast<enum LIEF_MACHO_LOAD_COMMAND_TYPES>(cmd.command());
+  c_command->size    = cmd.size();
+  c_command->data    = const_cast<uint8_t*>(cmd_content.data());
+  c_command->offset  = cmd.command_offset();
+}
+
 void init_c_commands(Macho_Binary_t* c_binary, Binary* binary) {
   Binary::it_commands commands = binary->commands();
 
@@ -27,17 +36,16 @@ void init_c_commands(Macho_Binary_t* c_binary, Binary* binary) {
     LoadCommand& cmd = commands[i];
 
     c_binary->commands[i] = static_cast<Macho_Command_t*>(malloc(sizeof(Macho_Command_t)));
+    init_c_command(c_binary->commands[i], cmd);
+
+    // The eager API owns a copy of the raw command
     const std::vector<uint8_t>& cmd_content = cmd.data();
     auto* content = static_cast<uint8_t*>(malloc(cmd_content.size() * sizeof(uint8_t)));
     std::copy(
         std::begin(cmd_content),
         std::end(cmd_content),
         content);
-
-    c_binary->commands[i]->command = static_cast<enum LIEF_MACHO_LOAD_COMMAND_TYPES>(cmd.command());
-    c_binary->commands[i]->size    = cmd.size();
-    c_binary->commands[i]->data    = content;
-    c_binary->commands[i]->offset  = cmd.command_offset();
+    c_binary->commands[i]->data = content;
   }
 
   c_binary->commands[commands.size()] = nullptr;
@@ -48,6 +56,9 @@ void init_c_commands(Macho_Binary_t* c_binary, Binary* binary) {
 
 void destroy_commands(Macho_Binary_t* c_binary) {
   Macho_Command_t **commands = c_binary->commands;
+  if (commands == nullptr) {
+    return;
+  }
   for (size_t idx = 0; commands[idx] != nullptr; ++idx) {
     free(commands[idx]->data);
     free(commands[idx]);
@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace MachO {
 
+void init_c_command(Macho_Command_t* c_command, const LoadCommand& cmd);
 void init_c_commands(Macho_Binary_t* c_binary, Binary* binary);
 void destroy_commands(Macho_Binary_t* c_binary);
 
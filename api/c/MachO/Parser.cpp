@@ -23,7 +23,10 @@
 
 using namespace LIEF::MachO;
 
-Macho_Binary_t** macho_parse(const char *file) {
+namespace {
+using init_fn_t = void(*)(Macho_Binary_t*, Binary*);
+
+Macho_Binary_t** parse_impl(const char *file, init_fn_t init_fn) {
   FatBinary* fat = Parser::parse(file).release();
   if (fat == nullptr) {
     return nullptr;
@@ -38,7 +41,7 @@ Macho_Binary_t** macho_parse(const char *file) {
     Binary* binary = fat->at(i);
     if (binary != nullptr) {
       c_macho_binaries[i] = static_cast<Macho_Binary_t*>(malloc(sizeof(Macho_Binary_t)));
-      init_c_binary(c_macho_binaries[i], binary);
+      init_fn(c_macho_binaries[i], binary);
     }
   }
 
@@ -49,4 +52,12 @@ Macho_Binary_t** macho_parse(const char *file) {
 
   return c_macho_binaries;
 }
+}
 
+Macho_Binary_t** macho_parse(const char *file) {
+  return parse_impl(file, &LIEF::MachO::init_c_binary);
+}
+
+Macho_Binary_t** macho_parse_lazy(const char *file) {
+  return parse_impl(file, &LIEF::MachO::init_c_binary_lazy);
+}
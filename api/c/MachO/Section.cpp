@@ -17,6 +17,25 @@
 
 namespace LIEF {
 namespace MachO {
+void init_c_section(Macho_Section_t* c_section, const Section& section) {
+  span<const uint8_t> section_content = section.content();
+
+  c_section->name                 = section.fullname().c_str();
+  c_section->alignment            = section.alignment();
+  c_section->relocation_offset    = section.relocation_offset();
+  c_section->numberof_relocations = section.numberof_relocations();
+  c_section->flags                = section.flags();
+  c_section->type                 = static_cast<enum LIEF_MACHO_MACHO_SECTION_TYPES>(section.type());
+  c_section->reserved1            = section.reserved1();
+  c_section->reserved2            = section.reserved2();
+  c_section->reserved3            = section.reserved3();
+  c_section->virtual_address      = section.virtual_address();
+  c_section->offset               = section.offset();
+  c_section->size                 = section_content.size();
+  c_section->content              = const_cast<uint8_t*>(section_content.data());
+  c_section->entropy              = 0;
+}
+
 void init_c_sections(Macho_Binary_t* c_binary, Binary* binary) {
   Binary::it_sections sections = binary->sections();
 
@@ -24,28 +43,16 @@ void init_c_sections(Macho_Binary_t* c_binary, Binary* binary) {
       malloc((sections.size() + 1) * sizeof(Macho_Section_t**)));
 
   for (size_t i = 0; i < sections.size(); ++i) {
-    const Section& section = sections[i];
-
     c_binary->sections[i] = static_cast<Macho_Section_t*>(malloc(sizeof(Macho_Section_t)));
-    span<const uint8_t> section_content = section.content();
-    auto* content = static_cast<uint8_t*>(malloc(section_content.size() * sizeof(uint8_t)));
-    std::copy(std::begin(section_content), std::end(section_content),
-              content);
+    init_c_section(c_binary->sections[i], sections[i]);
+    c_binary->sections[i]->entropy = sections[i].entropy();
 
-    c_binary->sections[i]->name                 = section.fullname().c_str();
-    c_binary->sections[i]->alignment            = section.alignment();
-    c_binary->sections[i]->relocation_offset    = section.relocation_offset();
-    c_binary->sections[i]->numberof_relocations = section.numberof_relocations();
-    c_binary->sections[i]->flags                = section.flags();
-    c_binary->sections[i]->type                 = static_cast<enum LIEF_MACHO_MACHO_SECTION_TYPES>(section.type());
-    c_binary->sections[i]->reserved1            = section.reserved1();
-    c_binary->sections[i]->reserved2            = section.reserved2();
-    c_binary->sections[i]->reserved3            = section.reserved3();
-    c_binary->sections[i]->virtual_address      = section.virtual_address();
-    c_binary->sections[i]->offset               = section.offset();
-    c_binary->sections[i]->size                 = section_content.size();
-    c_binary->sections[i]->content              = content;
-    c_binary->sections[i]->entropy              = section.entropy();
+    // The eager API owns a copy of the content
+    const uint8_t* section_content = c_binary->sections[i]->content;
+    const size_t size = c_binary->sections[i]->size;
+    auto* content = static_cast<uint8_t*>(malloc(size * sizeof(uint8_t)));
+    std::copy(section_content, section_content + size, content);
+    c_binary->sections[i]->content = content;
   }
 
   c_binary->sections[sections.size()] = nullptr;
@@ -56,6 +63,9 @@ void init_c_sections(Macho_Binary_t* c_binary, Binary* binary) {
 
 void destroy_sections(Macho_Binary_t* c_binary) {
   Macho_Section_t **sections = c_binary->sections;
+  if (sections == nullptr) {
+    return;
+  }
   for (size_t idx = 0; sections[idx] != nullptr; ++idx) {
     free(sections[idx]->content);
     free(sections[idx]);
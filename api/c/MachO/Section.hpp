@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace MachO {
 
+void init_c_section(Macho_Section_t* c_section, const Section& section);
 void init_c_sections(Macho_Binary_t* c_binary, Binary* binary);
 void destroy_sections(Macho_Binary_t* c_binary);
 
@@ -17,6 +17,23 @@
 
 namespace LIEF {
 namespace MachO {
+void init_c_segment(Macho_Segment_t* c_segment, const SegmentCommand& segment) {
+  span<const uint8_t> segment_content = segment.content();
+
+  c_segment->name              = segment.name().c_str();
+  c_segment->virtual_address   = segment.virtual_address();
+  c_segment->virtual_size      = segment.virtual_size();
+  c_segment->file_size         = segment.file_size();
+  c_segment->file_offset       = segment.file_offset();
+  c_segment->max_protection    = segment.max_protection();
+  c_segment->init_protection   = segment.init_protection();
+  c_segment->numberof_sections = segment.numberof_sections();
+  c_segment->flags             = segment.flags();
+  c_segment->content           = const_cast<uint8_t*>(segment_content.data());
+  c_segment->size              = segment_content.size();
+  c_segment->sections          = nullptr; //TODO
+}
+
 void init_c_segments(Macho_Binary_t* c_binary, Binary* binary) {
   Binary::it_segments segments = binary->segments();
 
@@ -24,28 +41,15 @@ void init_c_segments(Macho_Binary_t* c_binary, Binary* binary) {
       malloc((segments.size() + 1) * sizeof(Macho_Segment_t**)));
 
   for (size_t i = 0; i < segments.size(); ++i) {
-    SegmentCommand& segment = segments[i];
-
     c_binary->segments[i] = static_cast<Macho_Segment_t*>(malloc(sizeof(Macho_Segment_t)));
-    span<const uint8_t> segment_content = segment.content();
-    auto* content = static_cast<uint8_t*>(malloc(segment_content.size() * sizeof(uint8_t)));
-    std::copy(
-        std::begin(segment_content),
-        std::end(segment_content),
-        content);
+    init_c_segment(c_binary->segments[i], segments[i]);
 
-    c_binary->segments[i]->name              = segment.name().c_str();
-    c_binary->segments[i]->virtual_address   = segment.virtual_address();
-    c_binary->segments[i]->virtual_size      = segment.virtual_size();
-    c_binary->segments[i]->file_size         = segment.file_size();
-    c_binary->segments[i]->file_offset       = segment.file_offset();
-    c_binary->segments[i]->max_protection    = segment.max_protection();
-    c_binary->segments[i]->init_protection   = segment.init_protection();
-    c_binary->segments[i]->numberof_sections = segment.numberof_sections();
-    c_binary->segments[i]->flags             = segment.flags();
-    c_binary->segments[i]->content           = content;
-    c_binary->segments[i]->size              = segment_content.size();
-    c_binary->segments[i]->sections          = nullptr; //TODO
+    // The eager API owns a copy of the content
+    const uint8_t* segment_content = c_binary->segments[i]->content;
+    const size_t size = c_binary->segments[i]->size;
+    auto* content = static_cast<uint8_t*>(malloc(size * sizeof(uint8_t)));
+    std::copy(segment_content, segment_content + size, content);
+    c_binary->segments[i]->content = content;
   }
 
   c_binary->segments[segments.size()] = nullptr;
@@ -56,6 +60,9 @@ void init_c_segments(Macho_Binary_t* c_binary, Binary* binary) {
 
 void destroy_segments(Macho_Binary_t* c_binary) {
   Macho_Segment_t **segments = c_binary->segments;
+  if (segments == nullptr) {
+    return;
+  }
   for (size_t idx = 0; segments[idx] != nullptr; ++idx) {
     free(segments[idx]->content);
     free(segments[idx]);
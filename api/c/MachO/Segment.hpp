@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace MachO {
 
+void init_c_segment(Macho_Segment_t* c_segment, const SegmentCommand& segment);
 void init_c_segments(Macho_Binary_t* c_binary, Binary* binary);
 void destroy_segments(Macho_Binary_t* c_binary);
 
@@ -17,6 +17,14 @@
 
 namespace LIEF {
 namespace MachO {
+void init_c_symbol(Macho_Symbol_t* c_symbol, const Symbol& symbol) {
+  c_symbol->name              = symbol.name().c_str();
+  c_symbol->type              = symbol.type();
+  c_symbol->numberof_sections = symbol.numberof_sections();
+  c_symbol->description       = symbol.description();
+  c_symbol->value             = symbol.value();
+}
+
 void init_c_symbols(Macho_Binary_t* c_binary, Binary* binary) {
   Binary::it_symbols symbols = binary->symbols();
 
@@ -24,15 +32,8 @@ void init_c_symbols(Macho_Binary_t* c_binary, Binary* binary) {
       malloc((symbols.size() + 1) * sizeof(Macho_Symbol_t**)));
 
   for (size_t i = 0; i < symbols.size(); ++i) {
-    const Symbol& symbol = symbols[i];
-
     c_binary->symbols[i] = static_cast<Macho_Symbol_t*>(malloc(sizeof(Macho_Symbol_t)));
-
-    c_binary->symbols[i]->name              = symbol.name().c_str();
-    c_binary->symbols[i]->type              = symbol.type();
-    c_binary->symbols[i]->numberof_sections = symbol.numberof_sections();
-    c_binary->symbols[i]->description       = symbol.description();
-    c_binary->symbols[i]->value             = symbol.value();
+    init_c_symbol(c_binary->symbols[i], symbols[i]);
   }
 
   c_binary->symbols[symbols.size()] = nullptr;
@@ -43,6 +44,9 @@ void init_c_symbols(Macho_Binary_t* c_binary, Binary* binary) {
 
 void destroy_symbols(Macho_Binary_t* c_binary) {
   Macho_Symbol_t **symbols = c_binary->symbols;
+  if (symbols == nullptr) {
+    return;
+  }
   for (size_t idx = 0; symbols[idx] != nullptr; ++idx) {
     free(symbols[idx]);
   }
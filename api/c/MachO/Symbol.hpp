@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace MachO {
 
+void init_c_symbol(Macho_Symbol_t* c_symbol, const Symbol& symbol);
 void init_c_symbols(Macho_Binary_t* c_binary, Binary* binary);
 void destroy_symbols(Macho_Binary_t* c_binary);
 
@@ -27,22 +27,30 @@
 #include "Section.hpp"
 #include "DataDirectory.hpp"
 #include "Import.hpp"
+#include "ImportEntry.hpp"
 
 using namespace LIEF::PE;
 
 namespace LIEF {
 namespace PE {
 
-void init_c_binary(Pe_Binary_t* c_binary, Binary* binary) {
+void init_c_binary_lazy(Pe_Binary_t* c_binary, Binary* binary) {
   c_binary->handler = reinterpret_cast<void*>(binary);
 
   init_c_dos_header(c_binary, binary);
   init_c_header(c_binary, binary);
   init_c_optional_header(c_binary, binary);
+}
+
+void init_c_binary(Pe_Binary_t* c_binary, Binary* binary) {
+  init_c_binary_lazy(c_binary, binary);
   init_c_sections(c_binary, binary);
   init_c_data_directories(c_binary, binary);
   init_c_imports(c_binary, binary);
+}
 
+inline const Binary& get_binary(const Pe_Binary_t* c_binary) {
+  return *reinterpret_cast<const Binary*>(c_binary->handler);
 }
 
 }
@@ -62,6 +70,20 @@ Pe_Binary_t* pe_parse(const char *file) {
   return c_binary;
 }
 
+Pe_Binary_t* pe_parse_lazy(const char *file) {
+  Binary* binary = Parser::parse(file).release();
+
+  if (binary == nullptr) {
+    return nullptr;
+  }
+
+  auto* c_binary = static_cast<Pe_Binary_t*>(malloc(sizeof(Pe_Binary_t)));
+  std::memset(c_binary, 0, sizeof(Pe_Binary_t));
+  init_c_binary_lazy(c_binary, binary);
+
+  return c_binary;
+}
+
 void pe_binary_destroy(Pe_Binary_t* binary) {
   destroy_sections(binary);
   destroy_data_directories(binary);
@@ -69,3 +91,96 @@ void pe_binary_destroy(Pe_Binary_t* binary) {
   delete reinterpret_cast<Binary*>(binary->handler);
   free(binary);
 }
+
+size_t pe_binary_nb_data_directories(const Pe_Binary_t* binary) {
+  return get_binary(binary).data_directories().size();
+}
+
+int pe_binary_get_data_directory(const Pe_Binary_t* binary, size_t idx,
+                                 Pe_DataDirectory_t* dir) {
+  Binary::it_const_data_directories dirs = get_binary(binary).data_directories();
+  if (idx >= dirs.size()) {
+    return 0;
+  }
+  dir->rva  = dirs[idx].RVA();
+  dir->size = dirs[idx].size();
+  return 1;
+}
+
+size_t pe_binary_nb_sections(const Pe_Binary_t* binary) {
+  return get_binary(binary).sections().size();
+}
+
+int pe_binary_get_section(const Pe_Binary_t* binary, size_t idx,
+                          Pe_Section_t* section) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  init_c_section(section, sections[idx]);
+  return 1;
+}
+
+const char* pe_binary_get_section_name(const Pe_Binary_t* binary, size_t idx) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return nullptr;
+  }
+  return sections[idx].fullname().c_str();
+}
+
+int pe_binary_get_section_entropy(const Pe_Binary_t* binary, size_t idx,
+                                  double* entropy) {
+  Binary::it_const_sections sections = get_binary(binary).sections();
+  if (idx >= sections.size()) {
+    return 0;
+  }
+  *entropy = sections[idx].entropy();
+  return 1;
+}
+
+size_t pe_binary_nb_imports(const Pe_Binary_t* binary) {
+  return get_binary(binary).imports().size();
+}
+
+int pe_binary_get_import(const Pe_Binary_t* binary, size_t idx,
+                         Pe_Import_t* import) {
+  Binary::it_const_imports imports = get_binary(binary).imports();
+  if (idx >= imports.size()) {
+    return 0;
+  }
+  init_c_import(import, imports[idx]);
+  return 1;
+}
+
+const char* pe_binary_get_import_name(const Pe_Binary_t* binary, size_t idx) {
+  Binary::it_const_imports imports = get_binary(binary).imports();
+  if (idx >= imports.size()) {
+    return nullptr;
+  }
+  return imports[idx].name().c_str();
+}
+
+size_t pe_binary_nb_import_entries(const Pe_Binary_t* binary, size_t import_idx) {
+  Binary::it_const_imports imports = get_binary(binary).imports();
+  if (import_idx >= imports.size()) {
+    return 0;
+  }
+  return imports[import_idx].entries().size();
+}
+
+int pe_binary_get_import_entry(const Pe_Binary_t* binary,
+                               size_t import_idx, size_t entry_idx,
+                               Pe_ImportEntry_t* entry) {
+  Binary::it_const_imports imports = get_binary(binary).imports();
+  if (import_idx >= imports.size()) {
+    return 0;
+  }
+  const Import& imp = imports[import_idx];
+  Import::it_const_entries entries = imp.entries();
+  if (entry_idx >= entries.size()) {
+    return 0;
+  }
+  init_c_import_entry(entry, entries[entry_idx]);
+  return 1;
+}
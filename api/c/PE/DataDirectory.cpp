@@ -41,6 +41,9 @@ void init_c_data_directories(Pe_Binary_t* c_binary, Binary* binary) {
 void destroy_data_directories(Pe_Binary_t* c_binary) {
 
   Pe_DataDirectory_t **data_directories = c_binary->data_directories;
+  if (data_directories == nullptr) {
+    return;
+  }
   for (size_t idx = 0; data_directories[idx] != nullptr; ++idx) {
     free(data_directories[idx]);
   }
@@ -19,6 +19,15 @@
 namespace LIEF {
 namespace PE {
 
+void init_c_import(Pe_Import_t* c_import, const Import& imp) {
+  c_import->name                     = imp.name().c_str();
+  c_import->forwarder_chain          = imp.forwarder_chain();
+  c_import->timedatestamp            = imp.forwarder_chain();
+  c_import->import_address_table_rva = imp.import_address_table_rva();
+  c_import->import_lookup_table_rva  = imp.import_lookup_table_rva();
+  c_import->entries                  = nullptr;
+}
+
 void init_c_imports(Pe_Binary_t* c_binary, Binary* binary) {
 
   if (!binary->has_imports()) {
@@ -33,13 +42,7 @@ void init_c_imports(Pe_Binary_t* c_binary, Binary* binary) {
   for (size_t i = 0; i < imports.size(); ++i) {
     Import& imp = imports[i];
     c_binary->imports[i] = static_cast<Pe_Import_t*>(malloc(sizeof(Pe_Import_t)));
-
-    c_binary->imports[i]->name                     = imp.name().c_str();
-    c_binary->imports[i]->forwarder_chain          = imp.forwarder_chain();
-    c_binary->imports[i]->timedatestamp            = imp.forwarder_chain();
-    c_binary->imports[i]->import_address_table_rva = imp.import_address_table_rva();
-    c_binary->imports[i]->import_lookup_table_rva  = imp.import_lookup_table_rva();
-    c_binary->imports[i]->entries                  = nullptr;
+    init_c_import(c_binary->imports[i], imp);
     init_c_import_entries(c_binary->imports[i], imp);
   }
 
@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace PE {
 
+void init_c_import(Pe_Import_t* c_import, const Import& imp);
 void init_c_imports(Pe_Binary_t* c_binary, Binary* binary);
 void destroy_imports(Pe_Binary_t* c_binary);
 
@@ -18,6 +18,17 @@
 namespace LIEF {
 namespace PE {
 
+void init_c_import_entry(Pe_ImportEntry_t* c_entry, const ImportEntry& entry) {
+  c_entry->is_ordinal    = entry.is_ordinal();
+  c_entry->name          = entry.is_ordinal() ? nullptr : entry.name().c_str();
+  c_entry->ordinal       = entry.is_ordinal() ? entry.ordinal() : 0;
+  c_entry->hint_name_rva = entry.hint_name_rva();
+  c_entry->hint          = entry.hint();
+  c_entry->iat_value     = entry.iat_value();
+  c_entry->data          = entry.data();
+  c_entry->iat_address   = entry.iat_address();
+}
+
 void init_c_import_entries(Pe_Import_t* c_import, Import& imp) {
 
   Import::it_entries entries = imp.entries();
@@ -26,17 +37,8 @@ void init_c_import_entries(Pe_Import_t* c_import, Import& imp) {
       malloc((entries.size() + 1) * sizeof(Pe_ImportEntry_t**)));
 
   for (size_t i = 0; i < entries.size(); ++i) {
-    ImportEntry& import_entry = entries[i];
     c_import->entries[i] = static_cast<Pe_ImportEntry_t*>(malloc(sizeof(Pe_ImportEntry_t)));
-
-    c_import->entries[i]->is_ordinal    = import_entry.is_ordinal();
-    c_import->entries[i]->name          = import_entry.is_ordinal() ? nullptr : import_entry.name().c_str();
-    c_import->entries[i]->ordinal       = import_entry.is_ordinal() ? import_entry.ordinal() : 0;
-    c_import->entries[i]->hint_name_rva = import_entry.hint_name_rva();
-    c_import->entries[i]->hint          = import_entry.hint();
-    c_import->entries[i]->iat_value     = import_entry.iat_value();
-    c_import->entries[i]->data          = import_entry.data();
-    c_import->entries[i]->iat_address   = import_entry.iat_address();
+    init_c_import_entry(c_import->entries[i], entries[i]);
   }
 
   c_import->entries[entries.size()] = nullptr;
@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace PE {
 
+void init_c_import_entry(Pe_ImportEntry_t* c_entry, const ImportEntry& entry);
 void init_c_import_entries(Pe_Import_t* c_import, Import& imp);
 void destroy_import_entries(Pe_Import_t* c_import);
 
@@ -17,6 +17,23 @@
 
 namespace LIEF {
 namespace PE {
+void init_c_section(Pe_Section_t* c_section, const Section& section) {
+  span<const uint8_t> section_content = section.content();
+
+  c_section->name                    = section.fullname().c_str();
+  c_section->virtual_address         = section.virtual_address();
+  c_section->size                    = section.size();
+  c_section->offset                  = section.offset();
+  c_section->virtual_size            = section.virtual_size();
+  c_section->pointerto_relocation    = section.pointerto_relocation();
+  c_section->pointerto_line_numbers  = section.pointerto_line_numbers();
+  c_section->characteristics         = section.characteristics();
+  c_section->content                 = !section_content.empty() ?
+                                       const_cast<uint8_t*>(section_content.data()) : nullptr;
+  c_section->content_size            = section_content.size();
+  c_section->entropy                 = 0;
+}
+
 void init_c_sections(Pe_Binary_t* c_binary, Binary* binary) {
 
   Binary::it_sections sections = binary->sections();
@@ -25,28 +42,19 @@ void init_c_sections(Pe_Binary_t* c_binary, Binary* binary) {
       malloc((sections.size() + 1) * sizeof(Pe_Section_t**)));
 
   for (size_t i = 0; i < sections.size(); ++i) {
-    Section& b_section = sections[i];
     c_binary->sections[i] = static_cast<Pe_Section_t*>(malloc(sizeof(Pe_Section_t)));
-    span<const uint8_t> section_content = b_section.content();
-    uint8_t* content = nullptr;
+    init_c_section(c_binary->sections[i], sections[i]);
+    c_binary->sections[i]->entropy = sections[i].entropy();
 
-    if (!section_content.empty()) {
-      content = static_cast<uint8_t*>(malloc(section_content.size() * sizeof(uint8_t)));
-      std::copy(std::begin(section_content), std::end(section_content),
+    // The eager API owns a copy of the content
+    uint8_t* content = nullptr;
+    if (c_binary->sections[i]->content != nullptr) {
+      const size_t size = c_binary->sections[i]->content_size;
+      content = static_cast<uint8_t*>(malloc(size * sizeof(uint8_t)));
+      std::copy(c_binary->sections[i]->content, c_binary->sections[i]->content + size,
                 content);
     }
-
-    c_binary->sections[i]->name                    = b_section.fullname().c_str();
-    c_binary->sections[i]->virtual_address         = b_section.virtual_address();
-    c_binary->sections[i]->size                    = b_section.size();
-    c_binary->sections[i]->offset                  = b_section.offset();
-    c_binary->sections[i]->virtual_size            = b_section.virtual_size();
-    c_binary->sections[i]->pointerto_relocation    = b_section.pointerto_relocation();
-    c_binary->sections[i]->pointerto_line_numbers  = b_section.pointerto_line_numbers();
-    c_binary->sections[i]->characteristics         = b_section.characteristics();
-    c_binary->sections[i]->content                 = content;
-    c_binary->sections[i]->content_size            = section_content.size();
-    c_binary->sections[i]->entropy                 = b_section.entropy();
+    c_binary->sections[i]->content = content;
   }
   c_binary->sections[sections.size()] = nullptr;
 
@@ -57,6 +65,9 @@ void init_c_sections(Pe_Binary_t* c_binary, Binary* binary) {
 void destroy_sections(Pe_Binary_t* c_binary) {
 
   Pe_Section_t **sections = c_binary->sections;
+  if (sections == nullptr) {
+    return;
+  }
   for (size_t idx = 0; sections[idx] != nullptr; ++idx) {
     free(sections[idx]->content);
     free(sections[idx]);
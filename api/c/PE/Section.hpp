@@ -25,6 +25,7 @@
 namespace LIEF {
 namespace PE {
 
+void init_c_section(Pe_Section_t* c_section, const Section& section);
 void init_c_sections(Pe_Binary_t* c_binary, Binary* binary);
 void destroy_sections(Pe_Binary_t* c_binary);
 
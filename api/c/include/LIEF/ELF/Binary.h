@@ -59,6 +59,16 @@ typedef struct Elf_Binary_t Elf_Binary_t;
 /** @brief Wrapper for LIEF::ELF::Parser::parse */
 LIEF_API Elf_Binary_t* elf_parse(const char *file);
 
+/** @brief Same as ::elf_parse but only the header and the interpreter
+ * are set in the returned Elf_Binary_t.
+ *
+ * The ``sections``, ``segments``, ``dynamic_entries``, ``dynamic_symbols`` and
+ * ``static_symbols`` arrays are **NULL** and the elements must be accessed
+ * with the ``elf_binary_nb_xxx()`` / ``elf_binary_get_xxx()`` functions which
+ * read the underlying LIEF::ELF::Binary on demand.
+ */
+LIEF_API Elf_Binary_t* elf_parse_lazy(const char *file);
+
 LIEF_API void elf_binary_destroy(Elf_Binary_t* binary);
 
 /* ELF::Binary methods
@@ -68,6 +78,70 @@ LIEF_API void elf_binary_destroy(Elf_Binary_t* binary);
 /** @brief Update LIEF::ELF::Header object */
 LIEF_API int elf_binary_save_header(Elf_Binary_t* binary);
 
+/* On-demand accessors
+ * ===================
+ * These functions work on binaries created by ::elf_parse and ::elf_parse_lazy.
+ *
+ * The ``elf_binary_get_xxx()`` functions fill the structure provided by the
+ * caller and return 1 on success or 0 if the index is out of range. The
+ * strings (and content pointers) are borrowed from the underlying binary:
+ * they remain valid until the binary is modified or destroyed.
+ */
+
+/** @brief Number of sections */
+LIEF_API size_t elf_binary_nb_sections(const Elf_Binary_t* binary);
+
+/** @brief Fill ``section`` with the section at the given index
+ *
+ * The ``entropy`` field is not computed (it is set to 0):
+ * use ::elf_binary_get_section_entropy
+ */
+LIEF_API int elf_binary_get_section(const Elf_Binary_t* binary, size_t idx,
+                                    Elf_Section_t* section);
+
+/** @brief Name of the section at the given index (NULL if out of range) */
+LIEF_API const char* elf_binary_get_section_name(const Elf_Binary_t* binary, size_t idx);
+
+/** @brief Compute the entropy of the section at the given index and store it
+ * in ``entropy``. It returns 0 if the index is out of range.
+ */
+LIEF_API int elf_binary_get_section_entropy(const Elf_Binary_t* binary, size_t idx,
+                                            double* entropy);
+
+/** @brief Number of segments */
+LIEF_API size_t elf_binary_nb_segments(const Elf_Binary_t* binary);
+
+/** @brief Fill ``segment`` with the segment at the given index */
+LIEF_API int elf_binary_get_segment(const Elf_Binary_t* binary, size_t idx,
+                                    Elf_Segment_t* segment);
+
+/** @brief Number of dynamic entries */
+LIEF_API size_t elf_binary_nb_dynamic_entries(const Elf_Binary_t* binary);
+
+/** @brief Fill the tag and the value of the dynamic entry at the given index */
+LIEF_API int elf_binary_get_dynamic_entry(const Elf_Binary_t* binary, size_t idx,
+                                          Elf_DynamicEntry_t* entry);
+
+/** @brief Number of dynamic symbols */
+LIEF_API size_t elf_binary_nb_dynamic_symbols(const Elf_Binary_t* binary);
+
+/** @brief Fill ``symbol`` with the dynamic symbol at the given index */
+LIEF_API int elf_binary_get_dynamic_symbol(const Elf_Binary_t* binary, size_t idx,
+                                           Elf_Symbol_t* symbol);
+
+/** @brief Name of the dynamic symbol at the given index (NULL if out of range) */
+LIEF_API const char* elf_binary_get_dynamic_symbol_name(const Elf_Binary_t* binary, size_t idx);
+
+/** @brief Number of static symbols */
+LIEF_API size_t elf_binary_nb_static_symbols(const Elf_Binary_t* binary);
+
+/** @brief Fill ``symbol`` with the static symbol at the given index */
+LIEF_API int elf_binary_get_static_symbol(const Elf_Binary_t* binary, size_t idx,
+                                          Elf_Symbol_t* symbol);
+
+/** @brief Name of the static symbol at the given index (NULL if out of range) */
+LIEF_API const char* elf_binary_get_static_symbol_name(const Elf_Binary_t* binary, size_t idx);
+
 
 
 #ifdef __cplusplus
@@ -25,6 +25,7 @@
  */
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "LIEF/visibility.h"
 
@@ -56,8 +57,72 @@ typedef struct Macho_Binary_t Macho_Binary_t;
 /** @brief Wrapper on LIEF::MachO::Parser::parse */
 LIEF_API Macho_Binary_t** macho_parse(const char *file);
 
+/** @brief Same as ::macho_parse but only the header and the imagebase
+ * are set in the returned Macho_Binary_t.
+ *
+ * The ``commands``, ``symbols``, ``sections`` and ``segments`` arrays are
+ * **NULL** and the elements must be accessed with the
+ * ``macho_binary_nb_xxx()`` / ``macho_binary_get_xxx()`` functions which read
+ * the underlying LIEF::MachO::Binary on demand.
+ */
+LIEF_API Macho_Binary_t** macho_parse_lazy(const char *file);
+
 LIEF_API void macho_binaries_destroy(Macho_Binary_t** binaries);
 
+/* On-demand accessors
+ * ===================
+ * These functions work on binaries created by ::macho_parse and ::macho_parse_lazy.
+ *
+ * The ``macho_binary_get_xxx()`` functions fill the structure provided by the
+ * caller and return 1 on success or 0 if the index is out of range. The
+ * strings (and content pointers) are borrowed from the underlying binary:
+ * they remain valid until the binary is modified or destroyed.
+ */
+
+/** @brief Number of load commands */
+LIEF_API size_t macho_binary_nb_commands(const Macho_Binary_t* binary);
+
+/** @brief Fill ``command`` with the load command at the given index */
+LIEF_API int macho_binary_get_command(const Macho_Binary_t* binary, size_t idx,
+                                      Macho_Command_t* command);
+
+/** @brief Number of symbols */
+LIEF_API size_t macho_binary_nb_symbols(const Macho_Binary_t* binary);
+
+/** @brief Fill ``symbol`` with the symbol at the given index */
+LIEF_API int macho_binary_get_symbol(const Macho_Binary_t* binary, size_t idx,
+                                     Macho_Symbol_t* symbol);
+
+/** @brief Name of the symbol at the given index (NULL if out of range) */
+LIEF_API const char* macho_binary_get_symbol_name(const Macho_Binary_t* binary, size_t idx);
+
+/** @brief Number of sections */
+LIEF_API size_t macho_binary_nb_sections(const Macho_Binary_t* binary);
+
+/** @brief Fill ``section`` with the section at the given index
+ *
+ * The ``entropy`` field is not computed (it is set to 0):
+ * use ::macho_binary_get_section_entropy
+ */
+LIEF_API int macho_binary_get_section(const Macho_Binary_t* binary, size_t idx,
+                                      Macho_Section_t* section);
+
+/** @brief Name of the section at the given index (NULL if out of range) */
+LIEF_API const char* macho_binary_get_section_name(const Macho_Binary_t* binary, size_t idx);
+
+/** @brief Compute the entropy of the section at the given index and store it
+ * in ``entropy``. It returns 0 if the index is out of range.
+ */
+LIEF_API int macho_binary_get_section_entropy(const Macho_Binary_t* binary, size_t idx,
+                                              double* entropy);
+
+/** @brief Number of segments */
+LIEF_API size_t macho_binary_nb_segments(const Macho_Binary_t* binary);
+
+/** @brief Fill ``segment`` with the segment at the given index */
+LIEF_API int macho_binary_get_segment(const Macho_Binary_t* binary, size_t idx,
+                                      Macho_Segment_t* segment);
+
 #ifdef __cplusplus
 }
 #endif
@@ -58,8 +58,76 @@ typedef struct Pe_Binary_t Pe_Binary_t;
 /** Wrapper on LIEF::PE::Parser::parse */
 LIEF_API Pe_Binary_t* pe_parse(const char *file);
 
+/** @brief Same as ::pe_parse but only the headers are set in the
+ * returned Pe_Binary_t.
+ *
+ * The ``data_directories``, ``sections`` and ``imports`` arrays are **NULL**
+ * and the elements must be accessed with the ``pe_binary_nb_xxx()`` /
+ * ``pe_binary_get_xxx()`` functions which read the underlying LIEF::PE::Binary
+ * on demand.
+ */
+LIEF_API Pe_Binary_t* pe_parse_lazy(const char *file);
+
 LIEF_API void pe_binary_destroy(Pe_Binary_t* binary);
 
+/* On-demand accessors
+ * ===================
+ * These functions work on binaries created by ::pe_parse and ::pe_parse_lazy.
+ *
+ * The ``pe_binary_get_xxx()`` functions fill the structure provided by the
+ * caller and return 1 on success or 0 if the index is out of range. The
+ * strings and the section's content are borrowed from the underlying binary:
+ * they remain valid until the binary is modified or destroyed.
+ */
+
+/** @brief Number of data directories */
+LIEF_API size_t pe_binary_nb_data_directories(const Pe_Binary_t* binary);
+
+/** @brief Fill ``dir`` with the data directory at the given index */
+LIEF_API int pe_binary_get_data_directory(const Pe_Binary_t* binary, size_t idx,
+                                          Pe_DataDirectory_t* dir);
+
+/** @brief Number of sections */
+LIEF_API size_t pe_binary_nb_sections(const Pe_Binary_t* binary);
+
+/** @brief Fill ``section`` with the section at the given index
+ *
+ * The ``entropy`` field is not computed (it is set to 0):
+ * use ::pe_binary_get_section_entropy
+ */
+LIEF_API int pe_binary_get_section(const Pe_Binary_t* binary, size_t idx,
+                                   Pe_Section_t* section);
+
+/** @brief Name of the section at the given index (NULL if out of range) */
+LIEF_API const char* pe_binary_get_section_name(const Pe_Binary_t* binary, size_t idx);
+
+/** @brief Compute the entropy of the section at the given index and store it
+ * in ``entropy``. It returns 0 if the index is out of range.
+ */
+LIEF_API int pe_binary_get_section_entropy(const Pe_Binary_t* binary, size_t idx,
+                                           double* entropy);
+
+/** @brief Number of imported libraries */
+LIEF_API size_t pe_binary_nb_imports(const Pe_Binary_t* binary);
+
+/** @brief Fill ``import`` with the import at the given index.
+ *
+ * ``import->entries`` is set to NULL: use ::pe_binary_get_import_entry
+ */
+LIEF_API int pe_binary_get_import(const Pe_Binary_t* binary, size_t idx,
+                                  Pe_Import_t* import);
+
+/** @brief Name of the library imported at the given index (NULL if out of range) */
+LIEF_API const char* pe_binary_get_import_name(const Pe_Binary_t* binary, size_t idx);
+
+/** @brief Number of entries of the import at the given index */
+LIEF_API size_t pe_binary_nb_import_entries(const Pe_Binary_t* binary, size_t import_idx);
+
+/** @brief Fill ``entry`` with the ``entry_idx``-th entry of the ``import_idx``-th import */
+LIEF_API int pe_binary_get_import_entry(const Pe_Binary_t* binary,
+                                        size_t import_idx, size_t entry_idx,
+                                        Pe_ImportEntry_t* entry);
+
 #ifdef __cplusplus
 }
 #endif
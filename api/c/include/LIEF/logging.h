@@ -38,6 +38,9 @@ LIEF_API void lief_logging_enable(void);
 /** @brief Update logging level */
 LIEF_API void lief_logging_set_level(uint32_t level);
 
+/** @brief Update the logging level of the given module (see: LIEF::logging::MODULE) */
+LIEF_API void lief_logging_set_module_level(uint32_t module, uint32_t level);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,3 +29,7 @@ void lief_logging_enable(void) {
 void lief_logging_set_level(uint32_t level) {
   set_level(static_cast<LOGGING_LEVEL>(level));
 }
+
+void lief_logging_set_module_level(uint32_t module, uint32_t level) {
+  set_level(static_cast<MODULE>(module), static_cast<LOGGING_LEVEL>(level));
+}
@@ -1,4 +1,4 @@
-from typing import Any, ClassVar, Iterable, Iterator, Optional, Union
+from typing import Any, Callable, ClassVar, Iterable, Iterator, Optional, Union
 
 from typing import overload
 import io
@@ -9,6 +9,7 @@ import lief.ELF.Builder # type: ignore
 import lief.ELF.CoreAuxv # type: ignore
 import lief.ELF.CoreFile # type: ignore
 import lief.ELF.CorePrStatus # type: ignore
+import lief.ELF.Loader # type: ignore
 import lief.ELF.Section # type: ignore
 import lief.ELF.Segment # type: ignore
 import lief.ELF.SymbolVersionDefinition # type: ignore
@@ -247,6 +248,10 @@ class Binary(lief.Binary):
         __name__: Any
         def __init__(self, *args, **kwargs) -> None: ...
 
+    class Snapshot:
+        def __init__(self, *args, **kwargs) -> None: ...
+        def restore(self) -> lief.ELF.Binary: ...
+
     class it_dyn_static_symbols:
         def __init__(self, *args, **kwargs) -> None: ...
         def __getitem__(self, arg: int, /) -> lief.ELF.Symbol: ...
@@ -356,6 +361,7 @@ class Binary(lief.Binary):
     def extend(self, segment: lief.ELF.Segment, size: int) -> lief.ELF.Segment: ...
     @overload
     def extend(self, segment: lief.ELF.Section, size: int) -> lief.ELF.Section: ...
+    def function_at(self, address: int) -> Optional[lief.Function]: ...
     @overload
     def get(self, tag: lief.ELF.DYNAMIC_TAGS) -> lief.ELF.DynamicEntry: ...
     @overload
@@ -412,10 +418,12 @@ class Binary(lief.Binary):
     def remove_library(self, library_name: str) -> None: ...
     def remove_static_symbol(self, arg: lief.ELF.Symbol, /) -> None: ...
     def replace(self, new_segment: lief.ELF.Segment, original_segment: lief.ELF.Segment, base: int = ...) -> lief.ELF.Segment: ...
+    def save_snapshot(self, path: str) -> Union[lief.ok_t,lief.lief_errors]: ...
     def section_from_offset(self, offset: int, skip_nobits: bool = ...) -> lief.ELF.Section: ...
     def section_from_virtual_address(self, address: int, skip_nobits: bool = ...) -> lief.ELF.Section: ...
     def segment_from_offset(self, offset: int) -> lief.ELF.Segment: ...
     def segment_from_virtual_address(self, address: int) -> lief.ELF.Segment: ...
+    def snapshot(self) -> lief.ELF.Binary.Snapshot: ...
     def strip(self) -> None: ...
     def virtual_address_to_offset(self, virtual_address: int) -> Union[int,lief.lief_errors]: ...
     @overload
@@ -527,6 +535,7 @@ class Binary(lief.Binary):
 
 class Builder:
     class config_t:
+        android_rela: bool
         dt_hash: bool
         dyn_str: bool
         dynamic_section: bool
@@ -538,6 +547,7 @@ class Builder:
         notes: bool
         preinit_array: bool
         rela: bool
+        relr: bool
         static_symtab: bool
         sym_verdef: bool
         sym_verneed: bool
@@ -1248,6 +1258,47 @@ class LOONGARCH_EFLAGS:
     @property
     def value(self) -> int: ...
 
+class Loader:
+    class Image:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def base(self) -> int: ...
+        @property
+        def content(self) -> memoryview: ...
+        @property
+        def unresolved(self) -> list[lief.ELF.Loader.unresolved_t]: ...
+
+    class REASON:
+        OUT_OF_BOUNDS: ClassVar[Loader.REASON] = ...
+        SYMBOL_NOT_FOUND: ClassVar[Loader.REASON] = ...
+        UNKNOWN: ClassVar[Loader.REASON] = ...
+        UNSUPPORTED: ClassVar[Loader.REASON] = ...
+        __name__: Any
+        def __init__(self, *args, **kwargs) -> None: ...
+        @staticmethod
+        def from_value(arg: int, /) -> lief.ELF.Loader.REASON: ...
+        @property
+        def value(self) -> int: ...
+
+    class unresolved_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def address(self) -> int: ...
+        @property
+        def reason(self) -> lief.ELF.Loader.REASON: ...
+        @property
+        def symbol(self) -> str: ...
+        @property
+        def type(self) -> int: ...
+    page_size: int
+    def __init__(self, elf: lief.ELF.Binary) -> None: ...
+    def map(self, base: int) -> Union[lief.ELF.Loader.Image, lief.lief_errors]: ...
+    def resolver(self, fnc: Callable) -> lief.ELF.Loader: ...
+    @property
+    def image_size(self) -> int: ...
+    @property
+    def image_start(self) -> int: ...
+
 class MIPS_EFLAGS:
     ABI2: ClassVar[MIPS_EFLAGS] = ...
     ABI_EABI32: ClassVar[MIPS_EFLAGS] = ...
@@ -2225,6 +2276,18 @@ class RELOCATION_i386:
     def value(self) -> int: ...
 
 class Relocation(lief.Relocation):
+    class ENCODING:
+        ANDROID_SLEB: ClassVar[Relocation.ENCODING] = ...
+        REL: ClassVar[Relocation.ENCODING] = ...
+        RELA: ClassVar[Relocation.ENCODING] = ...
+        RELR: ClassVar[Relocation.ENCODING] = ...
+        UNKNOWN: ClassVar[Relocation.ENCODING] = ...
+        __name__: Any
+        def __init__(self, *args, **kwargs) -> None: ...
+        @staticmethod
+        def from_value(arg: int, /) -> lief.ELF.Relocation.ENCODING: ...
+        @property
+        def value(self) -> int: ...
     addend: int
     info: int
     purpose: lief.ELF.RELOCATION_PURPOSES
@@ -2237,10 +2300,14 @@ class Relocation(lief.Relocation):
     @overload
     def __init__(self, address: int, type: int = ..., addend: int = ..., is_rela: bool = ...) -> None: ...
     @property
+    def encoding(self) -> lief.ELF.Relocation.ENCODING: ...
+    @property
     def has_section(self) -> bool: ...
     @property
     def has_symbol(self) -> bool: ...
     @property
+    def is_packed(self) -> bool: ...
+    @property
     def is_rel(self) -> bool: ...
     @property
     def is_rela(self) -> bool: ...
@@ -2435,6 +2502,17 @@ class SYMBOL_VISIBILITY:
     def value(self) -> int: ...
 
 class Section(lief.Section):
+    class COMPRESSION:
+        NONE: ClassVar[Section.COMPRESSION] = ...
+        ZLIB: ClassVar[Section.COMPRESSION] = ...
+        ZSTD: ClassVar[Section.COMPRESSION] = ...
+        __name__: Any
+        def __init__(self, *args, **kwargs) -> None: ...
+        @staticmethod
+        def from_value(arg: int, /) -> lief.ELF.Section.COMPRESSION: ...
+        @property
+        def value(self) -> int: ...
+
     class it_segments:
         def __init__(self, *args, **kwargs) -> None: ...
         def __getitem__(self, arg: int, /) -> lief.ELF.Segment: ...
@@ -2448,6 +2526,7 @@ class Section(lief.Section):
     information: int
     link: int
     type: lief.ELF.SECTION_TYPES
+    uncompressed_content: memoryview
     @overload
     def __init__(self) -> None: ...
     @overload
@@ -2467,13 +2546,19 @@ class Section(lief.Section):
     def __iadd__(self, arg: lief.ELF.SECTION_FLAGS, /) -> lief.ELF.Section: ...
     def __isub__(self, arg: lief.ELF.SECTION_FLAGS, /) -> lief.ELF.Section: ...
     @property
+    def compression(self) -> lief.ELF.Section.COMPRESSION: ...
+    @property
     def flags_list(self) -> set[lief.ELF.SECTION_FLAGS]: ...
     @property
+    def is_compressed(self) -> bool: ...
+    @property
     def is_frame(self) -> bool: ...
     @property
     def original_size(self) -> int: ...
     @property
     def segments(self) -> lief.ELF.Section.it_segments: ...
+    @property
+    def uncompressed_size(self) -> int: ...
 
 class Segment(lief.Object):
     class it_sections:
@@ -2617,3 +2702,4 @@ def parse(filename: str, config: lief.ELF.ParserConfig = ...) -> Optional[lief.E
 def parse(raw: list[int], config: lief.ELF.ParserConfig = ...) -> Optional[lief.ELF.Binary]: ...
 @overload
 def parse(obj: Union[io.IOBase|os.PathLike], config: lief.ELF.ParserConfig = ...) -> Optional[lief.ELF.Binary]: ...
+def parse_snapshot(snapshot: str, source: str) -> Optional[lief.ELF.Binary]: ...
@@ -1,4 +1,4 @@
-from typing import Any, ClassVar, Optional, Union
+from typing import Any, ClassVar, Iterator, Optional, Union
 
 from typing import overload
 import io
@@ -11,6 +11,7 @@ import lief.MachO.Builder # type: ignore
 import lief.MachO.DataCodeEntry # type: ignore
 import lief.MachO.DyldChainedFixups # type: ignore
 import lief.MachO.DyldInfo # type: ignore
+import lief.MachO.ExportsTrieView # type: ignore
 import lief.MachO.FatBinary # type: ignore
 import lief.MachO.SegmentCommand # type: ignore
 import lief.MachO.Symbol # type: ignore
@@ -191,6 +192,7 @@ class Binary(lief.Binary):
     def can_remove_symbol(self, symbol_name: str) -> bool: ...
     def extend(self, load_command: lief.MachO.LoadCommand, size: int) -> bool: ...
     def extend_segment(self, segment_command: lief.MachO.SegmentCommand, size: int) -> bool: ...
+    def find_export(self, name: str) -> Union[lief.MachO.ExportsTrieView.export_t,lief.lief_errors]: ...
     def get(self, type: lief.MachO.LOAD_COMMAND_TYPES) -> lief.MachO.LoadCommand: ...
     @overload
     def get_section(self, name: str) -> lief.MachO.Section: ...
@@ -216,6 +218,7 @@ class Binary(lief.Binary):
     def remove_section(self, segname: str, secname: str, clear: bool = ...) -> None: ...
     def remove_signature(self) -> bool: ...
     def remove_symbol(self, name: str) -> bool: ...
+    def save_snapshot(self, path: str) -> Union[lief.ok_t,lief.lief_errors]: ...
     def section_from_offset(self, arg: int, /) -> lief.MachO.Section: ...
     def section_from_virtual_address(self, arg: int, /) -> lief.MachO.Section: ...
     def segment_from_offset(self, arg: int, /) -> lief.MachO.SegmentCommand: ...
@@ -257,6 +260,8 @@ class Binary(lief.Binary):
     @property
     def exported_symbols(self) -> lief.MachO.Binary.it_filter_symbols: ...
     @property
+    def exports_view(self) -> lief.MachO.ExportsTrieView: ...
+    @property
     def fat_offset(self) -> int: ...
     @property
     def fileset_name(self) -> str: ...
@@ -426,6 +431,7 @@ class BuildVersion(LoadCommand):
 
 class Builder:
     class config_t:
+        code_signature_hashes: bool
         linkedit: bool
         def __init__(self) -> None: ...
     def __init__(self, *args, **kwargs) -> None: ...
@@ -470,10 +476,91 @@ class ChainedBindingInfo(BindingInfo):
     @property
     def sign_extended_addend(self) -> int: ...
 
+class CodeDirectory:
+    class HASH_TYPES:
+        NONE: ClassVar[CodeDirectory.HASH_TYPES] = ...
+        SHA1: ClassVar[CodeDirectory.HASH_TYPES] = ...
+        SHA256: ClassVar[CodeDirectory.HASH_TYPES] = ...
+        SHA256_TRUNCATED: ClassVar[CodeDirectory.HASH_TYPES] = ...
+        SHA384: ClassVar[CodeDirectory.HASH_TYPES] = ...
+        __name__: Any
+        def __init__(self, *args, **kwargs) -> None: ...
+        @staticmethod
+        def from_value(arg: int, /) -> lief.MachO.CodeDirectory.HASH_TYPES: ...
+        @property
+        def value(self) -> int: ...
+
+    class SPECIAL_SLOTS:
+        APPLICATION: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        DER_ENTITLEMENTS: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        ENTITLEMENTS: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        INFO: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        REP_SPECIFIC: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        REQUIREMENTS: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        RESOURCEDIR: ClassVar[CodeDirectory.SPECIAL_SLOTS] = ...
+        __name__: Any
+        def __init__(self, *args, **kwargs) -> None: ...
+        @staticmethod
+        def from_value(arg: int, /) -> lief.MachO.CodeDirectory.SPECIAL_SLOTS: ...
+        @property
+        def value(self) -> int: ...
+    def __init__(self, *args, **kwargs) -> None: ...
+    def code_hash(self, page: int) -> memoryview: ...
+    def hash(self, data: list[int]) -> bytes: ...
+    def special_hash(self, slot: lief.MachO.CodeDirectory.SPECIAL_SLOTS) -> memoryview: ...
+    @overload
+    def verify(self, file: str) -> Union[list[int],lief.lief_errors]: ...
+    @overload
+    def verify(self, raw: list[int]) -> Union[list[int],lief.lief_errors]: ...
+    @property
+    def code_limit(self) -> int: ...
+    @property
+    def exec_seg_base(self) -> int: ...
+    @property
+    def exec_seg_flags(self) -> int: ...
+    @property
+    def exec_seg_limit(self) -> int: ...
+    @property
+    def flags(self) -> int: ...
+    @property
+    def hash_size(self) -> int: ...
+    @property
+    def hash_type(self) -> lief.MachO.CodeDirectory.HASH_TYPES: ...
+    @property
+    def identifier(self) -> str: ...
+    @property
+    def nb_code_slots(self) -> int: ...
+    @property
+    def nb_special_slots(self) -> int: ...
+    @property
+    def offset(self) -> int: ...
+    @property
+    def page_size(self) -> int: ...
+    @property
+    def platform(self) -> int: ...
+    @property
+    def slot_type(self) -> int: ...
+    @property
+    def team_id(self) -> str: ...
+    @property
+    def version(self) -> int: ...
+
 class CodeSignature(LoadCommand):
+    class it_code_directories:
+        def __init__(self, *args, **kwargs) -> None: ...
+        def __getitem__(self, arg: int, /) -> lief.MachO.CodeDirectory: ...
+        def __iter__(self) -> lief.MachO.CodeSignature.it_code_directories: ...
+        def __len__(self) -> int: ...
+        def __next__(self) -> lief.MachO.CodeDirectory: ...
     data_offset: int
     data_size: int
     def __init__(self, *args, **kwargs) -> None: ...
+    @overload
+    def update_code_hashes(self, file: str) -> Union[lief.ok_t,lief.lief_errors]: ...
+    @overload
+    def update_code_hashes(self, raw: list[int]) -> Union[lief.ok_t,lief.lief_errors]: ...
+    @property
+    def code_directories(self) -> lief.MachO.CodeSignature.it_code_directories: ...
     @property
     def content(self) -> memoryview: ...
 
@@ -573,6 +660,35 @@ class DyldChainedFixups(LoadCommand):
         @property
         def size(self) -> int: ...
 
+    class fixups_table_t:
+        class KIND:
+            AUTH_BIND: ClassVar[DyldChainedFixups.fixups_table_t.KIND] = ...
+            AUTH_REBASE: ClassVar[DyldChainedFixups.fixups_table_t.KIND] = ...
+            BIND: ClassVar[DyldChainedFixups.fixups_table_t.KIND] = ...
+            REBASE: ClassVar[DyldChainedFixups.fixups_table_t.KIND] = ...
+            __name__: Any
+            def __init__(self, *args, **kwargs) -> None: ...
+            @staticmethod
+            def from_value(arg: int, /) -> lief.MachO.DyldChainedFixups.fixups_table_t.KIND: ...
+            @property
+            def value(self) -> int: ...
+        def __init__(self, *args, **kwargs) -> None: ...
+        def __len__(self) -> int: ...
+        @property
+        def addend(self) -> list[int]: ...
+        @property
+        def kind(self) -> list[lief.MachO.DyldChainedFixups.fixups_table_t.KIND]: ...
+        @property
+        def offset(self) -> list[int]: ...
+        @property
+        def ordinal(self) -> list[int]: ...
+        @property
+        def raw(self) -> list[int]: ...
+        @property
+        def segment(self) -> list[int]: ...
+        @property
+        def target(self) -> list[int]: ...
+
     class it_binding_info:
         def __init__(self, *args, **kwargs) -> None: ...
         def __getitem__(self, arg: int, /) -> lief.MachO.ChainedBindingInfo: ...
@@ -600,6 +716,8 @@ class DyldChainedFixups(LoadCommand):
     def bindings(self) -> lief.MachO.DyldChainedFixups.it_binding_info: ...
     @property
     def chained_starts_in_segments(self) -> lief.MachO.DyldChainedFixups.it_chained_starts_in_segments_t: ...
+    @property
+    def fixups(self) -> lief.MachO.DyldChainedFixups.fixups_table_t: ...
 
 class DyldEnvironment(LoadCommand):
     value: str
@@ -615,11 +733,14 @@ class DyldExportsTrie(LoadCommand):
     data_offset: int
     data_size: int
     def __init__(self, *args, **kwargs) -> None: ...
+    def find_export(self, name: str) -> Union[lief.MachO.ExportsTrieView.export_t,lief.lief_errors]: ...
     def show_export_trie(self) -> str: ...
     @property
     def content(self) -> memoryview: ...
     @property
     def exports(self) -> lief.MachO.DyldInfo.it_export_info: ...
+    @property
+    def exports_view(self) -> lief.MachO.ExportsTrieView: ...
 
 class DyldInfo(LoadCommand):
     class it_binding_info:
@@ -646,6 +767,7 @@ class DyldInfo(LoadCommand):
     weak_bind: tuple[int,int]
     weak_bind_opcodes: memoryview
     def __init__(self, *args, **kwargs) -> None: ...
+    def find_export(self, name: str) -> Union[lief.MachO.ExportsTrieView.export_t,lief.lief_errors]: ...
     def set_bind_offset(self, offset: int) -> None: ...
     def set_bind_size(self, size: int) -> None: ...
     def set_export_offset(self, offset: int) -> None: ...
@@ -661,6 +783,8 @@ class DyldInfo(LoadCommand):
     @property
     def exports(self) -> lief.MachO.DyldInfo.it_export_info: ...
     @property
+    def exports_view(self) -> lief.MachO.ExportsTrieView: ...
+    @property
     def show_bind_opcodes(self) -> str: ...
     @property
     def show_export_trie(self) -> str: ...
@@ -763,6 +887,34 @@ class ExportInfo(lief.Object):
     @property
     def symbol(self) -> lief.MachO.Symbol: ...
 
+class ExportsTrieView:
+    class entry_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def info(self) -> lief.MachO.ExportsTrieView.export_t: ...
+        @property
+        def name(self) -> str: ...
+
+    class export_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        def has(self, flag: lief.MachO.EXPORT_SYMBOL_FLAGS) -> bool: ...
+        @property
+        def address(self) -> int: ...
+        @property
+        def flags(self) -> int: ...
+        @property
+        def imported_name(self) -> str: ...
+        @property
+        def kind(self) -> lief.MachO.EXPORT_SYMBOL_KINDS: ...
+        @property
+        def node_offset(self) -> int: ...
+        @property
+        def other(self) -> int: ...
+    def __init__(self, *args, **kwargs) -> None: ...
+    def find(self, name: str) -> Union[lief.MachO.ExportsTrieView.export_t,lief.lief_errors]: ...
+    def __contains__(self, arg: str, /) -> bool: ...
+    def __iter__(self) -> Iterator[lief.MachO.ExportsTrieView.entry_t]: ...
+
 class FILE_TYPES:
     BUNDLE: ClassVar[FILE_TYPES] = ...
     CORE: ClassVar[FILE_TYPES] = ...
@@ -1369,3 +1521,4 @@ def parse(raw: list[int], config: lief.MachO.ParserConfig = ...) -> Optional[lie
 @overload
 def parse(obj: Union[io.IOBase|os.PathLike], config: lief.MachO.ParserConfig = ...) -> Optional[lief.MachO.FatBinary]: ...
 def parse_from_memory(address: int, config: lief.MachO.ParserConfig = ...) -> Optional[lief.MachO.FatBinary]: ...
+def parse_snapshot(snapshot: str, source: str) -> Optional[lief.MachO.Binary]: ...
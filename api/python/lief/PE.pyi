@@ -271,6 +271,10 @@ class Attribute(lief.Object):
     def type(self) -> lief.PE.SIG_ATTRIBUTE_TYPES: ...
 
 class Binary(lief.Binary):
+    class Snapshot:
+        def __init__(self, *args, **kwargs) -> None: ...
+        def restore(self) -> lief.PE.Binary: ...
+
     class it_const_signatures:
         def __init__(self, *args, **kwargs) -> None: ...
         def __getitem__(self, arg: int, /) -> lief.PE.Signature: ...
@@ -348,8 +352,10 @@ class Binary(lief.Binary):
     def remove_all_relocations(self) -> None: ...
     def remove_library(self, import_name: str) -> None: ...
     def rva_to_offset(self, rva_address: int) -> int: ...
+    def save_snapshot(self, path: str) -> Union[lief.ok_t,lief.lief_errors]: ...
     def section_from_offset(self, offset: int) -> lief.PE.Section: ...
     def section_from_rva(self, rva: int) -> lief.PE.Section: ...
+    def snapshot(self) -> lief.PE.Binary.Snapshot: ...
     def va_to_offset(self, va_address: int) -> int: ...
     @overload
     def verify_signature(self, checks: lief.PE.Signature.VERIFICATION_CHECKS = ...) -> lief.PE.Signature.VERIFICATION_FLAGS: ...
@@ -839,6 +845,8 @@ class Export(lief.Object):
     timestamp: int
     def __init__(self) -> None: ...
     def copy(self) -> lief.PE.Export: ...
+    def find_entry(self, name: str) -> Optional[lief.PE.ExportEntry]: ...
+    def find_entry_at_ordinal(self, ordinal: int) -> Optional[lief.PE.ExportEntry]: ...
     @property
     def entries(self) -> lief.PE.Export.it_entries: ...
 
@@ -2562,6 +2570,27 @@ class TLS(lief.Object):
     @property
     def section(self) -> lief.PE.Section: ...
 
+class TrustStore:
+    @overload
+    def __init__(self) -> None: ...
+    @overload
+    def __init__(self, roots: list[lief.PE.x509]) -> None: ...
+    def add(self, cert: lief.PE.x509) -> None: ...
+    def clear_cache(self) -> None: ...
+    @overload
+    def verify(self, cert: lief.PE.x509, intermediates: list[lief.PE.x509] = ...) -> lief.PE.x509.VERIFICATION_FLAGS: ...
+    @overload
+    def verify(self, signature: lief.PE.Signature) -> lief.PE.x509.VERIFICATION_FLAGS: ...
+    def __len__(self) -> int: ...
+    @property
+    def cache_size(self) -> int: ...
+    @property
+    def max_cache_size(self) -> int: ...
+    @max_cache_size.setter
+    def max_cache_size(self, arg: int, /) -> None: ...
+    @property
+    def roots(self) -> list[lief.PE.x509]: ...
+
 class WINDOW_STYLES:
     BORDER: ClassVar[WINDOW_STYLES] = ...
     CAPTION: ClassVar[WINDOW_STYLES] = ...
@@ -2611,6 +2640,15 @@ class WIN_VERSION:
     @property
     def value(self) -> int: ...
 
+class export_lookup_t:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def address(self) -> int: ...
+    @property
+    def is_extern(self) -> bool: ...
+    @property
+    def ordinal(self) -> int: ...
+
 class x509(lief.Object):
     class KEY_TYPES:
         ECDSA: ClassVar[x509.KEY_TYPES] = ...
@@ -2726,6 +2764,14 @@ class x509(lief.Object):
     @property
     def version(self) -> int: ...
 
+@overload
+def find_export(file: str, name: str) -> Union[lief.PE.export_lookup_t,lief.lief_errors]: ...
+@overload
+def find_export(raw: list[int], name: str) -> Union[lief.PE.export_lookup_t,lief.lief_errors]: ...
+@overload
+def find_export(file: str, ordinal: int) -> Union[lief.PE.export_lookup_t,lief.lief_errors]: ...
+@overload
+def find_export(raw: list[int], ordinal: int) -> Union[lief.PE.export_lookup_t,lief.lief_errors]: ...
 def get_imphash(binary: lief.PE.Binary, mode: lief.PE.IMPHASH_MODE = ...) -> str: ...
 @overload
 def get_type(file: str) -> Union[lief.PE.PE_TYPE,lief.lief_errors]: ...
@@ -2738,4 +2784,5 @@ def parse(filename: str, config: lief.PE.ParserConfig = ...) -> Optional[lief.PE
 def parse(raw: list[int], config: lief.PE.ParserConfig = ...) -> Optional[lief.PE.Binary]: ...
 @overload
 def parse(obj: Union[io.IOBase|os.PathLike], config: lief.PE.ParserConfig = ...) -> Optional[lief.PE.Binary]: ...
+def parse_snapshot(snapshot: str, source: str) -> Optional[lief.PE.Binary]: ...
 def resolve_ordinals(imp: lief.PE.Import, strict: bool = ..., use_std: bool = ...) -> Union[lief.PE.Import,lief.lief_errors]: ...
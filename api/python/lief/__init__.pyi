@@ -8,6 +8,7 @@ import lief.ELF # type: ignore
 import lief.Function # type: ignore
 import lief.MachO # type: ignore
 import lief.PE # type: ignore
+import numpy # type: ignore
 import os
 
 class ARCHITECTURES:
@@ -69,7 +70,11 @@ class Binary(Object):
     @overload
     def patch_address(self, address: int, patch_value: int, size: int = ..., va_type: lief.Binary.VA_TYPES = ...) -> None: ...
     def remove_section(self, name: str, clear: bool = ...) -> None: ...
+    def search_all_parallel(self, pattern: str) -> list[int]: ...
+    def sections_entropy_parallel(self) -> list[float]: ...
+    def sections_hash_parallel(self) -> list[int]: ...
     def xref(self, virtual_address: int) -> list[int]: ...
+    def xref_parallel(self, virtual_address: int) -> list[int]: ...
     @property
     def abstract(self) -> lief.Binary: ...
     @property
@@ -124,6 +129,104 @@ class EXE_FORMATS:
     @property
     def value(self) -> int: ...
 
+class ExportIndex:
+    class import_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def library(self) -> str: ...
+        @property
+        def name(self) -> str: ...
+        @property
+        def providers(self) -> list[lief.ExportIndex.provider_t]: ...
+
+    class provider_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def address(self) -> int: ...
+        @property
+        def forward_library(self) -> str: ...
+        @property
+        def forward_name(self) -> str: ...
+        @property
+        def is_forwarded(self) -> bool: ...
+        @property
+        def library(self) -> str: ...
+        @property
+        def ordinal(self) -> int: ...
+        @property
+        def version(self) -> str: ...
+    def __init__(self) -> None: ...
+    @overload
+    def add(self, binary: lief.Binary, library: str = ...) -> bool: ...
+    @overload
+    def add(self, files: list[str]) -> int: ...
+    @overload
+    def find(self, name: str) -> list[lief.ExportIndex.provider_t]: ...
+    @overload
+    def find(self, library: str, ordinal: int) -> list[lief.ExportIndex.provider_t]: ...
+    @staticmethod
+    def load(path: str) -> Optional[lief.ExportIndex]: ...
+    def resolve(self, binary: lief.Binary) -> list[lief.ExportIndex.import_t]: ...
+    def save(self, path: str) -> Union[lief.ok_t,lief.lief_errors]: ...
+    def __len__(self) -> int: ...
+    @property
+    def libraries(self) -> list[str]: ...
+
+class Fingerprint:
+    class config_t:
+        authentihash: bool
+        entropy: bool
+        imphash: bool
+        md5: bool
+        sections: bool
+        segments: bool
+        sha1: bool
+        sha256: bool
+        def __init__(self) -> None: ...
+
+    class digests_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def md5(self) -> bytes: ...
+        @property
+        def sha1(self) -> bytes: ...
+        @property
+        def sha256(self) -> bytes: ...
+
+    class range_t:
+        def __init__(self, *args, **kwargs) -> None: ...
+        @property
+        def digests(self) -> lief.Fingerprint.digests_t: ...
+        @property
+        def entropy(self) -> float: ...
+        @property
+        def name(self) -> str: ...
+        @property
+        def offset(self) -> int: ...
+        @property
+        def size(self) -> int: ...
+    def __init__(self, *args, **kwargs) -> None: ...
+    @overload
+    @staticmethod
+    def compute(binary: lief.Binary, raw: bytes, config: lief.Fingerprint.config_t = ...) -> lief.Fingerprint: ...
+    @overload
+    @staticmethod
+    def compute(binary: lief.Binary, path: str, config: lief.Fingerprint.config_t = ...) -> Union[lief.Fingerprint,lief.lief_errors]: ...
+    @property
+    def authentihash(self) -> Optional[lief.Fingerprint.digests_t]: ...
+    @property
+    def entropy(self) -> float: ...
+    @property
+    def file(self) -> lief.Fingerprint.digests_t: ...
+    @property
+    def imphash(self) -> str: ...
+    @property
+    def sections(self) -> list[lief.Fingerprint.range_t]: ...
+    @property
+    def segments(self) -> list[lief.Fingerprint.range_t]: ...
+    @property
+    def size(self) -> int: ...
+
 class Function(Symbol):
     class FLAGS:
         CONSTRUCTOR: ClassVar[Function.FLAGS] = ...
@@ -211,11 +314,60 @@ class PLATFORMS:
     @property
     def value(self) -> int: ...
 
+class QuickSummary:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def architecture(self) -> lief.ARCHITECTURES: ...
+    @property
+    def build_id(self) -> bytes: ...
+    @property
+    def endianness(self) -> lief.ENDIANNESS: ...
+    @property
+    def entrypoint(self) -> int: ...
+    @property
+    def format(self) -> lief.EXE_FORMATS: ...
+    @property
+    def has_nx(self) -> bool: ...
+    @property
+    def imagebase(self) -> int: ...
+    @property
+    def imphash(self) -> str: ...
+    @property
+    def imported_libraries(self) -> list[str]: ...
+    @property
+    def is_64(self) -> bool: ...
+    @property
+    def is_pie(self) -> bool: ...
+    @property
+    def modes(self) -> set[lief.MODES]: ...
+    @property
+    def nb_sections(self) -> int: ...
+    @property
+    def nb_segments(self) -> int: ...
+    @property
+    def object_type(self) -> lief.OBJECT_TYPES: ...
+
 class Relocation(Object):
     address: int
     size: int
     def __init__(self, *args, **kwargs) -> None: ...
 
+class RelocationColumns:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @staticmethod
+    def extract(binary: lief.Binary) -> lief.RelocationColumns: ...
+    def __len__(self) -> int: ...
+    @property
+    def addends(self) -> numpy.ndarray: ...
+    @property
+    def addresses(self) -> numpy.ndarray: ...
+    @property
+    def sizes(self) -> numpy.ndarray: ...
+    @property
+    def symbols(self) -> lief.StringColumn: ...
+    @property
+    def types(self) -> numpy.ndarray: ...
+
 class Section(Object):
     content: memoryview
     name: Union[str,bytes]
@@ -238,12 +390,39 @@ class Section(Object):
     @property
     def fullname(self) -> bytes: ...
 
+class StringColumn:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __getitem__(self, arg: int, /) -> str: ...
+    def __len__(self) -> int: ...
+    @property
+    def data(self) -> numpy.ndarray: ...
+    @property
+    def offsets(self) -> numpy.ndarray: ...
+
 class Symbol(Object):
     name: Union[str,bytes]
     size: int
     value: int
     def __init__(self, *args, **kwargs) -> None: ...
 
+class SymbolColumns:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @staticmethod
+    def extract(binary: lief.Binary) -> lief.SymbolColumns: ...
+    def __len__(self) -> int: ...
+    @property
+    def bindings(self) -> numpy.ndarray: ...
+    @property
+    def names(self) -> lief.StringColumn: ...
+    @property
+    def section_indexes(self) -> numpy.ndarray: ...
+    @property
+    def sizes(self) -> numpy.ndarray: ...
+    @property
+    def types(self) -> numpy.ndarray: ...
+    @property
+    def values(self) -> numpy.ndarray: ...
+
 class lief_errors:
     asn1_bad_tag: ClassVar[lief_errors] = ...
     build_error: ClassVar[lief_errors] = ...
@@ -310,4 +489,11 @@ def parse(raw: bytes) -> Optional[lief.Binary]: ...
 def parse(filepath: str) -> Optional[lief.Binary]: ...
 @overload
 def parse(obj: Union[io.IOBase|os.PathLike]) -> Optional[lief.Binary]: ...
+@overload
+def quick_scan(raw: bytes) -> Union[lief.QuickSummary,lief.lief_errors]: ...
+@overload
+def quick_scan(path: object) -> Union[lief.QuickSummary,lief.lief_errors]: ...
+@overload
 def to_json(arg: lief.Object, /) -> str: ...
+@overload
+def to_json(obj: lief.Object, output: str, only: set[str] = ..., skip: set[str] = ...) -> bool: ...
@@ -1,4 +1,4 @@
-from typing import Any, ClassVar
+from typing import Any, ClassVar, overload
 
 import lief.logging # type: ignore
 
@@ -12,9 +12,26 @@ class LOGGING_LEVEL:
     __name__: Any
     def __init__(self, *args, **kwargs) -> None: ...
 
+class MODULE:
+    ART: ClassVar[MODULE] = ...
+    DEX: ClassVar[MODULE] = ...
+    ELF: ClassVar[MODULE] = ...
+    GENERIC: ClassVar[MODULE] = ...
+    MACHO: ClassVar[MODULE] = ...
+    MACHO_CHAINED_FIXUPS: ClassVar[MODULE] = ...
+    MACHO_DYLD_INFO: ClassVar[MODULE] = ...
+    OAT: ClassVar[MODULE] = ...
+    PE: ClassVar[MODULE] = ...
+    VDEX: ClassVar[MODULE] = ...
+    __name__: Any
+    def __init__(self, *args, **kwargs) -> None: ...
+
 def disable() -> None: ...
 def enable() -> None: ...
 def log(level: lief.logging.LOGGING_LEVEL, msg: str) -> None: ...
 def reset() -> None: ...
+@overload
 def set_level(level: lief.logging.LOGGING_LEVEL) -> None: ...
+@overload
+def set_level(module: lief.logging.MODULE, level: lief.logging.LOGGING_LEVEL) -> None: ...
 def set_path(path: str) -> None: ...
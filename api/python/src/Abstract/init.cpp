@@ -24,6 +24,10 @@
 #include "LIEF/Abstract/Parser.hpp"
 #include "LIEF/Abstract/Relocation.hpp"
 #include "LIEF/Abstract/Function.hpp"
+#include "LIEF/Abstract/ExportIndex.hpp"
+#include "LIEF/Abstract/Fingerprint.hpp"
+#include "LIEF/Abstract/QuickScan.hpp"
+#include "LIEF/Abstract/Columns.hpp"
 
 #define CREATE(X,Y) create<X>(Y)
 
@@ -37,6 +41,12 @@ void init_objects(nb::module_& m) {
   CREATE(Parser, m);
   CREATE(Relocation, m);
   CREATE(Function, m);
+  CREATE(ExportIndex, m);
+  CREATE(Fingerprint, m);
+  CREATE(QuickSummary, m);
+  CREATE(string_column_t, m);
+  CREATE(SymbolColumns, m);
+  CREATE(RelocationColumns, m);
 }
 void init_abstract(nb::module_& m) {
   init_enums(m);
@@ -218,6 +218,41 @@ void create<Binary>(nb::module_& m) {
         "Return all **virtual addresses** that *use* the ``address`` given in parameter"_doc,
         "virtual_address"_a)
 
+    .def("xref_parallel",
+        &Binary::xref_parallel,
+        R"delim(
+        Same as :meth:`~.xref` but the sections are scanned concurrently.
+        The addresses are returned in the same order as :meth:`~.xref`.
+        )delim"_doc,
+        "virtual_address"_a,
+        nb::call_guard<nb::gil_scoped_release>())
+
+    .def("search_all_parallel",
+        &Binary::search_all_parallel,
+        R"delim(
+        Return the **virtual addresses** of all the occurrences of ``pattern``
+        in the sections' content. The sections are scanned concurrently and the
+        addresses are ordered by section and then by offset.
+        )delim"_doc,
+        "pattern"_a,
+        nb::call_guard<nb::gil_scoped_release>())
+
+    .def("sections_entropy_parallel",
+        &Binary::sections_entropy_parallel,
+        R"delim(
+        Return the :attr:`lief.Section.entropy` of each section (in the order of
+        :attr:`~.sections`). The entropies are computed concurrently.
+        )delim"_doc,
+        nb::call_guard<nb::gil_scoped_release>())
+
+    .def("sections_hash_parallel",
+        &Binary::sections_hash_parallel,
+        R"delim(
+        Return the :func:`lief.hash` of each section (in the order of
+        :attr:`~.sections`). The hashes are computed concurrently.
+        )delim"_doc,
+        nb::call_guard<nb::gil_scoped_release>())
+
     .def("offset_to_virtual_address",
         [] (const Binary& self, uint64_t offset, uint64_t slide) {
           return error_or(&Binary::offset_to_virtual_address, self, offset, slide);
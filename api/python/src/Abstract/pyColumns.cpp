@@ -0,0 +1,157 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/string.h>
+
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Columns.hpp"
+
+namespace LIEF::py {
+
+template<class T>
+using array_t = nb::ndarray<nb::numpy, const T, nb::ndim<1>>;
+
+// Wrap the vector in a read-only numpy array without copying it. The
+// properties use rv_policy::reference_internal so that the columns object
+// outlives the array.
+template<class T>
+array_t<T> to_array(const std::vector<T>& vec) {
+  return array_t<T>(vec.data(), {vec.size()});
+}
+
+template<>
+void create<string_column_t>(nb::module_& m) {
+  nb::class_<string_column_t>(m, "StringColumn",
+      R"delim(
+      Column of strings stored in a single buffer.
+
+      The i-th string is ``data[offsets[i]:offsets[i + 1]]``. This is the layout
+      of the Apache Arrow ``large_utf8`` type so that the buffers can be wrapped
+      without copy:
+
+      .. code-block:: python
+
+        import pyarrow as pa
+        names = columns.names
+        array = pa.LargeStringArray.from_buffers(len(names),
+                                                 pa.py_buffer(names.offsets),
+                                                 pa.py_buffer(names.data))
+      )delim"_doc)
+    .def_prop_ro("offsets",
+        [] (const string_column_t& self) { return to_array(self.offsets); },
+        "Offsets (``numpy.uint64``) of the strings in :attr:`~.data`. "
+        "It contains ``len(self) + 1`` values"_doc,
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("data",
+        [] (const string_column_t& self) {
+          return array_t<uint8_t>(self.data.data(), {self.data.size()});
+        },
+        "Concatenation of the strings as a ``numpy.uint8`` array"_doc,
+        nb::rv_policy::reference_internal)
+    .def("__len__", &string_column_t::size)
+    .def("__getitem__",
+        [] (const string_column_t& self, size_t i) {
+          if (i >= self.size()) {
+            throw nb::index_error();
+          }
+          return self.get(i);
+        });
+}
+
+template<>
+void create<SymbolColumns>(nb::module_& m) {
+  nb::class_<SymbolColumns>(m, "SymbolColumns",
+      R"delim(
+      Symbols of a binary exported as numpy arrays (one array per attribute).
+
+      The arrays are filled in one call by :meth:`~.extract` and they are
+      exposed without copy nor per-symbol Python object.
+
+      The values of :attr:`~.types`, :attr:`~.bindings` and
+      :attr:`~.section_indexes` are the raw values of the format:
+
+      - ELF: :class:`lief.ELF.SYMBOL_TYPES`, :class:`lief.ELF.SYMBOL_BINDINGS`
+        and ``st_shndx``
+      - PE (COFF symbols): :attr:`lief.PE.Symbol.type`,
+        :class:`lief.PE.SYMBOL_STORAGE_CLASS` and ``SectionNumber``
+      - Mach-O: ``n_type``, ``n_desc`` and ``n_sect``
+
+      For ELF, the dynamic symbols come first followed by the static symbols
+      (as in :attr:`lief.ELF.Binary.symbols`).
+      )delim"_doc)
+    .def_static("extract", &SymbolColumns::extract,
+        "Export the symbols of the given binary"_doc,
+        "binary"_a)
+    .def_prop_ro("names",
+        [] (const SymbolColumns& self) -> const string_column_t& { return self.names; },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("values",
+        [] (const SymbolColumns& self) { return to_array(self.values); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("sizes",
+        [] (const SymbolColumns& self) { return to_array(self.sizes); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("types",
+        [] (const SymbolColumns& self) { return to_array(self.types); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("bindings",
+        [] (const SymbolColumns& self) { return to_array(self.bindings); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("section_indexes",
+        [] (const SymbolColumns& self) { return to_array(self.section_indexes); },
+        nb::rv_policy::reference_internal)
+    .def("__len__", &SymbolColumns::size);
+}
+
+template<>
+void create<RelocationColumns>(nb::module_& m) {
+  nb::class_<RelocationColumns>(m, "RelocationColumns",
+      R"delim(
+      Relocations of a binary exported as numpy arrays (one array per attribute).
+
+      - :attr:`~.types`: ELF relocation type, :class:`lief.PE.RELOCATIONS_BASE_TYPES`
+        or Mach-O relocation type
+      - :attr:`~.sizes`: size of the relocated value in **bits**
+      - :attr:`~.addends`: explicit addend (ELF only, 0 otherwise)
+      - :attr:`~.symbols`: name of the associated symbol or an empty string
+
+      The PE relocations are flattened: each :class:`lief.PE.RelocationEntry`
+      is a row.
+      )delim"_doc)
+    .def_static("extract", &RelocationColumns::extract,
+        "Export the relocations of the given binary"_doc,
+        "binary"_a)
+    .def_prop_ro("addresses",
+        [] (const RelocationColumns& self) { return to_array(self.addresses); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("types",
+        [] (const RelocationColumns& self) { return to_array(self.types); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("sizes",
+        [] (const RelocationColumns& self) { return to_array(self.sizes); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("addends",
+        [] (const RelocationColumns& self) { return to_array(self.addends); },
+        nb::rv_policy::reference_internal)
+    .def_prop_ro("symbols",
+        [] (const RelocationColumns& self) -> const string_column_t& { return self.symbols; },
+        nb::rv_policy::reference_internal)
+    .def("__len__", &RelocationColumns::size);
+}
+}
@@ -0,0 +1,124 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <nanobind/stl/unique_ptr.h>
+
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+#include "pyErr.hpp"
+
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/ExportIndex.hpp"
+
+namespace LIEF::py {
+
+template<>
+void create<ExportIndex>(nb::module_& m) {
+  nb::class_<ExportIndex> index(m, "ExportIndex",
+      R"delim(
+      Index of the symbols exported by a set of libraries (ELF, PE, Mach-O)
+      which can be used to resolve the imports of many binaries.
+
+      .. code-block:: python
+
+        index = lief.ExportIndex()
+        index.add(glob.glob("/usr/lib/x86_64-linux-gnu/*.so*"))
+        index.save("libs.idx")
+
+        index = lief.ExportIndex.load("libs.idx")
+        for imp in index.resolve(lief.parse("/bin/ls")):
+            print(imp.name, [p.library for p in imp.providers])
+      )delim"_doc);
+
+  nb::class_<ExportIndex::provider_t>(index, "provider_t",
+      "Library which exports a given symbol"_doc)
+    .def_ro("library", &ExportIndex::provider_t::library,
+            "Name of the library (``DT_SONAME``, DLL name, install name, ...)"_doc)
+    .def_ro("version", &ExportIndex::provider_t::version,
+            "Version of the symbol (ELF only)"_doc)
+    .def_ro("address", &ExportIndex::provider_t::address,
+            "Address of the exported symbol (RVA for PE)"_doc)
+    .def_ro("ordinal", &ExportIndex::provider_t::ordinal,
+            "Ordinal of the export (PE only)"_doc)
+    .def_ro("forward_library", &ExportIndex::provider_t::forward_library,
+            "Library targeted by a PE forwarded export or a Mach-O re-export"_doc)
+    .def_ro("forward_name", &ExportIndex::provider_t::forward_name,
+            "Symbol targeted by a PE forwarded export or a Mach-O re-export"_doc)
+    .def_prop_ro("is_forwarded", &ExportIndex::provider_t::is_forwarded);
+
+  nb::class_<ExportIndex::import_t>(index, "import_t",
+      "Import resolved by :meth:`~lief.ExportIndex.resolve`"_doc)
+    .def_ro("name", &ExportIndex::import_t::name,
+            "Name of the imported symbol"_doc)
+    .def_ro("library", &ExportIndex::import_t::library,
+            "Library from which the symbol is imported (empty for ELF)"_doc)
+    .def_ro("providers", &ExportIndex::import_t::providers,
+            "Libraries that provide the symbol (the forwarders are followed)"_doc);
+
+  index
+    .def(nb::init<>())
+
+    .def("add",
+        nb::overload_cast<const Binary&, const std::string&>(&ExportIndex::add),
+        R"delim(
+        Add the exports of the given binary. If ``library`` is empty, the name
+        of the library is determined from the binary (``DT_SONAME``, ...).
+
+        It returns False if the format is not supported or if the name of the
+        library can't be determined.
+        )delim"_doc,
+        "binary"_a, "library"_a = "")
+
+    .def("add",
+        nb::overload_cast<const std::vector<std::string>&>(&ExportIndex::add),
+        R"delim(
+        Parse the given files in parallel and add their exports.
+        It returns the number of files that have been added.
+        )delim"_doc,
+        "files"_a, nb::call_guard<nb::gil_scoped_release>())
+
+    .def("find",
+        nb::overload_cast<const std::string&>(&ExportIndex::find, nb::const_),
+        "Return the libraries that export the given symbol"_doc,
+        "name"_a)
+
+    .def("find",
+        nb::overload_cast<const std::string&, uint32_t>(&ExportIndex::find, nb::const_),
+        "Return the export associated with the given ordinal in the given library (PE only)"_doc,
+        "library"_a, "ordinal"_a)
+
+    .def("resolve", &ExportIndex::resolve,
+        "Resolve all the imports of the given binary against the index"_doc,
+        "binary"_a)
+
+    .def_prop_ro("libraries", &ExportIndex::libraries,
+        "Names of the libraries present in the index"_doc)
+
+    .def("save",
+        [] (const ExportIndex& self, const std::string& path) {
+          return error_or(&ExportIndex::save, self, path);
+        },
+        "Serialize the index in the given file"_doc,
+        "path"_a)
+
+    .def_static("load", &ExportIndex::load,
+        "Load an index previously serialized with :meth:`~lief.ExportIndex.save`"_doc,
+        "path"_a)
+
+    .def("__len__", &ExportIndex::size);
+}
+}
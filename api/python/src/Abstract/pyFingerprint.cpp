@@ -0,0 +1,138 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+#include "pyErr.hpp"
+
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Fingerprint.hpp"
+
+namespace LIEF::py {
+
+template<size_t N>
+nb::bytes to_bytes(const std::array<uint8_t, N>& digest) {
+  return nb::bytes(reinterpret_cast<const char*>(digest.data()), digest.size());
+}
+
+template<>
+void create<Fingerprint>(nb::module_& m) {
+  nb::class_<Fingerprint> fp(m, "Fingerprint",
+      R"delim(
+      Digests and entropy of a binary computed in a single pass over its raw
+      content.
+
+      The raw content is read once, block by block, and each block is fed to
+      the hash contexts of the file, of the sections (and segments) and of the
+      PE authentihash that cover it. The algorithms (MD5, SHA-1, SHA-256 and the
+      entropy) run in parallel.
+
+      The binary is only used for the layout: the digests are computed on the
+      raw bytes which must be the content the binary was parsed from.
+
+      .. code-block:: python
+
+        raw = pathlib.Path("notepad.exe").read_bytes()
+        fp = lief.Fingerprint.compute(lief.parse(raw), raw)
+        print(fp.file.sha256.hex(), fp.imphash)
+        for section in fp.sections:
+            print(section.name, section.digests.md5.hex(), section.entropy)
+      )delim"_doc);
+
+  nb::class_<Fingerprint::digests_t>(fp, "digests_t",
+      "Digests enabled in :class:`~lief.Fingerprint.config_t`"_doc)
+    .def_prop_ro("md5",
+        [] (const Fingerprint::digests_t& self) { return to_bytes(self.md5); })
+    .def_prop_ro("sha1",
+        [] (const Fingerprint::digests_t& self) { return to_bytes(self.sha1); })
+    .def_prop_ro("sha256",
+        [] (const Fingerprint::digests_t& self) { return to_bytes(self.sha256); });
+
+  nb::class_<Fingerprint::range_t>(fp, "range_t",
+      "Range of the file (section or segment)"_doc)
+    .def_ro("name", &Fingerprint::range_t::name)
+    .def_ro("offset", &Fingerprint::range_t::offset)
+    .def_ro("size", &Fingerprint::range_t::size)
+    .def_ro("digests", &Fingerprint::range_t::digests)
+    .def_ro("entropy", &Fingerprint::range_t::entropy,
+            "Shannon entropy of the range"_doc);
+
+  nb::class_<Fingerprint::config_t>(fp, "config_t",
+      "Select the values computed by :meth:`~lief.Fingerprint.compute`"_doc)
+    .def(nb::init<>())
+    .def_rw("md5", &Fingerprint::config_t::md5)
+    .def_rw("sha1", &Fingerprint::config_t::sha1)
+    .def_rw("sha256", &Fingerprint::config_t::sha256)
+    .def_rw("sections", &Fingerprint::config_t::sections,
+            "Compute the digests and the entropy of each section"_doc)
+    .def_rw("segments", &Fingerprint::config_t::segments,
+            "Compute the digests and the entropy of each segment (ELF, Mach-O)"_doc)
+    .def_rw("entropy", &Fingerprint::config_t::entropy,
+            "Compute the entropy of the file and of the sections/segments"_doc)
+    .def_rw("imphash", &Fingerprint::config_t::imphash,
+            "Compute the PE imphash"_doc)
+    .def_rw("authentihash", &Fingerprint::config_t::authentihash,
+            "Compute the PE authentihash with the selected algorithms"_doc);
+
+  fp
+    .def_static("compute",
+        [] (const Binary& binary, nb::bytes raw, const Fingerprint::config_t& config) {
+          span<const uint8_t> content(reinterpret_cast<const uint8_t*>(raw.c_str()), raw.size());
+          nb::gil_scoped_release release;
+          return Fingerprint::compute(binary, content, config);
+        },
+        "Compute the fingerprint of ``binary`` from its raw content"_doc,
+        "binary"_a, "raw"_a, "config"_a = Fingerprint::config_t())
+
+    .def_static("compute",
+        [] (const Binary& binary, const std::string& path, const Fingerprint::config_t& config) {
+          return error_or(
+              nb::overload_cast<const Binary&, const std::string&, const Fingerprint::config_t&>(&Fingerprint::compute),
+              binary, path, config);
+        },
+        R"delim(
+        Compute the fingerprint of ``binary`` which has been parsed from the file
+        located at ``path``
+        )delim"_doc,
+        "binary"_a, "path"_a, "config"_a = Fingerprint::config_t())
+
+    .def_prop_ro("file", &Fingerprint::file,
+        "Digests of the whole file"_doc)
+    .def_prop_ro("size", &Fingerprint::size,
+        "Size of the file"_doc)
+    .def_prop_ro("entropy", &Fingerprint::entropy,
+        "Shannon entropy of the whole file"_doc)
+    .def_prop_ro("sections", &Fingerprint::sections,
+        "Digests of the sections"_doc)
+    .def_prop_ro("segments", &Fingerprint::segments,
+        "Digests of the segments (ELF, Mach-O)"_doc)
+    .def_prop_ro("imphash", &Fingerprint::imphash,
+        "PE imphash or an empty string"_doc)
+    .def_prop_ro("authentihash",
+        [] (const Fingerprint& self) -> nb::object {
+          if (!self.has_authentihash()) {
+            return nb::none();
+          }
+          return nb::cast(self.authentihash());
+        },
+        R"delim(
+        PE authentihash computed on the raw bytes (i.e. the file without the
+        checksum, the certificate table entry and the certificate table) or None
+        )delim"_doc);
+}
+}
@@ -0,0 +1,94 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <nanobind/stl/set.h>
+
+#include "Abstract/init.hpp"
+#include "pyLIEF.hpp"
+#include "pyErr.hpp"
+#include "pyutils.hpp"
+
+#include "LIEF/Abstract/QuickScan.hpp"
+
+namespace LIEF::py {
+
+template<>
+void create<QuickSummary>(nb::module_& m) {
+  nb::class_<QuickSummary>(m, "QuickSummary",
+      R"delim(
+      Summary of a binary returned by :func:`lief.quick_scan`
+
+      The values are consistent with the ones of the :class:`lief.Binary`
+      returned by :func:`lief.parse` except for the number of sections and
+      segments which are read from the headers.
+      )delim"_doc)
+    .def_ro("format", &QuickSummary::format)
+    .def_ro("architecture", &QuickSummary::architecture)
+    .def_ro("modes", &QuickSummary::modes)
+    .def_ro("endianness", &QuickSummary::endianness)
+    .def_ro("object_type", &QuickSummary::object_type)
+    .def_ro("is_64", &QuickSummary::is_64)
+    .def_ro("entrypoint", &QuickSummary::entrypoint,
+            "Absolute address of the entrypoint"_doc)
+    .def_ro("imagebase", &QuickSummary::imagebase)
+    .def_ro("is_pie", &QuickSummary::is_pie)
+    .def_ro("has_nx", &QuickSummary::has_nx)
+    .def_ro("nb_sections", &QuickSummary::nb_sections,
+            "Number of sections as defined in the header(s)"_doc)
+    .def_ro("nb_segments", &QuickSummary::nb_segments,
+            "Number of segments (always 0 for PE)"_doc)
+    .def_ro("imported_libraries", &QuickSummary::imported_libraries)
+    .def_ro("imphash", &QuickSummary::imphash,
+            "PE imphash or an empty string"_doc)
+    .def_prop_ro("build_id",
+        [] (const QuickSummary& self) {
+          return nb::bytes(reinterpret_cast<const char*>(self.build_id.data()),
+                           self.build_id.size());
+        },
+        "ELF ``NT_GNU_BUILD_ID`` or Mach-O ``LC_UUID`` (empty if not present)"_doc);
+
+  m.def("quick_scan",
+      [] (nb::bytes raw) {
+        span<const uint8_t> content(reinterpret_cast<const uint8_t*>(raw.c_str()), raw.size());
+        return error_or(nb::overload_cast<span<const uint8_t>>(&quick_scan), content);
+      },
+      R"delim(
+      Summarize the binary from its raw content without parsing it.
+
+      Only the headers, the section/segment tables and the import (or dynamic)
+      tables are read. This is much faster than :func:`lief.parse` when only an
+      overview of the binary is needed.
+      )delim"_doc,
+      "raw"_a);
+
+  m.def("quick_scan",
+      [] (nb::object path) {
+        return error_or([] (nb::object path) -> result<QuickSummary> {
+          auto path_str = path_to_str(path);
+          if (!path_str) {
+            return make_error_code(path_str.error());
+          }
+          return quick_scan(*path_str);
+        }, path);
+      },
+      R"delim(
+      Summarize the binary located at the given path without parsing it.
+      For a Mach-O FAT binary, the last slice is summarized (as in :func:`lief.parse`)
+      )delim"_doc,
+      "path"_a);
+}
+}
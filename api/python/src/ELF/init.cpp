@@ -30,6 +30,7 @@
 #include "LIEF/ELF/DynamicSharedObject.hpp"
 #include "LIEF/ELF/GnuHash.hpp"
 #include "LIEF/ELF/Header.hpp"
+#include "LIEF/ELF/Loader.hpp"
 #include "LIEF/ELF/Note.hpp"
 #include "LIEF/ELF/NoteDetails.hpp"
 #include "LIEF/ELF/NoteDetails/AndroidNote.hpp"
@@ -79,6 +80,7 @@ void init_objects(nb::module_& m) {
   CREATE(GnuHash, m);
   CREATE(SysvHash, m);
   CREATE(Builder, m);
+  CREATE(Loader, m);
   CREATE(Note, m);
   CREATE(NoteDetails, m);
   CREATE(AndroidNote, m);
@@ -57,6 +57,17 @@ void create<Binary>(nb::module_& m) {
   Class which represents an ELF binary
   )delim"_doc);
 
+  nb::class_<Binary::Snapshot>(bin, "Snapshot",
+      R"delim(
+      Saved state of a binary created by :meth:`~.Binary.snapshot`
+      )delim"_doc)
+    .def("restore", &Binary::Snapshot::restore,
+        R"delim(
+        Create a new :class:`~lief.ELF.Binary` in the saved state. The binary
+        from which the snapshot has been created (and its sections, segments,
+        ...) is not affected.
+        )delim"_doc);
+
   init_ref_iterator<Binary::it_notes>(bin, "it_notes");
   init_ref_iterator<Binary::it_symbols_version_requirement>(bin, "it_symbols_version_requirement");
   init_ref_iterator<Binary::it_symbols_version_definition>(bin, "it_symbols_version_definition");
@@ -274,6 +285,21 @@ void create<Binary>(nb::module_& m) {
         &Binary::functions,
        "List of the functions found the in the binary"_doc)
 
+    .def("function_at",
+        [] (const Binary& self, uint64_t address) -> nb::object {
+          result<Function> func = self.function_at(address);
+          if (!func) {
+            return nb::none();
+          }
+          return nb::cast(*func, nb::rv_policy::copy);
+        },
+        R"delim(
+        Return a copy of the :class:`lief.Function` which contains the given
+        virtual address or None if the address is not covered by one of
+        the :attr:`~.functions`
+        )delim"_doc,
+        "address"_a)
+
     .def_prop_rw("interpreter",
         nb::overload_cast<>(&Binary::interpreter, nb::const_),
         nb::overload_cast<const std::string&>(&Binary::interpreter),
@@ -550,6 +576,38 @@ void create<Binary>(nb::module_& m) {
         "output"_a, "config"_a,
         nb::rv_policy::reference_internal)
 
+    .def("snapshot", &Binary::snapshot,
+        R"delim(
+        Save the current state of the binary so that it can be restored with
+        :meth:`lief.ELF.Binary.Snapshot.restore`. This can be used to try
+        several modifications on the same binary without parsing it again:
+
+        .. code-block:: python
+
+            snap = elf.snapshot()
+            for strategy in strategies:
+                elf = snap.restore()
+                strategy(elf)
+                elf.write(...)
+
+        The content of the file is shared between the binaries and the snapshot
+        until one of them modifies it.
+        )delim"_doc)
+
+    .def("save_snapshot",
+        [] (const Binary& self, const std::string& path) {
+          return error_or(&Binary::save_snapshot, self, path);
+        },
+        R"delim(
+        Save the parsed representation of this binary in a compact file that
+        can be loaded with :func:`lief.ELF.parse_snapshot` without parsing
+        the binary again.
+
+        The content of the binary is not stored in the snapshot: it is read from
+        the original file when the snapshot is loaded. Hence, it returns
+        :attr:`lief.lief_errors.not_supported` if the content has been modified.
+        )delim"_doc, "path"_a)
+
     .def_prop_ro("last_offset_section",
         &Binary::last_offset_section,
         "Return the last offset used in binary according to **sections table**"_doc)
@@ -0,0 +1,128 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+#include "ELF/pyELF.hpp"
+#include "enums_wrapper.hpp"
+#include "pyErr.hpp"
+#include "nanobind/extra/memoryview.hpp"
+
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Loader.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+
+#define PY_ENUM(x) LIEF::ELF::to_string(x), x
+
+namespace LIEF::ELF::py {
+
+template<>
+void create<Loader>(nb::module_& m) {
+  using namespace LIEF::py;
+
+  nb::class_<Loader> loader(m, "Loader",
+      R"delim(
+      Class which maps the ``PT_LOAD`` segments of an ELF binary in memory (as
+      the dynamic loader would do) and applies its dynamic relocations.
+
+      The ``RELATIVE`` relocations (including the ones packed in ``DT_RELR``) are
+      supported for all the architectures while the ``GLOB_DAT``, ``JUMP_SLOT``
+      and absolute relocations are supported for x86, x86-64, ARM and AArch64.
+
+      .. code-block:: python
+
+          elf = lief.ELF.parse("libfoo.so")
+          loader = lief.ELF.Loader(elf)
+          loader.resolver(lambda sym: imports.get(sym.name))
+          image = loader.map(0x7f0000000000)
+          print(image.unresolved)
+      )delim"_doc);
+
+  enum_<Loader::REASON>(loader, "REASON")
+    .value(PY_ENUM(Loader::REASON::UNKNOWN))
+    .value(PY_ENUM(Loader::REASON::SYMBOL_NOT_FOUND))
+    .value(PY_ENUM(Loader::REASON::UNSUPPORTED))
+    .value(PY_ENUM(Loader::REASON::OUT_OF_BOUNDS));
+
+  nb::class_<Loader::unresolved_t>(loader, "unresolved_t",
+      "Relocation which has not been applied"_doc)
+    .def_ro("address", &Loader::unresolved_t::address,
+            "Address of the relocation (not rebased)"_doc)
+    .def_ro("type", &Loader::unresolved_t::type)
+    .def_ro("symbol", &Loader::unresolved_t::symbol,
+            "Name of the symbol associated with the relocation (if any)"_doc)
+    .def_ro("reason", &Loader::unresolved_t::reason);
+
+  nb::class_<Loader::Image>(loader, "Image",
+      "Memory image created by :meth:`~lief.ELF.Loader.map`"_doc)
+    .def_prop_ro("base", &Loader::Image::base,
+        "Address at which the image is loaded"_doc)
+    .def_prop_ro("content",
+        [] (Loader::Image& self) {
+          const span<uint8_t> content = self.content();
+          return nb::memoryview::from_memory(content.data(), content.size());
+        }, "Content of the image (writable)"_doc, nb::keep_alive<0, 1>())
+    .def_prop_ro("unresolved", &Loader::Image::unresolved,
+        "Relocations that have not been applied"_doc,
+        nb::rv_policy::reference_internal);
+
+  loader
+    .def(nb::init<const Binary&>(), "elf"_a, nb::keep_alive<1, 2>())
+
+    .def("resolver",
+        [] (Loader& self, nb::callable fnc) -> Loader& {
+          return self.resolver(
+            [fnc] (const Symbol& sym) -> result<uint64_t> {
+              nb::object value = fnc(nb::cast(sym, nb::rv_policy::reference));
+              if (value.is_none()) {
+                return make_error_code(lief_errors::not_found);
+              }
+              return nb::cast<uint64_t>(value);
+            });
+        },
+        R"delim(
+        Set the function used to resolve the symbols of the relocations.
+
+        It takes a :class:`~lief.ELF.Symbol` and returns its absolute address or
+        ``None``. In the latter case, the loader uses the symbol's definition
+        in the binary (if any).
+        )delim"_doc, "fnc"_a, nb::rv_policy::reference_internal)
+
+    .def_prop_rw("page_size",
+        nb::overload_cast<>(&Loader::page_size, nb::const_),
+        nb::overload_cast<uint64_t>(&Loader::page_size),
+        "Page size used to align the image (default: ``0x1000``)"_doc)
+
+    .def_prop_ro("image_start", &Loader::image_start,
+        "Lowest (page-aligned) virtual address of the ``PT_LOAD`` segments"_doc)
+
+    .def_prop_ro("image_size", &Loader::image_size,
+        "Size of the memory image (page-aligned)"_doc)
+
+    .def("map",
+        [] (const Loader& self, uint64_t base) -> typing_error<result<Loader::Image>> {
+          auto image = self.map(base);
+          if (!image) {
+            return nb::cast(as_lief_err(image));
+          }
+          return nb::cast(std::move(*image));
+        },
+        R"delim(
+        Map the binary in a (zero-filled) buffer such as :attr:`~.image_start`
+        is loaded at ``base`` and apply the relocations.
+        )delim"_doc, "base"_a);
+}
+}
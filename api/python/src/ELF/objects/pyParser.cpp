@@ -78,5 +78,16 @@ void create<Parser>(nb::module_& m) {
       )delim"_doc,
       "obj"_a, "config"_a = ParserConfig::all(),
       nb::rv_policy::take_ownership);
+
+  m.def("parse_snapshot", &Parser::parse_snapshot,
+      R"delim(
+      Load a snapshot created by :meth:`lief.ELF.Binary.save_snapshot`.
+
+      ``source`` is the ELF file from which the snapshot has been created. It
+      returns None if this file has been modified since the creation of the
+      snapshot.
+      )delim"_doc,
+      "snapshot"_a, "source"_a,
+      nb::rv_policy::take_ownership);
 }
 }
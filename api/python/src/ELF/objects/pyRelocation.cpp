@@ -18,6 +18,7 @@
 #include <nanobind/stl/string.h>
 
 #include "ELF/pyELF.hpp"
+#include "enums_wrapper.hpp"
 
 #include "LIEF/ELF/Relocation.hpp"
 #include "LIEF/ELF/Symbol.hpp"
@@ -29,11 +30,19 @@ template<>
 void create<Relocation>(nb::module_& m) {
 
   // Relocation object
-  nb::class_<Relocation, LIEF::Relocation>(m, "Relocation",
+  nb::class_<Relocation, LIEF::Relocation> reloc(m, "Relocation",
       R"delim(
       Class that represents an ELF relocation.
-      )delim"_doc)
+      )delim"_doc);
+
+  enum_<Relocation::ENCODING>(reloc, "ENCODING")
+    .value("UNKNOWN",      Relocation::ENCODING::UNKNOWN)
+    .value("REL",          Relocation::ENCODING::REL)
+    .value("RELA",         Relocation::ENCODING::RELA)
+    .value("RELR",         Relocation::ENCODING::RELR)
+    .value("ANDROID_SLEB", Relocation::ENCODING::ANDROID_SLEB);
 
+  reloc
     .def(nb::init<>())
     .def(nb::init<ARCH>(), "arch"_a)
     .def(nb::init<uint64_t, uint32_t, int64_t, bool>(),
@@ -114,6 +123,18 @@ void create<Relocation>(nb::module_& m) {
       &Relocation::is_rel,
       "``True`` if the relocation **doesn't use** the :attr:`~lief.ELF.Relocation.addend` proprety"_doc)
 
+    .def_prop_ro("encoding",
+      &Relocation::encoding,
+      R"delim(
+      The encoding of the relocation (:class:`~lief.ELF.Relocation.ENCODING`), i.e.
+      whether it comes from a regular ``DT_REL(A)`` table, a ``DT_RELR`` table or an
+      Android packed (``APS2``) table.
+      )delim"_doc)
+
+    .def_prop_ro("is_packed",
+      &Relocation::is_packed,
+      "``True`` if the relocation is packed in a ``DT_RELR`` or an Android ``APS2`` table"_doc)
+
     LIEF_DEFAULT_STR(Relocation);
 }
 
@@ -15,6 +15,8 @@
  */
 #include "ELF/pyELF.hpp"
 #include "pyIterator.hpp"
+#include "enums_wrapper.hpp"
+#include "nanobind/extra/memoryview.hpp"
 
 #include <nanobind/operators.h>
 #include <nanobind/stl/string.h>
@@ -41,6 +43,11 @@ void create<Section>(nb::module_& m) {
 
   init_ref_iterator<Section::it_segments>(sec, "it_segments");
 
+  enum_<Section::COMPRESSION>(sec, "COMPRESSION")
+    .value("NONE", Section::COMPRESSION::NONE)
+    .value("ZLIB", Section::COMPRESSION::ZLIB)
+    .value("ZSTD", Section::COMPRESSION::ZSTD);
+
   sec
     .def(nb::init<>(),
         "Default constructor"_doc)
@@ -118,6 +125,41 @@ void create<Section>(nb::module_& m) {
         nb::overload_cast<uint32_t>(&Section::link),
         "Index to another section"_doc)
 
+    .def_prop_ro("is_compressed",
+        &Section::is_compressed,
+        "True if the section has the ``SHF_COMPRESSED`` flag"_doc)
+
+    .def_prop_ro("compression",
+        &Section::compression,
+        R"delim(
+        Algorithm used to compress the section's content
+        (:attr:`~.COMPRESSION.NONE` if the section is not compressed)
+        )delim"_doc)
+
+    .def_prop_ro("uncompressed_size",
+        &Section::uncompressed_size,
+        "Size of the uncompressed content as declared in the compression header"_doc)
+
+    .def_prop_rw("uncompressed_content",
+        [] (const Section& self) {
+          const span<const uint8_t> content = self.uncompressed_content();
+          return nb::memoryview::from_memory(content.data(), content.size());
+        },
+        nb::overload_cast<std::vector<uint8_t>>(&Section::uncompressed_content),
+        R"delim(
+        Uncompressed content of a ``SHF_COMPRESSED`` section (or the regular
+        :attr:`~lief.Section.content` if the section is not compressed).
+
+        The content is decompressed on the first access and then cached. When it is
+        changed, the :class:`~lief.ELF.Builder` compresses it back with the original
+        algorithm.
+
+        .. warning::
+
+            The :class:`memoryview` previously returned by this property is
+            invalidated when the uncompressed content is changed.
+        )delim"_doc)
+
     .def_prop_ro("segments",
       nb::overload_cast<>(&Section::segments),
       "Return segment(s) associated with the given section"_doc,
@@ -33,6 +33,7 @@
 #include <LIEF/MachO/DyldInfo.hpp>
 #include <LIEF/MachO/DyldChainedFixups.hpp>
 #include <LIEF/MachO/DyldExportsTrie.hpp>
+#include <LIEF/MachO/ExportsTrieView.hpp>
 #include <LIEF/MachO/DylibCommand.hpp>
 #include <LIEF/MachO/ThreadCommand.hpp>
 #include <LIEF/MachO/RPathCommand.hpp>
@@ -45,6 +46,7 @@
 #include <LIEF/MachO/DyldBindingInfo.hpp>
 #include <LIEF/MachO/ExportInfo.hpp>
 #include <LIEF/MachO/FunctionStarts.hpp>
+#include <LIEF/MachO/CodeDirectory.hpp>
 #include <LIEF/MachO/CodeSignature.hpp>
 #include <LIEF/MachO/CodeSignatureDir.hpp>
 #include <LIEF/MachO/DataInCode.hpp>
@@ -95,7 +97,9 @@ void init_objects(nb::module_& m) {
   CREATE(BindingInfo, m);
   CREATE(DyldBindingInfo, m);
   CREATE(ExportInfo, m);
+  CREATE(ExportsTrieView, m);
   CREATE(FunctionStarts, m);
+  CREATE(CodeDirectory, m);
   CREATE(CodeSignature, m);
   CREATE(CodeSignatureDir, m);
   CREATE(DataInCode, m);
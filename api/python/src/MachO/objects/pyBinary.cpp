@@ -414,6 +414,24 @@ void create<Binary>(nb::module_& m) {
         "Return the binary's " RST_CLASS_REF(lief.MachO.LinkerOptHint) " if any, or None"_doc,
         nb::rv_policy::reference_internal)
 
+    .def_prop_ro("exports_view", &Binary::exports_view,
+        R"delim(
+        Lazy view (:class:`~lief.MachO.ExportsTrieView`) over the export trie of
+        ``LC_DYLD_EXPORTS_TRIE`` or ``LC_DYLD_INFO``
+        )delim"_doc, nb::keep_alive<0, 1>())
+
+    .def("find_export",
+        [] (const Binary& self, const std::string& name) {
+          return error_or(&Binary::find_export, self, name);
+        },
+        R"delim(
+        Look for the given exported symbol directly in the raw export trie.
+
+        Contrary to :meth:`~lief.MachO.Binary.get_symbol`, it does not require
+        the trie to be parsed (see: :attr:`lief.MachO.ParserConfig.parse_dyld_exports`)
+        and it does not decode the other exports.
+        )delim"_doc, "name"_a)
+
     .def("virtual_address_to_offset",
         [] (const Binary& self, uint64_t va) {
           return error_or(&Binary::virtual_address_to_offset, self, va);
@@ -644,6 +662,21 @@ void create<Binary>(nb::module_& m) {
         &Binary::page_size,
         "Return the binary's page size"_doc)
 
+    .def("save_snapshot",
+        [] (const Binary& self, const std::string& path) {
+          return error_or(&Binary::save_snapshot, self, path);
+        },
+        R"delim(
+        Save the exports, the dyld bindings and the dyld rebases of this binary
+        in a compact file that can be loaded with :func:`lief.MachO.parse_snapshot`
+        without decoding the dyld opcodes and the exports trie again.
+
+        The other parts of the binary are parsed from the original file when
+        the snapshot is loaded. Hence, it returns
+        :attr:`lief.lief_errors.not_supported` if the content of the segments
+        has been modified.
+        )delim"_doc, "path"_a)
+
     .def("__getitem__",
         nb::overload_cast<LOAD_COMMAND_TYPES>(&Binary::operator[]),
         nb::rv_policy::reference_internal)
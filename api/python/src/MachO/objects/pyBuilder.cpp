@@ -37,7 +37,12 @@ void create<Builder>(nb::module_& m) {
   nb::class_<Builder::config_t>(builder, "config_t",
                                 "Interface to tweak the " RST_CLASS_REF(lief.MachO.Builder) ""_doc)
     .def(nb::init<>())
-    .def_rw("linkedit", &Builder::config_t::linkedit);
+    .def_rw("linkedit", &Builder::config_t::linkedit)
+    .def_rw("code_signature_hashes", &Builder::config_t::code_signature_hashes,
+            R"delim(
+            Recompute the page hashes of the :class:`~lief.MachO.CodeDirectory`
+            over the rebuilt binary (the CMS signature is not updated)
+            )delim"_doc);
 
   builder
     .def_static("write",
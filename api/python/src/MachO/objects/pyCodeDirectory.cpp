@@ -0,0 +1,140 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+#include <sstream>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+#include "LIEF/MachO/CodeDirectory.hpp"
+#include "LIEF/MachO/EnumToString.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#include "enums_wrapper.hpp"
+#include "pyErr.hpp"
+#include "MachO/pyMachO.hpp"
+#include "nanobind/extra/memoryview.hpp"
+
+#define PY_ENUM(x) LIEF::MachO::to_string(x), x
+
+namespace LIEF::MachO::py {
+
+template<>
+void create<CodeDirectory>(nb::module_& m) {
+  using namespace LIEF::py;
+
+  nb::class_<CodeDirectory> cls(m, "CodeDirectory",
+      R"delim(
+      Class which represents a CodeDirectory blob of the ``LC_CODE_SIGNATURE``'s
+      SuperBlob.
+
+      It contains the hashes of the pages of the binary (*code slots*) and the
+      hashes of auxiliary blobs like the requirements or the entitlements
+      (*special slots*).
+      )delim"_doc);
+
+  enum_<CodeDirectory::HASH_TYPES>(cls, "HASH_TYPES")
+    .value(PY_ENUM(CodeDirectory::HASH_TYPES::NONE))
+    .value(PY_ENUM(CodeDirectory::HASH_TYPES::SHA1))
+    .value(PY_ENUM(CodeDirectory::HASH_TYPES::SHA256))
+    .value(PY_ENUM(CodeDirectory::HASH_TYPES::SHA256_TRUNCATED))
+    .value(PY_ENUM(CodeDirectory::HASH_TYPES::SHA384));
+
+  enum_<CodeDirectory::SPECIAL_SLOTS>(cls, "SPECIAL_SLOTS")
+    .value("INFO",             CodeDirectory::SPECIAL_SLOTS::INFO)
+    .value("REQUIREMENTS",     CodeDirectory::SPECIAL_SLOTS::REQUIREMENTS)
+    .value("RESOURCEDIR",      CodeDirectory::SPECIAL_SLOTS::RESOURCEDIR)
+    .value("APPLICATION",      CodeDirectory::SPECIAL_SLOTS::APPLICATION)
+    .value("ENTITLEMENTS",     CodeDirectory::SPECIAL_SLOTS::ENTITLEMENTS)
+    .value("REP_SPECIFIC",     CodeDirectory::SPECIAL_SLOTS::REP_SPECIFIC)
+    .value("DER_ENTITLEMENTS", CodeDirectory::SPECIAL_SLOTS::DER_ENTITLEMENTS);
+
+  cls
+    .def_prop_ro("slot_type", &CodeDirectory::slot_type,
+        "SuperBlob's slot type (``0`` for the primary CodeDirectory, ``0x1000+`` for the alternate ones)"_doc)
+    .def_prop_ro("offset", &CodeDirectory::offset,
+        "Offset of the blob in :attr:`~lief.MachO.CodeSignature.content`"_doc)
+    .def_prop_ro("version", &CodeDirectory::version)
+    .def_prop_ro("flags", &CodeDirectory::flags)
+    .def_prop_ro("hash_type", &CodeDirectory::hash_type)
+    .def_prop_ro("hash_size", &CodeDirectory::hash_size,
+        "Size of a hash (in bytes)"_doc)
+    .def_prop_ro("platform", &CodeDirectory::platform)
+    .def_prop_ro("page_size", nb::overload_cast<>(&CodeDirectory::page_size, nb::const_),
+        "Size of the pages covered by a code slot"_doc)
+    .def_prop_ro("code_limit", &CodeDirectory::code_limit,
+        "Number of bytes (from the beginning of the file) covered by the code slots"_doc)
+    .def_prop_ro("nb_code_slots", &CodeDirectory::nb_code_slots)
+    .def_prop_ro("nb_special_slots", &CodeDirectory::nb_special_slots)
+    .def_prop_ro("identifier", &CodeDirectory::identifier,
+        "Identifier of the signed code"_doc)
+    .def_prop_ro("team_id", &CodeDirectory::team_id,
+        "Team identifier (empty if not present)"_doc)
+    .def_prop_ro("exec_seg_base", &CodeDirectory::exec_seg_base)
+    .def_prop_ro("exec_seg_limit", &CodeDirectory::exec_seg_limit)
+    .def_prop_ro("exec_seg_flags", &CodeDirectory::exec_seg_flags)
+
+    .def("code_hash",
+        [] (const CodeDirectory& self, uint32_t page) {
+          const span<const uint8_t> hash = self.code_hash(page);
+          return nb::memoryview::from_memory(hash.data(), hash.size());
+        }, "Hash of the given page (empty if the page is out of range)"_doc,
+        "page"_a, nb::keep_alive<0, 1>())
+
+    .def("special_hash",
+        [] (const CodeDirectory& self, CodeDirectory::SPECIAL_SLOTS slot) {
+          const span<const uint8_t> hash = self.special_hash(slot);
+          return nb::memoryview::from_memory(hash.data(), hash.size());
+        }, "Hash stored in the given special slot (empty if not present)"_doc,
+        "slot"_a, nb::keep_alive<0, 1>())
+
+    .def("hash",
+        [] (const CodeDirectory& self, const std::vector<uint8_t>& data) {
+          const std::vector<uint8_t> hash = self.hash(data);
+          return nb::bytes(reinterpret_cast<const char*>(hash.data()), hash.size());
+        }, "Compute the hash of the given data with the algorithm of this CodeDirectory"_doc,
+        "data"_a)
+
+    .def("verify",
+        [] (const CodeDirectory& self, const std::string& file) {
+          return error_or([&] () -> result<std::vector<uint32_t>> {
+            auto stream = FileStream::from_file(file);
+            if (!stream) {
+              return make_error_code(lief_errors::file_error);
+            }
+            return self.verify(*stream);
+          });
+        },
+        R"delim(
+        Recompute (in parallel) the hashes of the pages of the given Mach-O (thin)
+        file and return the indexes of the pages that don't match the code slots.
+        )delim"_doc, "file"_a)
+
+    .def("verify",
+        [] (const CodeDirectory& self, const std::vector<uint8_t>& raw) {
+          return error_or([&] () -> result<std::vector<uint32_t>> {
+            SpanStream stream(raw);
+            return self.verify(stream);
+          });
+        },
+        R"delim(
+        Recompute (in parallel) the hashes of the pages of the given Mach-O (thin)
+        content and return the indexes of the pages that don't match the code slots.
+        )delim"_doc, "raw"_a)
+
+    LIEF_DEFAULT_STR(CodeDirectory);
+}
+}
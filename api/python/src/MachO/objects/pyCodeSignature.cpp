@@ -18,9 +18,14 @@
 #include <string>
 #include <sstream>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
 
 #include "LIEF/MachO/CodeSignature.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
+#include "pyErr.hpp"
+#include "pyIterator.hpp"
 #include "MachO/pyMachO.hpp"
 #include "nanobind/extra/memoryview.hpp"
 
@@ -28,7 +33,12 @@ namespace LIEF::MachO::py {
 
 template<>
 void create<CodeSignature>(nb::module_& m) {
-  nb::class_<CodeSignature, LoadCommand>(m, "CodeSignature")
+  using namespace LIEF::py;
+  nb::class_<CodeSignature, LoadCommand> cls(m, "CodeSignature");
+
+  init_ref_iterator<CodeSignature::it_code_directories>(cls, "it_code_directories");
+
+  cls
     .def_prop_rw("data_offset",
         nb::overload_cast<>(&CodeSignature::data_offset, nb::const_),
         nb::overload_cast<uint32_t>(&CodeSignature::data_offset),
@@ -45,6 +55,40 @@ void create<CodeSignature>(nb::module_& m) {
           return nb::memoryview::from_memory(content.data(), content.size());
         }, "The raw signature as a bytes stream"_doc)
 
+    .def_prop_ro("code_directories",
+        nb::overload_cast<>(&CodeSignature::code_directories),
+        "Iterator over the " RST_CLASS_REF(lief.MachO.CodeDirectory) " of the signature"_doc,
+        nb::keep_alive<0, 1>())
+
+    .def("update_code_hashes",
+        [] (CodeSignature& self, const std::string& file) {
+          return error_or([&] () -> ok_error_t {
+            auto stream = FileStream::from_file(file);
+            if (!stream) {
+              return make_error_code(lief_errors::file_error);
+            }
+            return self.update_code_hashes(*stream);
+          });
+        },
+        R"delim(
+        Recompute the code slots of the CodeDirectory blobs from the given
+        Mach-O (thin) file and update :attr:`~lief.MachO.CodeSignature.content`.
+        The CMS signature is not updated.
+        )delim"_doc, "file"_a)
+
+    .def("update_code_hashes",
+        [] (CodeSignature& self, const std::vector<uint8_t>& raw) {
+          return error_or([&] () -> ok_error_t {
+            SpanStream stream(raw);
+            return self.update_code_hashes(stream);
+          });
+        },
+        R"delim(
+        Recompute the code slots of the CodeDirectory blobs from the given
+        Mach-O (thin) content and update :attr:`~lief.MachO.CodeSignature.content`.
+        The CMS signature is not updated.
+        )delim"_doc, "raw"_a)
+
   LIEF_DEFAULT_STR(CodeSignature);
 }
 }
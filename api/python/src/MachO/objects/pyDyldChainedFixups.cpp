@@ -19,6 +19,7 @@
 #include <nanobind/stl/vector.h>
 
 #include "pyIterator.hpp"
+#include "enums_wrapper.hpp"
 #include "LIEF/MachO/DyldChainedFixups.hpp"
 #include "LIEF/MachO/SegmentCommand.hpp"
 #include "LIEF/MachO/ChainedBindingInfo.hpp"
@@ -83,6 +84,37 @@ void create<DyldChainedFixups>(nb::module_& m) {
 
       LIEF_DEFAULT_STR(DyldChainedFixups::chained_starts_in_segment);
 
+  using fixups_table_t = DyldChainedFixups::fixups_table_t;
+  nb::class_<fixups_table_t> table(chained, "fixups_table_t",
+      R"delim(
+      Compact (struct-of-arrays) representation of the fixups.
+
+      The i-th fixup is described by ``offset[i]``, ``target[i]``, ``kind[i]``, ...
+      )delim"_doc);
+
+  enum_<fixups_table_t::KIND>(table, "KIND")
+    .value("REBASE",      fixups_table_t::KIND::REBASE)
+    .value("BIND",        fixups_table_t::KIND::BIND)
+    .value("AUTH_REBASE", fixups_table_t::KIND::AUTH_REBASE)
+    .value("AUTH_BIND",   fixups_table_t::KIND::AUTH_BIND);
+
+  table
+    .def_ro("offset", &fixups_table_t::offset,
+            "Offset of the fixup (relative to the beginning of the binary)"_doc)
+    .def_ro("target", &fixups_table_t::target,
+            "Target of the rebase (0 for a binding)"_doc)
+    .def_ro("kind", &fixups_table_t::kind,
+            "Kind of the fixup (:class:`~lief.MachO.DyldChainedFixups.fixups_table_t.KIND`)"_doc)
+    .def_ro("ordinal", &fixups_table_t::ordinal,
+            "Import ordinal of the binding (0 for a rebase)"_doc)
+    .def_ro("addend", &fixups_table_t::addend,
+            "Addend of the binding"_doc)
+    .def_ro("segment", &fixups_table_t::segment,
+            "Index of the segment in which the fixup takes place"_doc)
+    .def_ro("raw", &fixups_table_t::raw,
+            "Raw (encoded) value of the fixup pointer"_doc)
+    .def("__len__", &fixups_table_t::size);
+
   chained
     .def_prop_rw("data_offset",
         nb::overload_cast<>(&DyldChainedFixups::data_offset, nb::const_),
@@ -103,6 +135,14 @@ void create<DyldChainedFixups>(nb::module_& m) {
         " associated with this command"_doc,
         nb::keep_alive<0, 1>())
 
+    .def_prop_ro("fixups", &DyldChainedFixups::fixups,
+        R"delim(
+        Compact table of all the fixups (rebases and bindings) decoded
+        by the parser (:class:`~lief.MachO.DyldChainedFixups.fixups_table_t`).
+        This table is available even if the bindings and the rebases are not
+        parsed into objects (cf. :class:`~lief.MachO.ParserConfig`)
+        )delim"_doc, nb::rv_policy::reference_internal)
+
     .def_prop_ro("chained_starts_in_segments",
         nb::overload_cast<>(&DyldChainedFixups::chained_starts_in_segments),
         "Iterator over the chained fixup metadata, " RST_CLASS_REF(lief.MachO.DyldChainedFixups.chained_starts_in_segment) ""_doc,
@@ -23,6 +23,7 @@
 #include "LIEF/MachO/DyldExportsTrie.hpp"
 #include "LIEF/MachO/ExportInfo.hpp"
 
+#include "pyErr.hpp"
 #include "MachO/pyMachO.hpp"
 
 namespace LIEF::MachO::py {
@@ -66,6 +67,19 @@ void create<DyldExportsTrie>(nb::module_& m) {
                  this trie.
                  )delim"_doc)
 
+    .def_prop_ro("exports_view", &DyldExportsTrie::exports_view,
+        R"delim(
+        Lazy view (:class:`~lief.MachO.ExportsTrieView`) over the raw trie
+        )delim"_doc, nb::keep_alive<0, 1>())
+
+    .def("find_export",
+        [] (const DyldExportsTrie& self, const std::string& name) {
+          return error_or(&DyldExportsTrie::find_export, self, name);
+        },
+        R"delim(
+        Look for the given symbol in the trie without decoding the whole trie
+        )delim"_doc, "name"_a)
+
     .def("show_export_trie",
          &DyldExportsTrie::show_export_trie,
          "Show the trie in a humman-readable way"_doc)
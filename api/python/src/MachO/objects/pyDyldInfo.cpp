@@ -24,6 +24,7 @@
 #include "pyIterator.hpp"
 #include "nanobind/extra/memoryview.hpp"
 
+#include "pyErr.hpp"
 #include "MachO/pyMachO.hpp"
 
 namespace LIEF::MachO::py {
@@ -232,6 +233,19 @@ void create<DyldInfo>(nb::module_& m) {
         "Return an iterator over Dyld's " RST_CLASS_REF(lief.MachO.ExportInfo) ""_doc,
         nb::rv_policy::reference_internal)
 
+    .def_prop_ro("exports_view", &DyldInfo::exports_view,
+        R"delim(
+        Lazy view (:class:`~lief.MachO.ExportsTrieView`) over the raw export trie
+        )delim"_doc, nb::keep_alive<0, 1>())
+
+    .def("find_export",
+        [] (const DyldInfo& self, const std::string& name) {
+          return error_or(&DyldInfo::find_export, self, name);
+        },
+        R"delim(
+        Look for the given symbol in the export trie without decoding the whole trie
+        )delim"_doc, "name"_a)
+
     .def_prop_ro("show_export_trie",
         &DyldInfo::show_export_trie,
         "Return the export trie in a humman-readable way"_doc,
@@ -0,0 +1,84 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+#include <nanobind/stl/string.h>
+#include <nanobind/make_iterator.h>
+
+#include "LIEF/MachO/ExportsTrieView.hpp"
+
+#include "pyErr.hpp"
+#include "MachO/pyMachO.hpp"
+
+namespace LIEF::MachO::py {
+
+template<>
+void create<ExportsTrieView>(nb::module_& m) {
+  using namespace LIEF::py;
+
+  nb::class_<ExportsTrieView> view(m, "ExportsTrieView",
+      R"delim(
+      Lazy view over a raw export trie (``LC_DYLD_EXPORTS_TRIE`` or ``LC_DYLD_INFO``).
+
+      It can be used to look up an export with :meth:`~lief.MachO.ExportsTrieView.find`
+      or to iterate over the exports without decoding the whole trie into
+      :class:`~lief.MachO.ExportInfo` objects.
+      )delim"_doc);
+
+  nb::class_<ExportsTrieView::export_t>(view, "export_t",
+      "Information stored in a terminal node of the trie"_doc)
+    .def_ro("node_offset", &ExportsTrieView::export_t::node_offset,
+            "Offset of the terminal information in the trie"_doc)
+    .def_ro("flags", &ExportsTrieView::export_t::flags,
+            "Export flags (see: :class:`~lief.MachO.EXPORT_SYMBOL_FLAGS`)"_doc)
+    .def_ro("address", &ExportsTrieView::export_t::address,
+            "Address of the export (0 for a re-export)"_doc)
+    .def_ro("other", &ExportsTrieView::export_t::other,
+            "Library ordinal for a re-export or resolver's address for a stub-and-resolver"_doc)
+    .def_prop_ro("imported_name",
+        [] (const ExportsTrieView::export_t& self) {
+          return std::string(self.imported_name);
+        }, "Name of the re-exported symbol (empty if it is re-exported with the same name)"_doc)
+    .def_prop_ro("kind", &ExportsTrieView::export_t::kind,
+                 "The export's kind (regular, thread local, absolute, ...)"_doc)
+    .def("has", &ExportsTrieView::export_t::has,
+         "Check if the given flag is set"_doc, "flag"_a);
+
+  nb::class_<ExportsTrieView::entry_t>(view, "entry_t")
+    .def_ro("name", &ExportsTrieView::entry_t::name)
+    .def_ro("info", &ExportsTrieView::entry_t::info);
+
+  view
+    .def("find",
+        [] (const ExportsTrieView& self, const std::string& name) {
+          return error_or(&ExportsTrieView::find, self, name);
+        },
+        R"delim(
+        Look for the export associated with the given name.
+
+        The lookup follows the edges of the trie and does not decode
+        the other nodes.
+        )delim"_doc, "name"_a)
+
+    .def("__contains__", &ExportsTrieView::has)
+
+    .def("__iter__",
+        [] (const ExportsTrieView& self) {
+          return nb::make_iterator(nb::type<ExportsTrieView>(), "iterator",
+                                   self.begin(), self.end());
+        }, nb::keep_alive<0, 1>());
+}
+
+}
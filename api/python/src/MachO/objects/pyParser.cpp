@@ -24,6 +24,7 @@
 #include "pyIOStream.hpp"
 
 #include "LIEF/MachO/Parser.hpp"
+#include "LIEF/MachO/Binary.hpp"
 #include "LIEF/MachO/FatBinary.hpp"
 #include "LIEF/logging.hpp"
 
@@ -84,6 +85,18 @@ void create<Parser>(nb::module_& m) {
     )delim"_doc,
     "obj"_a, "config"_a = ParserConfig::quick(),
     nb::rv_policy::take_ownership);
+
+  m.def("parse_snapshot", &Parser::parse_snapshot,
+    R"delim(
+    Load a snapshot created by :meth:`lief.MachO.Binary.save_snapshot` and
+    return a :class:`~lief.MachO.Binary` object.
+
+    ``source`` is the Mach-O file (possibly FAT) from which the snapshot has
+    been created. It returns None if this file has been modified since the
+    creation of the snapshot.
+    )delim"_doc,
+    "snapshot"_a, "source"_a,
+    nb::rv_policy::take_ownership);
 }
 
 }
@@ -34,10 +34,16 @@ void create<ParserConfig>(nb::module_& m) {
             "Parse the Dyld export trie"_doc)
 
     .def_rw("parse_dyld_bindings", &ParserConfig::parse_dyld_bindings,
-            "Parse the Dyld binding opcodes"_doc)
+            R"delim(
+            Parse the Dyld binding opcodes and create the chained bindings
+            (:attr:`~lief.MachO.DyldChainedFixups.fixups` is always available)
+            )delim"_doc)
 
     .def_rw("parse_dyld_rebases", &ParserConfig::parse_dyld_rebases,
-            "Parse the Dyld rebase opcodes"_doc)
+            R"delim(
+            Parse the Dyld rebase opcodes and create the chained relocations
+            (:attr:`~lief.MachO.DyldChainedFixups.fixups` is always available)
+            )delim"_doc)
 
     .def_rw("fix_from_memory", &ParserConfig::fix_from_memory,
             R"delim(
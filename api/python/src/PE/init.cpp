@@ -34,6 +34,7 @@
 #include "LIEF/PE/resources/LangCodeItem.hpp"
 #include "LIEF/PE/signature/attributes.hpp"
 #include "LIEF/PE/signature/SpcIndirectData.hpp"
+#include "LIEF/PE/signature/TrustStore.hpp"
 #include "LIEF/PE/signature/GenericContent.hpp"
 
 #define CREATE(X,Y) create<X>(Y)
@@ -87,6 +88,7 @@ void init_signature(nb::module_& m) {
   CREATE(Signature, m);
   CREATE(RsaInfo, m);
   CREATE(x509, m);
+  CREATE(TrustStore, m);
   CREATE(ContentInfo, m);
   CREATE(GenericContent, m);
   CREATE(SpcIndirectData, m);
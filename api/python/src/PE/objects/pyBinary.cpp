@@ -51,6 +51,17 @@ void create<Binary>(nb::module_& m) {
       the constructor of this object can be used to craft a binary from scratch (see: :ref:`02-pe-from-scratch`)
       )delim"_doc);
 
+  nb::class_<Binary::Snapshot>(bin, "Snapshot",
+      R"delim(
+      Saved state of a binary created by :meth:`~.Binary.snapshot`
+      )delim"_doc)
+    .def("restore", &Binary::Snapshot::restore,
+        R"delim(
+        Create a new :class:`~lief.PE.Binary` in the saved state. The binary
+        from which the snapshot has been created (and its sections, imports,
+        ...) is not affected.
+        )delim"_doc);
+
   init_ref_iterator<Binary::it_sections>(bin, "it_section");
   init_ref_iterator<Binary::it_data_directories>(bin, "it_data_directories");
   init_ref_iterator<Binary::it_relocations>(bin, "it_relocations");
@@ -411,6 +422,31 @@ void create<Binary>(nb::module_& m) {
         "Build the binary and write the result to the given ``output`` file"_doc,
         "output_path"_a)
 
+    .def("snapshot", &Binary::snapshot,
+        R"delim(
+        Save the current state of the binary so that it can be restored with
+        :meth:`lief.PE.Binary.Snapshot.restore` (e.g. to try several
+        modifications without parsing the binary again).
+
+        The content of the sections is shared between the binaries and the
+        snapshot until one of them modifies it.
+        )delim"_doc)
+
+    .def("save_snapshot",
+        [] (const Binary& self, const std::string& path) {
+          return error_or(&Binary::save_snapshot, self, path);
+        },
+        R"delim(
+        Save the imports, the exports and the relocations of this binary in a
+        compact file that can be loaded with :func:`lief.PE.parse_snapshot`
+        without parsing these structures again.
+
+        The other parts of the binary are parsed from the original file when
+        the snapshot is loaded. Hence, it returns
+        :attr:`lief.lief_errors.not_supported` if the content of the sections
+        has been modified.
+        )delim"_doc, "path"_a)
+
     LIEF_DEFAULT_STR(Binary);
 
 }
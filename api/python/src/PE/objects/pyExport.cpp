@@ -76,6 +76,16 @@ void create<Export>(nb::module_& m) {
         "Iterator over the " RST_CLASS_REF(lief.PE.ExportEntry) ""_doc,
         nb::rv_policy::reference_internal)
 
+    .def("find_entry",
+        nb::overload_cast<const std::string&>(&Export::find_entry),
+        "Return the " RST_CLASS_REF(lief.PE.ExportEntry) " with the given name or None"_doc,
+        "name"_a, nb::rv_policy::reference_internal)
+
+    .def("find_entry_at_ordinal",
+        nb::overload_cast<uint32_t>(&Export::find_entry_at_ordinal),
+        "Return the " RST_CLASS_REF(lief.PE.ExportEntry) " associated with the given ordinal or None"_doc,
+        "ordinal"_a, nb::rv_policy::reference_internal)
+
     LIEF_COPYABLE(Export)
     LIEF_DEFAULT_STR(Export);
 }
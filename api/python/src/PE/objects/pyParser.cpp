@@ -65,6 +65,17 @@ void create<Parser>(nb::module_& m) {
     "Parse the PE binary from the given parameter and return a :class:`lief.PE.Binary` object"_doc,
     "obj"_a, "config"_a = ParserConfig::all(),
     nb::rv_policy::take_ownership);
+
+  m.def("parse_snapshot", &Parser::parse_snapshot,
+      R"delim(
+      Load a snapshot created by :meth:`lief.PE.Binary.save_snapshot`.
+
+      ``source`` is the PE file from which the snapshot has been created. It
+      returns None if this file has been modified since the creation of the
+      snapshot.
+      )delim"_doc,
+      "snapshot"_a, "source"_a,
+      nb::rv_policy::take_ownership);
 }
 
 }
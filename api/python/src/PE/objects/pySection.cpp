@@ -167,7 +167,7 @@ void create<Section>(nb::module_& m) {
 
     .def_prop_ro("padding",
         [] (const Section& sec) {
-          const std::vector<uint8_t>& data = sec.padding();
+          span<const uint8_t> data = sec.padding_content();
           return nb::bytes(reinterpret_cast<const char*>(data.data()), data.size());
         },
         "Section padding content as bytes"_doc)
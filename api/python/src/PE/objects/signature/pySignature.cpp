@@ -219,7 +219,7 @@ void create<Signature>(nb::module_& m) {
 
     .def_prop_ro("raw_der",
         [] (const Signature& sig) {
-          const std::vector<uint8_t>& raw = sig.raw_der();
+          const span<const uint8_t> raw = sig.raw_der();
           return nb::bytes(reinterpret_cast<const char*>(raw.data()), raw.size());
         },
         "Return the raw original signature as a byte object"_doc,
@@ -0,0 +1,96 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/PE/signature/TrustStore.hpp"
+#include "LIEF/PE/signature/Signature.hpp"
+
+#include "PE/pyPE.hpp"
+
+#include <nanobind/stl/vector.h>
+
+namespace LIEF::PE::py {
+
+template<>
+void create<TrustStore>(nb::module_& m) {
+  nb::class_<TrustStore>(m, "TrustStore",
+      R"delim(
+      Set of trusted (root) certificates used to verify the certificates of
+      Authenticode signatures.
+
+      Compared to :meth:`lief.PE.x509.is_trusted_by`, the roots are not copied
+      for each verification and the results are cached by the fingerprint of
+      the chain (leaf + intermediates). The same store should be re-used to
+      verify a large number of binaries. :meth:`~.verify` can be called from
+      several threads.
+
+      .. code-block:: python
+
+          store = lief.PE.TrustStore(lief.PE.x509.parse("windows-ca-bundle.pem"))
+          for sig in pe.signatures:
+              print(store.verify(sig))
+      )delim"_doc)
+
+    .def(nb::init<>())
+    .def(nb::init<TrustStore::certificates_t>(), "roots"_a)
+
+    .def("add", &TrustStore::add,
+        R"delim(
+        Add a trusted certificate to the store. It also clears the cache of the
+        verified chains
+        )delim"_doc, "cert"_a)
+
+    .def_prop_ro("roots", &TrustStore::roots,
+        "Trusted certificates"_doc)
+
+    .def("verify",
+        nb::overload_cast<const x509&, const TrustStore::certificates_t&>(&TrustStore::verify, nb::const_),
+        R"delim(
+        Verify that ``cert`` is trusted by this store, possibly through the given
+        ``intermediates`` certificates.
+
+        It returns a set of flags defined by :class:`~lief.PE.x509.VERIFICATION_FLAGS`
+        )delim"_doc, "cert"_a, "intermediates"_a = TrustStore::certificates_t{},
+        nb::call_guard<nb::gil_scoped_release>())
+
+    .def("verify",
+        nb::overload_cast<const Signature&>(&TrustStore::verify, nb::const_),
+        R"delim(
+        Verify the certificates of the signers of the given :class:`~lief.PE.Signature`.
+        The other certificates embedded in the signature are used as intermediates.
+        )delim"_doc, "signature"_a,
+        nb::call_guard<nb::gil_scoped_release>())
+
+    .def_prop_ro("cache_size", &TrustStore::cache_size,
+        "Number of chains whose verification result is cached"_doc)
+
+    .def_prop_rw("max_cache_size",
+        nb::overload_cast<>(&TrustStore::max_cache_size, nb::const_),
+        nb::overload_cast<size_t>(&TrustStore::max_cache_size),
+        R"delim(
+        Maximum number of results kept in the cache (the oldest results are
+        evicted first). ``0`` disables the cache.
+        )delim"_doc)
+
+    .def("clear_cache", &TrustStore::clear_cache,
+        R"delim(
+        Clear the cached results. Since the verification depends on the current
+        time (expiration of the certificates), a long-lived store should be
+        periodically cleared.
+        )delim"_doc)
+
+    .def("__len__", &TrustStore::size);
+}
+
+}
@@ -180,7 +180,7 @@ void create<x509>(nb::module_& m) {
             print(ca.verify(signer))  # lief.PE.x509.VERIFICATION_FLAGS.OK
 
         )delim"_doc,
-        "ca"_a)
+        "ca"_a, nb::call_guard<nb::gil_scoped_release>())
 
     .def("is_trusted_by",
         &x509::is_trusted_by,
@@ -21,12 +21,37 @@
 #include "LIEF/PE/Binary.hpp"
 
 #include "LIEF/PE/signature/OIDToString.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
 
 namespace LIEF::PE::py {
 
+template<class Key>
+void def_find_export(nb::module_& m, const char* key_name, const char* doc) {
+  using namespace LIEF::py;
+  m.def("find_export",
+      [] (const std::string& file, const Key& key) {
+        return error_or([&] () -> result<export_lookup_t> {
+          auto stream = FileStream::from_file(file);
+          if (!stream) {
+            return make_error_code(lief_errors::file_error);
+          }
+          return find_export(*stream, key);
+        });
+      }, doc, "file"_a, nb::arg(key_name));
+
+  m.def("find_export",
+      [] (const std::vector<uint8_t>& raw, const Key& key) {
+        return error_or([&] () -> result<export_lookup_t> {
+          SpanStream stream(raw);
+          return find_export(stream, key);
+        });
+      }, doc, "raw"_a, nb::arg(key_name));
+}
+
 void init_utils(nb::module_& m) {
   using namespace LIEF::py;
 
@@ -103,5 +128,29 @@ void init_utils(nb::module_& m) {
       )delim",
       "imp"_a, "strict"_a = false, "use_std"_a = false,
       nb::rv_policy::copy);
+
+  nb::class_<export_lookup_t>(m, "export_lookup_t",
+      "Export resolved by :func:`~lief.PE.find_export`"_doc)
+    .def_ro("ordinal", &export_lookup_t::ordinal,
+            "Ordinal of the export (including the ordinal base)"_doc)
+    .def_ro("address", &export_lookup_t::address,
+            "RVA of the exported symbol or of the forwarder string"_doc)
+    .def_ro("is_extern", &export_lookup_t::is_extern,
+            "True if the export is forwarded to another library"_doc);
+
+  def_find_export<std::string>(m, "name",
+      R"delim(
+      Look for the export ``name`` in the export directory of the given PE file (or raw data)
+      without parsing the whole binary.
+
+      The lookup is a binary search on the export name pointer table.
+      It returns a :class:`~lief.PE.export_lookup_t` or a :class:`lief.lief_errors`.
+      )delim");
+
+  def_find_export<uint32_t>(m, "ordinal",
+      R"delim(
+      Look for the export associated with the given ordinal in the export directory
+      of the given PE file (or raw data) without parsing the whole binary.
+      )delim");
 }
 }
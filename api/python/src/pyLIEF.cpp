@@ -13,11 +13,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <fstream>
+
 #include "pyLIEF.hpp"
 #include "pyErr.hpp"
 #include <spdlog/logger.h>
 #include "spdlog/sinks/python_sink.h"
 
+#include <nanobind/stl/set.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
 
@@ -91,6 +94,18 @@ void init_logger(nb::module_& m) {
     .value(PY_ENUM(logging::LOGGING_LEVEL::LOG_ERR))
     .value(PY_ENUM(logging::LOGGING_LEVEL::LOG_WARN))
     .value(PY_ENUM(logging::LOGGING_LEVEL::LOG_INFO));
+
+  nb::enum_<logging::MODULE>(logging, "MODULE")
+    .value(PY_ENUM(logging::MODULE::GENERIC))
+    .value(PY_ENUM(logging::MODULE::ELF))
+    .value(PY_ENUM(logging::MODULE::PE))
+    .value(PY_ENUM(logging::MODULE::MACHO))
+    .value(PY_ENUM(logging::MODULE::MACHO_DYLD_INFO))
+    .value(PY_ENUM(logging::MODULE::MACHO_CHAINED_FIXUPS))
+    .value(PY_ENUM(logging::MODULE::OAT))
+    .value(PY_ENUM(logging::MODULE::DEX))
+    .value(PY_ENUM(logging::MODULE::VDEX))
+    .value(PY_ENUM(logging::MODULE::ART));
   #undef PY_ENUM
 
   logging.def("disable", &logging::disable,
@@ -99,9 +114,12 @@ void init_logger(nb::module_& m) {
   logging.def("enable", &logging::enable,
               "Enable the logger globally");
 
-  logging.def("set_level", &logging::set_level,
+  logging.def("set_level", nb::overload_cast<logging::LOGGING_LEVEL>(&logging::set_level),
               "Change logging level", "level"_a);
 
+  logging.def("set_level", nb::overload_cast<logging::MODULE, logging::LOGGING_LEVEL>(&logging::set_level),
+              "Change the logging level of the given module only", "module"_a, "level"_a);
+
   logging.def("set_path", &logging::set_path,
               "Change the logger as a file-base logging and set its path",
               "path"_a);
@@ -135,7 +153,33 @@ void init_hash(nb::module_& m) {
 
 
 void init_json(nb::module_& m) {
-  m.def("to_json", &LIEF::to_json);
+  m.def("to_json", nb::overload_cast<const Object&>(&LIEF::to_json));
+
+  m.def("to_json",
+        [] (const Object& obj, const std::string& output,
+            const std::set<std::string>& only, const std::set<std::string>& skip)
+        {
+          std::ofstream ofs(output, std::ios::binary | std::ios::trunc);
+          if (!ofs) {
+            logging::log(logging::LOG_ERR, "Can't open " + output);
+            return false;
+          }
+          JsonConfig config;
+          config.only = only;
+          config.skip = skip;
+          LIEF::to_json(obj, ofs, config);
+          return static_cast<bool>(ofs);
+        },
+        R"delim(
+        Serialize the given object in JSON directly into the file ``output``.
+
+        Contrary to :func:`lief.to_json` with a single argument, the JSON
+        representation of a binary is not entirely built in memory. ``only``
+        and ``skip`` can be used to select the top-level entries to serialize
+        (e.g. ``only={"header", "imports"}``).
+        )delim"_doc,
+        "obj"_a, "output"_a,
+        "only"_a = std::set<std::string>(), "skip"_a = std::set<std::string>());
 }
 
 
@@ -209,6 +209,28 @@ if (LIEF_SUPPORT_CXX14 AND NOT LIEF_DISABLE_FROZEN)
   endif()
 endif()
 
+# zlib / zstd
+# -----------
+if(LIEF_OPT_ZLIB)
+  find_package(ZLIB QUIET)
+  if(NOT ZLIB_FOUND)
+    message(FATAL_ERROR "LIEF_OPT_ZLIB is enabled but zlib can't be found "
+                        "(configure with -DLIEF_OPT_ZLIB=OFF to disable it)")
+  endif()
+  message(STATUS "Enable zlib support for SHF_COMPRESSED sections")
+  set(LIEF_ZLIB_SUPPORT 1)
+endif()
+
+if(LIEF_OPT_ZSTD)
+  find_package(zstd CONFIG QUIET)
+  if(NOT zstd_FOUND)
+    message(FATAL_ERROR "LIEF_OPT_ZSTD is enabled but zstd can't be found "
+                        "(configure with -DLIEF_OPT_ZSTD=OFF to disable it)")
+  endif()
+  message(STATUS "Enable zstd support for SHF_COMPRESSED sections")
+  set(LIEF_ZSTD_SUPPORT 1)
+endif()
+
 # expected
 # ----------
 if(NOT LIEF_EXTERNAL_EXPECTED)
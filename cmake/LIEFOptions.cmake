@@ -70,6 +70,11 @@ option(LIEF_OPT_MBEDTLS_EXTERNAL OFF)
 # This option enables to provide an external version of nanobind
 option(LIEF_OPT_NANOBIND_EXTERNAL OFF)
 
+# These options enable the decompression of the ELF SHF_COMPRESSED
+# sections with the zlib / zstd libraries installed on the system
+option(LIEF_OPT_ZLIB "Support zlib-compressed ELF sections (requires zlib)" ON)
+option(LIEF_OPT_ZSTD "Support zstd-compressed ELF sections (requires zstd)" ON)
+
 # This option enables to provide an external
 # version of https://github.com/tcbrindle/span (e.g. present on the system)
 option(LIEF_OPT_EXTERNAL_SPAN OFF)
@@ -108,6 +113,9 @@ set(LIEF_EXTERNAL_UTF8CPP 0)
 set(LIEF_EXTERNAL_MBEDTLS 0)
 set(LIEF_EXTERNAL_SPAN 0)
 
+set(LIEF_ZLIB_SUPPORT 0)
+set(LIEF_ZSTD_SUPPORT 0)
+
 if(LIEF_ELF)
   set(LIEF_ELF_SUPPORT 1)
 endif()
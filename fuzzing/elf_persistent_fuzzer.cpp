@@ -0,0 +1,44 @@
+#include <LIEF/ELF.hpp>
+#include <LIEF/BinaryStream/SpanStream.hpp>
+#include <memory>
+
+#include "harness.hpp"
+
+using namespace LIEF;
+
+extern "C" int LLVMFuzzerInitialize(int* /*argc*/, char*** /*argv*/) {
+  fuzzing::init();
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  fuzzing::iteration_t iteration;
+  std::unique_ptr<ELF::Binary> elf =
+    ELF::Parser::parse(std::make_unique<SpanStream>(data, size));
+
+  if (elf == nullptr) {
+    return 0;
+  }
+
+  fuzzing::lookups(*elf);
+  elf->get_section(".text");
+  elf->get_dynamic_symbol("main");
+  elf->get_relocation("__libc_start_main");
+  elf->section_from_offset(elf->header().section_headers_offset());
+  elf->segment_from_virtual_address(elf->entrypoint());
+  elf->virtual_address_to_offset(elf->entrypoint());
+  if (elf->has_interpreter()) {
+    elf->interpreter();
+  }
+
+  if (elf->eof_offset() > fuzzing::MAX_BUILD_SIZE) {
+    return 0;
+  }
+
+  // Round-trip: rebuild the binary and parse the output
+  ELF::Builder builder(*elf);
+  builder.build();
+  const std::vector<uint8_t>& raw = builder.get_build();
+  ELF::Parser::parse(std::make_unique<SpanStream>(raw.data(), raw.size()));
+  return 0;
+}
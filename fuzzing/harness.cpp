@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// The arena relies on mmap() to reserve its address space and on
+// posix_memalign() for the over-aligned fallbacks (see fuzzing/CMakeLists.txt)
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#  include <sys/mman.h>
+#else
+#  error "The persistent fuzzing harness is only supported on POSIX hosts"
+#endif
+
+#include <LIEF/logging.hpp>
+#include <LIEF/Abstract/Binary.hpp>
+#include <LIEF/Abstract/Section.hpp>
+#include <LIEF/Abstract/Symbol.hpp>
+
+#include "harness.hpp"
+
+#if defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+#    define LIEF_FUZZING_ASAN 1
+#  endif
+#endif
+
+#if !defined(LIEF_FUZZING_ASAN) && defined(__SANITIZE_ADDRESS__)
+#  define LIEF_FUZZING_ASAN 1
+#endif
+
+#if defined(LIEF_FUZZING_ASAN)
+#  include <sanitizer/asan_interface.h>
+#  define LIEF_POISON(addr, size)   ASAN_POISON_MEMORY_REGION(addr, size)
+#  define LIEF_UNPOISON(addr, size) ASAN_UNPOISON_MEMORY_REGION(addr, size)
+#else
+#  define LIEF_POISON(addr, size)   ((void)(addr), (void)(size))
+#  define LIEF_UNPOISON(addr, size) ((void)(addr), (void)(size))
+#endif
+
+namespace LIEF {
+namespace fuzzing {
+
+namespace {
+// The arena is only reserved: the pages are committed by the kernel
+// when they are touched for the first time.
+static constexpr size_t ARENA_SIZE = 1llu << 30;
+static constexpr size_t ALIGN      = 16;
+static constexpr size_t POISON_STEP = 1llu << 20;
+
+// Each block is preceded by a header that stores its size. When ASan is
+// enabled, the header and a redzone after the block are poisoned so that the
+// overflows and the use-after-free are still reported within an iteration.
+struct header_t {
+  size_t size;
+  size_t pad;
+};
+static_assert(sizeof(header_t) == ALIGN, "The header must keep the alignment");
+
+#if defined(LIEF_FUZZING_ASAN)
+static constexpr size_t REDZONE = ALIGN;
+#else
+static constexpr size_t REDZONE = 0;
+#endif
+
+struct arena_t {
+  uint8_t* base = nullptr;
+  size_t used = 0;
+  size_t floor = 0;
+  size_t poisoned = 0;
+  std::atomic<size_t> live{0};
+  arena_stats_t stats;
+};
+
+arena_t& get_arena() {
+  static arena_t* arena = [] {
+    // Allocated with malloc() as it must outlive the static objects which
+    // could release blocks of the arena when they are destroyed.
+    auto* ptr = static_cast<arena_t*>(std::malloc(sizeof(arena_t)));
+    return new (ptr) arena_t{};
+  }();
+  return *arena;
+}
+
+// Only the thread that runs the iteration uses the arena. The other threads
+// (e.g. the workers of the parallel helpers) keep using malloc().
+thread_local bool in_iteration = false;
+
+inline size_t align_up(size_t value, size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+inline bool owns(const void* ptr) {
+  const arena_t& arena = get_arena();
+  const auto* p = static_cast<const uint8_t*>(ptr);
+  return arena.base != nullptr && arena.base <= p && p < arena.base + ARENA_SIZE;
+}
+
+void* allocate(size_t size, size_t align) {
+  if (!in_iteration) {
+    return nullptr;
+  }
+  arena_t& arena = get_arena();
+  if (arena.base == nullptr) {
+    return nullptr;
+  }
+  const size_t start = align_up(arena.used + sizeof(header_t), align);
+  const size_t end   = align_up(start + size, ALIGN) + REDZONE;
+  if (end > ARENA_SIZE) {
+    ++arena.stats.fallbacks;
+    return nullptr;
+  }
+  if (end > arena.poisoned) {
+    // Poison the fresh area so that an overflow of the last block is
+    // reported even beyond its redzone
+    const size_t upto = std::min(align_up(end, POISON_STEP), ARENA_SIZE);
+    LIEF_POISON(arena.base + arena.poisoned, upto - arena.poisoned);
+    arena.poisoned = upto;
+  }
+  uint8_t* ptr = arena.base + start;
+  auto* hdr = reinterpret_cast<header_t*>(ptr - sizeof(header_t));
+  LIEF_UNPOISON(hdr, sizeof(header_t) + size);
+  hdr->size = size;
+  LIEF_POISON(hdr, sizeof(header_t));
+  LIEF_POISON(ptr + size, end - start - size);
+  arena.used = end;
+  arena.live.fetch_add(1, std::memory_order_relaxed);
+  return ptr;
+}
+
+bool release(void* ptr) {
+  if (ptr == nullptr || !owns(ptr)) {
+    return false;
+  }
+  arena_t& arena = get_arena();
+  auto* hdr = reinterpret_cast<header_t*>(static_cast<uint8_t*>(ptr) - sizeof(header_t));
+  LIEF_UNPOISON(hdr, sizeof(header_t));
+  const size_t size = hdr->size;
+  LIEF_POISON(hdr, sizeof(header_t) + size);
+  // The blocks below the floor are not accounted (see ~iteration_t)
+  if (static_cast<uint8_t*>(ptr) >= arena.base + arena.floor) {
+    arena.live.fetch_sub(1, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+void* allocate_or_throw(size_t size, size_t align) {
+  if (void* ptr = allocate(size, align)) {
+    return ptr;
+  }
+  void* ptr = nullptr;
+  if (align <= ALIGN) {
+    ptr = std::malloc(size != 0 ? size : 1);
+  } else if (posix_memalign(&ptr, align, size != 0 ? size : 1) != 0) {
+    ptr = nullptr;
+  }
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void deallocate(void* ptr) {
+  if (!release(ptr)) {
+    std::free(ptr);
+  }
+}
+}
+
+void init() {
+  logging::disable();
+  arena_t& arena = get_arena();
+  if (arena.base != nullptr) {
+    return;
+  }
+  void* base = mmap(nullptr, ARENA_SIZE, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (base == MAP_FAILED) {
+    return;
+  }
+  arena.base = static_cast<uint8_t*>(base);
+}
+
+iteration_t::iteration_t() {
+  ++get_arena().stats.iterations;
+  in_iteration = true;
+}
+
+iteration_t::~iteration_t() {
+  in_iteration = false;
+  arena_t& arena = get_arena();
+  const size_t used = arena.used - arena.floor;
+  if (used > arena.stats.high_water) {
+    arena.stats.high_water = used;
+  }
+  if (arena.live.load(std::memory_order_relaxed) == 0) {
+    LIEF_POISON(arena.base + arena.floor, used);
+    arena.used = arena.floor;
+    ++arena.stats.resets;
+    return;
+  }
+  // Some blocks outlive the iteration (e.g. the lazily-initialized static
+  // tables). They are pinned by moving the floor of the arena above them
+  // so that the next iterations can still be reset.
+  arena.floor = arena.used;
+  arena.stats.pinned = arena.floor;
+  arena.live.store(0, std::memory_order_relaxed);
+}
+
+void lookups(const Binary& bin) {
+  const uint64_t entrypoint = bin.entrypoint();
+  bin.get_content_from_virtual_address(entrypoint, 0x10);
+  bin.offset_to_virtual_address(0);
+  bin.imagebase();
+  bin.is_pie();
+  bin.has_nx();
+
+  for (const Section& section : bin.sections()) {
+    bin.offset_to_virtual_address(section.offset());
+    bin.get_content_from_virtual_address(section.virtual_address(), 0x10);
+  }
+
+  for (const Symbol& sym : bin.symbols()) {
+    bin.get_symbol(sym.name());
+  }
+
+  bin.imported_libraries();
+  bin.imported_functions();
+  bin.exported_functions();
+  bin.ctor_functions();
+}
+
+const arena_stats_t& arena_stats() {
+  return get_arena().stats;
+}
+
+}
+}
+
+// Replacements of the global allocation functions so that the containers
+// of LIEF (and the STL) use the arena. All the forms are replaced such as the
+// sanitizers' versions are not pulled in at link time.
+void* operator new(size_t size) {
+  return LIEF::fuzzing::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size) {
+  return LIEF::fuzzing::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return LIEF::fuzzing::allocate_or_throw(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return LIEF::fuzzing::allocate_or_throw(size, alignof(std::max_align_t));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+  return LIEF::fuzzing::allocate_or_throw(size, static_cast<size_t>(align));
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+  return LIEF::fuzzing::allocate_or_throw(size, static_cast<size_t>(align));
+}
+
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  try {
+    return LIEF::fuzzing::allocate_or_throw(size, static_cast<size_t>(align));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+  try {
+    return LIEF::fuzzing::allocate_or_throw(size, static_cast<size_t>(align));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* ptr) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+  LIEF::fuzzing::deallocate(ptr);
+}
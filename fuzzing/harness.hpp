@@ -0,0 +1,72 @@
+#ifndef LIEF_FUZZING_HARNESS_H
+#define LIEF_FUZZING_HARNESS_H
+#include <cstdint>
+#include <cstddef>
+
+namespace LIEF {
+class Binary;
+
+//! Helpers shared by the persistent harnesses (``*_persistent_fuzzer.cpp``)
+//!
+//! These harnesses are executed in-process, millions of times, so they avoid
+//! the per-iteration costs of the original fuzzers:
+//!
+//! - The input is parsed from a SpanStream over the fuzzer's buffer (no copy)
+//! - The logger is disabled once in ``LLVMFuzzerInitialize``
+//! - The allocations of an iteration are served by a bump arena which is
+//!   reset (instead of freed block by block) when the iteration ends.
+//!
+//! Since the arena does not go through ``malloc``, the leaks are not reported
+//! by LeakSanitizer: the original harnesses should be used for this purpose.
+namespace fuzzing {
+
+//! The builders are skipped for the inputs which would produce a larger
+//! output (e.g. a section at a huge offset) as the allocation would only
+//! be reported as an out-of-memory.
+static constexpr uint64_t MAX_BUILD_SIZE = 64llu << 20;
+
+struct arena_stats_t {
+  //! Number of iterations
+  uint64_t iterations = 0;
+
+  //! Number of iterations which ended with all their allocations released
+  //! (the arena has been reset)
+  uint64_t resets = 0;
+
+  //! Number of allocations that have been served by ``malloc`` because the
+  //! arena was full
+  uint64_t fallbacks = 0;
+
+  //! Largest number of bytes used by an iteration
+  uint64_t high_water = 0;
+
+  //! Number of bytes pinned by the blocks which outlived their iteration
+  uint64_t pinned = 0;
+};
+
+//! One-time setup of the harness. Must be called from ``LLVMFuzzerInitialize``
+void init();
+
+//! Scope of a fuzzing iteration: the allocations made by the current thread
+//! while this object is alive are served by the arena.
+//!
+//! It must be the first object of ``LLVMFuzzerTestOneInput`` such as all the
+//! other objects of the iteration are destroyed before the arena is reset.
+class iteration_t {
+  public:
+  iteration_t();
+  ~iteration_t();
+
+  iteration_t(const iteration_t&) = delete;
+  iteration_t& operator=(const iteration_t&) = delete;
+};
+
+//! Run the format-independent lookups of the abstract layer
+//! (sections, symbols, address translation, ...)
+void lookups(const Binary& bin);
+
+const arena_stats_t& arena_stats();
+
+}
+}
+#endif
@@ -0,0 +1,49 @@
+#include <LIEF/MachO.hpp>
+#include <LIEF/BinaryStream/SpanStream.hpp>
+#include <algorithm>
+#include <memory>
+
+#include "harness.hpp"
+
+using namespace LIEF;
+
+extern "C" int LLVMFuzzerInitialize(int* /*argc*/, char*** /*argv*/) {
+  fuzzing::init();
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  fuzzing::iteration_t iteration;
+  std::unique_ptr<MachO::FatBinary> fat =
+    MachO::Parser::parse(std::make_unique<SpanStream>(data, size));
+
+  if (fat == nullptr) {
+    return 0;
+  }
+
+  std::vector<uint8_t> raw;
+  for (MachO::Binary& bin : *fat) {
+    fuzzing::lookups(bin);
+    bin.get_section("__TEXT", "__text");
+    bin.get_segment("__LINKEDIT");
+    if (bin.has_main_command()) {
+      bin.main_command();
+    }
+
+    uint64_t build_size = 0;
+    for (const MachO::SegmentCommand& segment : bin.segments()) {
+      build_size = std::max(build_size, segment.file_offset() + segment.file_size());
+    }
+
+    if (build_size > fuzzing::MAX_BUILD_SIZE) {
+      continue;
+    }
+
+    // Round-trip: rebuild the binary and parse the output
+    raw.clear();
+    if (MachO::Builder::write(bin, raw)) {
+      MachO::Parser::parse(std::make_unique<SpanStream>(raw.data(), raw.size()));
+    }
+  }
+  return 0;
+}
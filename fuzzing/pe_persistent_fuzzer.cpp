@@ -0,0 +1,47 @@
+#include <LIEF/PE.hpp>
+#include <LIEF/BinaryStream/SpanStream.hpp>
+#include <algorithm>
+#include <memory>
+
+#include "harness.hpp"
+
+using namespace LIEF;
+
+extern "C" int LLVMFuzzerInitialize(int* /*argc*/, char*** /*argv*/) {
+  fuzzing::init();
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  fuzzing::iteration_t iteration;
+  std::unique_ptr<PE::Binary> pe =
+    PE::Parser::parse(std::make_unique<SpanStream>(data, size));
+
+  if (pe == nullptr) {
+    return 0;
+  }
+
+  fuzzing::lookups(*pe);
+  pe->get_section(".text");
+  pe->section_from_rva(pe->optional_header().addressof_entrypoint());
+  pe->rva_to_offset(pe->optional_header().addressof_entrypoint());
+  pe->get_import("KERNEL32.dll");
+  PE::get_imphash(*pe);
+
+  uint64_t build_size = 0;
+  for (const PE::Section& section : pe->sections()) {
+    build_size = std::max<uint64_t>(build_size,
+        static_cast<uint64_t>(section.pointerto_raw_data()) + section.sizeof_raw_data());
+  }
+
+  if (build_size > fuzzing::MAX_BUILD_SIZE) {
+    return 0;
+  }
+
+  // Round-trip: rebuild the binary and parse the output
+  PE::Builder builder(*pe);
+  builder.build();
+  const std::vector<uint8_t>& raw = builder.get_build();
+  PE::Parser::parse(std::make_unique<SpanStream>(raw.data(), raw.size()));
+  return 0;
+}
@@ -0,0 +1,127 @@
+// Standalone driver for the persistent harnesses which replays a corpus and
+// reports the number of executions per second. It is used by the fuzzing
+// jobs to catch the regressions in the parsers' throughput:
+//
+//   $ elf_persistent_fuzzer_bench -runs=20 -min_exec_s=500 corpus/elf
+//
+// The output uses the same ``stat::`` format as libFuzzer's
+// ``-print_final_stats=1``. The driver exits with 1 if the throughput is
+// below ``-min_exec_s``.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "harness.hpp"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv);
+
+namespace fs = std::filesystem;
+using clock_type = std::chrono::steady_clock;
+
+struct input_t {
+  std::string path;
+  std::vector<uint8_t> data;
+  clock_type::duration elapsed{};
+};
+
+static void usage(const char* name) {
+  fprintf(stderr, "Usage: %s [-runs=N] [-min_exec_s=N] <file|dir>...\n", name);
+}
+
+static bool load(const fs::path& path, std::vector<input_t>& inputs) {
+  std::error_code ec;
+  if (fs::is_directory(path, ec)) {
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(path, ec)) {
+      if (entry.is_regular_file(ec)) {
+        load(entry.path(), inputs);
+      }
+    }
+    return !ec;
+  }
+
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) {
+    fprintf(stderr, "Can't open %s\n", path.c_str());
+    return false;
+  }
+  input_t input;
+  input.path = path.string();
+  input.data = {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+  inputs.push_back(std::move(input));
+  return true;
+}
+
+int main(int argc, char** argv) {
+  uint64_t runs = 10;
+  double min_exec_s = 0.;
+  std::vector<input_t> inputs;
+
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+    if (strncmp(arg, "-runs=", 6) == 0) {
+      runs = strtoull(arg + 6, nullptr, 10);
+    } else if (strncmp(arg, "-min_exec_s=", 12) == 0) {
+      min_exec_s = strtod(arg + 12, nullptr);
+    } else if (arg[0] == '-') {
+      usage(argv[0]);
+      return 1;
+    } else if (!load(arg, inputs)) {
+      return 1;
+    }
+  }
+
+  if (inputs.empty() || runs == 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  LLVMFuzzerInitialize(&argc, &argv);
+
+  uint64_t nb_bytes = 0;
+  for (const input_t& input : inputs) {
+    nb_bytes += input.data.size();
+  }
+
+  const clock_type::time_point start = clock_type::now();
+  for (uint64_t run = 0; run < runs; ++run) {
+    for (input_t& input : inputs) {
+      const clock_type::time_point begin = clock_type::now();
+      LLVMFuzzerTestOneInput(input.data.data(), input.data.size());
+      input.elapsed += clock_type::now() - begin;
+    }
+  }
+  const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+  const uint64_t execs = runs * inputs.size();
+  const double exec_s = execs / elapsed.count();
+  const input_t& slowest = *std::max_element(inputs.begin(), inputs.end(),
+      [] (const input_t& lhs, const input_t& rhs) { return lhs.elapsed < rhs.elapsed; });
+  const LIEF::fuzzing::arena_stats_t& arena = LIEF::fuzzing::arena_stats();
+
+  printf("stat::number_of_executed_units: %llu\n", (unsigned long long)execs);
+  printf("stat::average_exec_per_sec:     %.0f\n", exec_s);
+  printf("stat::average_mb_per_sec:       %.2f\n", (runs * nb_bytes) / elapsed.count() / (1 << 20));
+  printf("stat::slowest_unit_ms:          %.3f (%s)\n",
+         std::chrono::duration<double, std::milli>(slowest.elapsed).count() / runs,
+         slowest.path.c_str());
+  printf("stat::arena_resets:             %llu/%llu\n",
+         (unsigned long long)arena.resets, (unsigned long long)arena.iterations);
+  printf("stat::arena_fallbacks:          %llu\n", (unsigned long long)arena.fallbacks);
+  printf("stat::arena_high_water_mb:      %.2f\n", arena.high_water / double(1 << 20));
+  printf("stat::arena_pinned_kb:          %.2f\n", arena.pinned / double(1 << 10));
+
+  if (exec_s < min_exec_s) {
+    fprintf(stderr, "Throughput regression: %.0f exec/s < %.0f exec/s\n", exec_s, min_exec_s);
+    return 1;
+  }
+  return 0;
+}
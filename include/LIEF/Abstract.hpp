@@ -24,5 +24,9 @@
 #include <LIEF/Abstract/Function.hpp>
 #include <LIEF/Abstract/Symbol.hpp>
 #include <LIEF/Abstract/Section.hpp>
+#include <LIEF/Abstract/ExportIndex.hpp>
+#include <LIEF/Abstract/Fingerprint.hpp>
+#include <LIEF/Abstract/QuickScan.hpp>
+#include <LIEF/Abstract/Columns.hpp>
 
 #endif
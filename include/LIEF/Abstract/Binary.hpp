@@ -16,6 +16,7 @@
 #ifndef LIEF_ABSTRACT_BINARY_H
 #define LIEF_ABSTRACT_BINARY_H
 
+#include <functional>
 #include <vector>
 
 #include "LIEF/types.hpp"
@@ -144,6 +145,39 @@ class LIEF_API Binary : public Object {
 
   std::vector<uint64_t> xref(uint64_t address) const;
 
+  //! @name Parallel section helpers
+  //!
+  //! These functions process the sections concurrently (the largest ones
+  //! first) with the hardware threads available. The results are
+  //! deterministic: they are ordered as the sections (Binary::sections)
+  //! regardless of the order in which the sections have been processed.
+  //! Small binaries are processed by the calling thread.
+  //! @{
+
+  //! Call ``fn(idx, section)`` for each section where ``idx`` is the index
+  //! of the section in Binary::sections.
+  //!
+  //! ``fn`` is called concurrently from different threads: it must be
+  //! thread-safe and it must not throw. The binary must not be modified
+  //! while this function is running.
+  void for_each_section_parallel(const std::function<void(size_t, const Section&)>& fn) const;
+
+  //! Same as xref() but the sections are scanned concurrently
+  std::vector<uint64_t> xref_parallel(uint64_t address) const;
+
+  //! Return the virtual addresses of all the occurrences of ``pattern`` in
+  //! the sections' content. The addresses are ordered by section and then
+  //! by offset within the section.
+  std::vector<uint64_t> search_all_parallel(const std::string& pattern) const;
+
+  //! Section::entropy of each section
+  std::vector<double> sections_entropy_parallel() const;
+
+  //! LIEF::hash of each section
+  std::vector<size_t> sections_hash_parallel() const;
+
+  //! @}
+
   //! Patch the content at virtual address @p address with @p patch_value
   //!
   //! @param[in] address        Address to patch
@@ -0,0 +1,123 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_COLUMNS_H
+#define LIEF_ABSTRACT_COLUMNS_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+class Binary;
+
+//! Column of strings stored in a single buffer.
+//!
+//! The i-th string is ``data[offsets[i], offsets[i + 1])``: ``offsets`` has
+//! size() + 1 entries and the strings are not null-terminated. This is the
+//! layout of the Apache Arrow ``large_utf8`` type so that the buffers can be
+//! used as-is by Arrow-based tools.
+struct LIEF_API string_column_t {
+  std::vector<uint64_t> offsets = {0};
+  std::string data;
+
+  //! Number of strings in the column
+  size_t size() const {
+    return offsets.size() - 1;
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  //! Return the i-th string or an empty string if ``i`` is out of range
+  std::string get(size_t i) const;
+
+  void push_back(const std::string& str) {
+    data += str;
+    offsets.push_back(data.size());
+  }
+
+  //! Reserve ``count`` strings with a total size of ``nb_bytes``
+  void reserve(size_t count, size_t nb_bytes) {
+    offsets.reserve(count + 1);
+    data.reserve(nb_bytes);
+  }
+};
+
+//! Symbols of a binary exported as a struct of arrays.
+//!
+//! The i-th symbol is described by the i-th element of each array which is
+//! filled from the format-specific symbol table:
+//!
+//! | Column              | ELF (Binary::symbols) | PE (COFF symbols)    | Mach-O     |
+//! |---------------------|-----------------------|----------------------|------------|
+//! | ``types``           | ELF_SYMBOL_TYPES      | Symbol::type()       | ``n_type`` |
+//! | ``bindings``        | SYMBOL_BINDINGS       | SYMBOL_STORAGE_CLASS | ``n_desc`` |
+//! | ``section_indexes`` | ``st_shndx``          | ``SectionNumber``    | ``n_sect`` |
+//!
+//! For ELF, the dynamic symbols come first followed by the static symbols
+//! (as in ELF::Binary::symbols).
+//!
+//! Compared to iterating over the symbols, SymbolColumns::extract fills all
+//! the columns in one call with a single allocation per column which makes it
+//! suitable for bulk processing (e.g. with numpy).
+struct LIEF_API SymbolColumns {
+  string_column_t names;
+  std::vector<uint64_t> values;
+  std::vector<uint64_t> sizes;
+  std::vector<uint32_t> types;
+  std::vector<uint32_t> bindings;
+  std::vector<int32_t>  section_indexes;
+
+  //! Number of symbols
+  size_t size() const {
+    return values.size();
+  }
+
+  //! Export the symbols of the given binary
+  static SymbolColumns extract(const Binary& binary);
+};
+
+//! Relocations of a binary exported as a struct of arrays.
+//!
+//! The i-th relocation is described by the i-th element of each array:
+//!
+//! - ``types``: ELF::Relocation::type, PE::RELOCATIONS_BASE_TYPES or
+//!   MachO::Relocation::type
+//! - ``sizes``: size of the relocated value in **bits**
+//! - ``addends``: explicit addend (ELF only, 0 otherwise)
+//! - ``symbols``: name of the associated symbol or an empty string
+//!
+//! The PE relocations are flattened: each PE::RelocationEntry is a row.
+struct LIEF_API RelocationColumns {
+  std::vector<uint64_t> addresses;
+  std::vector<uint32_t> types;
+  std::vector<uint32_t> sizes;
+  std::vector<int64_t>  addends;
+  string_column_t symbols;
+
+  //! Number of relocations
+  size_t size() const {
+    return addresses.size();
+  }
+
+  //! Export the relocations of the given binary
+  static RelocationColumns extract(const Binary& binary);
+};
+
+}
+#endif
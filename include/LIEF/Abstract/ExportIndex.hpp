@@ -0,0 +1,178 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_EXPORT_INDEX_H
+#define LIEF_ABSTRACT_EXPORT_INDEX_H
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+
+namespace LIEF {
+class Binary;
+
+namespace details {
+struct library_exports_t;
+}
+
+//! Index of the symbols exported by a set of libraries (ELF, PE, Mach-O)
+//! which can be used to resolve the imports of many binaries.
+//!
+//! The index only keeps the information needed to answer
+//! *"which library provides this symbol?"*: the names are stored in a
+//! single string pool and the entries are sorted by name so that a lookup
+//! is a binary search.
+//!
+//! - ELF: the exported dynamic symbols (with their version) of the library
+//!   identified by its ``DT_SONAME``.
+//! - PE: the export table (including the forwarded entries) of the DLL
+//!   identified by its export name.
+//! - Mach-O: the exports trie (including the re-exports) of the dylib
+//!   identified by its ``LC_ID_DYLIB`` command.
+//!
+//! The index can be saved on the disk with ExportIndex::save() and reloaded
+//! with ExportIndex::load().
+//!
+//! The entries are sorted when they are added, so the const functions
+//! (find(), resolve(), ...) don't modify the index and can be called
+//! concurrently.
+class LIEF_API ExportIndex {
+  public:
+  //! Library which exports a given symbol
+  struct LIEF_API provider_t {
+    //! Name of the library (``DT_SONAME``, DLL name, install name, ...)
+    std::string library;
+
+    //! Version of the symbol (ELF only)
+    std::string version;
+
+    //! Address of the exported symbol (RVA for PE)
+    uint64_t address = 0;
+
+    //! Ordinal of the export (PE only)
+    uint32_t ordinal = 0;
+
+    //! Library and symbol's name targeted by a PE forwarded export or a
+    //! Mach-O re-export. These attributes are empty for a regular export.
+    std::string forward_library;
+    std::string forward_name;
+
+    bool is_forwarded() const {
+      return !forward_library.empty();
+    }
+  };
+
+  //! Import resolved by ExportIndex::resolve()
+  struct LIEF_API import_t {
+    //! Name of the imported symbol (PE imports by ordinal are resolved
+    //! with PE::resolve_ordinals() when possible)
+    std::string name;
+
+    //! Library from which the symbol is imported (empty for ELF)
+    std::string library;
+
+    //! Libraries that provide the symbol. The forwarders are followed
+    //! so that the providers are the final ones.
+    std::vector<provider_t> providers;
+  };
+
+  ExportIndex();
+  ExportIndex(const ExportIndex&);
+  ExportIndex& operator=(const ExportIndex&);
+  ExportIndex(ExportIndex&&);
+  ExportIndex& operator=(ExportIndex&&);
+  ~ExportIndex();
+
+  //! Add the exports of the given binary. If ``library`` is empty, the name
+  //! of the library is determined from the binary (``DT_SONAME``, ...).
+  //!
+  //! It returns false if the format of the binary is not supported, if
+  //! the name of the library can't be determined or if the index is full
+  //! (the string pool is limited to 4GB).
+  bool add(const Binary& binary, const std::string& library = "");
+
+  //! Parse the given files in parallel and add their exports. If the name of
+  //! a library can't be determined from the binary, the filename is used.
+  //!
+  //! It returns the number of files that have been added.
+  size_t add(const std::vector<std::string>& files);
+
+  //! Return the libraries that export the given symbol
+  std::vector<provider_t> find(const std::string& name) const;
+
+  //! Return the export associated with the given ordinal in the given
+  //! library (PE only, the library name is case-insensitive)
+  std::vector<provider_t> find(const std::string& library, uint32_t ordinal) const;
+
+  //! Resolve all the imports of the given binary against the index
+  std::vector<import_t> resolve(const Binary& binary) const;
+
+  //! Names of the libraries present in the index
+  const std::vector<std::string>& libraries() const {
+    return libraries_;
+  }
+
+  //! Number of exports in the index
+  size_t size() const;
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  //! Serialize the index in the given file
+  ok_error_t save(const std::string& path) const;
+
+  //! Load an index previously serialized with save()
+  static std::unique_ptr<ExportIndex> load(const std::string& path);
+
+  private:
+  struct entry_t {
+    uint32_t name            = 0; // Offset in strings_
+    uint32_t library         = 0; // Index in libraries_
+    uint32_t version         = 0; // Offset in strings_
+    uint32_t forward_library = 0; // Offset in strings_
+    uint32_t forward_name    = 0; // Offset in strings_
+    uint32_t ordinal         = 0;
+    uint64_t address         = 0;
+  };
+
+  ok_error_t insert(const details::library_exports_t& exports);
+  result<uint32_t> add_string(const std::string& str);
+  const char* string(uint32_t offset) const;
+  void sort(size_t begin);
+  void index_ordinals();
+  provider_t to_provider(const entry_t& entry) const;
+  void resolve_forward(const provider_t& provider, std::vector<provider_t>& out,
+                       size_t depth) const;
+
+  std::vector<std::string> libraries_;
+  std::string strings_;
+  std::vector<entry_t> entries_; // Sorted by name
+
+  // String -> offset in strings_ (each string is stored once)
+  std::unordered_map<std::string, uint32_t> strings_map_;
+
+  // Entries (indexes in entries_) sorted by (library, ordinal) and the
+  // normalized name of the libraries used as key (see: find(library, ordinal))
+  std::vector<uint32_t> ordinals_;
+  std::vector<std::string> library_keys_;
+};
+
+}
+#endif
@@ -0,0 +1,167 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_FINGERPRINT_H
+#define LIEF_ABSTRACT_FINGERPRINT_H
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+class Binary;
+
+//! Digests and entropy of a binary computed in a single pass over its raw
+//! content.
+//!
+//! Instead of hashing the file, each section and the authenticode ranges
+//! separately (hashstream, Section::entropy(), ...), Fingerprint::compute
+//! reads the raw bytes once, block by block, and feeds each block to all the
+//! hash contexts that cover it. Each algorithm (MD5, SHA-1, SHA-256 and the
+//! byte histogram) is a *lane* processed by its own thread.
+//!
+//! The binary is only used for the layout (sections, segments, certificate
+//! table) and for the imphash: the digests are computed on the raw bytes
+//! given to compute() which must be the content the binary was parsed from.
+//!
+//! \code{.cpp}
+//! std::vector<uint8_t> raw = ...;
+//! std::unique_ptr<PE::Binary> pe = PE::Parser::parse(raw);
+//! Fingerprint fp = Fingerprint::compute(*pe, raw);
+//! std::cout << hex_dump(fp.file().sha256) << '\n';
+//! \endcode
+class LIEF_API Fingerprint {
+  public:
+  //! Digests that are enabled through config_t
+  struct LIEF_API digests_t {
+    std::array<uint8_t, 16> md5    = {};
+    std::array<uint8_t, 20> sha1   = {};
+    std::array<uint8_t, 32> sha256 = {};
+  };
+
+  //! Range of the file (section or segment)
+  struct LIEF_API range_t {
+    std::string name;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    digests_t digests;
+    //! Shannon entropy of the range (same as Section::entropy)
+    double entropy = 0.;
+  };
+
+  //! Select the values computed by Fingerprint::compute
+  struct LIEF_API config_t {
+    bool md5    = true;
+    bool sha1   = true;
+    bool sha256 = true;
+
+    //! Compute the digests and the entropy of each section
+    bool sections = true;
+
+    //! Compute the digests and the entropy of each segment (ELF, Mach-O)
+    bool segments = false;
+
+    //! Compute the entropy of the file and of the sections/segments
+    bool entropy = true;
+
+    //! Compute the PE imphash (PE::get_imphash)
+    bool imphash = true;
+
+    //! Compute the PE authentihash with the selected algorithms
+    bool authentihash = true;
+  };
+
+  //! Compute the fingerprint of ``binary`` from its raw content
+  static Fingerprint compute(const Binary& binary, span<const uint8_t> raw,
+                             const config_t& config);
+
+  static Fingerprint compute(const Binary& binary, span<const uint8_t> raw) {
+    return compute(binary, raw, config_t());
+  }
+
+  //! Compute the fingerprint of ``binary`` which has been parsed from
+  //! the file located at ``path``
+  static result<Fingerprint> compute(const Binary& binary, const std::string& path,
+                                     const config_t& config);
+
+  static result<Fingerprint> compute(const Binary& binary, const std::string& path) {
+    return compute(binary, path, config_t());
+  }
+
+  Fingerprint() = default;
+  Fingerprint(const Fingerprint&) = default;
+  Fingerprint& operator=(const Fingerprint&) = default;
+  Fingerprint(Fingerprint&&) = default;
+  Fingerprint& operator=(Fingerprint&&) = default;
+  ~Fingerprint() = default;
+
+  //! Digests of the whole file
+  const digests_t& file() const {
+    return file_;
+  }
+
+  //! Size of the file
+  uint64_t size() const {
+    return size_;
+  }
+
+  //! Shannon entropy of the whole file
+  double entropy() const {
+    return entropy_;
+  }
+
+  //! Digests of the sections (in the order of Binary::sections)
+  const std::vector<range_t>& sections() const {
+    return sections_;
+  }
+
+  //! Digests of the segments (ELF, Mach-O)
+  const std::vector<range_t>& segments() const {
+    return segments_;
+  }
+
+  //! PE imphash or an empty string
+  const std::string& imphash() const {
+    return imphash_;
+  }
+
+  //! PE authentihash computed on the raw bytes (i.e. the file without the
+  //! checksum, the certificate table entry and the certificate table)
+  const digests_t& authentihash() const {
+    return authentihash_;
+  }
+
+  //! Whether the authentihash has been computed (PE only)
+  bool has_authentihash() const {
+    return has_authentihash_;
+  }
+
+  private:
+  digests_t file_;
+  uint64_t size_ = 0;
+  double entropy_ = 0.;
+  std::vector<range_t> sections_;
+  std::vector<range_t> segments_;
+  std::string imphash_;
+  digests_t authentihash_;
+  bool has_authentihash_ = false;
+};
+
+}
+#endif
@@ -0,0 +1,91 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ABSTRACT_QUICK_SCAN_H
+#define LIEF_ABSTRACT_QUICK_SCAN_H
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+#include "LIEF/Abstract/enums.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+//! Summary of a binary returned by LIEF::quick_scan
+//!
+//! The values are consistent with the ones of the LIEF::Binary that would be
+//! returned by LIEF::Parser::parse (e.g. QuickSummary::entrypoint is
+//! Binary::entrypoint) except for the number of sections and segments which
+//! are read from the headers.
+struct LIEF_API QuickSummary {
+  EXE_FORMATS format = EXE_FORMATS::FORMAT_UNKNOWN;
+
+  ARCHITECTURES architecture = ARCHITECTURES::ARCH_NONE;
+  std::set<MODES> modes;
+  ENDIANNESS endianness = ENDIANNESS::ENDIAN_NONE;
+  OBJECT_TYPES object_type = OBJECT_TYPES::TYPE_NONE;
+
+  bool is_64 = false;
+
+  //! Absolute address of the entrypoint
+  uint64_t entrypoint = 0;
+  uint64_t imagebase = 0;
+
+  bool is_pie = false;
+  bool has_nx = false;
+
+  //! Number of sections as defined in the header(s)
+  //! (``e_shnum``, ``NumberOfSections``, sum of the segments' ``nsects``)
+  uint64_t nb_sections = 0;
+
+  //! Number of segments (``e_phnum``, number of ``LC_SEGMENT/LC_SEGMENT_64``).
+  //! Always 0 for PE.
+  uint64_t nb_segments = 0;
+
+  //! Libraries imported by the binary (see: Binary::imported_libraries)
+  std::vector<std::string> imported_libraries;
+
+  //! PE imphash (IMPHASH_MODE::DEFAULT) or an empty string
+  std::string imphash;
+
+  //! ELF ``NT_GNU_BUILD_ID`` or Mach-O ``LC_UUID``. Empty if the binary
+  //! does not have one.
+  std::vector<uint8_t> build_id;
+};
+
+//! Summarize the binary wrapped by the given stream without parsing it.
+//!
+//! This function only reads the headers, the section/segment tables and the
+//! import (or dynamic) tables directly from the stream. It does not create
+//! a LIEF::Binary and it is therefore much faster than LIEF::Parser::parse
+//! when only an overview of the binary is needed (e.g. for triage).
+//!
+//! For a Mach-O FAT binary, the last slice is summarized
+//! (as in LIEF::Parser::parse).
+LIEF_API result<QuickSummary> quick_scan(BinaryStream& stream);
+
+//! Summarize the binary located at ``path``
+LIEF_API result<QuickSummary> quick_scan(const std::string& path);
+
+//! Summarize the binary from its raw content
+LIEF_API result<QuickSummary> quick_scan(span<const uint8_t> raw);
+
+}
+#endif
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
 
 struct mbedtls_x509_crt;
 struct mbedtls_x509_time;
@@ -52,12 +53,18 @@ class ASN1Reader {
   result<int64_t> read_int64();
   result<std::vector<uint8_t>> read_large_int();
 
-  result<std::vector<uint8_t>> read_bitstring();
-  result<std::vector<uint8_t>> read_octet_string();
+  // The spans returned by the following functions reference the stream's
+  // buffer: they are valid as long as this buffer is alive.
+  result<span<const uint8_t>> read_bitstring();
+  result<span<const uint8_t>> read_octet_string();
   result<std::string> read_utf8_string();
-  result<std::unique_ptr<mbedtls_x509_crt>> read_cert();
+
+  //! Parse the x509 certificate at the current position. If ``copy`` is false,
+  //! the certificate references the DER blob in the stream's buffer
+  //! (which must outlive the certificate)
+  result<std::unique_ptr<mbedtls_x509_crt>> read_cert(bool copy = true);
   result<std::string> x509_read_names();
-  result<std::vector<uint8_t>> x509_read_serial();
+  result<span<const uint8_t>> x509_read_serial();
   result<std::unique_ptr<mbedtls_x509_time>> x509_read_time();
 
   std::string get_str_tag();
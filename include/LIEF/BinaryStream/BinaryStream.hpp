@@ -26,14 +26,22 @@
 
 #include "LIEF/BinaryStream/Convert.hpp"
 #include "LIEF/errors.hpp"
+#include "LIEF/SharedContent.hpp"
 
 namespace LIEF {
 class ASN1Reader;
+class StreamCursor;
 
 //! Class that is used to a read stream of data from different sources
+//!
+//! The stream keeps a (mutable) position which is updated by the ``read_xxx``
+//! functions. The functions that take an explicit offset (``peek<T>(offset)``,
+//! ``peek_string_at()``, ...) do not modify this position. To read a stream
+//! from several threads, one should use a StreamCursor per thread.
 class BinaryStream {
   public:
   friend class ASN1Reader;
+  friend class StreamCursor;
   enum class STREAM_TYPE {
     UNKNOWN = 0,
     VECTOR,
@@ -94,6 +102,19 @@ class BinaryStream {
     return make_error_code(lief_errors::read_error);
   }
 
+  //! Same as peek_data() but, if the stream owns a refcounted buffer, the
+  //! content references this buffer (copy-on-write) instead of copying it.
+  virtual ok_error_t peek_shared_data(SharedContent& content,
+                                      uint64_t offset, uint64_t size)
+  {
+    std::vector<uint8_t> data;
+    if (!peek_data(data, offset, size)) {
+      return make_error_code(lief_errors::read_error);
+    }
+    content.assign(std::move(data));
+    return ok();
+  }
+
   virtual ok_error_t read_data(std::vector<uint8_t>& container, uint64_t size) {
     if (!peek_data(container, pos(), size)) {
       return make_error_code(lief_errors::read_error);
@@ -198,7 +219,32 @@ class BinaryStream {
     return nullptr;
   }
 
+  //! Return a pointer to the beginning of the stream if its content is
+  //! stored in a contiguous area of memory such as ``start() + offset``
+  //! is the data at the offset ``offset``. Otherwise, it returns a nullptr.
+  //!
+  //! This is used for the fast paths of read_string(), read_uleb128(), ...
+  virtual const uint8_t* contiguous_start() const {
+    return start();
+  }
+
   protected:
+  template<class T>
+  static void swap_conv(T& value, std::true_type /* is_integral */) {
+    value = swap_endian<T>(value);
+  }
+
+  template<class T>
+  static void swap_conv(T& value, std::false_type /* is_integral */) {
+    LIEF::Convert::swap_endian<T>(&value);
+  }
+
+  //! Decode the LEB128 located at the given offset without changing the
+  //! position of the stream. On success, ``size`` is set to the number of
+  //! bytes used by the encoding.
+  result<uint64_t> peek_uleb128_at(size_t offset, size_t& size) const;
+  result<uint64_t> peek_sleb128_at(size_t offset, size_t& size) const;
+
   virtual result<const void*> read_at(uint64_t offset, uint64_t size) const = 0;
   virtual ok_error_t peek_in(void* dst, uint64_t offset, uint64_t size) const {
     if (auto raw = read_at(offset, size)) {
@@ -276,45 +322,33 @@ result<T> BinaryStream::read() const {
 
 template<class T>
 result<T> BinaryStream::peek() const {
-  const auto current_p = pos();
+  return peek<T>(pos());
+}
+
+template<class T>
+result<T> BinaryStream::peek(size_t offset) const {
   T ret{};
-  if (auto res = peek_in(&ret, pos(), sizeof(T))) {
-    setpos(current_p);
+  if (auto res = peek_in(&ret, offset, sizeof(T))) {
     return ret;
   }
-
-  setpos(current_p);
   return make_error_code(lief_errors::read_error);
 }
 
+
 template<class T>
-result<T> BinaryStream::peek(size_t offset) const {
-  const size_t saved_offset = this->pos();
-  this->setpos(offset);
-  result<T> r = this->peek<T>();
-  this->setpos(saved_offset);
-  return r;
+const T* BinaryStream::peek_array(size_t size) const {
+  return peek_array<T>(pos(), size);
 }
 
-
 template<class T>
-const T* BinaryStream::peek_array(size_t size) const {
-  result<const void*> raw = this->read_at(this->pos(), sizeof(T) * size);
+const T* BinaryStream::peek_array(size_t offset, size_t size) const {
+  result<const void*> raw = this->read_at(offset, sizeof(T) * size);
   if (!raw) {
     return nullptr;
   }
   return reinterpret_cast<const T*>(raw.value());
 }
 
-template<class T>
-const T* BinaryStream::peek_array(size_t offset, size_t size) const {
-  const size_t saved_offset = this->pos();
-  this->setpos(offset);
-  const T* r = this->peek_array<T>(size);
-  this->setpos(saved_offset);
-  return r;
-}
-
 
 template<typename T>
 bool BinaryStream::can_read() const {
@@ -353,20 +387,22 @@ result<T> BinaryStream::read_conv() const {
 template<class T>
 typename std::enable_if<std::is_integral<T>::value, result<T>>::type
 BinaryStream::peek_conv() const {
-  T ret;
-  if (auto res = peek_in(&ret, pos(), sizeof(T))) {
-    return endian_swap_ ? swap_endian<T>(ret) : ret;
-  }
-  return make_error_code(lief_errors::read_error);
+  return peek_conv<T>(pos());
 }
 
 template<class T>
 typename std::enable_if<!std::is_integral<T>::value, result<T>>::type
 BinaryStream::peek_conv() const {
+  return peek_conv<T>(pos());
+}
+
+
+template<class T>
+result<T> BinaryStream::peek_conv(size_t offset) const {
   T ret;
-  if (auto res = peek_in(&ret, pos(), sizeof(T))) {
+  if (auto res = peek_in(&ret, offset, sizeof(T))) {
     if (endian_swap_) {
-      LIEF::Convert::swap_endian<T>(&ret);
+      swap_conv(ret, std::is_integral<T>{});
     }
     return ret;
   }
@@ -374,16 +410,6 @@ BinaryStream::peek_conv() const {
 }
 
 
-template<class T>
-result<T> BinaryStream::peek_conv(size_t offset) const {
-  const size_t saved_offset = this->pos();
-  this->setpos(offset);
-  result<T> r = this->peek_conv<T>();
-  this->setpos(saved_offset);
-  return r;
-}
-
-
 template<typename T>
 std::unique_ptr<T[]> BinaryStream::read_conv_array(size_t size) const {
   const T *t = this->read_array<T>(size);
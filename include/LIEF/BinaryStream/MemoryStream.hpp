@@ -55,6 +55,12 @@ class MemoryStream : public BinaryStream {
     return start() + size_;
   }
 
+  const uint8_t* contiguous_start() const override {
+    // When a binary is associated with the stream, the offsets are translated
+    // into virtual addresses
+    return binary_ == nullptr ? start() : nullptr;
+  }
+
   void binary(Binary& bin) {
     this->binary_ = &bin;
   }
@@ -0,0 +1,145 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_STREAM_CURSOR_H
+#define LIEF_STREAM_CURSOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+
+namespace LIEF {
+
+//! Lightweight reader over a BinaryStream which owns its position.
+//!
+//! Contrary to BinaryStream::read() or BinaryStream::setpos(), a cursor never
+//! modifies the underlying stream. Therefore, several cursors can read the
+//! same stream concurrently (one cursor per thread) as long as the stream
+//! does not change and its data accessors are stateless. This is the case
+//! for VectorStream, SpanStream and MemoryStream but **not** for FileStream
+//! which reads through a std::ifstream.
+//!
+//! The semantic of the functions is the same as their BinaryStream's
+//! counterparts.
+class StreamCursor {
+  public:
+  StreamCursor(const BinaryStream& stream, uint64_t pos = 0) :
+    stream_(&stream),
+    pos_(pos)
+  {}
+
+  const BinaryStream& stream() const {
+    return *stream_;
+  }
+
+  uint64_t size() const {
+    return stream_->size();
+  }
+
+  uint64_t pos() const {
+    return pos_;
+  }
+
+  void setpos(uint64_t pos) {
+    pos_ = pos;
+  }
+
+  void increment_pos(uint64_t value) {
+    pos_ += value;
+  }
+
+  operator bool() const {
+    return pos_ < stream_->size();
+  }
+
+  template<class T>
+  result<T> peek() const {
+    return stream_->peek<T>(pos_);
+  }
+
+  template<class T>
+  result<T> peek(uint64_t offset) const {
+    return stream_->peek<T>(offset);
+  }
+
+  template<class T>
+  result<T> read() {
+    result<T> value = peek<T>();
+    if (value) {
+      pos_ += sizeof(T);
+    }
+    return value;
+  }
+
+  template<class T>
+  result<T> peek_conv() const {
+    return stream_->peek_conv<T>(pos_);
+  }
+
+  template<class T>
+  result<T> read_conv() {
+    result<T> value = peek_conv<T>();
+    if (value) {
+      pos_ += sizeof(T);
+    }
+    return value;
+  }
+
+  template<class T>
+  const T* peek_array(size_t size) const {
+    return stream_->peek_array<T>(pos_, size);
+  }
+
+  template<class T>
+  const T* read_array(size_t size) {
+    const T* array = peek_array<T>(size);
+    pos_ += sizeof(T) * size;
+    return array;
+  }
+
+  ok_error_t peek_data(std::vector<uint8_t>& container, uint64_t size) const {
+    return peek_data(container, pos_, size);
+  }
+
+  ok_error_t peek_data(std::vector<uint8_t>& container,
+                       uint64_t offset, uint64_t size) const;
+
+  ok_error_t read_data(std::vector<uint8_t>& container, uint64_t size);
+
+  result<std::string> peek_string(size_t maxsize = ~static_cast<size_t>(0)) const {
+    return stream_->peek_string_at(pos_, maxsize);
+  }
+
+  result<std::string> read_string(size_t maxsize = ~static_cast<size_t>(0));
+
+  result<std::u16string> peek_u16string(size_t length) const {
+    return stream_->peek_u16string_at(pos_, length);
+  }
+
+  result<std::u16string> read_u16string(size_t length);
+
+  result<uint64_t> read_uleb128();
+  result<uint64_t> read_sleb128();
+
+  private:
+  const BinaryStream* stream_ = nullptr;
+  uint64_t pos_ = 0;
+};
+
+}
+#endif
@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 
 #include "LIEF/errors.hpp"
 #include "LIEF/BinaryStream/BinaryStream.hpp"
@@ -46,28 +47,37 @@ class VectorStream : public BinaryStream {
 
   const std::vector<uint8_t>& content() const;
 
+  //! Move the underlying buffer out of the stream. The buffer is copied if
+  //! it is still referenced by a SharedContent
   std::vector<uint8_t>&& move_content() {
     size_ = 0;
-    return std::move(binary_);
+    if (binary_.use_count() > 1) {
+      binary_ = std::make_shared<std::vector<uint8_t>>(*binary_);
+    }
+    return std::move(*binary_);
   }
 
+  //! Content which shares the stream's buffer instead of copying it
+  ok_error_t peek_shared_data(SharedContent& content,
+                              uint64_t offset, uint64_t size) override;
+
   const uint8_t* p() const override {
-    return this->binary_.data() + this->pos();
+    return this->binary_->data() + this->pos();
   }
 
   const uint8_t* start() const override {
-    return this->binary_.data();
+    return this->binary_->data();
   }
 
   const uint8_t* end() const override {
-    return this->binary_.data() + this->binary_.size();
+    return this->binary_->data() + this->binary_->size();
   }
 
   static bool classof(const BinaryStream& stream);
 
   protected:
   result<const void*> read_at(uint64_t offset, uint64_t size) const override;
-  std::vector<uint8_t> binary_;
+  std::shared_ptr<std::vector<uint8_t>> binary_;
   uint64_t size_ = 0; // Original size without alignment
 };
 }
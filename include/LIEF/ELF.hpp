@@ -28,6 +28,7 @@
 #include "LIEF/ELF/Binary.hpp"
 #include "LIEF/ELF/Segment.hpp"
 #include "LIEF/ELF/Builder.hpp"
+#include "LIEF/ELF/Loader.hpp"
 #include "LIEF/ELF/EnumToString.hpp"
 #include "LIEF/ELF/Relocation.hpp"
 #include "LIEF/ELF/DynamicEntryArray.hpp"
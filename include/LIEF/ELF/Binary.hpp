@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include "LIEF/visibility.h"
 #include "LIEF/errors.hpp"
@@ -53,6 +54,10 @@ class DynamicEntryLibrary;
 class SysvHash;
 struct sizing_info_t;
 
+namespace details {
+class ModificationCounter;
+}
+
 //! Class which represents an ELF binary
 class LIEF_API Binary : public LIEF::Binary {
   friend class Parser;
@@ -221,6 +226,31 @@ class LIEF_API Binary : public LIEF::Binary {
     SEGMENT_GAP,
   };
 
+  //! Saved state of a binary created by Binary::snapshot() and used by
+  //! Binary::restore()
+  class LIEF_API Snapshot {
+    public:
+    Snapshot(Snapshot&&) noexcept;
+    Snapshot& operator=(Snapshot&&) noexcept;
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    ~Snapshot();
+
+    //! Create a new binary in the saved state. Contrary to Binary::restore(),
+    //! the objects of the binary from which the snapshot has been created
+    //! are not affected.
+    //!
+    //! It returns a nullptr if the snapshot is empty (i.e. moved)
+    std::unique_ptr<Binary> restore() const;
+
+    private:
+    friend class Binary;
+    Snapshot(std::unique_ptr<Binary> state);
+    std::unique_ptr<Binary> state_;
+  };
+
   public:
   Binary& operator=(const Binary& ) = delete;
   Binary(const Binary& copy) = delete;
@@ -629,6 +659,43 @@ class LIEF_API Binary : public LIEF::Binary {
   //! @param config Builder configuration
   void write(std::ostream& os, Builder::config_t config);
 
+  //! Save the current state of the binary so that it can be restored with
+  //! restore(). This is meant to try several modifications on the same
+  //! binary without parsing it again:
+  //!
+  //! \code{.cpp}
+  //! Binary::Snapshot snap = elf->snapshot();
+  //! for (const auto& strategy : strategies) {
+  //!   strategy(*elf);
+  //!   elf->write(...);
+  //!   elf->restore(snap);
+  //! }
+  //! \endcode
+  //!
+  //! The sections, segments, symbols, ... are copied but the content of the
+  //! file is shared between the binary and the snapshot until one of them
+  //! modifies it.
+  Snapshot snapshot();
+
+  //! Restore the state saved by snapshot(). The snapshot can be restored
+  //! several times.
+  //!
+  //! \warning The references on the sections, segments, symbols, ... of this
+  //!          binary are invalidated (see: Snapshot::restore() to get a new
+  //!          binary instead)
+  void restore(const Snapshot& snapshot);
+
+  //! Save the parsed representation of this binary (header, sections,
+  //! segments, symbols, relocations, dynamic entries, ...) in a compact file
+  //! that can be loaded with Parser::parse_snapshot() without parsing the
+  //! binary again.
+  //!
+  //! The content of the binary is not stored in the snapshot: it is read from
+  //! the original file when the snapshot is loaded. Therefore, this function
+  //! fails with lief_errors::not_supported if the content has been modified
+  //! since the parsing (e.g. with Section::content() or Binary::add()).
+  ok_error_t save_snapshot(const std::string& path) const;
+
   //! Reconstruct the binary object and return its content as a byte vector
   std::vector<uint8_t> raw();
 
@@ -729,8 +796,20 @@ class LIEF_API Binary : public LIEF::Binary {
   LIEF::Binary::functions_t dtor_functions() const;
 
   //! List of the functions found the in the binary.
+  //!
+  //! The list is sorted by address. It is computed on the first call and then cached
+  //! until this binary is modified, either through the Binary's API (e.g. add_symbol,
+  //! patch_address, ...) or through the setters of its symbols, segments and
+  //! dynamic entries. Concurrent calls on an unmodified binary are safe.
   LIEF::Binary::functions_t functions() const;
 
+  //! Return (a copy of) the function which contains the given virtual address
+  //! or an error if the address is not covered by a function of functions().
+  //!
+  //! For functions with an unknown size, the function is assumed to
+  //! extend up to the next function.
+  result<Function> function_at(uint64_t address) const;
+
   //! ``true`` if the binary embeds notes
   bool has_notes() const;
 
@@ -837,6 +916,9 @@ class LIEF_API Binary : public LIEF::Binary {
   LIEF::Binary::functions_t eh_frame_functions() const;
   LIEF::Binary::functions_t armexid_functions() const;
 
+  const LIEF::Binary::functions_t& functions_index() const;
+  void reset_functions_index();
+
   template<E_TYPE OBJECT_TYPE, bool note = false>
   Segment* add_segment(const Segment& segment, uint64_t base);
 
@@ -858,6 +940,9 @@ class LIEF_API Binary : public LIEF::Binary {
 
   LIEF::Binary::functions_t tor_functions(DYNAMIC_TAGS tag) const;
 
+  //! Copy the state of ``from`` in ``to`` (see: snapshot())
+  static void copy_state(Binary& from, Binary& to);
+
   ELF_CLASS type_ = ELF_CLASS::ELFCLASSNONE;
   Header header_;
   sections_t sections_;
@@ -878,6 +963,14 @@ class LIEF_API Binary : public LIEF::Binary {
   std::string interpreter_;
   std::vector<uint8_t> overlay_;
   std::unique_ptr<sizing_info_t> sizing_info_;
+
+  // Sorted functions (cache of functions()) and the value of the
+  // modification counter when it has been computed. The counter is
+  // attached to the objects used to compute the index.
+  std::shared_ptr<details::ModificationCounter> modifications_;
+  mutable std::unique_ptr<LIEF::Binary::functions_t> functions_index_;
+  mutable uint64_t functions_index_count_ = 0;
+  mutable std::mutex functions_lock_;
 };
 
 }
@@ -31,6 +31,8 @@
 #include "LIEF/ELF/enums.hpp"
 
 namespace LIEF {
+class OutputSink;
+
 namespace ELF {
 class Binary;
 class Layout;
@@ -67,6 +69,8 @@ class LIEF_API Builder {
     bool notes           = false; /// Disable note building since it can break the default layout
     bool preinit_array   = true;  /// Rebuild DT_PREINIT_ARRAY
     bool rela            = true;  /// Rebuild DT_REL[A]
+    bool relr            = true;  /// Rebuild DT_RELR (and pack the new relative relocations in it)
+    bool android_rela    = true;  /// Rebuild DT_ANDROID_REL[A] (APS2)
     bool static_symtab   = true;  /// Rebuild `.symtab`
     bool sym_verdef      = true;  /// Rebuild DT_VERDEF
     bool sym_verneed     = true;  /// Rebuild DT_VERNEED
@@ -103,6 +107,9 @@ class LIEF_API Builder {
   //! Write the built ELF binary in the stream ``os`` given in parameter
   void write(std::ostream& os) const;
 
+  //! Write the built ELF binary in the given sink (file, mapping, buffer, ...)
+  ok_error_t write(OutputSink& sink) const;
+
   protected:
   template<typename ELF_T>
   ok_error_t build();
@@ -143,9 +150,21 @@ class LIEF_API Builder {
   template<typename ELF_T>
   ok_error_t build_pltgot_relocations();
 
+  template<typename ELF_T>
+  ok_error_t pack_dynamic_relocations();
+
+  template<typename ELF_T>
+  ok_error_t build_relative_relocations();
+
+  template<typename ELF_T>
+  ok_error_t build_android_relocations();
+
   template<typename ELF_T>
   ok_error_t build_section_relocations();
 
+  template<typename ELF_T>
+  ok_error_t build_compressed_sections();
+
   uint32_t sort_dynamic_symbols();
 
   template<typename ELF_T>
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <memory>
 
 #include "LIEF/visibility.h"
 #include "LIEF/Object.hpp"
@@ -27,14 +28,18 @@
 
 namespace LIEF {
 namespace ELF {
+class Binary;
+
 namespace details {
 struct Elf64_Dyn;
 struct Elf32_Dyn;
+class ModificationCounter;
 }
 
 //! Class which represents an entry in the dynamic table
 //! These entries are located in the ``.dynamic`` section or the ``PT_DYNAMIC`` segment
 class LIEF_API DynamicEntry : public Object {
+  friend class Binary;
   public:
 
   DynamicEntry(const details::Elf64_Dyn& header);
@@ -69,6 +74,7 @@ class LIEF_API DynamicEntry : public Object {
   protected:
   DYNAMIC_TAGS tag_;
   uint64_t     value_;
+  std::shared_ptr<details::ModificationCounter> modifications_;
 };
 }
 }
@@ -0,0 +1,162 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_LOADER_H
+#define LIEF_ELF_LOADER_H
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+namespace ELF {
+class Binary;
+class Symbol;
+
+//! Class which maps the ``PT_LOAD`` segments of an ELF binary in memory (as
+//! the dynamic loader would do) and applies its dynamic relocations.
+//!
+//! The loader supports the ``R_<ARCH>_RELATIVE`` relocations (including the
+//! ones packed in ``DT_RELR`` or Android's ``APS2`` tables) for all the
+//! architectures, and the ``GLOB_DAT``, ``JUMP_SLOT`` and absolute (word-sized)
+//! relocations for x86, x86-64, ARM and AArch64. The other relocations
+//! (TLS, COPY, IRELATIVE, ...) are reported as unresolved.
+//!
+//! \code{.cpp}
+//! ELF::Loader loader(*elf);
+//! loader.resolver([] (const ELF::Symbol& sym) -> result<uint64_t> {
+//!   ...
+//! });
+//! auto image = loader.map(0x7f0000000000);
+//! \endcode
+class LIEF_API Loader {
+  public:
+  //! Reason for which a relocation has not been applied
+  enum class REASON {
+    UNKNOWN = 0,
+    SYMBOL_NOT_FOUND, ///< The symbol can't be resolved
+    UNSUPPORTED,      ///< The relocation type is not supported by the loader
+    OUT_OF_BOUNDS,    ///< The relocation's address is outside of the image
+  };
+
+  //! Relocation which has not been applied
+  struct unresolved_t {
+    //! Address of the relocation (as defined in the ELF file, i.e. not rebased)
+    uint64_t address = 0;
+    uint32_t type = 0;
+    //! Name of the symbol associated with the relocation (if any)
+    std::string symbol;
+    REASON reason = REASON::UNKNOWN;
+  };
+
+  //! Callback which returns the absolute address of the given symbol. If it
+  //! returns an error, the loader falls back on the symbol's definition in the
+  //! binary (if any)
+  using resolver_t = std::function<result<uint64_t>(const Symbol&)>;
+
+  //! Memory image owned by the loader (see: Loader::map)
+  class LIEF_API Image {
+    friend class Loader;
+    public:
+    Image(const Image&) = delete;
+    Image& operator=(const Image&) = delete;
+
+    Image(Image&& other) noexcept;
+    Image& operator=(Image&& other) noexcept;
+    ~Image();
+
+    //! Address at which the image is loaded
+    uint64_t base() const {
+      return base_;
+    }
+
+    span<uint8_t> content() {
+      return {data_, size_};
+    }
+
+    span<const uint8_t> content() const {
+      return {data_, size_};
+    }
+
+    //! Relocations that have not been applied
+    const std::vector<unresolved_t>& unresolved() const {
+      return unresolved_;
+    }
+
+    private:
+    Image() = default;
+    static result<Image> allocate(size_t size);
+    void release();
+
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    uint64_t base_ = 0;
+    std::vector<unresolved_t> unresolved_;
+  };
+
+  //! Default page size used to align the image
+  static constexpr uint64_t DEFAULT_PAGE_SIZE = 0x1000;
+
+  //! The binary must outlive the loader
+  Loader(const Binary& bin);
+
+  Loader& resolver(resolver_t fnc) {
+    resolver_ = std::move(fnc);
+    return *this;
+  }
+
+  Loader& page_size(uint64_t size) {
+    page_size_ = size;
+    return *this;
+  }
+
+  uint64_t page_size() const {
+    return page_size_;
+  }
+
+  //! Lowest (page-aligned) virtual address of the ``PT_LOAD`` segments. This
+  //! address is mapped at the ``base`` address given to load() / map()
+  uint64_t image_start() const;
+
+  //! Size of the memory image (page-aligned)
+  uint64_t image_size() const;
+
+  //! Load the binary at the address ``base`` in the given buffer which must be
+  //! at least image_size() bytes long.
+  //!
+  //! It returns the relocations that have not been applied
+  result<std::vector<unresolved_t>> load(span<uint8_t> buffer, uint64_t base) const;
+
+  //! Same as load() but in a (zero-filled) buffer allocated by the loader
+  result<Image> map(uint64_t base) const;
+
+  private:
+  ok_error_t load_segments(span<uint8_t> buffer) const;
+  std::vector<unresolved_t> relocate(span<uint8_t> buffer, uint64_t base) const;
+
+  const Binary* binary_ = nullptr;
+  resolver_t resolver_;
+  uint64_t page_size_ = DEFAULT_PAGE_SIZE;
+};
+
+LIEF_API const char* to_string(Loader::REASON e);
+
+}
+}
+#endif
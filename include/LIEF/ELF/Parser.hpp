@@ -88,6 +88,14 @@ class LIEF_API Parser : public LIEF::Parser {
   static std::unique_ptr<Binary> parse(std::unique_ptr<BinaryStream> stream,
                                        const ParserConfig& conf = ParserConfig::all());
 
+  //! Load a snapshot created by Binary::save_snapshot(). ``source`` is the
+  //! ELF file from which the snapshot has been created: it provides the
+  //! content of the binary and its SHA-256 must match the one recorded in
+  //! the snapshot. Otherwise, the snapshot is considered as stale and
+  //! a nullptr is returned.
+  static std::unique_ptr<Binary> parse_snapshot(const std::string& snapshot,
+                                                const std::string& source);
+
   Parser& operator=(const Parser&) = delete;
   Parser(const Parser&)            = delete;
 
@@ -175,6 +183,18 @@ class LIEF_API Parser : public LIEF::Parser {
   template<typename ELF_T, typename REL_T>
   ok_error_t parse_dynamic_relocations(uint64_t relocations_offset, uint64_t size);
 
+  //! Parse the relative relocations packed in a RELR table
+  //!
+  //! It uses DT_RELR/DT_RELRSZ (or DT_ANDROID_RELR/DT_ANDROID_RELRSZ)
+  template<typename ELF_T>
+  ok_error_t parse_relative_relocations(uint64_t offset, uint64_t size);
+
+  //! Parse the relocations packed in an Android APS2 table
+  //!
+  //! It uses DT_ANDROID_REL[A]/DT_ANDROID_REL[A]SZ
+  template<typename ELF_T>
+  ok_error_t parse_packed_relocations(uint64_t offset, uint64_t size, bool is_rela);
+
   //! Parse `.plt.got`/`got` relocations
   //!
   //! For:
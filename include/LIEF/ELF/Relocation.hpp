@@ -52,6 +52,16 @@ class LIEF_API Relocation : public LIEF::Relocation {
   friend class Builder;
 
   public:
+  //! The *encoding* of the relocation, i.e. the dynamic table from which
+  //! the relocation comes from and in which it is re-encoded by the Builder.
+  enum class ENCODING {
+    UNKNOWN = 0,
+    REL,          ///< Regular ``Elf_Rel`` entry
+    RELA,         ///< Regular ``Elf_Rela`` entry
+    RELR,         ///< Relative relocation packed in a ``DT_RELR`` bitmap
+    ANDROID_SLEB, ///< Relocation packed in an Android ``APS2`` (SLEB128) table
+  };
+
   Relocation(const details::Elf32_Rel&  header);
   Relocation(const details::Elf32_Rela& header);
   Relocation(const details::Elf64_Rel&  header);
@@ -101,6 +111,17 @@ class LIEF_API Relocation : public LIEF::Relocation {
   //! Relocation info which contains for instance the symbol index
   uint32_t info() const;
 
+  //! The encoding of the relocation
+  ENCODING encoding() const {
+    return encoding_;
+  }
+
+  //! True if the relocation is packed in a ``DT_RELR`` or an Android
+  //! ``APS2`` table
+  bool is_packed() const {
+    return encoding_ == ENCODING::RELR || encoding_ == ENCODING::ANDROID_SLEB;
+  }
+
   ARCH architecture() const;
   RELOCATION_PURPOSES purpose() const;
 
@@ -153,8 +174,11 @@ class LIEF_API Relocation : public LIEF::Relocation {
   Section*            section_{nullptr};
   Section*            symbol_table_{nullptr};
   uint32_t            info_ = 0;
+  ENCODING            encoding_ = ENCODING::UNKNOWN;
 };
 
+LIEF_API const char* to_string(Relocation::ENCODING e);
+
 
 
 }
@@ -20,6 +20,8 @@
 #include <vector>
 #include <ostream>
 #include <set>
+#include <memory>
+#include <mutex>
 
 #include "LIEF/visibility.h"
 
@@ -29,6 +31,8 @@
 #include "LIEF/iterators.hpp"
 
 namespace LIEF {
+class BinaryStream;
+
 namespace ELF {
 
 namespace DataHandler {
@@ -60,6 +64,14 @@ class LIEF_API Section : public LIEF::Section {
   using it_segments       = ref_iterator<segments_t&>;
   using it_const_segments = const_ref_iterator<const segments_t&>;
 
+  //! Algorithm used to compress the content of a ``SHF_COMPRESSED`` section
+  //! (``Elf_Chdr.ch_type``)
+  enum class COMPRESSION : uint32_t {
+    NONE = 0,
+    ZLIB = 1, ///< ``ELFCOMPRESS_ZLIB``
+    ZSTD = 2, ///< ``ELFCOMPRESS_ZSTD``
+  };
+
   Section(const uint8_t *data, ELF_CLASS type);
   Section(const details::Elf64_Shdr& header);
   Section(const details::Elf32_Shdr& header);
@@ -132,6 +144,48 @@ class LIEF_API Section : public LIEF::Section {
   //! Index to another section
   uint32_t link() const;
 
+  //! ``True`` if the content of the section is compressed (``SHF_COMPRESSED``)
+  bool is_compressed() const;
+
+  //! Algorithm used to compress the section's content (or COMPRESSION::NONE
+  //! if the section is not compressed)
+  COMPRESSION compression() const {
+    return chdr_.type;
+  }
+
+  //! Size of the uncompressed content as declared in the compression header.
+  //! For a regular section, it returns size()
+  uint64_t uncompressed_size() const;
+
+  //! Return the uncompressed content of a ``SHF_COMPRESSED`` section.
+  //!
+  //! The content is decompressed on the first call and then cached. For
+  //! a section which is not compressed, it returns content().
+  //! If the section can't be decompressed (corrupted data, LIEF compiled
+  //! without zlib or zstd support, ...), it returns an empty span.
+  //!
+  //! This function can be called concurrently on the same section. The
+  //! returned span is invalidated when the uncompressed content is changed.
+  span<const uint8_t> uncompressed_content() const;
+
+  //! Change the uncompressed content of a ``SHF_COMPRESSED`` section.
+  //!
+  //! The new content is compressed with the original algorithm when the
+  //! binary is rebuilt (ELF::Builder).
+  //!
+  //! \warning The spans previously returned by uncompressed_content() are
+  //!          invalidated.
+  void uncompressed_content(std::vector<uint8_t> data);
+
+  //! Return a stream over the uncompressed content which decompresses
+  //! the data on demand (i.e. only what has been read).
+  //! This is useful to process a few parts of large sections like ``.debug_info``
+  //! without fully inflating them.
+  //!
+  //! It returns a nullptr if the section is not compressed or if the
+  //! algorithm is not supported.
+  std::unique_ptr<BinaryStream> uncompressed_stream() const;
+
   //! Clear the content of the section with the given ``value``
   Section& clear(uint8_t value = 0);
 
@@ -171,7 +225,14 @@ class LIEF_API Section : public LIEF::Section {
   LIEF_API friend std::ostream& operator<<(std::ostream& os, const Section& section);
 
   private:
+  struct compression_header_t {
+    COMPRESSION type = COMPRESSION::NONE;
+    uint64_t size = 0;        ///< Size of the uncompressed data (``ch_size``)
+    uint64_t alignment = 0;   ///< Alignment of the uncompressed data (``ch_addralign``)
+    uint32_t header_size = 0; ///< ``sizeof(Elf_Chdr)``
+  };
   span<uint8_t> writable_content();
+  void reset_uncompressed();
   ELF_SECTION_TYPES     type_ = ELF_SECTION_TYPES::SHT_PROGBITS;
   uint64_t              flags_ = 0;
   uint64_t              original_size_ = 0;
@@ -183,6 +244,14 @@ class LIEF_API Section : public LIEF::Section {
   bool                  is_frame_ = false;
   DataHandler::Handler* datahandler_ = nullptr;
   std::vector<uint8_t>  content_c_;
+
+  compression_header_t chdr_;
+  // Cache of the uncompressed content (shared by the copies of the section)
+  mutable std::shared_ptr<const std::vector<uint8_t>> uncompressed_;
+  mutable std::mutex uncompressed_lock_;
+  // True if the uncompressed content has been changed and needs to be
+  // compressed by the Builder
+  bool uncompressed_modified_ = false;
 };
 
 }
@@ -43,6 +43,7 @@ class Builder;
 namespace details {
 struct Elf64_Phdr;
 struct Elf32_Phdr;
+class ModificationCounter;
 }
 
 //! Class which represents the ELF segments
@@ -165,6 +166,7 @@ class LIEF_API Segment : public Object {
   sections_t            sections_;
   DataHandler::Handler* datahandler_ = nullptr;
   std::vector<uint8_t>  content_c_;
+  std::shared_ptr<details::ModificationCounter> modifications_;
 };
 
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <memory>
 
 #include "LIEF/visibility.h"
 #include "LIEF/Abstract/Symbol.hpp"
@@ -35,6 +36,7 @@ class Section;
 namespace details {
 struct Elf32_Sym;
 struct Elf64_Sym;
+class ModificationCounter;
 }
 
 //! Class which represents an ELF symbol
@@ -122,13 +124,11 @@ class LIEF_API Symbol : public LIEF::Symbol {
   void information(uint8_t info);
   void shndx(uint16_t idx);
 
-  void value(uint64_t value) override {
-    value_ = value;
-  }
+  void value(uint64_t value) override;
+  void size(uint64_t size) override;
 
-  void size(uint64_t size) override {
-    size_ = size;
-  }
+  using LIEF::Symbol::name;
+  void name(const std::string& name) override;
 
   void shndx(SYMBOL_SECTION_INDEX idx) {
     this->shndx_ = static_cast<uint16_t>(idx);
@@ -174,6 +174,7 @@ class LIEF_API Symbol : public LIEF::Symbol {
   Section*         section_ = nullptr;
   SymbolVersion*   symbol_version_ = nullptr;
   ARCH             arch_ = ARCH::EM_NONE;
+  std::shared_ptr<details::ModificationCounter> modifications_;
 };
 }
 }
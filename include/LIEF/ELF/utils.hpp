@@ -21,6 +21,7 @@
 
 #include "LIEF/types.hpp"
 #include "LIEF/visibility.h"
+#include "LIEF/ELF/enums.hpp"
 
 namespace LIEF {
 class BinaryStream;
@@ -39,6 +40,10 @@ LIEF_API bool is_elf(const std::vector<uint8_t>& raw);
 LIEF_API unsigned long hash32(const char* name);
 LIEF_API unsigned long hash64(const char* name);
 LIEF_API uint32_t dl_new_hash(const char* name);
+
+// In these functions, we assume that the stream wraps an ELF file
+LIEF_LOCAL ELF_DATA determine_elf_endianess(BinaryStream& stream);
+LIEF_LOCAL ELF_CLASS determine_elf_class(BinaryStream& stream);
 }
 }
 
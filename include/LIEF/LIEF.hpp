@@ -28,6 +28,7 @@
 #include <LIEF/MachO.hpp>
 #include <LIEF/DWARF.hpp>
 #include <LIEF/logging.hpp>
+#include <LIEF/OutputSink.hpp>
 #include <LIEF/platforms.hpp>
 
 
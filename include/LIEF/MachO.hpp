@@ -26,6 +26,7 @@
 #include "LIEF/MachO/BuildVersion.hpp"
 #include "LIEF/MachO/Builder.hpp"
 #include "LIEF/MachO/ChainedBindingInfo.hpp"
+#include "LIEF/MachO/CodeDirectory.hpp"
 #include "LIEF/MachO/CodeSignature.hpp"
 #include "LIEF/MachO/CodeSignatureDir.hpp"
 #include "LIEF/MachO/DataCodeEntry.hpp"
@@ -41,6 +42,7 @@
 #include "LIEF/MachO/EncryptionInfo.hpp"
 #include "LIEF/MachO/EnumToString.hpp"
 #include "LIEF/MachO/ExportInfo.hpp"
+#include "LIEF/MachO/ExportsTrieView.hpp"
 #include "LIEF/MachO/FatBinary.hpp"
 #include "LIEF/MachO/FilesetCommand.hpp"
 #include "LIEF/MachO/FunctionStarts.hpp"
@@ -28,7 +28,9 @@
 
 #include "LIEF/iterators.hpp"
 #include "LIEF/MachO/Header.hpp"
+#include "LIEF/MachO/ExportsTrieView.hpp"
 #include "LIEF/errors.hpp"
+#include "LIEF/SharedContent.hpp"
 
 namespace LIEF {
 
@@ -608,6 +610,18 @@ class LIEF_API Binary : public LIEF::Binary  {
   DyldExportsTrie* dyld_exports_trie();
   const DyldExportsTrie* dyld_exports_trie() const;
 
+  //! Lazy view over the exports trie of LC_DYLD_EXPORTS_TRIE or
+  //! LC_DYLD_INFO (empty if the binary does not have any of them)
+  ExportsTrieView exports_view() const;
+
+  //! Look for the given exported symbol directly in the raw exports trie
+  //! (LC_DYLD_EXPORTS_TRIE or LC_DYLD_INFO). Contrary to
+  //! Binary::get_symbol, it does not require the trie to be parsed
+  //! (see: ParserConfig::parse_dyld_exports).
+  result<ExportsTrieView::export_t> find_export(const std::string& name) const {
+    return exports_view().find(name);
+  }
+
   //! ``true`` if the binary has the command LC_TWO_LEVEL_HINTS.
   bool has_two_level_hints() const;
 
@@ -682,6 +696,16 @@ class LIEF_API Binary : public LIEF::Binary  {
 
   uint32_t page_size() const;
 
+  //! Save the exports, the dyld bindings and the dyld rebases of this binary
+  //! in a compact file that can be loaded with Parser::parse_snapshot()
+  //! without decoding the dyld opcodes and the exports trie again.
+  //!
+  //! The other parts of the binary are parsed from the original file when the
+  //! snapshot is loaded. Therefore, this function fails with
+  //! lief_errors::not_supported if the binary has not been parsed from a file
+  //! (or a buffer) or if the content of its segments has been modified.
+  ok_error_t save_snapshot(const std::string& path) const;
+
   private:
   //! Default constructor
   Binary();
@@ -741,6 +765,9 @@ class LIEF_API Binary : public LIEF::Binary  {
   // offset_to_virtual_address
   std::map<uint64_t, SegmentCommand*> offset_seg_;
 
+  //! Content from which the binary has been parsed (shared with the segments)
+  SharedContent source_;
+
   protected:
   uint64_t fat_offset_ = 0;
   uint64_t fileset_offset_ = 0;
@@ -36,6 +36,10 @@ namespace LIEF {
 class BinaryStream;
 class SpanStream;
 
+namespace snapshot {
+class reader_t;
+}
+
 namespace MachO {
 class ChainedBindingInfo;
 class CodeSignature;
@@ -60,9 +64,7 @@ struct ParserConfig;
 namespace details {
 struct dyld_chained_starts_in_segment;
 struct dyld_chained_fixups_header;
-union dyld_chained_ptr_arm64e;
-union dyld_chained_ptr_generic64;
-union dyld_chained_ptr_generic32;
+struct chain_start_t;
 }
 
 //! Class used to parse a **single** binary (i.e. non-FAT)
@@ -166,34 +168,16 @@ class LIEF_API BinaryParser : public LIEF::Parser {
 
   template<class MACHO_T>
   ok_error_t parse_fixup_seg(SpanStream& stream, uint32_t seg_info_offset,
-                             uint64_t offset, uint32_t seg_idx);
+                             uint64_t offset, uint32_t seg_idx,
+                             std::vector<details::chain_start_t>& chains,
+                             details::dyld_chained_starts_in_segment& seg_info);
 
   template<class MACHO_T>
   ok_error_t do_fixup(DYLD_CHAINED_FORMAT fmt, int32_t ord, const std::string& symbol_name,
                       int64_t addend, bool is_weak);
 
   template<class MACHO_T>
-  ok_error_t process_fixup(SegmentCommand& segment, uint64_t chain_offset,
-                           const details::dyld_chained_starts_in_segment& seg_info);
-
-  template<class MACHO_T>
-  result<uint64_t> next_chain(uint64_t chain_offset, const details::dyld_chained_starts_in_segment& seg_info);
-
-  template<class MACHO_T>
-  ok_error_t walk_chain(SegmentCommand& segment, uint64_t chain_offset,
-                        const details::dyld_chained_starts_in_segment& seg_info);
-
-  ok_error_t do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                              const details::dyld_chained_starts_in_segment& seg_info,
-                              const details::dyld_chained_ptr_arm64e& fixup);
-
-  ok_error_t do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                              const details::dyld_chained_starts_in_segment& seg_info,
-                              const details::dyld_chained_ptr_generic64& fixup);
-
-  ok_error_t do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                              const details::dyld_chained_starts_in_segment& seg_info,
-                              const details::dyld_chained_ptr_generic32 & fixup);
+  ok_error_t decode_chains(const std::vector<details::chain_start_t>& chains);
 
   template<class MACHO_T>
   ok_error_t post_process(SymbolCommand& cmd);
@@ -230,7 +214,15 @@ class LIEF_API BinaryParser : public LIEF::Parser {
   ok_error_t parse_export_trie(exports_list_t& exports, uint64_t start,
                                uint64_t end, const std::string& prefix);
 
-  void copy_from(ChainedBindingInfo& to, ChainedBindingInfo& from);
+  // Snapshot (see: Binary::save_snapshot)
+  // --------
+  template<class MACHO_T>
+  ok_error_t restore_dyldinfo_binds();
+
+  template<class MACHO_T>
+  ok_error_t restore_dyldinfo_rebases();
+
+  ok_error_t restore_exports(exports_list_t& exports, uint32_t table);
 
   std::unique_ptr<BinaryStream>  stream_;
   std::unique_ptr<Binary>        binary_;
@@ -246,6 +238,9 @@ class LIEF_API BinaryParser : public LIEF::Parser {
 
   // Cache of DyldChainedFixups
   DyldChainedFixups* chained_fixups_ = nullptr;
+
+  // Snapshot from which the dyld info are restored (instead of being decoded)
+  const snapshot::reader_t* snapshot_ = nullptr;
 };
 
 
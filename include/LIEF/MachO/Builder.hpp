@@ -28,6 +28,8 @@
 #include "LIEF/iostream.hpp"
 
 namespace LIEF {
+class OutputSink;
+
 namespace MachO {
 
 class Binary;
@@ -60,6 +62,11 @@ class LIEF_API Builder {
   //! Options to tweak the building process
   struct config_t {
     bool linkedit = true;
+
+    //! Recompute the page hashes of the CodeDirectory blobs (LC_CODE_SIGNATURE)
+    //! over the rebuilt binary. The binary must keep the same number of pages
+    //! and the CMS signature (if any) is not updated.
+    bool code_signature_hashes = false;
   };
 
   Builder() = delete;
@@ -73,6 +80,9 @@ class LIEF_API Builder {
   static ok_error_t write(Binary& binary, std::ostream& out);
   static ok_error_t write(Binary& binary, std::ostream& out, config_t config);
 
+  static ok_error_t write(Binary& binary, OutputSink& out);
+  static ok_error_t write(Binary& binary, OutputSink& out, config_t config);
+
   static ok_error_t write(FatBinary& fat, const std::string& filename);
   static ok_error_t write(FatBinary& fat, const std::string& filename, config_t config);
 
@@ -82,6 +92,9 @@ class LIEF_API Builder {
   static ok_error_t write(FatBinary& fat, std::ostream& out);
   static ok_error_t write(FatBinary& fat, std::ostream& out, config_t config);
 
+  static ok_error_t write(FatBinary& fat, OutputSink& out);
+  static ok_error_t write(FatBinary& fat, OutputSink& out, config_t config);
+
   ~Builder();
   private:
   ok_error_t build();
@@ -89,6 +102,7 @@ class LIEF_API Builder {
   const std::vector<uint8_t>& get_build();
   ok_error_t write(const std::string& filename) const;
   ok_error_t write(std::ostream& os) const;
+  ok_error_t write(OutputSink& sink) const;
 
   Builder(Binary& binary, config_t config);
   Builder(std::vector<Binary*> binaries, config_t config);
@@ -177,6 +191,7 @@ class LIEF_API Builder {
   ok_error_t build_symbols();
 
   ok_error_t build_uuid();
+  ok_error_t build_code_signature_hashes();
 
   template <typename T>
   ok_error_t update_fixups(DyldChainedFixups& fixups);
@@ -28,6 +28,7 @@ namespace MachO {
 class Symbol;
 class BinaryParser;
 class Builder;
+class DyldChainedFixups;
 
 namespace details {
 struct dyld_chained_ptr_arm64e_bind;
@@ -49,6 +50,7 @@ class LIEF_API ChainedBindingInfo : public BindingInfo {
 
   friend class BinaryParser;
   friend class Builder;
+  friend class DyldChainedFixups;
 
   public:
   ChainedBindingInfo() = delete;
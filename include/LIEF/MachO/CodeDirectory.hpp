@@ -0,0 +1,202 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MACHO_CODE_DIRECTORY_H
+#define LIEF_MACHO_CODE_DIRECTORY_H
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/visibility.h"
+
+namespace LIEF {
+class BinaryStream;
+namespace MachO {
+class CodeSignature;
+
+//! Class which represents a CodeDirectory blob (``CSMAGIC_CODEDIRECTORY``)
+//! of the SuperBlob referenced by LC_CODE_SIGNATURE.
+//!
+//! A CodeDirectory contains the hashes of the pages of the binary
+//! (*code slots*) from the beginning of the file up to code_limit() and the
+//! hashes of some auxiliary blobs like the requirements or the entitlements
+//! (*special slots*).
+class LIEF_API CodeDirectory {
+  friend class CodeSignature;
+
+  public:
+  enum class HASH_TYPES : uint8_t {
+    NONE             = 0,
+    SHA1             = 1,
+    SHA256           = 2,
+    SHA256_TRUNCATED = 3, ///< SHA-256 truncated to 20 bytes
+    SHA384           = 4,
+  };
+
+  //! Index of the special slots (stored *before* the code slots)
+  enum class SPECIAL_SLOTS : uint32_t {
+    INFO             = 1, ///< Info.plist
+    REQUIREMENTS     = 2,
+    RESOURCEDIR      = 3, ///< CodeResources
+    APPLICATION      = 4,
+    ENTITLEMENTS     = 5,
+    REP_SPECIFIC     = 6,
+    DER_ENTITLEMENTS = 7,
+  };
+
+  //! SuperBlob's slot type of the primary CodeDirectory
+  static constexpr uint32_t SLOT_CODEDIRECTORY = 0;
+
+  //! SuperBlob's slot type of the first alternate CodeDirectory
+  //! (e.g. the SHA-256 CodeDirectory next to a SHA-1 one)
+  static constexpr uint32_t SLOT_ALTERNATE_CODEDIRECTORIES = 0x1000;
+
+  CodeDirectory();
+  CodeDirectory(const CodeDirectory&);
+  CodeDirectory& operator=(const CodeDirectory&);
+  ~CodeDirectory();
+
+  //! Parse the CodeDirectory blob that starts at the beginning of ``blob``
+  static result<CodeDirectory> parse(span<const uint8_t> blob);
+
+  //! SuperBlob's slot type associated with this CodeDirectory
+  uint32_t slot_type() const {
+    return slot_type_;
+  }
+
+  //! Offset of the blob in CodeSignature::content()
+  uint32_t offset() const {
+    return offset_;
+  }
+
+  uint32_t version() const {
+    return version_;
+  }
+
+  uint32_t flags() const {
+    return flags_;
+  }
+
+  HASH_TYPES hash_type() const {
+    return hash_type_;
+  }
+
+  //! Size of a hash (in bytes)
+  uint8_t hash_size() const {
+    return hash_size_;
+  }
+
+  uint8_t platform() const {
+    return platform_;
+  }
+
+  //! Size of the pages covered by a code slot. If the CodeDirectory does
+  //! not use paging, it returns code_limit()
+  uint64_t page_size() const;
+
+  //! Number of bytes (from the beginning of the file) covered by the code slots
+  uint64_t code_limit() const {
+    return code_limit_;
+  }
+
+  uint32_t nb_code_slots() const {
+    return nb_code_slots_;
+  }
+
+  uint32_t nb_special_slots() const {
+    return nb_special_slots_;
+  }
+
+  //! Identifier of the signed code (e.g. ``com.apple.ls``)
+  const std::string& identifier() const {
+    return identifier_;
+  }
+
+  //! Team identifier (empty if not present)
+  const std::string& team_id() const {
+    return team_id_;
+  }
+
+  uint64_t exec_seg_base() const {
+    return exec_seg_base_;
+  }
+
+  uint64_t exec_seg_limit() const {
+    return exec_seg_limit_;
+  }
+
+  uint64_t exec_seg_flags() const {
+    return exec_seg_flags_;
+  }
+
+  //! Hash of the ``page``-th page. It returns an empty span if the page is out of range
+  span<const uint8_t> code_hash(uint32_t page) const;
+
+  //! Hash stored in the given special slot. It returns an empty span if
+  //! the slot is not present
+  span<const uint8_t> special_hash(SPECIAL_SLOTS slot) const;
+
+  //! Compute the hash of the given data with the algorithm of this CodeDirectory
+  std::vector<uint8_t> hash(span<const uint8_t> data) const;
+
+  //! Recompute (in parallel) the hashes of the pages of the given Mach-O
+  //! (thin) file and return the indexes of the pages that don't match the
+  //! code slots.
+  result<std::vector<uint32_t>> verify(BinaryStream& stream) const;
+
+  //! Recompute the code slots from the given Mach-O (thin) file whose
+  //! code signature starts at ``code_limit``.
+  //!
+  //! The new code limit must cover the same number of pages as the original
+  //! one. The special slots are not modified and the CMS signature (if any) is
+  //! not updated, so it no longer matches this CodeDirectory.
+  ok_error_t update(BinaryStream& stream, uint64_t code_limit);
+
+  LIEF_API friend std::ostream& operator<<(std::ostream& os, const CodeDirectory& cd);
+
+  private:
+  //! Hashes of the pages in [0, code_limit) concatenated
+  result<std::vector<uint8_t>> compute_hashes(BinaryStream& stream, uint64_t code_limit) const;
+  uint64_t page_size(uint64_t code_limit) const;
+
+  uint32_t slot_type_ = SLOT_CODEDIRECTORY;
+  uint32_t offset_ = 0;
+  uint32_t version_ = 0;
+  uint32_t flags_ = 0;
+  uint32_t hash_offset_ = 0;
+  uint32_t nb_special_slots_ = 0;
+  uint32_t nb_code_slots_ = 0;
+  uint64_t code_limit_ = 0;
+  bool has_code_limit64_ = false;
+  HASH_TYPES hash_type_ = HASH_TYPES::NONE;
+  uint8_t hash_size_ = 0;
+  uint8_t platform_ = 0;
+  uint8_t page_size_log2_ = 0;
+  std::string identifier_;
+  std::string team_id_;
+  uint64_t exec_seg_base_ = 0;
+  uint64_t exec_seg_limit_ = 0;
+  uint64_t exec_seg_flags_ = 0;
+
+  // Special slots (from -nb_special_slots to -1) followed by the code slots
+  std::vector<uint8_t> slots_;
+};
+
+}
+}
+#endif
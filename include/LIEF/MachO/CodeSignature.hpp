@@ -19,12 +19,16 @@
 #include <ostream>
 
 #include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/iterators.hpp"
 #include "LIEF/visibility.h"
 #include "LIEF/types.hpp"
 
 #include "LIEF/MachO/LoadCommand.hpp"
+#include "LIEF/MachO/CodeDirectory.hpp"
 
 namespace LIEF {
+class BinaryStream;
 namespace MachO {
 
 class BinaryParser;
@@ -41,6 +45,15 @@ class LIEF_API CodeSignature : public LoadCommand {
   friend class LinkEdit;
 
   public:
+  //! Internal container for storing the CodeDirectory blobs
+  using code_directories_t = std::vector<CodeDirectory>;
+
+  //! Iterator which outputs CodeDirectory&
+  using it_code_directories = ref_iterator<code_directories_t&>;
+
+  //! Iterator which outputs const CodeDirectory&
+  using it_const_code_directories = const_ref_iterator<const code_directories_t&>;
+
   CodeSignature();
   CodeSignature(const details::linkedit_data_command& cmd);
 
@@ -66,6 +79,24 @@ class LIEF_API CodeSignature : public LoadCommand {
     return content_;
   }
 
+  //! CodeDirectory blobs of the signature's SuperBlob (the primary
+  //! CodeDirectory followed by the alternate ones)
+  it_code_directories code_directories() {
+    return code_directories_;
+  }
+
+  it_const_code_directories code_directories() const {
+    return code_directories_;
+  }
+
+  //! Recompute the code slots of the CodeDirectory blobs from the given
+  //! Mach-O (thin) file and update content() accordingly.
+  //!
+  //! The file is expected to have the same layout as the parsed one
+  //! (see Builder::config_t::code_signature_hashes to update the hashes of
+  //! a rebuilt binary). The CMS signature is not updated.
+  ok_error_t update_code_hashes(BinaryStream& stream);
+
   ~CodeSignature() override;
 
 
@@ -76,10 +107,13 @@ class LIEF_API CodeSignature : public LoadCommand {
   static bool classof(const LoadCommand* cmd);
 
   private:
+  void parse_code_directories();
+  ok_error_t update_code_hashes(BinaryStream& stream, uint64_t code_limit);
+
   uint32_t data_offset_ = 0;
   uint32_t data_size_ = 0;
   span<uint8_t> content_;
-
+  code_directories_t code_directories_;
 };
 
 }
@@ -16,14 +16,18 @@
 #ifndef LIEF_MACHO_DYLD_CHAINED_FIXUPS_H
 #define LIEF_MACHO_DYLD_CHAINED_FIXUPS_H
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "LIEF/span.hpp"
 #include "LIEF/iterators.hpp"
 #include "LIEF/visibility.h"
 #include "LIEF/MachO/LoadCommand.hpp"
+#include "LIEF/MachO/enums.hpp"
 
 namespace LIEF {
 namespace MachO {
 
+class Binary;
 class BinaryParser;
 class Builder;
 class ChainedBindingInfo;
@@ -43,9 +47,11 @@ struct dyld_chained_starts_in_segment;
 //! the DyldInfo's bytecode. Compared to the DyldInfo bytecode, these chained
 //! fixups are taking less space.
 class LIEF_API DyldChainedFixups : public LoadCommand {
+  friend class Binary;
   friend class BinaryParser;
   friend class Builder;
   friend class LinkEdit;
+  friend class SegmentCommand;
 
   public:
   //! Structure that mirrors the raw dyld_chained_starts_in_segment
@@ -79,6 +85,47 @@ class LIEF_API DyldChainedFixups : public LoadCommand {
                               SegmentCommand& segment);
   };
 
+  //! Compact (struct-of-arrays) representation of the fixups.
+  //!
+  //! This table is filled by the parser (the chains are decoded in parallel).
+  //! The RelocationFixup / ChainedBindingInfo objects are created from this
+  //! table on the first access to the relocations (SegmentCommand::relocations,
+  //! Binary::relocations) or to the bindings (DyldChainedFixups::bindings).
+  //! The i-th fixup is described by ``offset[i]``, ``target[i]``, ``kind[i]``, ...
+  struct LIEF_API fixups_table_t {
+    enum class KIND : uint8_t {
+      REBASE = 0,
+      BIND,
+      AUTH_REBASE,
+      AUTH_BIND,
+    };
+
+    std::vector<uint64_t> offset;  ///< Offset of the fixup (i.e. ``address - imagebase``)
+    std::vector<uint64_t> target;  ///< Address targeted by a rebase (0 for a bind)
+    std::vector<KIND>     kind;    ///< Kind of fixup
+    std::vector<uint32_t> ordinal; ///< Import ordinal of a bind (0 for a rebase)
+    std::vector<int64_t>  addend;  ///< Addend of a bind (0 for a rebase)
+    std::vector<uint32_t> segment; ///< Index of the segment in which the fixup takes place
+    std::vector<uint64_t> raw;     ///< Raw (encoded) value of the fixup pointer
+
+    size_t size() const {
+      return offset.size();
+    }
+
+    bool empty() const {
+      return offset.empty();
+    }
+
+    void reserve(size_t size);
+    void clear();
+    void push_back(uint64_t offset, uint64_t target, KIND kind,
+                   uint32_t ordinal, int64_t addend, uint32_t segment,
+                   uint64_t raw);
+
+    //! Append the entries of ``other`` at the end of this table
+    void append(const fixups_table_t& other);
+  };
+
   //! Internal container for storing chained_starts_in_segment
   using chained_starts_in_segments_t = std::vector<chained_starts_in_segment>;
 
@@ -115,14 +162,10 @@ class LIEF_API DyldChainedFixups : public LoadCommand {
   void data_size(uint32_t size);
 
   //! Iterator over the bindings (ChainedBindingInfo) associated with this command
-  it_binding_info bindings() {
-    return all_bindings_;
-  }
+  it_binding_info bindings();
 
   //! Iterator over the bindings (ChainedBindingInfo) associated with this command
-  it_const_binding_info bindings() const {
-    return all_bindings_;
-  }
+  it_const_binding_info bindings() const;
 
   //! Iterator over the chained fixup metadata
   it_chained_starts_in_segments_t chained_starts_in_segments() {
@@ -133,6 +176,12 @@ class LIEF_API DyldChainedFixups : public LoadCommand {
     return chained_starts_in_segment_;
   }
 
+  //! Compact table of all the fixups (rebases and binds) in the order
+  //! of the chains
+  const fixups_table_t& fixups() const {
+    return fixups_;
+  }
+
   //! Chained fixups version. The loader (dyld v852.2) checks
   //! that this value is set to 0
   uint32_t fixups_version() const { return fixups_version_; }
@@ -174,7 +223,20 @@ class LIEF_API DyldChainedFixups : public LoadCommand {
   static bool classof(const LoadCommand* cmd);
 
   private:
+  //! Segment referenced by fixups_table_t::segment along with the
+  //! pointer format of its chains
+  struct fixups_segment_t {
+    SegmentCommand* segment = nullptr;
+    DYLD_CHAINED_PTR_FORMAT pointer_format = DYLD_CHAINED_PTR_FORMAT::PTR_64;
+    uint32_t max_valid_pointer = 0;
+  };
+
   void update_with(const details::dyld_chained_fixups_header& header);
+
+  //! Create the RelocationFixup / ChainedBindingInfo objects from fixups_
+  //! if they have not been created yet. This function can be called
+  //! concurrently (e.g. from bindings() const)
+  void create_objects() const;
   DyldChainedFixups& operator=(const DyldChainedFixups& other);
   DyldChainedFixups(const DyldChainedFixups& other);
 
@@ -196,7 +258,16 @@ class LIEF_API DyldChainedFixups : public LoadCommand {
   chained_starts_in_segments_t chained_starts_in_segment_;
 
   std::vector<std::unique_ptr<ChainedBindingInfoList>> internal_bindings_;
-  binding_info_t all_bindings_;
+  mutable binding_info_t all_bindings_;
+
+  fixups_table_t fixups_;
+  std::vector<fixups_segment_t> fixups_segments_;
+
+  // Binary that owns this command as long as the objects
+  // of fixups_ have not been created (nullptr otherwise).
+  // It is guarded by objects_lock_
+  mutable Binary* binary_ = nullptr;
+  mutable std::mutex objects_lock_;
 };
 
 }
@@ -20,6 +20,7 @@
 #include "LIEF/iterators.hpp"
 #include "LIEF/visibility.h"
 #include "LIEF/MachO/LoadCommand.hpp"
+#include "LIEF/MachO/ExportsTrieView.hpp"
 
 namespace LIEF {
 namespace MachO {
@@ -79,6 +80,18 @@ class LIEF_API DyldExportsTrie : public LoadCommand {
   it_export_info       exports();
   it_const_export_info exports() const;
 
+  //! Lazy view over the raw trie which does not depend
+  //! on the ExportInfo decoded by the parser.
+  ExportsTrieView exports_view() const {
+    return content();
+  }
+
+  //! Look for the given symbol in the trie without decoding
+  //! the whole trie (see: ExportsTrieView::find)
+  result<ExportsTrieView::export_t> find_export(const std::string& name) const {
+    return exports_view().find(name);
+  }
+
   //! Print the exports trie in a humman-readable way
   std::string show_export_trie() const;
 
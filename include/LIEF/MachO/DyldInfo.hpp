@@ -26,6 +26,7 @@
 #include "LIEF/span.hpp"
 
 #include "LIEF/MachO/LoadCommand.hpp"
+#include "LIEF/MachO/ExportsTrieView.hpp"
 #include "LIEF/MachO/type_traits.hpp"
 #include "LIEF/iterators.hpp"
 
@@ -245,6 +246,18 @@ class LIEF_API DyldInfo : public LoadCommand {
   //! Set new trie
   void export_trie(buffer_t raw);
 
+  //! Lazy view over the raw export trie which does not depend
+  //! on the ExportInfo decoded by the parser.
+  ExportsTrieView exports_view() const {
+    return export_trie();
+  }
+
+  //! Look for the given symbol in the export trie without decoding
+  //! the whole trie (see: ExportsTrieView::find)
+  result<ExportsTrieView::export_t> find_export(const std::string& name) const {
+    return exports_view().find(name);
+  }
+
   //! Return the export trie in a humman-readable way
   std::string show_export_trie() const;
 
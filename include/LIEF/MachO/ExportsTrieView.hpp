@@ -0,0 +1,179 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MACHO_EXPORTS_TRIE_VIEW_H
+#define LIEF_MACHO_EXPORTS_TRIE_VIEW_H
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <iterator>
+
+#include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/visibility.h"
+
+#include "LIEF/MachO/enums.hpp"
+
+namespace LIEF {
+namespace MachO {
+
+//! Non-owning view over a raw dyld exports trie (LC_DYLD_EXPORTS_TRIE or
+//! the export area of LC_DYLD_INFO).
+//!
+//! Contrary to DyldExportsTrie::exports() or DyldInfo::exports(), this view
+//! does not require the trie to be decoded into ExportInfo objects:
+//! ExportsTrieView::find() follows the edges matching the requested name
+//! (O(len(name)) without allocation) and the iterator decodes the nodes on
+//! the fly.
+//!
+//! The view is valid as long as the underlying buffer is alive (i.e. as long
+//! as the Binary is not modified or destroyed).
+class LIEF_API ExportsTrieView {
+  public:
+  //! Information stored in a terminal node of the trie
+  struct LIEF_API export_t {
+    //! Offset of the terminal information in the trie (same as
+    //! ExportInfo::node_offset)
+    uint64_t node_offset = 0;
+
+    //! EXPORT_SYMBOL_FLAGS (same as ExportInfo::flags)
+    uint64_t flags = 0;
+
+    //! Address of the export (0 for a re-export)
+    uint64_t address = 0;
+
+    //! Library ordinal for a re-export or resolver's address for a
+    //! stub-and-resolver (same as ExportInfo::other)
+    uint64_t other = 0;
+
+    //! Name of the re-exported symbol. It points into the trie and it is
+    //! empty if the symbol is re-exported with the same name.
+    const char* imported_name = "";
+
+    bool has(EXPORT_SYMBOL_FLAGS flag) const {
+      return (flags & static_cast<uint64_t>(flag)) != 0;
+    }
+
+    EXPORT_SYMBOL_KINDS kind() const {
+      static constexpr auto MASK = EXPORT_SYMBOL_FLAGS::EXPORT_SYMBOL_FLAGS_KIND_MASK;
+      return static_cast<EXPORT_SYMBOL_KINDS>(flags & static_cast<uint64_t>(MASK));
+    }
+  };
+
+  //! Export yielded by the iterator
+  struct LIEF_API entry_t {
+    std::string name;
+    export_t info;
+  };
+
+  //! Forward iterator which decodes the trie lazily (depth-first, in the
+  //! same order as the ExportInfo created by the parser)
+  class LIEF_API iterator {
+    public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = entry_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const entry_t*;
+    using reference         = const entry_t&;
+
+    iterator() = default;
+    iterator(span<const uint8_t> trie);
+
+    iterator& operator++();
+
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    reference operator*() const {
+      return entry_;
+    }
+
+    pointer operator->() const {
+      return &entry_;
+    }
+
+    friend bool operator==(const iterator& lhs, const iterator& rhs) {
+      if (lhs.is_end_ || rhs.is_end_) {
+        return lhs.is_end_ == rhs.is_end_;
+      }
+      return lhs.trie_.data() == rhs.trie_.data() &&
+             lhs.entry_.info.node_offset == rhs.entry_.info.node_offset;
+    }
+
+    friend bool operator!=(const iterator& lhs, const iterator& rhs) {
+      return !(lhs == rhs);
+    }
+
+    private:
+    struct frame_t {
+      uint64_t children_offset = 0;
+      uint32_t remaining = 0;
+      size_t prefix_size = 0;
+    };
+
+    bool enter(uint64_t offset);
+    void next();
+    void finish();
+
+    span<const uint8_t> trie_;
+    std::vector<frame_t> stack_;
+    std::set<uint64_t> visited_;
+    entry_t entry_;
+    bool is_end_ = true;
+  };
+
+  ExportsTrieView() = default;
+  ExportsTrieView(span<const uint8_t> trie) :
+    trie_(trie)
+  {}
+
+  //! Look for the export associated with the given name.
+  //!
+  //! It returns lief_errors::not_found if the symbol is not exported
+  //! and lief_errors::read_error if the trie is corrupted.
+  result<export_t> find(const std::string& name) const;
+
+  //! Check if the given name is exported by the trie
+  bool has(const std::string& name) const {
+    return find(name).has_value();
+  }
+
+  iterator begin() const {
+    return iterator(trie_);
+  }
+
+  iterator end() const {
+    return {};
+  }
+
+  bool empty() const {
+    return trie_.empty();
+  }
+
+  span<const uint8_t> content() const {
+    return trie_;
+  }
+
+  private:
+  span<const uint8_t> trie_;
+};
+
+}
+}
+#endif
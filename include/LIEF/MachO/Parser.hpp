@@ -83,6 +83,15 @@ class LIEF_API Parser : public LIEF::Parser {
   static std::unique_ptr<FatBinary> parse_from_memory(uintptr_t address, size_t size,
                                                       const ParserConfig& conf = ParserConfig::deep());
 
+  //! Load a snapshot created by Binary::save_snapshot(). ``source`` is the
+  //! Mach-O file (possibly FAT) from which the snapshot has been created:
+  //! the exports and the dyld bindings/rebases are restored from the snapshot
+  //! while the other structures are parsed from this file. If the SHA-256 of
+  //! the binary does not match the one recorded in the snapshot, the snapshot
+  //! is considered as stale and a nullptr is returned.
+  static std::unique_ptr<Binary> parse_snapshot(const std::string& snapshot,
+                                                const std::string& source);
+
   private:
   Parser(const std::string& file, const ParserConfig& conf);
   Parser(std::vector<uint8_t> data, const ParserConfig& conf);
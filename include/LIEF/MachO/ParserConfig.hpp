@@ -37,8 +37,8 @@ struct LIEF_API ParserConfig {
   ParserConfig& full_dyldinfo(bool flag);
 
   bool parse_dyld_exports  = true; ///< Parse the Dyld export trie
-  bool parse_dyld_bindings = true; ///< Parse the Dyld binding opcodes
-  bool parse_dyld_rebases  = true; ///< Parse the Dyld rebase opcodes
+  bool parse_dyld_bindings = true; ///< Parse the Dyld binding opcodes (and create the chained bindings)
+  bool parse_dyld_rebases  = true; ///< Parse the Dyld rebase opcodes (and create the chained relocations)
 
   /// When parsing Mach-O from memory, this option
   /// can be used to *undo* relocations and symbols bindings.
@@ -24,6 +24,7 @@
 #include "LIEF/span.hpp"
 #include "LIEF/types.hpp"
 #include "LIEF/visibility.h"
+#include "LIEF/SharedContent.hpp"
 
 #include "LIEF/iterators.hpp"
 #include "LIEF/MachO/LoadCommand.hpp"
@@ -38,6 +39,7 @@ class Builder;
 class Section;
 class Relocation;
 class DyldInfo;
+class DyldChainedFixups;
 
 namespace details {
 struct segment_command_32;
@@ -51,6 +53,7 @@ class LIEF_API SegmentCommand : public LoadCommand {
   friend class Binary;
   friend class Section;
   friend class Builder;
+  friend class DyldChainedFixups;
 
   public:
   using content_t = std::vector<uint8_t>;
@@ -135,7 +138,7 @@ class LIEF_API SegmentCommand : public LoadCommand {
 
   //! The raw content of this segment
   span<const uint8_t> content() const {
-    return data_;
+    return data_.content();
   }
 
   //! The original index of this segment
@@ -174,9 +177,10 @@ class LIEF_API SegmentCommand : public LoadCommand {
   static bool classof(const LoadCommand* cmd);
 
   protected:
-  span<uint8_t> writable_content() {
-    return data_;
-  }
+  //! Content of the segment that can be modified. If the content still
+  //! references the parser's buffer, a private copy is created through
+  //! update_data() so that the spans owned by LinkEdit are updated.
+  span<uint8_t> writable_content();
 
   void content_resize(size_t size);
   void content_insert(size_t where, size_t size);
@@ -201,9 +205,13 @@ class LIEF_API SegmentCommand : public LoadCommand {
   uint32_t nb_sections_ = 0;
   uint32_t flags_ = 0;
   int8_t  index_ = -1;
-  content_t data_;
+  SharedContent data_;
   sections_t sections_;
   relocations_t relocations_;
+
+  // Chained fixups whose RelocationFixup objects (for this segment)
+  // have not been created yet
+  DyldChainedFixups* chained_fixups_ = nullptr;
 };
 
 }
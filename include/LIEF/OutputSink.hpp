@@ -0,0 +1,151 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_OUTPUT_SINK_H
+#define LIEF_OUTPUT_SINK_H
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "LIEF/visibility.h"
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+
+//! Destination of the binaries written by the builders (ELF::Builder,
+//! PE::Builder, MachO::Builder).
+//!
+//! Compared to a ``std::ostream``, a sink is written at absolute offsets and
+//! can skip the runs of zeros (e.g. the padding between the segments) instead
+//! of writing them.
+class LIEF_API OutputSink {
+  public:
+  OutputSink() = default;
+  virtual ~OutputSink();
+
+  //! Write ``data`` at the given offset
+  virtual ok_error_t write(uint64_t offset, span<const uint8_t> data) = 0;
+
+  //! Fill ``size`` bytes with zeros at the given offset. The default
+  //! implementation writes the zeros but sinks which start zero-initialized
+  //! (like files) leave a hole.
+  virtual ok_error_t zeros(uint64_t offset, uint64_t size);
+
+  //! Must be called once all the content has been written. ``size`` is the
+  //! size of the output which can be larger than the last write if the
+  //! output ends with zeros.
+  virtual ok_error_t finalize(uint64_t size) = 0;
+
+  //! Write ``data`` at the given offset but use zeros() for the (page-sized)
+  //! runs of zeros.
+  ok_error_t write_sparse(uint64_t offset, span<const uint8_t> data);
+};
+
+//! Sink which writes in a file.
+//!
+//! On POSIX systems, the content of a regular file is written with ``pwrite()``
+//! and the runs of zeros that have not been written yet are skipped such as
+//! the filesystem can create holes (sparse file).
+//!
+//! The other outputs (pipes, FIFOs, ``/dev/stdout``, ...) are written
+//! sequentially: the offsets must be increasing and the gaps are filled
+//! with zeros.
+class LIEF_API FileSink : public OutputSink {
+  public:
+  static result<FileSink> open(const std::string& path);
+
+  FileSink(const FileSink&) = delete;
+  FileSink& operator=(const FileSink&) = delete;
+
+  FileSink(FileSink&& other);
+  FileSink& operator=(FileSink&& other);
+
+  ok_error_t write(uint64_t offset, span<const uint8_t> data) override;
+  ok_error_t zeros(uint64_t offset, uint64_t size) override;
+  ok_error_t finalize(uint64_t size) override;
+
+  ~FileSink() override;
+
+  private:
+  FileSink() = default;
+  void close();
+
+  int fd_ = -1;
+  FILE* file_ = nullptr;
+
+  // False for the outputs that can't be written at arbitrary offsets
+  bool is_regular_ = true;
+
+  // End of the content written so far (the current position when the
+  // output is not regular)
+  uint64_t end_ = 0;
+};
+
+//! Sink which writes in a file mapped in memory. The size of the output must
+//! be known beforehand.
+//!
+//! This sink is only available on POSIX systems
+class LIEF_API MmapSink : public OutputSink {
+  public:
+  static result<MmapSink> open(const std::string& path, uint64_t size);
+
+  MmapSink(const MmapSink&) = delete;
+  MmapSink& operator=(const MmapSink&) = delete;
+
+  MmapSink(MmapSink&& other);
+  MmapSink& operator=(MmapSink&& other);
+
+  ok_error_t write(uint64_t offset, span<const uint8_t> data) override;
+  ok_error_t zeros(uint64_t offset, uint64_t size) override;
+  ok_error_t finalize(uint64_t size) override;
+
+  ~MmapSink() override;
+
+  private:
+  MmapSink() = default;
+  void close();
+
+  int fd_ = -1;
+  uint8_t* data_ = nullptr;
+  uint64_t size_ = 0;
+};
+
+//! Sink which writes in a buffer provided by the caller. The writes that are
+//! out of the bounds of the buffer fail with lief_errors::data_too_large.
+class LIEF_API BufferSink : public OutputSink {
+  public:
+  BufferSink(span<uint8_t> buffer) :
+    buffer_(buffer)
+  {}
+
+  ok_error_t write(uint64_t offset, span<const uint8_t> data) override;
+  ok_error_t zeros(uint64_t offset, uint64_t size) override;
+  ok_error_t finalize(uint64_t size) override;
+
+  //! Number of bytes used in the buffer (once finalized)
+  uint64_t size() const {
+    return size_;
+  }
+
+  ~BufferSink() override = default;
+
+  private:
+  span<uint8_t> buffer_;
+  uint64_t size_ = 0;
+};
+
+}
+#endif
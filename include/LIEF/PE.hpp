@@ -66,6 +66,7 @@
 #include "LIEF/PE/signature/Signature.hpp"
 #include "LIEF/PE/signature/SignerInfo.hpp"
 #include "LIEF/PE/signature/SpcIndirectData.hpp"
+#include "LIEF/PE/signature/TrustStore.hpp"
 #include "LIEF/PE/signature/attributes.hpp"
 #include "LIEF/PE/signature/types.hpp"
 #include "LIEF/PE/signature/x509.hpp"
@@ -29,6 +29,7 @@
 #include "LIEF/PE/signature/Signature.hpp"
 
 #include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/SharedContent.hpp"
 
 #include "LIEF/visibility.h"
 
@@ -55,6 +56,31 @@ class LIEF_API Binary : public LIEF::Binary {
   friend class Builder;
 
   public:
+  //! Saved state of a binary created by Binary::snapshot() and used by
+  //! Binary::restore()
+  class LIEF_API Snapshot {
+    public:
+    Snapshot(Snapshot&&) noexcept;
+    Snapshot& operator=(Snapshot&&) noexcept;
+
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    ~Snapshot();
+
+    //! Create a new binary in the saved state. Contrary to Binary::restore(),
+    //! the objects of the binary from which the snapshot has been created
+    //! are not affected.
+    //!
+    //! It returns a nullptr if the snapshot is empty (i.e. moved)
+    std::unique_ptr<Binary> restore() const;
+
+    private:
+    friend class Binary;
+    Snapshot(std::unique_ptr<Binary> state);
+    std::unique_ptr<Binary> state_;
+  };
+
   //! Internal container for storing PE's Section
   using sections_t = std::vector<std::unique_ptr<Section>>;
 
@@ -345,6 +371,9 @@ class LIEF_API Binary : public LIEF::Binary {
     return export_.get();
   }
 
+  //! Return the RVA of the exported function ``func_name``
+  result<uint64_t> get_function_address(const std::string& func_name) const override;
+
   //! Return binary Symbols
   std::vector<Symbol>& symbols();
   const std::vector<Symbol>& symbols() const;
@@ -577,6 +606,33 @@ class LIEF_API Binary : public LIEF::Binary {
   //! When rebuilding, import table and relocations are not rebuilt.
   void write(std::ostream& os) override;
 
+  //! Save the current state of the binary so that it can be restored with
+  //! restore() (e.g. to try several modifications without parsing the
+  //! binary again).
+  //!
+  //! The sections, imports, resources, ... are copied but the content of
+  //! the sections is shared between the binary and the snapshot until one of
+  //! them modifies it.
+  Snapshot snapshot() const;
+
+  //! Restore the state saved by snapshot(). The snapshot can be restored
+  //! several times.
+  //!
+  //! \warning The references on the sections, imports, ... of this binary
+  //!          are invalidated (see: Snapshot::restore() to get a new binary
+  //!          instead)
+  void restore(const Snapshot& snapshot);
+
+  //! Save the imports, the exports and the base relocations of this binary
+  //! in a compact file that can be loaded with Parser::parse_snapshot()
+  //! without parsing these structures again.
+  //!
+  //! The other parts of the binary are parsed from the original file when the
+  //! snapshot is loaded. Therefore, this function fails with
+  //! lief_errors::not_supported if the binary has not been parsed from a file
+  //! (or a buffer) or if the content of its sections has been modified.
+  ok_error_t save_snapshot(const std::string& path) const;
+
   void accept(Visitor& visitor) const override;
 
   //! Patch the content at virtual address @p address with @p patch_value
@@ -632,6 +688,9 @@ class LIEF_API Binary : public LIEF::Binary {
   private:
   Binary();
 
+  //! Copy the state of ``from`` in ``to`` (see: snapshot())
+  static void copy_state(const Binary& from, Binary& to);
+
   //! Make space between the last section header and the beginning of the
   //! content of first section
   void make_space_for_new_section();
@@ -674,6 +733,9 @@ class LIEF_API Binary : public LIEF::Binary {
   std::vector<uint8_t> dos_stub_;
   std::vector<uint8_t> section_offset_padding_;
 
+  //! Content from which the binary has been parsed (shared with the sections)
+  SharedContent source_;
+
   std::unique_ptr<RichHeader> rich_header_;
   std::unique_ptr<Export> export_;
   std::unique_ptr<ResourceNode> resources_;
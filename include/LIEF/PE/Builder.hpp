@@ -32,6 +32,8 @@
 #include "LIEF/errors.hpp"
 
 namespace LIEF {
+class OutputSink;
+
 namespace PE {
 class Binary;
 class ResourceNode;
@@ -98,6 +100,9 @@ class LIEF_API Builder {
   //! @brief Write the build result into the ``os`` stream
   void write(std::ostream& os) const;
 
+  //! Write the build result into the given sink (file, mapping, buffer, ...)
+  ok_error_t write(OutputSink& sink) const;
+
   LIEF_API friend std::ostream& operator<<(std::ostream& os, const Builder& b);
 
   ok_error_t build(const DosHeader& dos_header);
@@ -18,6 +18,7 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "LIEF/Object.hpp"
 #include "LIEF/visibility.h"
@@ -91,6 +92,23 @@ class LIEF_API Export : public Object {
     return entries_;
   }
 
+  //! Return the ExportEntry with the given name or a nullptr if it is not found.
+  //!
+  //! To look up an export without parsing the binary, see PE::find_export()
+  const ExportEntry* find_entry(const std::string& name) const;
+
+  ExportEntry* find_entry(const std::string& name) {
+    return const_cast<ExportEntry*>(static_cast<const Export*>(this)->find_entry(name));
+  }
+
+  //! Return the ExportEntry associated with the given ordinal or a nullptr
+  //! if it is not found.
+  const ExportEntry* find_entry_at_ordinal(uint32_t ordinal) const;
+
+  ExportEntry* find_entry_at_ordinal(uint32_t ordinal) {
+    return const_cast<ExportEntry*>(static_cast<const Export*>(this)->find_entry_at_ordinal(ordinal));
+  }
+
   void export_flags(uint32_t flags) {
     export_flags_ = flags;
   }
@@ -125,7 +143,6 @@ class LIEF_API Export : public Object {
   uint32_t ordinal_base_ = 0;
   entries_t entries_;
   std::string name_;
-
 };
 
 }
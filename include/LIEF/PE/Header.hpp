@@ -16,6 +16,7 @@
 #ifndef LIEF_PE_HEADER_H
 #define LIEF_PE_HEADER_H
 #include <array>
+#include <set>
 #include <vector>
 #include <ostream>
 #include <cstdint>
@@ -23,6 +24,7 @@
 #include "LIEF/Object.hpp"
 #include "LIEF/visibility.h"
 #include "LIEF/enums.hpp"
+#include "LIEF/Abstract/enums.hpp"
 #include "LIEF/PE/enums.hpp"
 
 namespace LIEF {
@@ -151,6 +153,17 @@ class LIEF_API Header : public Object {
   //! The list of the CHARACTERISTICS
   std::vector<CHARACTERISTICS> characteristics_list() const;
 
+  //! LIEF abstract object type
+  OBJECT_TYPES abstract_object_type() const;
+
+  //! LIEF abstract architecture
+  //!
+  //! It returns Empty if it can't be abstracted
+  std::pair<ARCHITECTURES, std::set<MODES>> abstract_architecture() const;
+
+  //! LIEF abstract endianness
+  ENDIANNESS abstract_endianness() const;
+
   void machine(MACHINE_TYPES type) {
     machine_ = type;
   }
@@ -40,6 +40,7 @@ struct pe_import;
 class LIEF_API Import : public Object {
 
   friend class Parser;
+  friend class Binary;
   friend class Builder;
 
   public:
@@ -86,6 +86,15 @@ class LIEF_API Parser : public LIEF::Parser {
   static std::unique_ptr<Binary> parse(std::unique_ptr<BinaryStream> stream,
                                        const ParserConfig& conf = ParserConfig::all());
 
+  //! Load a snapshot created by Binary::save_snapshot(). ``source`` is the
+  //! PE file from which the snapshot has been created: the imports, the
+  //! exports and the relocations are restored from the snapshot while the
+  //! other structures are parsed from this file. If the SHA-256 of the file
+  //! does not match the one recorded in the snapshot, the snapshot is
+  //! considered as stale and a nullptr is returned.
+  static std::unique_ptr<Binary> parse_snapshot(const std::string& snapshot,
+                                                const std::string& source);
+
   Parser& operator=(const Parser& copy) = delete;
   Parser(const Parser& copy)            = delete;
 
@@ -22,6 +22,7 @@
 
 #include "LIEF/visibility.h"
 #include "LIEF/iterators.hpp"
+#include "LIEF/SharedContent.hpp"
 #include "LIEF/Abstract/Section.hpp"
 #include "LIEF/enums.hpp"
 #include "LIEF/PE/enums.hpp"
@@ -112,7 +113,16 @@ class LIEF_API Section : public LIEF::Section {
   }
 
   //! Content of the section's padding area
-  const std::vector<uint8_t>& padding() const {
+  //!
+  //! This function returns a copy of the padding: padding_content() can be
+  //! used to access it without copy.
+  std::vector<uint8_t> padding() const {
+    span<const uint8_t> content = padding_content();
+    return {content.begin(), content.end()};
+  }
+
+  //! Content of the section's padding area (without copy)
+  span<const uint8_t> padding_content() const {
     return padding_;
   }
 
@@ -218,11 +228,11 @@ class LIEF_API Section : public LIEF::Section {
 
   private:
   span<uint8_t> writable_content() {
-    return content_;
+    return content_.writable();
   }
 
-  std::vector<uint8_t> content_;
-  std::vector<uint8_t> padding_;
+  SharedContent content_;
+  SharedContent padding_;
   uint32_t virtual_size_           = 0;
   uint32_t pointer_to_relocations_ = 0;
   uint32_t pointer_to_linenumbers_ = 0;
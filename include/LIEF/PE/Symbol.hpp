@@ -41,6 +41,7 @@ struct pe_symbol;
 class LIEF_API Symbol : public LIEF::Symbol {
 
   friend class Parser;
+  friend class Binary;
   friend class Builder;
 
   public:
@@ -44,6 +44,7 @@ struct pe64_tls;
 //! This PE structure is also used to implement binary/library constructors.
 class LIEF_API TLS : public Object {
   friend class Parser;
+  friend class Binary;
   friend class Builder;
 
   public:
@@ -17,6 +17,8 @@
 #define LIEF_PE_SIGNATURE_H
 
 #include "LIEF/Object.hpp"
+#include "LIEF/SharedContent.hpp"
+#include "LIEF/span.hpp"
 #include "LIEF/visibility.h"
 
 #include "LIEF/PE/signature/x509.hpp"
@@ -111,8 +113,12 @@ class LIEF_API Signature : public Object {
   //! Return an iterator over the signers (SignerInfo) defined in the PKCS #7 signature
   it_const_signers_t signers() const;
 
-  //! Return the raw original PKCS7 signature
-  const std::vector<uint8_t>& raw_der() const;
+  //! Return the raw original PKCS7 signature.
+  //!
+  //! The signature (as well as its certificates) references the buffer from
+  //! which it has been parsed: this span is valid as long as the signature
+  //! (or a copy of it) is alive.
+  span<const uint8_t> raw_der() const;
 
   //! Find x509 certificate according to its serial number
   const x509* find_crt(const std::vector<uint8_t>& serialno) const;
@@ -167,7 +173,7 @@ class LIEF_API Signature : public Object {
   uint64_t                content_info_start_ = 0;
   uint64_t                content_info_end_ = 0;
 
-  std::vector<uint8_t> original_raw_signature_;
+  SharedContent raw_;
 };
 
 
@@ -27,6 +27,7 @@
 namespace LIEF {
 class BinaryStream;
 class VectorStream;
+class SharedContent;
 
 namespace PE {
 class Parser;
@@ -71,15 +72,26 @@ class LIEF_API SignatureParser {
   ~SignatureParser();
   SignatureParser();
 
+  //! Parse the signature from a blob which is shared with the signature
+  //! (and its certificates)
+  static result<Signature> parse_blob(SharedContent blob, bool skip_header);
+
+  //! ``stream`` must reference the content of ``blob``. The overloads without
+  //! ``blob`` parse a copy of the stream's content.
   static result<Signature> parse_signature(BinaryStream& stream);
+  static result<Signature> parse_signature(BinaryStream& stream, const SharedContent& blob);
 
   static result<ContentInfo> parse_content_info(BinaryStream& stream, range_t& range);
   static result<x509_certificates_t> parse_certificates(BinaryStream& stream);
+  static result<x509_certificates_t> parse_certificates(BinaryStream& stream, const SharedContent& blob);
   static result<signer_infos_t> parse_signer_infos(BinaryStream& stream);
+  static result<signer_infos_t> parse_signer_infos(BinaryStream& stream, const SharedContent& blob);
   static result<attributes_t> parse_attributes(BinaryStream& stream);
+  static result<attributes_t> parse_attributes(BinaryStream& stream, const SharedContent& blob);
   static result<std::unique_ptr<Attribute>> parse_content_type(BinaryStream& stream);
 
   static result<signer_infos_t> parse_pkcs9_counter_sign(BinaryStream& stream);
+  static result<signer_infos_t> parse_pkcs9_counter_sign(BinaryStream& stream, const SharedContent& blob);
   static result<std::vector<uint8_t>> parse_pkcs9_message_digest(BinaryStream& stream);
   static result<int32_t> parse_pkcs9_at_sequence_number(BinaryStream& stream);
   static result<time_t> parse_pkcs9_signing_time(BinaryStream& stream);
@@ -87,6 +99,7 @@ class LIEF_API SignatureParser {
 
   static result<std::unique_ptr<Attribute>> parse_ms_counter_sign(BinaryStream& stream);
   static result<Signature> parse_ms_spc_nested_signature(BinaryStream& stream);
+  static result<Signature> parse_ms_spc_nested_signature(BinaryStream& stream, const SharedContent& blob);
   static result<oid_t> parse_ms_spc_statement_type(BinaryStream& stream);
 
   static result<SpcSpOpusInfo> parse_spc_sp_opus_info(BinaryStream& stream);
@@ -0,0 +1,131 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PE_TRUST_STORE_H
+#define LIEF_PE_TRUST_STORE_H
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LIEF/visibility.h"
+
+#include "LIEF/PE/signature/x509.hpp"
+
+struct mbedtls_x509_crt;
+
+namespace LIEF {
+namespace PE {
+class Signature;
+
+//! Set of trusted (root) certificates used to verify the certificates of
+//! Authenticode signatures.
+//!
+//! Compared to x509::is_trusted_by, the roots are not copied for each
+//! verification: they are linked in a mbedtls chain once (once per thread
+//! that concurrently uses the store) and the verification results are cached
+//! by the SHA-256 fingerprint of the chain (leaf + intermediates). Therefore,
+//! the same store should be re-used to verify a large number of binaries
+//! signed with the same certificates. The cache is bounded by
+//! max_cache_size(): the oldest results are evicted first.
+//!
+//! verify() can be called concurrently from several threads while add()
+//! must not be called concurrently with verify().
+//!
+//! \code{.cpp}
+//! PE::TrustStore store(PE::x509::parse("windows-ca-bundle.pem"));
+//! for (const PE::Signature& sig : pe->signatures()) {
+//!   PE::x509::VERIFICATION_FLAGS flags = store.verify(sig);
+//! }
+//! \endcode
+class LIEF_API TrustStore {
+  public:
+  using certificates_t = std::vector<x509>;
+
+  //! Default value of max_cache_size()
+  static constexpr size_t DEFAULT_MAX_CACHE_SIZE = 4096;
+
+  TrustStore() = default;
+  TrustStore(certificates_t roots);
+
+  TrustStore(const TrustStore&) = delete;
+  TrustStore& operator=(const TrustStore&) = delete;
+
+  ~TrustStore();
+
+  //! Add a trusted certificate to the store. This function also clears the
+  //! cache of the verified chains
+  void add(const x509& cert);
+
+  //! Trusted certificates
+  const certificates_t& roots() const {
+    return roots_;
+  }
+
+  //! Number of trusted certificates
+  size_t size() const {
+    return roots_.size();
+  }
+
+  //! Verify that ``cert`` is trusted by this store, possibly through the
+  //! given ``intermediates`` certificates
+  x509::VERIFICATION_FLAGS verify(const x509& cert,
+                                  const certificates_t& intermediates = {}) const;
+
+  //! Verify the certificates of the signers of the given signature. The other
+  //! certificates embedded in the signature are used as intermediates.
+  //!
+  //! It returns the union of the flags of each signer (x509::VERIFICATION_FLAGS::BADCERT_MISSING
+  //! if the certificate of a signer can't be found)
+  x509::VERIFICATION_FLAGS verify(const Signature& sig) const;
+
+  //! Number of chains whose verification result is cached
+  size_t cache_size() const;
+
+  //! Maximum number of results kept in the cache
+  size_t max_cache_size() const;
+
+  //! Change the maximum number of cached results (0 disables the cache)
+  void max_cache_size(size_t size);
+
+  //! Clear the cached results. Since the verification depends on the
+  //! current time (expiration of the certificates), a long-lived store should
+  //! be periodically cleared
+  void clear_cache();
+
+  private:
+  using cache_t = std::unordered_map<std::string, x509::VERIFICATION_FLAGS>;
+
+  //! Take a copy of the roots in the mbedtls representation (linked list)
+  //! which is not used by another thread
+  mbedtls_x509_crt* acquire() const;
+  void release(mbedtls_x509_crt* chain) const;
+  void clear_chains();
+  void evict() const;
+
+  certificates_t roots_;
+
+  mutable std::mutex lock_;
+  mutable std::vector<mbedtls_x509_crt*> chains_;
+  mutable cache_t cache_;
+  // Fingerprints in insertion order (for the eviction)
+  mutable std::deque<std::string> cache_order_;
+  size_t max_cache_size_ = DEFAULT_MAX_CACHE_SIZE;
+};
+
+}
+}
+#endif
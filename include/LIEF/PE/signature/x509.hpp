@@ -36,6 +36,7 @@ namespace PE {
 class Parser;
 class SignatureParser;
 class Signature;
+class TrustStore;
 
 class RsaInfo;
 
@@ -45,6 +46,7 @@ class LIEF_API x509 : public Object {
   friend class Parser;
   friend class SignatureParser;
   friend class Signature;
+  friend class TrustStore;
 
   public:
   //! Tuple (Year, Month, Day, Hour, Minute, Second)
@@ -118,7 +120,11 @@ class LIEF_API x509 : public Object {
     DECIPHER_ONLY,         /**< In **association with** KEY_AGREEMENT (otherwise the meaning is undefined), the key is only used for deciphering data while performing key agreement */
   };
 
+  //! Take the ownership of the given mbedtls certificate
   x509(mbedtls_x509_crt* ca);
+
+  //! The underlying certificate is immutable and shared (refcounted) between
+  //! the copies: copying a x509 object does not re-parse the DER blob
   x509(const x509& other);
   x509& operator=(x509 other);
   void swap(x509& other);
@@ -160,9 +166,17 @@ class LIEF_API x509 : public Object {
   std::unique_ptr<RsaInfo> rsa_info() const;
 
   //! Verify that this certificate has been used **to trust** the given certificate
+  //!
+  //! This function can be called concurrently, including on copies that
+  //! share the same parsed certificate.
   VERIFICATION_FLAGS verify(const x509& ca) const;
 
   //! Verify that this certificate **is trusted** by the given CA list
+  //!
+  //! The roots of the last CA list are kept in a TrustStore so that
+  //! consecutive calls with the same list don't load them again.
+  //!
+  //! \see TrustStore to verify several certificates against the same CA list
   VERIFICATION_FLAGS is_trusted_by(const std::vector<x509>& ca) const;
 
   //! Policy information terms as OID (see RFC #5280)
@@ -187,7 +201,16 @@ class LIEF_API x509 : public Object {
 
   private:
   x509();
-  mbedtls_x509_crt* x509_cert_ = nullptr;
+
+  //! Certificate parsed without copying its DER blob. ``owner`` keeps alive
+  //! the buffer referenced by ``ca``
+  x509(mbedtls_x509_crt* ca, std::shared_ptr<const void> owner);
+
+  //! Verify the given chain (leaf first) against the trusted certificates
+  static VERIFICATION_FLAGS verify_chain(mbedtls_x509_crt& chain,
+                                         mbedtls_x509_crt& trusted);
+
+  std::shared_ptr<mbedtls_x509_crt> x509_cert_;
 
 };
 
@@ -70,6 +70,13 @@ LIEF_LOCAL result<PE_TYPE> get_type_from_stream(BinaryStream& stream);
 //! @see https://www.fireeye.com/blog/threat-research/2014/01/tracking-malware-import-hashing.html
 LIEF_API std::string get_imphash(const Binary& binary, IMPHASH_MODE mode = IMPHASH_MODE::DEFAULT);
 
+//! Compute the *imphash* of the given list of imports
+//!
+//! This function is used to compute the *imphash* from imports that are
+//! not attached to a LIEF::PE::Binary (see: LIEF::quick_scan)
+LIEF_API std::string get_imphash(const std::vector<Import>& imports,
+                                 IMPHASH_MODE mode = IMPHASH_MODE::DEFAULT);
+
 //! Take a PE::Import as entry and try to resolve imports
 //! by ordinal.
 //!
@@ -84,6 +91,27 @@ LIEF_API std::string get_imphash(const Binary& binary, IMPHASH_MODE mode = IMPHA
 LIEF_API result<Import> resolve_ordinals(const Import& import, bool strict=false, bool use_std=false);
 
 LIEF_API ALGORITHMS algo_from_oid(const std::string& oid);
+
+//! Export resolved by LIEF::PE::find_export
+struct export_lookup_t {
+  uint32_t ordinal   = 0;     ///< Ordinal of the export (including the ordinal base)
+  uint32_t address   = 0;     ///< RVA of the exported symbol or of the forwarder string
+  bool     is_extern = false; ///< ``true`` if the export is forwarded to another library
+};
+
+//! Look for the export ``name`` directly in the export directory of the PE
+//! file wrapped by the given stream.
+//!
+//! Contrary to the Parser, this function does not create ExportEntry objects:
+//! it performs a binary search on the (sorted) export name pointer table
+//! and does not allocate memory.
+//!
+//! @param[in] stream Stream over the raw PE file (the position is not changed)
+//! @param[in] name   Name of the export to resolve
+LIEF_API result<export_lookup_t> find_export(BinaryStream& stream, const std::string& name);
+
+//! Same as above but with the (biased) ordinal of the export
+LIEF_API result<export_lookup_t> find_export(BinaryStream& stream, uint32_t ordinal);
 }
 }
 #endif
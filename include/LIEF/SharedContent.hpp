@@ -0,0 +1,143 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_SHARED_CONTENT_H
+#define LIEF_SHARED_CONTENT_H
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+
+//! Copy-on-write byte buffer used to store the content of sections and
+//! segments.
+//!
+//! When created from a parser, the content references a slice of the
+//! (refcounted) buffer in which the file has been loaded instead of owning
+//! a copy of it. A private copy is only created when the content is
+//! modified through writable() or assign().
+class SharedContent {
+  public:
+  using buffer_t = std::vector<uint8_t>;
+  using source_t = std::shared_ptr<const buffer_t>;
+
+  SharedContent() = default;
+
+  SharedContent(buffer_t data) :
+    owned_(std::move(data))
+  {}
+
+  //! Reference ``size`` bytes of ``source`` starting at ``offset``.
+  //! The caller is in charge of checking that the slice is within the bounds
+  SharedContent(source_t source, uint64_t offset, uint64_t size) :
+    source_(std::move(source)),
+    ptr_(source_->data() + offset),
+    size_(size)
+  {}
+
+  SharedContent(const SharedContent&) = default;
+  SharedContent& operator=(const SharedContent&) = default;
+
+  SharedContent(SharedContent&&) = default;
+  SharedContent& operator=(SharedContent&&) = default;
+
+  SharedContent& operator=(buffer_t data) {
+    assign(std::move(data));
+    return *this;
+  }
+
+  span<const uint8_t> content() const {
+    if (is_shared()) {
+      return {ptr_, size_};
+    }
+    return owned_;
+  }
+
+  operator span<const uint8_t>() const {
+    return content();
+  }
+
+  const uint8_t* data() const {
+    return is_shared() ? ptr_ : owned_.data();
+  }
+
+  size_t size() const {
+    return is_shared() ? size_ : owned_.size();
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  //! True if the content still references the source buffer
+  bool is_shared() const {
+    return source_ != nullptr;
+  }
+
+  //! Buffer referenced by the content (nullptr if the content is owned)
+  const source_t& source() const {
+    return source_;
+  }
+
+  //! Content of ``size`` bytes starting at ``offset`` which references the
+  //! same source buffer (or a copy if this content is owned).
+  //! The caller is in charge of checking that the slice is within the bounds
+  SharedContent slice(uint64_t offset, uint64_t size) const {
+    if (is_shared()) {
+      const auto start = static_cast<uint64_t>(ptr_ - source_->data());
+      return SharedContent(source_, start + offset, size);
+    }
+    return SharedContent(buffer_t(owned_.begin() + offset,
+                                  owned_.begin() + offset + size));
+  }
+
+  //! Return the private copy of the content. The copy is created on the
+  //! first call and the reference on the source buffer is released.
+  buffer_t& writable() {
+    if (is_shared()) {
+      owned_.assign(ptr_, ptr_ + size_);
+      release();
+    }
+    return owned_;
+  }
+
+  //! Replace the content with the given data
+  void assign(buffer_t data) {
+    release();
+    owned_ = std::move(data);
+  }
+
+  buffer_t to_vector() const {
+    span<const uint8_t> raw = content();
+    return {raw.begin(), raw.end()};
+  }
+
+  private:
+  void release() {
+    source_.reset();
+    ptr_  = nullptr;
+    size_ = 0;
+  }
+
+  source_t source_;
+  const uint8_t* ptr_ = nullptr;
+  size_t size_ = 0;
+  buffer_t owned_;
+};
+
+}
+#endif
@@ -54,13 +54,7 @@ class vector_iostream {
 
   template<class T, typename U = typename std::enable_if<!std::is_integral<T>::value>, T>
   vector_iostream& write(const U& t) {
-    const auto pos = static_cast<size_t>(tellp());
-    if (raw_.size() < (pos + sizeof(T))) {
-      raw_.resize(pos + sizeof(T));
-    }
-    memcpy(raw_.data() + pos, &t, sizeof(T));
-    current_pos_ += sizeof(T);
-    return *this;
+    return write(reinterpret_cast<const uint8_t*>(&t), sizeof(T));
   }
 
   template<typename T>
@@ -73,13 +67,7 @@ class vector_iostream {
 
   template<class Integer, typename = typename std::enable_if<std::is_integral<Integer>::value>>
   vector_iostream& write(Integer integer) {
-    const auto pos = static_cast<size_t>(tellp());
-    if (raw_.size() < (pos + sizeof(Integer))) {
-      raw_.resize(pos + sizeof(Integer));
-    }
-    memcpy(raw_.data() + pos, &integer, sizeof(Integer));
-    current_pos_ += sizeof(Integer);
-    return *this;
+    return write(reinterpret_cast<const uint8_t*>(&integer), sizeof(Integer));
   }
 
   template<typename T, size_t size, typename = typename std::enable_if<std::is_integral<T>::value>>
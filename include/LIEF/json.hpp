@@ -16,11 +16,32 @@
 #ifndef LIEF_JSON_MAIN_H
 #define LIEF_JSON_MAIN_H
 #include <string>
+#include <set>
+#include <ostream>
 #include <LIEF/visibility.h>
 namespace LIEF {
 class Object;
 
+//! Configuration for the streaming JSON serialization
+//! (see: to_json(const Object&, std::ostream&, const JsonConfig&))
+struct LIEF_API JsonConfig {
+  //! If not empty, only these top-level entries are serialized
+  //! (e.g. ``{"header", "imports"}``)
+  std::set<std::string> only;
+
+  //! Top-level entries that must not be serialized (e.g. ``{"symbols"}``)
+  std::set<std::string> skip;
+};
+
 LIEF_API std::string to_json(const Object& v);
 
+//! Serialize the given object in JSON directly into the output stream.
+//!
+//! Contrary to to_json(const Object&), the JSON representation of a binary is
+//! never entirely built in memory: the elements of the large lists
+//! (sections, symbols, relocations, ...) are serialized one by one.
+LIEF_API void to_json(const Object& v, std::ostream& os,
+                      const JsonConfig& config = JsonConfig());
+
 }
 #endif
@@ -20,6 +20,7 @@
 #include "LIEF/types.hpp"
 
 #include <string>
+#include <cstdint>
 
 namespace spdlog {
 class logger;
@@ -42,7 +43,27 @@ enum LOGGING_LEVEL {
   LOG_CRITICAL,
 };
 
+//! Subsystems for which the logging level can be tuned independently
+//! of the global level.
+//!
+//! For instance, ``set_level(MODULE::MACHO_CHAINED_FIXUPS, LOG_DEBUG)`` only
+//! enables the debug messages related to the Mach-O chained fixups while the
+//! other parts of LIEF keep the global logging level.
+enum class MODULE : uint32_t {
+  GENERIC = 0,
+  ELF,
+  PE,
+  MACHO,
+  MACHO_DYLD_INFO,
+  MACHO_CHAINED_FIXUPS,
+  OAT,
+  DEX,
+  VDEX,
+  ART,
+};
+
 LIEF_API const char* to_string(LOGGING_LEVEL e);
+LIEF_API const char* to_string(MODULE e);
 
 //! Globally disable the logging module
 LIEF_API void disable();
@@ -51,8 +72,13 @@ LIEF_API void disable();
 LIEF_API void enable();
 
 //! Change the logging level (**hierarchical**)
+//!
+//! This level is applied to all the modules (see: LIEF::logging::MODULE)
 LIEF_API void set_level(LOGGING_LEVEL level);
 
+//! Change the logging level (**hierarchical**) of the given module only
+LIEF_API void set_level(MODULE module, LOGGING_LEVEL level);
+
 //! Change the logger as a file-base logging and set its path
 LIEF_API void set_path(const std::string& path);
 
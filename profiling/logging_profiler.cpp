@@ -0,0 +1,45 @@
+#include <LIEF/LIEF.hpp>
+#include <LIEF/logging.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+// Measure the overhead of the (disabled) logging on the parsers.
+//
+// The figures printed by this profiler are meant to be compared between a
+// regular build and a build configured with -DLIEF_LOGGING_DEBUG=OFF
+// (i.e. where the debug messages are compiled out)
+static double bench(const std::filesystem::path& target, size_t nb_iterations) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nb_iterations; ++i) {
+    LIEF::Parser::parse(target.string());
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const std::chrono::duration<double, std::milli> elapsed = end - start;
+  return elapsed.count() / nb_iterations;
+}
+
+int main(int argc, const char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <binary> [iterations]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  const std::filesystem::path target{argv[1]};
+  const size_t nb_iterations = argc > 2 ? std::stoul(argv[2]) : 20;
+
+  using namespace LIEF::logging;
+  set_level(LOG_WARN);
+  fprintf(stdout, "default level:                   %.3f ms\n",
+          bench(target, nb_iterations));
+
+  // The sink is now at the DEBUG level but only the messages of this module
+  // must be formatted
+  set_level(MODULE::ART, LOG_DEBUG);
+  fprintf(stdout, "debug enabled for another module: %.3f ms\n",
+          bench(target, nb_iterations));
+
+  disable();
+  fprintf(stdout, "logging disabled:                %.3f ms\n",
+          bench(target, nb_iterations));
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+#include <LIEF/PE.hpp>
+#include <LIEF/PE/signature/SignatureParser.hpp>
+#include <LIEF/logging.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <vector>
+
+// Measure the time and the number of allocations needed to parse PKCS #7
+// (Authenticode) signatures. The input is either a DER blob or a directory of
+// DER blobs like the corpus of the pkcs7_signature fuzzer.
+static std::atomic<size_t> NB_ALLOCS{0};
+
+void* operator new(size_t size) {
+  ++NB_ALLOCS;
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+static std::vector<uint8_t> read_file(const std::filesystem::path& path) {
+  std::ifstream ifs(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+}
+
+int main(int argc, const char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <blob|corpus dir> [iterations]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  const std::filesystem::path target{argv[1]};
+  const size_t nb_iterations = argc > 2 ? std::stoul(argv[2]) : 20;
+  LIEF::logging::disable();
+
+  std::vector<std::vector<uint8_t>> blobs;
+  if (std::filesystem::is_directory(target)) {
+    for (const auto& entry : std::filesystem::directory_iterator(target)) {
+      if (entry.is_regular_file()) {
+        blobs.push_back(read_file(entry.path()));
+      }
+    }
+  } else {
+    blobs.push_back(read_file(target));
+  }
+
+  size_t nb_signatures = 0;
+  size_t nb_certificates = 0;
+  const size_t allocs_start = NB_ALLOCS;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nb_iterations; ++i) {
+    for (const std::vector<uint8_t>& blob : blobs) {
+      auto sig = LIEF::PE::SignatureParser::parse(blob);
+      if (!sig) {
+        continue;
+      }
+      ++nb_signatures;
+      nb_certificates += sig->certificates().size();
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const size_t nb_allocs = NB_ALLOCS - allocs_start;
+  const std::chrono::duration<double, std::milli> elapsed = end - start;
+
+  if (nb_signatures == 0) {
+    fprintf(stderr, "No valid signature in %s\n", target.string().c_str());
+    return EXIT_FAILURE;
+  }
+  fprintf(stdout, "signatures:               %zu (%zu certificates)\n",
+          nb_signatures / nb_iterations, nb_certificates / nb_iterations);
+  fprintf(stdout, "time per signature:       %.3f us\n",
+          elapsed.count() * 1000.0 / nb_signatures);
+  fprintf(stdout, "allocations per signature: %.1f\n",
+          double(nb_allocs) / nb_signatures);
+  fprintf(stdout, "allocations per certificate: %.1f\n",
+          nb_certificates == 0 ? 0.0 : double(nb_allocs) / nb_certificates);
+  return EXIT_SUCCESS;
+}
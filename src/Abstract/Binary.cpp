@@ -15,13 +15,54 @@
  */
 #include "LIEF/Abstract/Binary.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 #include "LIEF/Visitor.hpp"
+#include "LIEF/hash.hpp"
 #include "logging.hpp"
+#include "parallel.hpp"
 
 #include "LIEF/Abstract/Section.hpp"
 #include "LIEF/Abstract/Symbol.hpp"
 
 namespace LIEF {
+
+namespace {
+// Below this amount of content, the sections are processed by the calling
+// thread as the cost of the threads would exceed the gain.
+static constexpr uint64_t PARALLEL_MIN_SIZE = 0x100000;
+
+template<class T, class F>
+std::vector<T> map_sections(const Binary& binary, F&& fn) {
+  std::vector<T> results(binary.sections().size());
+  binary.for_each_section_parallel(
+    [&results, &fn] (size_t idx, const Section& section) {
+      results[idx] = fn(section);
+    });
+  return results;
+}
+
+// Virtual addresses of the occurrences of ``value`` ordered by section
+template<class T>
+std::vector<uint64_t> search_all_sections(const Binary& binary, const T& value) {
+  const std::vector<std::vector<uint64_t>> founds = map_sections<std::vector<uint64_t>>(binary,
+    [&value] (const Section& section) {
+      std::vector<uint64_t> addresses;
+      for (size_t found : section.search_all(value)) {
+        addresses.push_back(section.virtual_address() + found);
+      }
+      return addresses;
+    });
+
+  std::vector<uint64_t> result;
+  for (const std::vector<uint64_t>& addresses : founds) {
+    result.insert(result.end(), addresses.begin(), addresses.end());
+  }
+  return result;
+}
+}
+
 Binary::Binary() = default;
 
 Binary::~Binary() = default;
@@ -117,6 +158,59 @@ std::vector<uint64_t> Binary::xref(uint64_t address) const {
   return result;
 }
 
+void Binary::for_each_section_parallel(const std::function<void(size_t, const Section&)>& fn) const {
+  const sections_t sections = const_cast<Binary*>(this)->get_abstract_sections();
+
+  uint64_t total_size = 0;
+  for (const Section* section : sections) {
+    total_size += section->size();
+  }
+
+  if (total_size < PARALLEL_MIN_SIZE) {
+    for (size_t idx = 0; idx < sections.size(); ++idx) {
+      fn(idx, *sections[idx]);
+    }
+    return;
+  }
+
+  // Dispatch the largest sections first so that a large section is not
+  // processed alone at the end while the other threads are idle.
+  std::vector<size_t> order(sections.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+    [&sections] (size_t lhs, size_t rhs) {
+      return sections[lhs]->size() > sections[rhs]->size();
+    });
+
+  parallel::for_each_index(order.size(), parallel::nb_threads(),
+    [&sections, &order, &fn] (size_t i) {
+      const size_t idx = order[i];
+      fn(idx, *sections[idx]);
+    });
+}
+
+std::vector<uint64_t> Binary::xref_parallel(uint64_t address) const {
+  return search_all_sections(*this, address);
+}
+
+std::vector<uint64_t> Binary::search_all_parallel(const std::string& pattern) const {
+  return search_all_sections(*this, pattern);
+}
+
+std::vector<double> Binary::sections_entropy_parallel() const {
+  return map_sections<double>(*this,
+    [] (const Section& section) {
+      return section.entropy();
+    });
+}
+
+std::vector<size_t> Binary::sections_hash_parallel() const {
+  return map_sections<size_t>(*this,
+    [] (const Section& section) {
+      return LIEF::hash(section);
+    });
+}
+
 void Binary::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
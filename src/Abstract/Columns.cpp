@@ -0,0 +1,216 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/config.h"
+#include "LIEF/Abstract/Columns.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+
+#if defined(LIEF_ELF_SUPPORT)
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Symbol.hpp"
+#include "LIEF/PE/Relocation.hpp"
+#include "LIEF/PE/RelocationEntry.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+#include "LIEF/MachO/Relocation.hpp"
+#endif
+
+namespace LIEF {
+
+namespace {
+// Fill the symbol columns in two passes over ``symbols``: the first one
+// computes the sizes so that each column is allocated once.
+template<class SYMBOLS, class F>
+void fill(SymbolColumns& columns, const SYMBOLS& symbols, F&& func) {
+  const size_t count = symbols.size();
+  size_t nb_bytes = 0;
+  for (const auto& sym : symbols) {
+    nb_bytes += sym.name().size();
+  }
+
+  columns.names.reserve(count, nb_bytes);
+  columns.values.reserve(count);
+  columns.sizes.reserve(count);
+  columns.types.reserve(count);
+  columns.bindings.reserve(count);
+  columns.section_indexes.reserve(count);
+
+  for (const auto& sym : symbols) {
+    columns.names.push_back(sym.name());
+    columns.values.push_back(sym.value());
+    columns.sizes.push_back(sym.size());
+    func(columns, sym);
+  }
+}
+
+template<class RELOCATIONS, class F>
+void fill(RelocationColumns& columns, const RELOCATIONS& relocations, F&& func) {
+  const size_t count = columns.size() + relocations.size();
+  columns.addresses.reserve(count);
+  columns.types.reserve(count);
+  columns.sizes.reserve(count);
+  columns.addends.reserve(count);
+  columns.symbols.reserve(count, 0);
+
+  for (const auto& reloc : relocations) {
+    columns.addresses.push_back(reloc.address());
+    columns.sizes.push_back(static_cast<uint32_t>(reloc.size()));
+    func(columns, reloc);
+  }
+}
+}
+
+#if defined(LIEF_ELF_SUPPORT)
+namespace ELF {
+namespace {
+void extract(SymbolColumns& columns, const Binary& binary) {
+  fill(columns, binary.symbols(),
+    [] (SymbolColumns& columns, const Symbol& sym) {
+      columns.types.push_back(static_cast<uint32_t>(sym.type()));
+      columns.bindings.push_back(static_cast<uint32_t>(sym.binding()));
+      columns.section_indexes.push_back(sym.shndx());
+    });
+}
+
+void extract(RelocationColumns& columns, const Binary& binary) {
+  fill(columns, binary.relocations(),
+    [] (RelocationColumns& columns, const Relocation& reloc) {
+      const Symbol* sym = reloc.symbol();
+      columns.types.push_back(reloc.type());
+      columns.addends.push_back(reloc.addend());
+      columns.symbols.push_back(sym != nullptr ? sym->name() : "");
+    });
+}
+}
+}
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+namespace PE {
+namespace {
+void extract(SymbolColumns& columns, const Binary& binary) {
+  fill(columns, binary.symbols(),
+    [] (SymbolColumns& columns, const Symbol& sym) {
+      columns.types.push_back(sym.type());
+      columns.bindings.push_back(static_cast<uint32_t>(sym.storage_class()));
+      columns.section_indexes.push_back(sym.section_number());
+    });
+}
+
+void extract(RelocationColumns& columns, const Binary& binary) {
+  size_t count = 0;
+  for (const Relocation& reloc : binary.relocations()) {
+    count += reloc.entries().size();
+  }
+
+  // Reserve all the entries upfront so that fill() does not reallocate
+  // the columns for each block
+  columns.addresses.reserve(count);
+  columns.types.reserve(count);
+  columns.sizes.reserve(count);
+  columns.addends.reserve(count);
+  columns.symbols.reserve(count, 0);
+
+  // PE base relocations are not associated with symbols nor addends
+  for (const Relocation& reloc : binary.relocations()) {
+    fill(columns, reloc.entries(),
+      [] (RelocationColumns& columns, const RelocationEntry& entry) {
+        columns.types.push_back(static_cast<uint32_t>(entry.type()));
+        columns.addends.push_back(0);
+        columns.symbols.push_back("");
+      });
+  }
+}
+}
+}
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+namespace MachO {
+namespace {
+void extract(SymbolColumns& columns, const Binary& binary) {
+  fill(columns, binary.symbols(),
+    [] (SymbolColumns& columns, const Symbol& sym) {
+      columns.types.push_back(sym.type());
+      columns.bindings.push_back(sym.description());
+      columns.section_indexes.push_back(sym.numberof_sections());
+    });
+}
+
+void extract(RelocationColumns& columns, const Binary& binary) {
+  fill(columns, binary.relocations(),
+    [] (RelocationColumns& columns, const Relocation& reloc) {
+      const Symbol* sym = reloc.symbol();
+      columns.types.push_back(reloc.type());
+      columns.addends.push_back(0);
+      columns.symbols.push_back(sym != nullptr ? sym->name() : "");
+    });
+}
+}
+}
+#endif
+
+namespace {
+template<class T>
+T extract_columns(const Binary& binary) {
+  T columns;
+  switch (binary.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case EXE_FORMATS::FORMAT_ELF:
+      ELF::extract(columns, static_cast<const ELF::Binary&>(binary));
+      break;
+#endif
+#if defined(LIEF_PE_SUPPORT)
+    case EXE_FORMATS::FORMAT_PE:
+      PE::extract(columns, static_cast<const PE::Binary&>(binary));
+      break;
+#endif
+#if defined(LIEF_MACHO_SUPPORT)
+    case EXE_FORMATS::FORMAT_MACHO:
+      MachO::extract(columns, static_cast<const MachO::Binary&>(binary));
+      break;
+#endif
+    default:
+      break;
+  }
+  return columns;
+}
+}
+
+std::string string_column_t::get(size_t i) const {
+  if (i >= size()) {
+    return "";
+  }
+  return data.substr(offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+SymbolColumns SymbolColumns::extract(const Binary& binary) {
+  return extract_columns<SymbolColumns>(binary);
+}
+
+RelocationColumns RelocationColumns::extract(const Binary& binary) {
+  return extract_columns<RelocationColumns>(binary);
+}
+
+}
@@ -0,0 +1,775 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include "logging.hpp"
+#include "parallel.hpp"
+
+#include "LIEF/config.h"
+#include "LIEF/iostream.hpp"
+#include "LIEF/Abstract/ExportIndex.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Parser.hpp"
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#if defined(LIEF_ELF_SUPPORT)
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/DynamicSharedObject.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#include "LIEF/ELF/SymbolVersion.hpp"
+#include "LIEF/ELF/SymbolVersionAux.hpp"
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/DataDirectory.hpp"
+#include "LIEF/PE/Export.hpp"
+#include "LIEF/PE/ExportEntry.hpp"
+#include "LIEF/PE/Import.hpp"
+#include "LIEF/PE/ImportEntry.hpp"
+#include "LIEF/PE/utils.hpp"
+#include "PE/Structures.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/DylibCommand.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+#include "LIEF/MachO/BindingInfo.hpp"
+#endif
+
+namespace LIEF {
+
+namespace details {
+struct export_t {
+  std::string name;
+  std::string version;
+  std::string forward_library;
+  std::string forward_name;
+  uint64_t address = 0;
+  uint32_t ordinal = 0;
+};
+
+// Exports of a single library, extracted from a Binary
+struct library_exports_t {
+  std::string library;
+  std::vector<export_t> exports;
+};
+}
+
+using details::export_t;
+using details::library_exports_t;
+
+static constexpr char INDEX_MAGIC[] = {'L', 'I', 'E', 'F', 'E', 'I', 'D', 'X'};
+static constexpr uint32_t INDEX_VERSION = 1;
+
+// Forwarders can loop (A.f -> B.f -> A.f)
+static constexpr size_t MAX_FORWARD_DEPTH = 8;
+
+static std::string basename(const std::string& path) {
+  const size_t pos = path.find_last_of("/\\");
+  return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+// Lowercase name of the library without its extension such as two libraries
+// have the same key if and only if same_library() is true
+static std::string library_key(const std::string& name) {
+  const size_t dot = name.find_last_of('.');
+  std::string key = name.substr(0, dot);
+  std::transform(key.begin(), key.end(), key.begin(),
+    [] (char c) {
+      return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+  return key;
+}
+
+// Compare two library names without considering the case and the
+// extension (PE forwarders reference "NTDLL" for "ntdll.dll")
+static bool same_library(const std::string& lhs, const std::string& rhs) {
+  static const auto stem = [] (const std::string& name) {
+    const size_t dot = name.find_last_of('.');
+    return dot == std::string::npos ? name.size() : dot;
+  };
+  const size_t lsize = stem(lhs);
+  const size_t rsize = stem(rhs);
+  if (lsize != rsize) {
+    return false;
+  }
+  return std::equal(lhs.begin(), lhs.begin() + lsize, rhs.begin(),
+    [] (char l, char r) {
+      return std::tolower(static_cast<unsigned char>(l)) ==
+             std::tolower(static_cast<unsigned char>(r));
+    });
+}
+
+// Keep the elements that match the predicate unless none of them match
+template<class T, class F>
+static void keep_if_any(std::vector<T>& values, F&& pred) {
+  if (std::any_of(values.begin(), values.end(), pred)) {
+    values.erase(std::remove_if(values.begin(), values.end(),
+                                [&pred] (const T& value) { return !pred(value); }),
+                 values.end());
+  }
+}
+
+#if defined(LIEF_ELF_SUPPORT)
+static std::string symbol_version(const ELF::Symbol& sym) {
+  const ELF::SymbolVersion* version = sym.symbol_version();
+  if (version == nullptr || !version->has_auxiliary_version()) {
+    return "";
+  }
+  return version->symbol_version_auxiliary()->name();
+}
+
+static library_exports_t elf_exports(const ELF::Binary& elf) {
+  library_exports_t result;
+  const ELF::DynamicEntry* soname = elf.get(ELF::DYNAMIC_TAGS::DT_SONAME);
+  if (soname != nullptr && ELF::DynamicSharedObject::classof(soname)) {
+    result.library = static_cast<const ELF::DynamicSharedObject*>(soname)->name();
+  }
+
+  for (const ELF::Symbol& sym : elf.dynamic_symbols()) {
+    if (!sym.is_exported() || sym.name().empty()) {
+      continue;
+    }
+    export_t exp;
+    exp.name    = sym.name();
+    exp.version = symbol_version(sym);
+    exp.address = sym.value();
+    result.exports.push_back(std::move(exp));
+  }
+  return result;
+}
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+// The name of a forwarded PE::ExportEntry is the forwarder string
+// (e.g. "NTDLL.RtlFoo"), so the exported names are read again from the
+// name pointer table. It returns a map: ordinal -> name
+static std::unordered_map<uint32_t, std::string> pe_export_names(const PE::Binary& pe) {
+  static constexpr size_t MAX_NAME_SIZE = 0x1000;
+  std::unordered_map<uint32_t, std::string> names;
+  const PE::DataDirectory* dir = pe.data_directory(PE::DataDirectory::TYPES::EXPORT_TABLE);
+  if (dir == nullptr || dir->RVA() == 0) {
+    return names;
+  }
+
+  const auto va = LIEF::Binary::VA_TYPES::RVA;
+  span<const uint8_t> raw_table =
+    pe.get_content_from_virtual_address(dir->RVA(), sizeof(PE::details::pe_export_directory_table), va);
+  if (raw_table.size() < sizeof(PE::details::pe_export_directory_table)) {
+    return names;
+  }
+  PE::details::pe_export_directory_table table;
+  std::memcpy(&table, raw_table.data(), sizeof(table));
+
+  const size_t nb_names = table.NumberOfNamePointers;
+  span<const uint8_t> name_ptrs =
+    pe.get_content_from_virtual_address(table.NamePointerRVA, nb_names * sizeof(uint32_t), va);
+  span<const uint8_t> ordinals =
+    pe.get_content_from_virtual_address(table.OrdinalTableRVA, nb_names * sizeof(uint16_t), va);
+
+  const size_t count = std::min(name_ptrs.size() / sizeof(uint32_t),
+                                ordinals.size() / sizeof(uint16_t));
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t name_rva = 0;
+    uint16_t index = 0;
+    std::memcpy(&name_rva, name_ptrs.data() + i * sizeof(uint32_t), sizeof(uint32_t));
+    std::memcpy(&index, ordinals.data() + i * sizeof(uint16_t), sizeof(uint16_t));
+
+    span<const uint8_t> raw_name = pe.get_content_from_virtual_address(name_rva, MAX_NAME_SIZE, va);
+    const auto end = std::find(raw_name.begin(), raw_name.end(), 0);
+    if (end == raw_name.end() || end == raw_name.begin()) {
+      continue;
+    }
+    names.emplace(table.OrdinalBase + index, std::string(raw_name.begin(), end));
+  }
+  return names;
+}
+
+static library_exports_t pe_exports(const PE::Binary& pe) {
+  library_exports_t result;
+  const PE::Export* exp = pe.get_export();
+  if (exp == nullptr) {
+    return result;
+  }
+
+  result.library = exp->name();
+  result.exports.reserve(exp->entries().size());
+  std::unordered_map<uint32_t, std::string> forwarded_names;
+  bool has_names = false;
+  for (const PE::ExportEntry& entry : exp->entries()) {
+    export_t info;
+    info.ordinal = entry.ordinal();
+    info.address = entry.function_rva();
+    if (entry.is_forwarded()) {
+      const PE::ExportEntry::forward_information_t fwd = entry.forward_information();
+      info.forward_library = fwd.library;
+      info.forward_name    = fwd.function;
+      if (!has_names) {
+        forwarded_names = pe_export_names(pe);
+        has_names = true;
+      }
+      auto it = forwarded_names.find(entry.ordinal());
+      if (it != forwarded_names.end()) {
+        info.name = it->second;
+      }
+    } else {
+      info.name = entry.name();
+    }
+    result.exports.push_back(std::move(info));
+  }
+  return result;
+}
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+static library_exports_t macho_exports(const MachO::Binary& macho) {
+  library_exports_t result;
+  const MachO::LoadCommand* id = macho.get(MachO::LOAD_COMMAND_TYPES::LC_ID_DYLIB);
+  if (id != nullptr && MachO::DylibCommand::classof(id)) {
+    result.library = static_cast<const MachO::DylibCommand*>(id)->name();
+  }
+
+  std::vector<const MachO::DylibCommand*> libraries;
+  for (const MachO::DylibCommand& lib : macho.libraries()) {
+    libraries.push_back(&lib);
+  }
+
+  for (const MachO::ExportsTrieView::entry_t& entry : macho.exports_view()) {
+    export_t exp;
+    exp.name    = entry.name;
+    exp.address = entry.info.address;
+    if (entry.info.has(MachO::EXPORT_SYMBOL_FLAGS::EXPORT_SYMBOL_FLAGS_REEXPORT)) {
+      const uint64_t ordinal = entry.info.other;
+      if (0 < ordinal && ordinal <= libraries.size()) {
+        exp.forward_library = libraries[ordinal - 1]->name();
+        exp.forward_name    = *entry.info.imported_name != '\0' ?
+                              entry.info.imported_name : entry.name;
+      }
+    }
+    result.exports.push_back(std::move(exp));
+  }
+  return result;
+}
+#endif
+
+static library_exports_t get_exports(const Binary& binary) {
+  switch (binary.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case EXE_FORMATS::FORMAT_ELF:
+      return elf_exports(static_cast<const ELF::Binary&>(binary));
+#endif
+#if defined(LIEF_PE_SUPPORT)
+    case EXE_FORMATS::FORMAT_PE:
+      return pe_exports(static_cast<const PE::Binary&>(binary));
+#endif
+#if defined(LIEF_MACHO_SUPPORT)
+    case EXE_FORMATS::FORMAT_MACHO:
+      return macho_exports(static_cast<const MachO::Binary&>(binary));
+#endif
+    default:
+      return {};
+  }
+}
+
+static bool is_supported(const Binary& binary) {
+  const EXE_FORMATS fmt = binary.format();
+  return fmt == EXE_FORMATS::FORMAT_ELF || fmt == EXE_FORMATS::FORMAT_PE ||
+         fmt == EXE_FORMATS::FORMAT_MACHO;
+}
+
+ExportIndex::ExportIndex() :
+  strings_(1, '\0')
+{}
+
+ExportIndex::ExportIndex(const ExportIndex&) = default;
+ExportIndex& ExportIndex::operator=(const ExportIndex&) = default;
+ExportIndex::ExportIndex(ExportIndex&&) = default;
+ExportIndex& ExportIndex::operator=(ExportIndex&&) = default;
+ExportIndex::~ExportIndex() = default;
+
+result<uint32_t> ExportIndex::add_string(const std::string& str) {
+  if (str.empty()) {
+    return 0;
+  }
+  auto it = strings_map_.find(str);
+  if (it != strings_map_.end()) {
+    return it->second;
+  }
+  const size_t offset = strings_.size();
+  if (str.size() + 1 > UINT32_MAX - offset) {
+    LIEF_ERR("ExportIndex: the string pool is full");
+    return make_error_code(lief_errors::data_too_large);
+  }
+  strings_.append(str.c_str(), str.size() + 1);
+  strings_map_.emplace(str, static_cast<uint32_t>(offset));
+  return static_cast<uint32_t>(offset);
+}
+
+const char* ExportIndex::string(uint32_t offset) const {
+  return strings_.c_str() + offset;
+}
+
+ok_error_t ExportIndex::insert(const library_exports_t& exports) {
+  const size_t nb_entries = entries_.size();
+  const auto rollback = [this, nb_entries] {
+    entries_.resize(nb_entries);
+    return make_error_code(lief_errors::data_too_large);
+  };
+
+  const auto library = static_cast<uint32_t>(libraries_.size());
+  entries_.reserve(entries_.size() + exports.exports.size());
+  for (const export_t& exp : exports.exports) {
+    auto name            = add_string(exp.name);
+    auto version         = add_string(exp.version);
+    auto forward_library = add_string(exp.forward_library);
+    auto forward_name    = add_string(exp.forward_name);
+    if (!name || !version || !forward_library || !forward_name) {
+      return rollback();
+    }
+    entry_t entry;
+    entry.library         = library;
+    entry.name            = *name;
+    entry.version         = *version;
+    entry.forward_library = *forward_library;
+    entry.forward_name    = *forward_name;
+    entry.ordinal         = exp.ordinal;
+    entry.address         = exp.address;
+    entries_.push_back(entry);
+  }
+  libraries_.push_back(exports.library);
+  library_keys_.push_back(library_key(exports.library));
+  return ok();
+}
+
+void ExportIndex::sort(size_t begin) {
+  const auto compare = [this] (const entry_t& lhs, const entry_t& rhs) {
+    return std::strcmp(string(lhs.name), string(rhs.name)) < 0;
+  };
+  // The entries in [0, begin) are already sorted
+  const auto middle = entries_.begin() + begin;
+  std::stable_sort(middle, entries_.end(), compare);
+  std::inplace_merge(entries_.begin(), middle, entries_.end(), compare);
+  index_ordinals();
+}
+
+void ExportIndex::index_ordinals() {
+  ordinals_.resize(entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    ordinals_[i] = static_cast<uint32_t>(i);
+  }
+  std::stable_sort(ordinals_.begin(), ordinals_.end(),
+    [this] (uint32_t lhs, uint32_t rhs) {
+      const entry_t& lentry = entries_[lhs];
+      const entry_t& rentry = entries_[rhs];
+      const int cmp = library_keys_[lentry.library].compare(library_keys_[rentry.library]);
+      if (cmp != 0) {
+        return cmp < 0;
+      }
+      return lentry.ordinal < rentry.ordinal;
+    });
+}
+
+bool ExportIndex::add(const Binary& binary, const std::string& library) {
+  if (!is_supported(binary)) {
+    LIEF_WARN("ExportIndex: unsupported format");
+    return false;
+  }
+  library_exports_t exports = get_exports(binary);
+  if (!library.empty()) {
+    exports.library = library;
+  }
+  if (exports.library.empty()) {
+    LIEF_WARN("ExportIndex: can't determine the name of the library");
+    return false;
+  }
+  const size_t begin = entries_.size();
+  if (!insert(exports)) {
+    return false;
+  }
+  sort(begin);
+  return true;
+}
+
+size_t ExportIndex::add(const std::vector<std::string>& files) {
+  const size_t chunks = parallel::nb_chunks(files.size(), /*grain=*/1);
+  std::vector<std::vector<std::unique_ptr<library_exports_t>>> chunks_exports(chunks);
+
+  parallel::for_each_chunk(files.size(), chunks,
+    [&] (size_t idx, size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        std::unique_ptr<Binary> binary = Parser::parse(files[i]);
+        if (binary == nullptr || !is_supported(*binary)) {
+          continue;
+        }
+        auto exports = std::make_unique<library_exports_t>(get_exports(*binary));
+        if (exports->library.empty()) {
+          exports->library = basename(files[i]);
+        }
+        chunks_exports[idx].push_back(std::move(exports));
+      }
+    });
+
+  const size_t begin = entries_.size();
+  size_t count = 0;
+  for (std::vector<std::unique_ptr<library_exports_t>>& exports : chunks_exports) {
+    for (std::unique_ptr<library_exports_t>& lib : exports) {
+      if (insert(*lib)) {
+        ++count;
+      }
+      lib.reset();
+    }
+  }
+  sort(begin);
+  return count;
+}
+
+size_t ExportIndex::size() const {
+  return entries_.size();
+}
+
+ExportIndex::provider_t ExportIndex::to_provider(const entry_t& entry) const {
+  provider_t provider;
+  provider.library         = libraries_[entry.library];
+  provider.version         = string(entry.version);
+  provider.address         = entry.address;
+  provider.ordinal         = entry.ordinal;
+  provider.forward_library = string(entry.forward_library);
+  provider.forward_name    = string(entry.forward_name);
+  return provider;
+}
+
+std::vector<ExportIndex::provider_t> ExportIndex::find(const std::string& name) const {
+  std::vector<provider_t> providers;
+  if (name.empty()) {
+    return providers;
+  }
+  const char* target = name.c_str();
+  auto it = std::lower_bound(entries_.begin(), entries_.end(), target,
+    [this] (const entry_t& entry, const char* value) {
+      return std::strcmp(string(entry.name), value) < 0;
+    });
+
+  for (; it != entries_.end() && std::strcmp(string(it->name), target) == 0; ++it) {
+    providers.push_back(to_provider(*it));
+  }
+  return providers;
+}
+
+std::vector<ExportIndex::provider_t>
+ExportIndex::find(const std::string& library, uint32_t ordinal) const {
+  std::vector<provider_t> providers;
+  const std::string key = library_key(library);
+  const auto compare = [this] (uint32_t idx, const std::string& key, uint32_t ordinal) {
+    const entry_t& entry = entries_[idx];
+    const int cmp = library_keys_[entry.library].compare(key);
+    if (cmp != 0) {
+      return cmp < 0;
+    }
+    return entry.ordinal < ordinal;
+  };
+
+  auto it = std::lower_bound(ordinals_.begin(), ordinals_.end(), ordinal,
+    [&compare, &key] (uint32_t idx, uint32_t ordinal) {
+      return compare(idx, key, ordinal);
+    });
+
+  for (; it != ordinals_.end(); ++it) {
+    const entry_t& entry = entries_[*it];
+    if (entry.ordinal != ordinal || library_keys_[entry.library] != key) {
+      break;
+    }
+    providers.push_back(to_provider(entry));
+  }
+  return providers;
+}
+
+void ExportIndex::resolve_forward(const provider_t& provider, std::vector<provider_t>& out,
+                                  size_t depth) const
+{
+  if (!provider.is_forwarded()) {
+    out.push_back(provider);
+    return;
+  }
+
+  if (depth >= MAX_FORWARD_DEPTH) {
+    LIEF_DEBUG("ExportIndex: too many forwarders for {}!{}",
+               provider.forward_library, provider.forward_name);
+    out.push_back(provider);
+    return;
+  }
+
+  std::vector<provider_t> targets;
+  // PE forwarders can target an ordinal: NTDLL.#123
+  const std::string& fwd_name = provider.forward_name;
+  if (fwd_name.size() > 1 && fwd_name[0] == '#') {
+    const std::string ordinal = fwd_name.substr(1);
+    if (std::all_of(ordinal.begin(), ordinal.end(),
+          [] (char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }) && ordinal.size() < 10) {
+      targets = find(provider.forward_library, static_cast<uint32_t>(std::stoul(ordinal)));
+    }
+  } else {
+    targets = find(fwd_name);
+  }
+
+  targets.erase(std::remove_if(targets.begin(), targets.end(),
+    [&provider] (const provider_t& target) {
+      return !same_library(target.library, provider.forward_library);
+    }), targets.end());
+
+  // The targeted library is not in the index: keep the forwarder
+  if (targets.empty()) {
+    out.push_back(provider);
+    return;
+  }
+
+  for (const provider_t& target : targets) {
+    resolve_forward(target, out, depth + 1);
+  }
+}
+
+std::vector<ExportIndex::import_t> ExportIndex::resolve(const Binary& binary) const {
+  std::vector<import_t> imports;
+  const auto finalize = [this] (import_t& imp, std::vector<provider_t> providers) {
+    for (const provider_t& provider : providers) {
+      resolve_forward(provider, imp.providers, 0);
+    }
+  };
+
+  switch (binary.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case EXE_FORMATS::FORMAT_ELF:
+      {
+        const auto& elf = static_cast<const ELF::Binary&>(binary);
+        const std::vector<std::string> needed = elf.imported_libraries();
+        for (const ELF::Symbol& sym : elf.dynamic_symbols()) {
+          if (!sym.is_imported() || sym.name().empty()) {
+            continue;
+          }
+          import_t imp;
+          imp.name = sym.name();
+          std::vector<provider_t> providers = find(imp.name);
+
+          keep_if_any(providers, [&needed] (const provider_t& provider) {
+            return std::find(needed.begin(), needed.end(), provider.library) != needed.end();
+          });
+
+          const std::string version = symbol_version(sym);
+          if (!version.empty()) {
+            keep_if_any(providers, [&version] (const provider_t& provider) {
+              return provider.version == version;
+            });
+          }
+          finalize(imp, std::move(providers));
+          imports.push_back(std::move(imp));
+        }
+        break;
+      }
+#endif
+#if defined(LIEF_PE_SUPPORT)
+    case EXE_FORMATS::FORMAT_PE:
+      {
+        const auto& pe = static_cast<const PE::Binary&>(binary);
+        for (const PE::Import& raw_imp : pe.imports()) {
+          result<PE::Import> resolved = PE::resolve_ordinals(raw_imp);
+          const PE::Import& import = resolved ? *resolved : raw_imp;
+          for (const PE::ImportEntry& entry : import.entries()) {
+            import_t imp;
+            imp.library = import.name();
+            std::vector<provider_t> providers;
+            if (entry.is_ordinal()) {
+              imp.name = "#" + std::to_string(entry.ordinal());
+              providers = find(imp.library, entry.ordinal());
+            } else {
+              imp.name = entry.name();
+              providers = find(imp.name);
+              providers.erase(std::remove_if(providers.begin(), providers.end(),
+                [&imp] (const provider_t& provider) {
+                  return !same_library(provider.library, imp.library);
+                }), providers.end());
+            }
+            finalize(imp, std::move(providers));
+            imports.push_back(std::move(imp));
+          }
+        }
+        break;
+      }
+#endif
+#if defined(LIEF_MACHO_SUPPORT)
+    case EXE_FORMATS::FORMAT_MACHO:
+      {
+        const auto& macho = static_cast<const MachO::Binary&>(binary);
+        for (const MachO::Symbol& sym : macho.imported_symbols()) {
+          if (sym.name().empty()) {
+            continue;
+          }
+          const MachO::DylibCommand* lib = sym.library();
+          if (lib == nullptr && sym.has_binding_info()) {
+            lib = sym.binding_info()->library();
+          }
+          import_t imp;
+          imp.name    = sym.name();
+          imp.library = lib != nullptr ? lib->name() : "";
+          std::vector<provider_t> providers = find(imp.name);
+          if (!imp.library.empty()) {
+            keep_if_any(providers, [&imp] (const provider_t& provider) {
+              return provider.library == imp.library;
+            });
+          }
+          finalize(imp, std::move(providers));
+          imports.push_back(std::move(imp));
+        }
+        break;
+      }
+#endif
+    default:
+      LIEF_WARN("ExportIndex: unsupported format");
+  }
+  return imports;
+}
+
+ok_error_t ExportIndex::save(const std::string& path) const {
+  vector_iostream os;
+  os.write(reinterpret_cast<const uint8_t*>(INDEX_MAGIC), sizeof(INDEX_MAGIC))
+    .write<uint32_t>(INDEX_VERSION)
+    .write<uint32_t>(libraries_.size());
+
+  for (const std::string& lib : libraries_) {
+    os.write<uint32_t>(lib.size())
+      .write(reinterpret_cast<const uint8_t*>(lib.data()), lib.size());
+  }
+
+  os.write<uint64_t>(strings_.size())
+    .write(reinterpret_cast<const uint8_t*>(strings_.data()), strings_.size())
+    .write<uint64_t>(entries_.size());
+
+  for (const entry_t& entry : entries_) {
+    os.write<uint32_t>(entry.name)
+      .write<uint32_t>(entry.library)
+      .write<uint32_t>(entry.version)
+      .write<uint32_t>(entry.forward_library)
+      .write<uint32_t>(entry.forward_name)
+      .write<uint32_t>(entry.ordinal)
+      .write<uint64_t>(entry.address);
+  }
+
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    LIEF_ERR("Can't open {}", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  const std::vector<uint8_t>& raw = os.raw();
+  ofs.write(reinterpret_cast<const char*>(raw.data()), raw.size());
+  if (!ofs) {
+    LIEF_ERR("Error while writing {}", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  return ok();
+}
+
+std::unique_ptr<ExportIndex> ExportIndex::load(const std::string& path) {
+  auto stream = VectorStream::from_file(path);
+  if (!stream) {
+    LIEF_ERR("Can't open {}", path);
+    return nullptr;
+  }
+
+  for (char c : INDEX_MAGIC) {
+    auto res = stream->read<char>();
+    if (!res || *res != c) {
+      LIEF_ERR("{} is not a LIEF export index", path);
+      return nullptr;
+    }
+  }
+
+  auto version = stream->read<uint32_t>();
+  if (!version || *version != INDEX_VERSION) {
+    LIEF_ERR("Unsupported index version");
+    return nullptr;
+  }
+
+  auto index = std::make_unique<ExportIndex>();
+
+  auto nb_libraries = stream->read<uint32_t>();
+  if (!nb_libraries) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < *nb_libraries; ++i) {
+    auto size = stream->read<uint32_t>();
+    std::vector<uint8_t> raw;
+    if (!size || !stream->read_data(raw, *size)) {
+      LIEF_ERR("Can't read the libraries of the index");
+      return nullptr;
+    }
+    index->libraries_.emplace_back(raw.begin(), raw.end());
+    index->library_keys_.push_back(library_key(index->libraries_.back()));
+  }
+
+  auto strings_size = stream->read<uint64_t>();
+  std::vector<uint8_t> strings;
+  if (!strings_size || *strings_size == 0 || *strings_size > UINT32_MAX ||
+      !stream->read_data(strings, *strings_size) ||
+      strings.front() != '\0' || strings.back() != '\0')
+  {
+    LIEF_ERR("Can't read the strings of the index");
+    return nullptr;
+  }
+  index->strings_.assign(strings.begin(), strings.end());
+  for (size_t offset = 1; offset < index->strings_.size();) {
+    const char* str = index->string(offset);
+    const size_t size = std::strlen(str);
+    index->strings_map_.emplace(std::string(str, size), offset);
+    offset += size + 1;
+  }
+
+  auto nb_entries = stream->read<uint64_t>();
+  static constexpr size_t ENTRY_SIZE = 6 * sizeof(uint32_t) + sizeof(uint64_t);
+  if (!nb_entries || *nb_entries > (stream->size() - stream->pos()) / ENTRY_SIZE) {
+    LIEF_ERR("Can't read the entries of the index");
+    return nullptr;
+  }
+
+  const size_t nb_strings = index->strings_.size();
+  index->entries_.reserve(*nb_entries);
+  for (size_t i = 0; i < *nb_entries; ++i) {
+    entry_t entry;
+    entry.name            = stream->read<uint32_t>().value_or(0);
+    entry.library         = stream->read<uint32_t>().value_or(0);
+    entry.version         = stream->read<uint32_t>().value_or(0);
+    entry.forward_library = stream->read<uint32_t>().value_or(0);
+    entry.forward_name    = stream->read<uint32_t>().value_or(0);
+    entry.ordinal         = stream->read<uint32_t>().value_or(0);
+    entry.address         = stream->read<uint64_t>().value_or(0);
+    if (entry.name >= nb_strings || entry.version >= nb_strings ||
+        entry.forward_library >= nb_strings || entry.forward_name >= nb_strings ||
+        entry.library >= index->libraries_.size())
+    {
+      LIEF_ERR("Entry #{} is corrupted", i);
+      return nullptr;
+    }
+    index->entries_.push_back(entry);
+  }
+  // The binary searches rely on the order of the entries
+  index->sort(0);
+  return index;
+}
+
+}
@@ -0,0 +1,415 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "logging.hpp"
+#include "parallel.hpp"
+#include "hash_stream.hpp"
+
+#include "LIEF/config.h"
+#include "LIEF/Abstract/Fingerprint.hpp"
+#include "LIEF/Abstract/Binary.hpp"
+#include "LIEF/Abstract/Section.hpp"
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#if defined(LIEF_ELF_SUPPORT)
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/EnumToString.hpp"
+#include "LIEF/ELF/Section.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/DataDirectory.hpp"
+#include "LIEF/PE/Section.hpp"
+#include "LIEF/PE/utils.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/Section.hpp"
+#include "LIEF/MachO/SegmentCommand.hpp"
+#endif
+
+namespace LIEF {
+
+namespace {
+// Size of the blocks fed to the hash contexts of a lane. It is small enough
+// for a block to stay in the cache while it is dispatched to the contexts
+// of the sections that overlap it.
+static constexpr uint64_t BLOCK_SIZE = 0x10000;
+
+using histogram_t = std::array<uint64_t, 256>;
+
+//! [begin, end) ranges of the file
+struct interval_t {
+  uint64_t begin = 0;
+  uint64_t end = 0;
+};
+
+struct layout_t {
+  span<const uint8_t> raw;
+  std::vector<Fingerprint::range_t*> ranges;
+
+  bool authentihash = false;
+  //! Sorted (and disjoint) ranges which are not part of the authentihash
+  std::vector<interval_t> excluded;
+};
+
+enum class LANE {
+  MD5, SHA1, SHA256, HISTOGRAM,
+};
+
+inline bool intersect(uint64_t offset, uint64_t size, uint64_t begin, uint64_t end,
+                      interval_t& out)
+{
+  out.begin = std::max(offset, begin);
+  out.end   = std::min(offset + size, end);
+  return out.begin < out.end;
+}
+
+template<size_t N>
+void store(hashstream& hs, std::array<uint8_t, N>& out) {
+  const std::vector<uint8_t>& digest = hs.raw();
+  std::copy_n(digest.begin(), std::min(N, digest.size()), out.begin());
+}
+
+void store(LANE lane, hashstream& hs, Fingerprint::digests_t& digests) {
+  switch (lane) {
+    case LANE::MD5:       return store(hs, digests.md5);
+    case LANE::SHA1:      return store(hs, digests.sha1);
+    case LANE::SHA256:    return store(hs, digests.sha256);
+    case LANE::HISTOGRAM: return;
+  }
+}
+
+inline hashstream::HASH hash_type(LANE lane) {
+  switch (lane) {
+    case LANE::MD5:  return hashstream::HASH::MD5;
+    case LANE::SHA1: return hashstream::HASH::SHA1;
+    default:         return hashstream::HASH::SHA256;
+  }
+}
+
+double entropy(const histogram_t& histogram, uint64_t size) {
+  if (size <= 1) {
+    return 0.;
+  }
+  double entropy = 0.0;
+  for (uint64_t p : histogram) {
+    if (p > 0) {
+      double freq = static_cast<double>(p) / static_cast<double>(size);
+      entropy += freq * std::log2l(freq);
+    }
+  }
+  return (-entropy);
+}
+
+//! Hash the file, the authenticode ranges and the ranges of the layout
+//! with the algorithm associated with the lane
+void hash_lane(LANE lane, const layout_t& layout, Fingerprint::digests_t& file,
+               Fingerprint::digests_t& authentihash)
+{
+  const hashstream::HASH type = hash_type(lane);
+  span<const uint8_t> raw = layout.raw;
+
+  hashstream file_hs(type);
+  std::unique_ptr<hashstream> auth_hs;
+  if (layout.authentihash) {
+    auth_hs = std::make_unique<hashstream>(type);
+  }
+  std::vector<std::unique_ptr<hashstream>> ranges_hs;
+  ranges_hs.reserve(layout.ranges.size());
+  for (size_t i = 0; i < layout.ranges.size(); ++i) {
+    ranges_hs.push_back(std::make_unique<hashstream>(type));
+  }
+
+  for (uint64_t pos = 0; pos < raw.size(); pos += BLOCK_SIZE) {
+    const uint64_t end = std::min<uint64_t>(raw.size(), pos + BLOCK_SIZE);
+    file_hs.write(raw.data() + pos, end - pos);
+
+    if (auth_hs != nullptr) {
+      uint64_t cursor = pos;
+      for (const interval_t& excluded : layout.excluded) {
+        if (excluded.end <= cursor) {
+          continue;
+        }
+        if (excluded.begin >= end) {
+          break;
+        }
+        if (excluded.begin > cursor) {
+          auth_hs->write(raw.data() + cursor, excluded.begin - cursor);
+        }
+        cursor = std::min(excluded.end, end);
+      }
+      if (cursor < end) {
+        auth_hs->write(raw.data() + cursor, end - cursor);
+      }
+    }
+
+    for (size_t i = 0; i < layout.ranges.size(); ++i) {
+      const Fingerprint::range_t& range = *layout.ranges[i];
+      interval_t chunk;
+      if (intersect(range.offset, range.size, pos, end, chunk)) {
+        ranges_hs[i]->write(raw.data() + chunk.begin, chunk.end - chunk.begin);
+      }
+    }
+  }
+
+  store(lane, file_hs, file);
+  if (auth_hs != nullptr) {
+    store(lane, *auth_hs, authentihash);
+  }
+  for (size_t i = 0; i < layout.ranges.size(); ++i) {
+    store(lane, *ranges_hs[i], layout.ranges[i]->digests);
+  }
+}
+
+//! Compute the entropy of the file and of the ranges of the layout
+double histogram_lane(const layout_t& layout) {
+  span<const uint8_t> raw = layout.raw;
+  histogram_t file = {};
+  std::vector<histogram_t> ranges(layout.ranges.size(), histogram_t{});
+
+  for (uint64_t pos = 0; pos < raw.size(); pos += BLOCK_SIZE) {
+    const uint64_t end = std::min<uint64_t>(raw.size(), pos + BLOCK_SIZE);
+    for (uint64_t i = pos; i < end; ++i) {
+      ++file[raw[i]];
+    }
+    for (size_t i = 0; i < layout.ranges.size(); ++i) {
+      const Fingerprint::range_t& range = *layout.ranges[i];
+      interval_t chunk;
+      if (!intersect(range.offset, range.size, pos, end, chunk)) {
+        continue;
+      }
+      histogram_t& histogram = ranges[i];
+      for (uint64_t j = chunk.begin; j < chunk.end; ++j) {
+        ++histogram[raw[j]];
+      }
+    }
+  }
+
+  for (size_t i = 0; i < layout.ranges.size(); ++i) {
+    layout.ranges[i]->entropy = entropy(ranges[i], layout.ranges[i]->size);
+  }
+  return entropy(file, raw.size());
+}
+
+Fingerprint::range_t make_range(std::string name, uint64_t offset, uint64_t size,
+                                uint64_t raw_size)
+{
+  Fingerprint::range_t range;
+  range.name = std::move(name);
+  // Only the bytes that are present in the file are fingerprinted
+  range.offset = std::min(offset, raw_size);
+  range.size   = std::min(size, raw_size - range.offset);
+  return range;
+}
+
+std::vector<Fingerprint::range_t> get_sections(const Binary& binary, uint64_t raw_size) {
+  std::vector<Fingerprint::range_t> sections;
+  switch (binary.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case EXE_FORMATS::FORMAT_ELF:
+      {
+        for (const ELF::Section& sec : static_cast<const ELF::Binary&>(binary).sections()) {
+          const uint64_t size = sec.type() == ELF::ELF_SECTION_TYPES::SHT_NOBITS ? 0 : sec.size();
+          sections.push_back(make_range(sec.name(), sec.file_offset(), size, raw_size));
+        }
+        return sections;
+      }
+#endif
+#if defined(LIEF_PE_SUPPORT)
+    case EXE_FORMATS::FORMAT_PE:
+      {
+        for (const PE::Section& sec : static_cast<const PE::Binary&>(binary).sections()) {
+          sections.push_back(make_range(sec.name(), sec.pointerto_raw_data(),
+                                        sec.sizeof_raw_data(), raw_size));
+        }
+        return sections;
+      }
+#endif
+#if defined(LIEF_MACHO_SUPPORT)
+    case EXE_FORMATS::FORMAT_MACHO:
+      {
+        for (const MachO::Section& sec : static_cast<const MachO::Binary&>(binary).sections()) {
+          const MachO::MACHO_SECTION_TYPES type = sec.type();
+          const bool is_zerofill = type == MachO::MACHO_SECTION_TYPES::S_ZEROFILL ||
+                                   type == MachO::MACHO_SECTION_TYPES::S_GB_ZEROFILL ||
+                                   type == MachO::MACHO_SECTION_TYPES::S_THREAD_LOCAL_ZEROFILL;
+          sections.push_back(make_range(sec.name(), sec.offset(),
+                                        is_zerofill ? 0 : sec.size(), raw_size));
+        }
+        return sections;
+      }
+#endif
+    default:
+      {
+        for (const Section& sec : binary.sections()) {
+          sections.push_back(make_range(sec.name(), sec.offset(), sec.size(), raw_size));
+        }
+        return sections;
+      }
+  }
+}
+
+std::vector<Fingerprint::range_t> get_segments(const Binary& binary, uint64_t raw_size) {
+  std::vector<Fingerprint::range_t> segments;
+  switch (binary.format()) {
+#if defined(LIEF_ELF_SUPPORT)
+    case EXE_FORMATS::FORMAT_ELF:
+      {
+        for (const ELF::Segment& seg : static_cast<const ELF::Binary&>(binary).segments()) {
+          segments.push_back(make_range(ELF::to_string(seg.type()), seg.file_offset(),
+                                        seg.physical_size(), raw_size));
+        }
+        return segments;
+      }
+#endif
+#if defined(LIEF_MACHO_SUPPORT)
+    case EXE_FORMATS::FORMAT_MACHO:
+      {
+        for (const MachO::SegmentCommand& seg : static_cast<const MachO::Binary&>(binary).segments()) {
+          segments.push_back(make_range(seg.name(), seg.file_offset(),
+                                        seg.file_size(), raw_size));
+        }
+        return segments;
+      }
+#endif
+    default:
+      return segments;
+  }
+}
+
+#if defined(LIEF_PE_SUPPORT)
+//! Ranges of the raw file that are not covered by the authentihash:
+//! the checksum, the certificate table entry and the certificate table
+std::vector<interval_t> authenticode_excluded(const PE::Binary& pe) {
+  // Offset of the optional header: PE signature + COFF header
+  const uint64_t opt_hdr = pe.dos_header().addressof_new_exeheader() + 4 + 20;
+  const uint64_t data_dirs = opt_hdr + (pe.type() == PE::PE_TYPE::PE32 ? 96 : 112);
+  const uint64_t cert_entry = data_dirs +
+    static_cast<size_t>(PE::DataDirectory::TYPES::CERTIFICATE_TABLE) * 8;
+
+  std::vector<interval_t> excluded = {
+    {opt_hdr + 64, opt_hdr + 64 + sizeof(uint32_t)},
+    {cert_entry,   cert_entry + 8},
+  };
+
+  const PE::DataDirectory* cert_dir = pe.data_directory(PE::DataDirectory::TYPES::CERTIFICATE_TABLE);
+  if (cert_dir != nullptr && cert_dir->RVA() > 0 && cert_dir->size() > 0) {
+    // The RVA of the certificate table is an offset in the file
+    excluded.push_back({cert_dir->RVA(), uint64_t(cert_dir->RVA()) + cert_dir->size()});
+  }
+
+  std::sort(excluded.begin(), excluded.end(),
+            [] (const interval_t& lhs, const interval_t& rhs) {
+              return lhs.begin < rhs.begin;
+            });
+  std::vector<interval_t> merged;
+  for (const interval_t& itv : excluded) {
+    if (!merged.empty() && itv.begin <= merged.back().end) {
+      merged.back().end = std::max(merged.back().end, itv.end);
+      continue;
+    }
+    merged.push_back(itv);
+  }
+  return merged;
+}
+#endif
+}
+
+Fingerprint Fingerprint::compute(const Binary& binary, span<const uint8_t> raw,
+                                 const config_t& config)
+{
+  Fingerprint fp;
+  fp.size_ = raw.size();
+
+  if (config.sections) {
+    fp.sections_ = get_sections(binary, raw.size());
+  }
+  if (config.segments) {
+    fp.segments_ = get_segments(binary, raw.size());
+  }
+
+  layout_t layout;
+  layout.raw = raw;
+  layout.ranges.reserve(fp.sections_.size() + fp.segments_.size());
+  for (range_t& range : fp.sections_) {
+    layout.ranges.push_back(&range);
+  }
+  for (range_t& range : fp.segments_) {
+    layout.ranges.push_back(&range);
+  }
+
+#if defined(LIEF_PE_SUPPORT)
+  if (binary.format() == EXE_FORMATS::FORMAT_PE) {
+    const auto& pe = static_cast<const PE::Binary&>(binary);
+    if (config.authentihash) {
+      layout.authentihash = true;
+      layout.excluded = authenticode_excluded(pe);
+      fp.has_authentihash_ = true;
+    }
+    if (config.imphash) {
+      fp.imphash_ = PE::get_imphash(pe);
+    }
+  }
+#endif
+
+  std::vector<LANE> lanes;
+  if (config.md5) {
+    lanes.push_back(LANE::MD5);
+  }
+  if (config.sha1) {
+    lanes.push_back(LANE::SHA1);
+  }
+  if (config.sha256) {
+    lanes.push_back(LANE::SHA256);
+  }
+  if (config.entropy) {
+    lanes.push_back(LANE::HISTOGRAM);
+  }
+
+  // The lanes write different attributes of the ranges (digests_t::md5,
+  // digests_t::sha1, ...) so that they can run concurrently
+  parallel::for_each_chunk(lanes.size(), parallel::nb_chunks(lanes.size(), 1),
+    [&] (size_t /*chunk*/, size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        if (lanes[i] == LANE::HISTOGRAM) {
+          fp.entropy_ = histogram_lane(layout);
+          continue;
+        }
+        hash_lane(lanes[i], layout, fp.file_, fp.authentihash_);
+      }
+    });
+  return fp;
+}
+
+result<Fingerprint> Fingerprint::compute(const Binary& binary, const std::string& path,
+                                         const config_t& config)
+{
+  auto stream = VectorStream::from_file(path);
+  if (!stream) {
+    LIEF_ERR("Can't open {}", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  return compute(binary, stream->content(), config);
+}
+
+}
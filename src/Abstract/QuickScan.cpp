@@ -0,0 +1,757 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "logging.hpp"
+
+#include "LIEF/config.h"
+#include "LIEF/utils.hpp"
+#include "LIEF/Abstract/QuickScan.hpp"
+#include "LIEF/BinaryStream/FileStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
+
+#if defined(LIEF_ELF_SUPPORT)
+#include "LIEF/ELF/utils.hpp"
+#include "LIEF/ELF/Header.hpp"
+#include "ELF/Structures.hpp"
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+#include "LIEF/PE/utils.hpp"
+#include "LIEF/PE/Parser.hpp"
+#include "LIEF/PE/Header.hpp"
+#include "LIEF/PE/OptionalHeader.hpp"
+#include "LIEF/PE/DataDirectory.hpp"
+#include "LIEF/PE/Import.hpp"
+#include "LIEF/PE/ImportEntry.hpp"
+#include "PE/Structures.hpp"
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+#include "LIEF/MachO/utils.hpp"
+#include "LIEF/MachO/Header.hpp"
+#include "LIEF/MachO/ThreadCommand.hpp"
+#include "MachO/Structures.hpp"
+#endif
+
+namespace LIEF {
+
+namespace {
+// Same limits as the parsers
+static constexpr size_t MAX_DYNAMIC_ENTRIES = 1000;
+static constexpr size_t MAX_PE_SECTIONS     = 1000;
+static constexpr size_t MAX_FAT_ARCH        = 10;
+}
+
+#if defined(LIEF_ELF_SUPPORT)
+namespace ELF {
+namespace {
+
+inline bool is_host_little_endian() {
+  const uint16_t value = 1;
+  return *reinterpret_cast<const uint8_t*>(&value) == 1;
+}
+
+template<class ELF_T>
+struct scanner {
+  using Elf_Ehdr = typename ELF_T::Elf_Ehdr;
+  using Elf_Phdr = typename ELF_T::Elf_Phdr;
+  using Elf_Dyn  = typename ELF_T::Elf_Dyn;
+
+  BinaryStream& stream;
+  std::vector<Elf_Phdr> phdrs;
+
+  result<uint64_t> va_to_offset(uint64_t va) const {
+    for (const Elf_Phdr& phdr : phdrs) {
+      if (static_cast<SEGMENT_TYPES>(phdr.p_type) == SEGMENT_TYPES::PT_LOAD &&
+          phdr.p_vaddr <= va && va < (phdr.p_vaddr + phdr.p_memsz))
+      {
+        return va - (phdr.p_vaddr - phdr.p_offset);
+      }
+    }
+    return make_error_code(lief_errors::conversion_error);
+  }
+
+  const Elf_Phdr* get(SEGMENT_TYPES type) const {
+    const auto it = std::find_if(std::begin(phdrs), std::end(phdrs),
+        [type] (const Elf_Phdr& phdr) {
+          return static_cast<SEGMENT_TYPES>(phdr.p_type) == type;
+        });
+    return it != std::end(phdrs) ? &*it : nullptr;
+  }
+
+  void parse_dynamic(QuickSummary& summary, bool& is_pie_flag) const {
+    const Elf_Phdr* dynamic = get(SEGMENT_TYPES::PT_DYNAMIC);
+    if (dynamic == nullptr) {
+      return;
+    }
+    const size_t nb_entries = std::min<size_t>(dynamic->p_filesz / sizeof(Elf_Dyn),
+                                               MAX_DYNAMIC_ENTRIES);
+    std::vector<Elf_Dyn> entries;
+    entries.reserve(nb_entries);
+    uint64_t strtab = 0;
+    for (size_t i = 0; i < nb_entries; ++i) {
+      auto res = stream.peek_conv<Elf_Dyn>(dynamic->p_offset + i * sizeof(Elf_Dyn));
+      if (!res) {
+        break;
+      }
+      const auto tag = static_cast<DYNAMIC_TAGS>(res->d_tag);
+      if (tag == DYNAMIC_TAGS::DT_NULL) {
+        break;
+      }
+      if (tag == DYNAMIC_TAGS::DT_STRTAB) {
+        if (auto offset = va_to_offset(res->d_un.d_val)) {
+          strtab = *offset;
+        }
+      }
+      if (tag == DYNAMIC_TAGS::DT_FLAGS_1) {
+        is_pie_flag = (res->d_un.d_val & static_cast<uint64_t>(DYNAMIC_FLAGS_1::DF_1_PIE)) != 0;
+      }
+      entries.push_back(*res);
+    }
+
+    for (const Elf_Dyn& entry : entries) {
+      if (static_cast<DYNAMIC_TAGS>(entry.d_tag) != DYNAMIC_TAGS::DT_NEEDED) {
+        continue;
+      }
+      if (auto name = stream.peek_string_at(strtab + entry.d_un.d_val)) {
+        summary.imported_libraries.push_back(std::move(*name));
+      } else {
+        LIEF_ERR("Can't read library name for DT_NEEDED entry");
+      }
+    }
+  }
+
+  void parse_build_id(QuickSummary& summary) const {
+    for (const Elf_Phdr& phdr : phdrs) {
+      if (static_cast<SEGMENT_TYPES>(phdr.p_type) != SEGMENT_TYPES::PT_NOTE) {
+        continue;
+      }
+      const uint64_t align = phdr.p_align == 8 ? 8 : 4;
+      uint64_t offset = phdr.p_offset;
+      const uint64_t end = phdr.p_offset + phdr.p_filesz;
+      while (offset + 3 * sizeof(uint32_t) <= end) {
+        auto namesz = stream.peek_conv<uint32_t>(offset);
+        auto descsz = stream.peek_conv<uint32_t>(offset + sizeof(uint32_t));
+        auto type   = stream.peek_conv<uint32_t>(offset + 2 * sizeof(uint32_t));
+        if (!namesz || !descsz || !type) {
+          break;
+        }
+        const uint64_t name_off = offset + 3 * sizeof(uint32_t);
+        const uint64_t desc_off = name_off + align_up(*namesz, align);
+        if (desc_off + *descsz > end) {
+          break;
+        }
+        if (*type == static_cast<uint32_t>(NOTE_TYPES::NT_GNU_BUILD_ID) && *namesz == 4) {
+          auto name = stream.peek_string_at(name_off, *namesz);
+          if (name && *name == "GNU") {
+            std::vector<uint8_t> build_id;
+            if (stream.peek_data(build_id, desc_off, *descsz)) {
+              summary.build_id = std::move(build_id);
+              return;
+            }
+          }
+        }
+        offset = desc_off + align_up(*descsz, align);
+      }
+    }
+  }
+
+  static uint64_t align_up(uint64_t value, uint64_t align) {
+    return (value + align - 1) & ~(align - 1);
+  }
+
+  result<QuickSummary> scan() {
+    auto res_ehdr = stream.peek_conv<Elf_Ehdr>(0);
+    if (!res_ehdr) {
+      LIEF_ERR("Can't read the ELF header");
+      return make_error_code(lief_errors::read_error);
+    }
+    const Elf_Ehdr& ehdr = *res_ehdr;
+    const Header header(ehdr);
+
+    QuickSummary summary;
+    summary.format = EXE_FORMATS::FORMAT_ELF;
+    summary.is_64  = std::is_same<ELF_T, details::ELF64>::value;
+
+    const Header::abstract_architecture_t arch = header.abstract_architecture();
+    summary.architecture = arch.first;
+    summary.modes        = arch.second;
+    summary.endianness   = header.abstract_endianness();
+    summary.object_type  = header.abstract_object_type();
+    summary.entrypoint   = ehdr.e_entry;
+    summary.nb_sections  = ehdr.e_shnum;
+    summary.nb_segments  = ehdr.e_phnum;
+
+    if (ehdr.e_phoff > 0) {
+      phdrs.reserve(ehdr.e_phnum);
+      for (size_t i = 0; i < ehdr.e_phnum; ++i) {
+        auto res = stream.peek_conv<Elf_Phdr>(ehdr.e_phoff + i * sizeof(Elf_Phdr));
+        if (!res) {
+          LIEF_ERR("Can't read segment #{:d}", i);
+          break;
+        }
+        phdrs.push_back(*res);
+      }
+    }
+
+    auto imagebase = static_cast<uint64_t>(-1);
+    for (const Elf_Phdr& phdr : phdrs) {
+      if (static_cast<SEGMENT_TYPES>(phdr.p_type) == SEGMENT_TYPES::PT_LOAD) {
+        imagebase = std::min<uint64_t>(imagebase, phdr.p_vaddr - phdr.p_offset);
+      }
+    }
+    summary.imagebase = imagebase;
+
+    bool is_pie_flag = false;
+    parse_dynamic(summary, is_pie_flag);
+    parse_build_id(summary);
+
+    // See ELF::Binary::get_abstract_header
+    if (header.file_type() == E_TYPE::ET_DYN && get(SEGMENT_TYPES::PT_INTERP) != nullptr) {
+      summary.object_type = OBJECT_TYPES::TYPE_EXECUTABLE;
+    }
+
+    // See ELF::Binary::is_pie
+    if (header.file_type() == E_TYPE::ET_DYN) {
+      summary.is_pie = get(SEGMENT_TYPES::PT_INTERP) != nullptr ||
+                       (get(SEGMENT_TYPES::PT_DYNAMIC) != nullptr && is_pie_flag);
+    }
+
+    // See ELF::Binary::has_nx
+    if (const Elf_Phdr* gnu_stack = get(SEGMENT_TYPES::PT_GNU_STACK)) {
+      summary.has_nx = (gnu_stack->p_flags & static_cast<uint32_t>(ELF_SEGMENT_FLAGS::PF_X)) != 0;
+    } else {
+      summary.has_nx = header.machine_type() == ARCH::EM_PPC64;
+    }
+    return summary;
+  }
+};
+
+result<QuickSummary> scan(BinaryStream& stream) {
+  const ELF_DATA endian = determine_elf_endianess(stream);
+  const ELF_DATA host = is_host_little_endian() ? ELF_DATA::ELFDATA2LSB :
+                                                  ELF_DATA::ELFDATA2MSB;
+  const bool is_swap = stream.should_swap();
+  stream.set_endian_swap(endian != ELF_DATA::ELFDATANONE && endian != host);
+
+  result<QuickSummary> summary = make_error_code(lief_errors::corrupted);
+  switch (determine_elf_class(stream)) {
+    case ELF_CLASS::ELFCLASS32:
+      {
+        summary = scanner<details::ELF32>{stream, {}}.scan();
+        break;
+      }
+    case ELF_CLASS::ELFCLASS64:
+      {
+        summary = scanner<details::ELF64>{stream, {}}.scan();
+        break;
+      }
+    default:
+      {
+        LIEF_ERR("Can't determine the ELF class");
+      }
+  }
+  stream.set_endian_swap(is_swap);
+  return summary;
+}
+}
+}
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+namespace PE {
+namespace {
+
+struct section_t {
+  uint32_t virtual_address = 0;
+  uint32_t virtual_size = 0;
+  uint32_t sizeof_raw_data = 0;
+  uint32_t pointerto_raw_data = 0;
+};
+
+template<class PE_T>
+struct scanner {
+  using uint = typename PE_T::uint;
+  using pe_optional_header = typename PE_T::pe_optional_header;
+
+  BinaryStream& stream;
+  std::vector<section_t> sections;
+  uint32_t section_alignment = 0;
+  uint32_t file_alignment = 0;
+
+  // Same as PE::Binary::rva_to_offset
+  uint64_t rva_to_offset(uint64_t RVA) const {
+    const auto it_section = std::find_if(std::begin(sections), std::end(sections),
+        [RVA] (const section_t& section) {
+          const auto vsize_adj = std::max<uint64_t>(section.virtual_size, section.sizeof_raw_data);
+          return section.virtual_address <= RVA &&
+                 RVA < (section.virtual_address + vsize_adj);
+        });
+
+    if (it_section == std::end(sections)) {
+      return RVA;
+    }
+
+    uint32_t sec_align = section_alignment;
+    if (sec_align < 0x1000) {
+      sec_align = file_alignment;
+    }
+
+    const uint64_t section_va     = align(it_section->virtual_address, sec_align);
+    const uint64_t section_offset = align(it_section->pointerto_raw_data, file_alignment);
+    return (RVA - section_va) + section_offset;
+  }
+
+  // See PE::Parser::parse_import_table
+  void parse_imports(const details::pe_data_directory& dir, std::vector<Import>& imports) const {
+    const uint64_t import_offset = rva_to_offset(dir.RelativeVirtualAddress);
+    const uint64_t import_end    = import_offset + dir.Size;
+    const PE_TYPE type = std::is_same<PE_T, details::PE64>::value ? PE_TYPE::PE32_PLUS :
+                                                                    PE_TYPE::PE32;
+
+    for (uint64_t pos = import_offset; pos < import_end; pos += sizeof(details::pe_import)) {
+      auto res_imp = stream.peek<details::pe_import>(pos);
+      if (!res_imp || BinaryStream::is_all_zero(*res_imp)) {
+        break;
+      }
+      const details::pe_import& raw_imp = *res_imp;
+      if (raw_imp.NameRVA == 0) {
+        break;
+      }
+
+      auto res_name = stream.peek_string_at(rva_to_offset(raw_imp.NameRVA));
+      if (!res_name || !Parser::is_valid_dll_name(*res_name)) {
+        continue;
+      }
+
+      Import import(std::move(*res_name));
+
+      uint64_t LT_offset = raw_imp.ImportLookupTableRVA > 0 ?
+                           rva_to_offset(raw_imp.ImportLookupTableRVA) : 0;
+      uint64_t IAT_offset = raw_imp.ImportAddressTableRVA > 0 ?
+                            rva_to_offset(raw_imp.ImportAddressTableRVA) : 0;
+
+      uint IAT = 0;
+      uint table = 0;
+      if (IAT_offset > 0) {
+        if (auto res_iat = stream.peek<uint>(IAT_offset)) {
+          IAT = *res_iat;
+          table = IAT;
+          IAT_offset += sizeof(uint);
+        }
+      }
+
+      if (LT_offset > 0) {
+        if (auto res_lt = stream.peek<uint>(LT_offset)) {
+          table = *res_lt;
+          LT_offset += sizeof(uint);
+        }
+      }
+
+      while (table != 0 || IAT != 0) {
+        ImportEntry entry(table > 0 ? table : IAT, type, "");
+        if (!entry.is_ordinal()) {
+          const uint64_t name_off = rva_to_offset(entry.hint_name_rva()) + sizeof(uint16_t);
+          auto entry_name = stream.peek_string_at(name_off);
+          if (entry_name && Parser::is_valid_import_name(*entry_name)) {
+            entry.name(*entry_name);
+            import.add_entry(entry);
+          }
+        } else {
+          import.add_entry(entry);
+        }
+
+        IAT = 0;
+        if (IAT_offset > 0) {
+          if (auto iat = stream.peek<uint>(IAT_offset)) {
+            IAT = *iat;
+            IAT_offset += sizeof(uint);
+          }
+        }
+
+        table = 0;
+        if (LT_offset > 0) {
+          if (auto lt = stream.peek<uint>(LT_offset)) {
+            table = *lt;
+            LT_offset += sizeof(uint);
+          }
+        }
+      }
+      imports.push_back(std::move(import));
+    }
+  }
+
+  // See PE::Parser::parse_delay_imports
+  void parse_delay_imports(const details::pe_data_directory& dir,
+                           std::vector<std::string>& libraries) const
+  {
+    const uint64_t offset = rva_to_offset(dir.RelativeVirtualAddress);
+    const uint64_t delay_end = offset + dir.Size;
+    for (uint64_t pos = offset; pos < delay_end; pos += sizeof(details::delay_imports)) {
+      auto res = stream.peek<details::delay_imports>(pos);
+      if (!res || BinaryStream::is_all_zero(*res)) {
+        break;
+      }
+      auto dll_name = stream.peek_string_at(rva_to_offset(res->name));
+      if (!dll_name) {
+        break;
+      }
+      if (!Parser::is_valid_dll_name(*dll_name)) {
+        continue;
+      }
+      libraries.push_back(std::move(*dll_name));
+    }
+  }
+
+  result<QuickSummary> scan() {
+    auto dos_hdr = stream.peek<details::pe_dos_header>(0);
+    if (!dos_hdr) {
+      LIEF_ERR("Can't read the DOS Header");
+      return make_error_code(dos_hdr.error());
+    }
+    const uint64_t pe_hdr_off = dos_hdr->AddressOfNewExeHeader;
+    auto pe_hdr = stream.peek<details::pe_header>(pe_hdr_off);
+    if (!pe_hdr) {
+      LIEF_ERR("Can't read the PE header");
+      return make_error_code(pe_hdr.error());
+    }
+    const uint64_t opt_hdr_off = pe_hdr_off + sizeof(details::pe_header);
+    auto opt_hdr = stream.peek<pe_optional_header>(opt_hdr_off);
+    if (!opt_hdr) {
+      LIEF_ERR("Can't read the optional header");
+      return make_error_code(opt_hdr.error());
+    }
+
+    const Header header(*pe_hdr);
+    const OptionalHeader opt_header(*opt_hdr);
+    section_alignment = opt_header.section_alignment();
+    file_alignment    = opt_header.file_alignment();
+
+    QuickSummary summary;
+    summary.format = EXE_FORMATS::FORMAT_PE;
+    summary.is_64  = std::is_same<PE_T, details::PE64>::value;
+
+    const std::pair<ARCHITECTURES, std::set<MODES>> arch = header.abstract_architecture();
+    summary.architecture = arch.first;
+    summary.modes        = arch.second;
+    summary.endianness   = header.abstract_endianness();
+    summary.object_type  = header.abstract_object_type();
+    summary.imagebase    = opt_header.imagebase();
+    summary.entrypoint   = opt_header.imagebase() + opt_header.addressof_entrypoint();
+    summary.is_pie       = opt_header.has(OptionalHeader::DLL_CHARACTERISTICS::DYNAMIC_BASE);
+    summary.has_nx       = opt_header.has(OptionalHeader::DLL_CHARACTERISTICS::NX_COMPAT);
+    summary.nb_sections  = header.numberof_sections();
+
+    // Section table (only the fields needed to translate the RVAs)
+    const uint64_t sections_off = opt_hdr_off + header.sizeof_optional_header();
+    const size_t nb_sections = std::min<size_t>(header.numberof_sections(), MAX_PE_SECTIONS);
+    sections.reserve(nb_sections);
+    for (size_t i = 0; i < nb_sections; ++i) {
+      auto raw_sec = stream.peek<details::pe_section>(sections_off + i * sizeof(details::pe_section));
+      if (!raw_sec) {
+        LIEF_ERR("Can't read section #{:d}", i);
+        break;
+      }
+      section_t sec;
+      sec.virtual_address    = raw_sec->VirtualAddress;
+      sec.virtual_size       = raw_sec->VirtualSize;
+      sec.sizeof_raw_data    = raw_sec->SizeOfRawData;
+      sec.pointerto_raw_data = raw_sec->PointerToRawData;
+      sections.push_back(sec);
+    }
+
+    // The data directories are located right after the (standard) optional header
+    const uint64_t dirs_off = opt_hdr_off + sizeof(pe_optional_header);
+    auto read_dir = [&] (DataDirectory::TYPES type) -> result<details::pe_data_directory> {
+      const uint64_t offset = dirs_off + static_cast<size_t>(type) * sizeof(details::pe_data_directory);
+      return stream.peek<details::pe_data_directory>(offset);
+    };
+
+    std::vector<Import> imports;
+    if (auto dir = read_dir(DataDirectory::TYPES::IMPORT_TABLE)) {
+      if (dir->RelativeVirtualAddress > 0) {
+        parse_imports(*dir, imports);
+      }
+    }
+
+    for (const Import& imp : imports) {
+      summary.imported_libraries.push_back(imp.name());
+    }
+
+    if (auto dir = read_dir(DataDirectory::TYPES::DELAY_IMPORT_DESCRIPTOR)) {
+      if (dir->RelativeVirtualAddress > 0) {
+        parse_delay_imports(*dir, summary.imported_libraries);
+      }
+    }
+    summary.imphash = get_imphash(imports, IMPHASH_MODE::DEFAULT);
+    return summary;
+  }
+};
+
+result<QuickSummary> scan(BinaryStream& stream) {
+  auto type = get_type_from_stream(stream);
+  if (!type) {
+    LIEF_ERR("Can't determine PE type.");
+    return make_error_code(lief_errors::file_format_error);
+  }
+  if (*type == PE_TYPE::PE32) {
+    return scanner<details::PE32>{stream, {}}.scan();
+  }
+  return scanner<details::PE64>{stream, {}}.scan();
+}
+}
+}
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+namespace MachO {
+namespace {
+
+template<class MACHO_T>
+result<QuickSummary> scan_binary(BinaryStream& stream, uint64_t base, uint64_t size) {
+  using header_t          = typename MACHO_T::header;
+  using segment_command_t = typename MACHO_T::segment_command;
+
+  auto res_hdr = stream.peek<header_t>(base);
+  if (!res_hdr) {
+    LIEF_ERR("Can't read the Mach-O header");
+    return make_error_code(lief_errors::read_error);
+  }
+  const header_t& raw_hdr = *res_hdr;
+  const Header header(raw_hdr);
+
+  QuickSummary summary;
+  summary.format = EXE_FORMATS::FORMAT_MACHO;
+  summary.is_64  = std::is_same<MACHO_T, details::MachO64>::value;
+
+  const std::pair<ARCHITECTURES, std::set<MODES>> arch = header.abstract_architecture();
+  summary.architecture = arch.first;
+  summary.modes        = arch.second;
+  summary.endianness   = header.abstract_endianness();
+  summary.object_type  = header.abstract_object_type();
+  summary.is_pie       = header.has(HEADER_FLAGS::MH_PIE);
+  summary.has_nx       = !header.has(HEADER_FLAGS::MH_ALLOW_STACK_EXECUTION);
+
+  bool has_main = false;
+  uint64_t entryoff = 0;
+  bool has_thread = false;
+  uint64_t pc = 0;
+
+  uint64_t va_start = std::numeric_limits<uint64_t>::max();
+  uint64_t va_end   = 0;
+
+  const uint64_t end = base + size;
+  uint64_t offset = base + sizeof(header_t);
+  for (size_t i = 0; i < raw_hdr.ncmds; ++i) {
+    auto res_cmd = stream.peek<details::load_command>(offset);
+    if (!res_cmd || res_cmd->cmdsize < sizeof(details::load_command) ||
+        offset + res_cmd->cmdsize > end)
+    {
+      LIEF_ERR("Can't read the load command #{:d}", i);
+      break;
+    }
+    const auto type = static_cast<LOAD_COMMAND_TYPES>(res_cmd->cmd);
+    switch (type) {
+      case LOAD_COMMAND_TYPES::LC_SEGMENT:
+      case LOAD_COMMAND_TYPES::LC_SEGMENT_64:
+        {
+          auto seg = stream.peek<segment_command_t>(offset);
+          if (!seg) {
+            break;
+          }
+          ++summary.nb_segments;
+          summary.nb_sections += seg->nsects;
+          const std::string name(seg->segname, strnlen(seg->segname, sizeof(seg->segname)));
+          if (name == "__TEXT") {
+            summary.imagebase = seg->vmaddr;
+          }
+          if (seg->vmaddr > 0) {
+            va_start = std::min<uint64_t>(va_start, seg->vmaddr);
+          }
+          va_end = std::max<uint64_t>(va_end, seg->vmaddr + seg->vmsize);
+          break;
+        }
+
+      case LOAD_COMMAND_TYPES::LC_LOAD_DYLIB:
+      case LOAD_COMMAND_TYPES::LC_LOAD_WEAK_DYLIB:
+      case LOAD_COMMAND_TYPES::LC_ID_DYLIB:
+      case LOAD_COMMAND_TYPES::LC_REEXPORT_DYLIB:
+      case LOAD_COMMAND_TYPES::LC_LAZY_LOAD_DYLIB:
+        {
+          auto cmd = stream.peek<details::dylib_command>(offset);
+          if (!cmd || cmd->dylib.name >= res_cmd->cmdsize) {
+            break;
+          }
+          if (auto name = stream.peek_string_at(offset + cmd->dylib.name,
+                                                res_cmd->cmdsize - cmd->dylib.name))
+          {
+            summary.imported_libraries.push_back(std::move(*name));
+          }
+          break;
+        }
+
+      case LOAD_COMMAND_TYPES::LC_UUID:
+        {
+          if (auto cmd = stream.peek<details::uuid_command>(offset)) {
+            summary.build_id = {std::begin(cmd->uuid), std::end(cmd->uuid)};
+          }
+          break;
+        }
+
+      case LOAD_COMMAND_TYPES::LC_MAIN:
+        {
+          if (auto cmd = stream.peek<details::entry_point_command>(offset)) {
+            has_main = true;
+            entryoff = cmd->entryoff;
+          }
+          break;
+        }
+
+      case LOAD_COMMAND_TYPES::LC_THREAD:
+      case LOAD_COMMAND_TYPES::LC_UNIXTHREAD:
+        {
+          auto cmd = stream.peek<details::thread_command>(offset);
+          if (!cmd || has_thread) {
+            break;
+          }
+          ThreadCommand thread(cmd->flavor, cmd->count, header.cpu_type());
+          const uint64_t state_off = offset + sizeof(details::thread_command);
+          const uint64_t state_size = std::min<uint64_t>(
+              res_cmd->cmdsize - sizeof(details::thread_command),
+              static_cast<uint64_t>(cmd->count) * sizeof(uint32_t));
+          std::vector<uint8_t> state;
+          if (stream.peek_data(state, state_off, state_size)) {
+            thread.state(state);
+            has_thread = true;
+            pc = thread.pc();
+          }
+          break;
+        }
+
+      default: {}
+    }
+    offset += res_cmd->cmdsize;
+  }
+
+  // See MachO::Binary::entrypoint
+  if (has_main) {
+    summary.entrypoint = summary.imagebase + entryoff;
+  } else if (has_thread) {
+    summary.entrypoint = va_start <= pc && pc < va_end ? pc : summary.imagebase + pc;
+  }
+  return summary;
+}
+
+result<QuickSummary> scan(BinaryStream& stream) {
+  auto res_magic = stream.peek<uint32_t>(0);
+  if (!res_magic) {
+    return make_error_code(lief_errors::read_error);
+  }
+  uint64_t base = 0;
+  uint64_t size = stream.size();
+  auto magic = static_cast<MACHO_TYPES>(*res_magic);
+
+  // For a FAT binary, we take the last slice (as LIEF::Parser::parse)
+  if (magic == MACHO_TYPES::FAT_MAGIC || magic == MACHO_TYPES::FAT_CIGAM) {
+    auto header = stream.peek<details::fat_header>(0);
+    if (!header) {
+      LIEF_ERR("Can't read the FAT header");
+      return make_error_code(lief_errors::read_error);
+    }
+    const uint32_t nb_arch = BinaryStream::swap_endian(header->nfat_arch);
+    if (nb_arch == 0 || nb_arch > MAX_FAT_ARCH) {
+      LIEF_ERR("Wrong number of architectures: {}", nb_arch);
+      return make_error_code(lief_errors::parsing_error);
+    }
+    const uint64_t arch_off = sizeof(details::fat_header) +
+                              (nb_arch - 1) * sizeof(details::fat_arch);
+    auto arch = stream.peek<details::fat_arch>(arch_off);
+    if (!arch) {
+      LIEF_ERR("Can't read the last FAT arch");
+      return make_error_code(lief_errors::read_error);
+    }
+    base = BinaryStream::swap_endian(arch->offset);
+    size = BinaryStream::swap_endian(arch->size);
+    if (base + size > stream.size()) {
+      LIEF_ERR("The last FAT arch is corrupted");
+      return make_error_code(lief_errors::corrupted);
+    }
+    res_magic = stream.peek<uint32_t>(base);
+    if (!res_magic) {
+      return make_error_code(lief_errors::read_error);
+    }
+    magic = static_cast<MACHO_TYPES>(*res_magic);
+  }
+
+  switch (magic) {
+    case MACHO_TYPES::MH_MAGIC:
+    case MACHO_TYPES::MH_CIGAM:
+      return scan_binary<details::MachO32>(stream, base, size);
+    case MACHO_TYPES::MH_MAGIC_64:
+    case MACHO_TYPES::MH_CIGAM_64:
+      return scan_binary<details::MachO64>(stream, base, size);
+    default:
+      {
+        LIEF_ERR("Unknown Mach-O magic: 0x{:x}", static_cast<uint32_t>(magic));
+        return make_error_code(lief_errors::file_format_error);
+      }
+  }
+}
+}
+}
+#endif
+
+result<QuickSummary> quick_scan(BinaryStream& stream) {
+#if defined(LIEF_ELF_SUPPORT)
+  if (ELF::is_elf(stream)) {
+    return ELF::scan(stream);
+  }
+#endif
+
+#if defined(LIEF_PE_SUPPORT)
+  if (PE::is_pe(stream)) {
+    return PE::scan(stream);
+  }
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+  if (MachO::is_macho(stream)) {
+    return MachO::scan(stream);
+  }
+#endif
+
+  LIEF_ERR("Unknown format");
+  return make_error_code(lief_errors::file_format_error);
+}
+
+result<QuickSummary> quick_scan(const std::string& path) {
+  auto stream = FileStream::from_file(path);
+  if (!stream) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(stream.error());
+  }
+  return quick_scan(*stream);
+}
+
+result<QuickSummary> quick_scan(span<const uint8_t> raw) {
+  SpanStream stream(raw);
+  return quick_scan(stream);
+}
+
+}
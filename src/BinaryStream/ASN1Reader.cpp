@@ -282,7 +282,7 @@ result<int32_t> ASN1Reader::read_int() {
   return value;
 }
 
-result<std::vector<uint8_t>> ASN1Reader::read_bitstring() {
+result<span<const uint8_t>> ASN1Reader::read_bitstring() {
   mbedtls_asn1_bitstring bs = {0, 0, nullptr};
 
   const uint8_t* cur_p = stream_.p();
@@ -297,7 +297,7 @@ result<std::vector<uint8_t>> ASN1Reader::read_bitstring() {
 
   if (ret == MBEDTLS_ERR_ASN1_LENGTH_MISMATCH) {
     stream_.increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-    return std::vector<uint8_t>{bs.p, bs.p + bs.len};
+    return span<const uint8_t>{bs.p, bs.len};
   }
 
   if (ret != 0) {
@@ -305,21 +305,21 @@ result<std::vector<uint8_t>> ASN1Reader::read_bitstring() {
   }
 
   stream_.increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::vector<uint8_t>{bs.p, bs.p + bs.len};
+  return span<const uint8_t>{bs.p, bs.len};
 }
 
 
-result<std::vector<uint8_t>> ASN1Reader::read_octet_string() {
+result<span<const uint8_t>> ASN1Reader::read_octet_string() {
   auto tag = read_tag(MBEDTLS_ASN1_OCTET_STRING);
   if (!tag) {
     return make_error_code(tag.error());
   }
-  std::vector<uint8_t> raw = {stream_.p(), stream_.p() + tag.value()};
+  span<const uint8_t> raw{stream_.p(), tag.value()};
   stream_.increment_pos(tag.value());
   return raw;
 }
 
-result<std::unique_ptr<mbedtls_x509_crt>> ASN1Reader::read_cert() {
+result<std::unique_ptr<mbedtls_x509_crt>> ASN1Reader::read_cert(bool copy) {
   std::unique_ptr<mbedtls_x509_crt> ca{new mbedtls_x509_crt{}};
   mbedtls_x509_crt_init(ca.get());
 
@@ -327,7 +327,9 @@ result<std::unique_ptr<mbedtls_x509_crt>> ASN1Reader::read_cert() {
   const uint8_t* end       = stream_.end();
   const uintptr_t buff_len = reinterpret_cast<uintptr_t>(end) - reinterpret_cast<uintptr_t>(p);
 
-  int ret = mbedtls_x509_crt_parse_der(ca.get(), p, /* buff len */ buff_len);
+  int ret = copy ?
+            mbedtls_x509_crt_parse_der(ca.get(), p, /* buff len */ buff_len) :
+            mbedtls_x509_crt_parse_der_nocopy(ca.get(), p, /* buff len */ buff_len);
   if (ret != 0) {
     std::string strerr(1024, 0);
     mbedtls_strerror(ret, const_cast<char*>(strerr.data()), strerr.size());
@@ -374,7 +376,7 @@ result<std::string> ASN1Reader::x509_read_names() {
   return std::string(buffer.data());
 }
 
-result<std::vector<uint8_t>> ASN1Reader::x509_read_serial() {
+result<span<const uint8_t>> ASN1Reader::x509_read_serial() {
   mbedtls_x509_buf serial;
 
   const uint8_t* cur_p = stream_.p();
@@ -388,7 +390,7 @@ result<std::vector<uint8_t>> ASN1Reader::x509_read_serial() {
   }
 
   stream_.increment_pos(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(cur_p));
-  return std::vector<uint8_t>{serial.p, serial.p + serial.len};
+  return span<const uint8_t>{serial.p, serial.len};
 }
 
 result<std::unique_ptr<mbedtls_x509_time>> ASN1Reader::x509_read_time() {
@@ -27,6 +27,42 @@
 #define TMPL_DECL(T) template T BinaryStream::swap_endian<T>(T u)
 
 namespace LIEF {
+
+namespace {
+// Decode a LEB128 from the buffer [p, end) and return the number of bytes
+// consumed (0 if the buffer ends before the last byte of the LEB128).
+// The bits beyond the 64th are discarded.
+template<bool SIGNED>
+inline size_t decode_leb128(const uint8_t* p, const uint8_t* end, uint64_t& value) {
+  if (p < end && *p < 0x80) {
+    // Fast path: most of the LEB128 values fit in one byte
+    value = SIGNED && (*p & 0x40) != 0 ? *p | (~uint64_t(0) << 7) : *p;
+    return 1;
+  }
+
+  const uint8_t* it = p;
+  uint64_t result = 0;
+  unsigned shift = 0;
+  uint8_t byte = 0;
+  do {
+    if (it >= end) {
+      return 0;
+    }
+    byte = *it++;
+    if (shift < 64) {
+      result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    }
+    shift += 7;
+  } while (byte >= 0x80);
+
+  if (SIGNED && (byte & 0x40) != 0 && shift < 64) {
+    result |= ~uint64_t(0) << shift;
+  }
+  value = result;
+  return it - p;
+}
+}
+
 BinaryStream::~BinaryStream() = default;
 BinaryStream::BinaryStream() = default;
 
@@ -123,41 +159,74 @@ result<int64_t> BinaryStream::read_dwarf_encoded(uint8_t encoding) const {
 
 }
 
-result<uint64_t> BinaryStream::read_uleb128() const {
+namespace {
+template<bool SIGNED>
+result<uint64_t> peek_leb128(const BinaryStream& stream, size_t offset, size_t& size) {
+  if (const uint8_t* start = stream.contiguous_start()) {
+    if (offset >= stream.size()) {
+      return make_error_code(lief_errors::read_error);
+    }
+    uint64_t value = 0;
+    size = decode_leb128<SIGNED>(start + offset, start + stream.size(), value);
+    if (size == 0) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return value;
+  }
+
   uint64_t value = 0;
   unsigned shift = 0;
-  result<uint8_t> byte_read = 0;
+  uint8_t byte = 0;
+  size_t off = offset;
   do {
-    byte_read = read<uint8_t>();
+    auto byte_read = stream.peek<uint8_t>(off++);
     if (!byte_read) {
       return make_error_code(lief_errors::read_error);
     }
-    value += static_cast<uint64_t>(*byte_read & 0x7f) << shift;
+    byte = *byte_read;
+    if (shift < 64) {
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    }
     shift += 7;
-  } while (byte_read && *byte_read >= 128);
+  } while (byte >= 0x80);
 
+  // Sign extend
+  if (SIGNED && (byte & 0x40) != 0 && shift < 64) {
+    value |= ~uint64_t(0) << shift;
+  }
+  size = off - offset;
   return value;
 }
+}
 
-result<uint64_t> BinaryStream::read_sleb128() const {
-  int64_t  value = 0;
-  unsigned shift = 0;
-  result<uint8_t> byte_read = 0;
-  do {
-    byte_read = read<uint8_t>();
-    if (!byte_read) {
-      return make_error_code(lief_errors::read_error);
-    }
-    value += static_cast<int64_t>(*byte_read & 0x7f) << shift;
-    shift += 7;
-  } while (byte_read && *byte_read >= 128);
+result<uint64_t> BinaryStream::peek_uleb128_at(size_t offset, size_t& size) const {
+  return peek_leb128<false>(*this, offset, size);
+}
 
+result<uint64_t> BinaryStream::peek_sleb128_at(size_t offset, size_t& size) const {
+  return peek_leb128<true>(*this, offset, size);
+}
 
-  // Sign extend
-  if ((*byte_read & 0x40) != 0) {
-    value |= -1llu << shift;
+result<uint64_t> BinaryStream::read_uleb128() const {
+  size_t nb_bytes = 0;
+  auto value = peek_uleb128_at(pos(), nb_bytes);
+  if (!value) {
+    // The bytes are consumed up to the end of the stream
+    setpos(std::max<size_t>(pos(), size()));
+    return value;
   }
+  increment_pos(nb_bytes);
+  return value;
+}
 
+result<uint64_t> BinaryStream::read_sleb128() const {
+  size_t nb_bytes = 0;
+  auto value = peek_sleb128_at(pos(), nb_bytes);
+  if (!value) {
+    setpos(std::max<size_t>(pos(), size()));
+    return value;
+  }
+  increment_pos(nb_bytes);
   return value;
 }
 
@@ -171,15 +240,31 @@ result<std::string> BinaryStream::read_string(size_t maxsize) const {
 }
 
 result<std::string> BinaryStream::peek_string(size_t maxsize) const {
+  return peek_string_at(pos(), maxsize);
+}
+
+result<std::string> BinaryStream::peek_string_at(size_t offset, size_t maxsize) const {
   std::string str_result;
-  str_result.reserve(10);
-  result<char> c = '\0';
-  size_t off = pos();
+  size_t off = offset;
+
+  if (!can_read<char>(offset)) {
+    return str_result;
+  }
 
-  if (!can_read<char>()) {
+  if (const uint8_t* start = contiguous_start()) {
+    // Same semantic as the generic loop below: at most min(maxsize, size - offset)
+    // bytes are scanned and the last one is dropped if it's not a '\0'
+    const uint8_t* str = start + off;
+    const size_t limit = std::max<size_t>(1, std::min<size_t>(maxsize, size() - off));
+    const auto* nul = static_cast<const uint8_t*>(std::memchr(str, '\0', limit));
+    const size_t len = nul != nullptr ? nul - str : limit - 1;
+    str_result.assign(reinterpret_cast<const char*>(str), len);
     return str_result;
   }
 
+  str_result.reserve(10);
+  result<char> c = '\0';
+
   size_t count = 0;
   do {
     c = peek<char>(off);
@@ -190,17 +275,9 @@ result<std::string> BinaryStream::peek_string(size_t maxsize) const {
     str_result.push_back(*c);
     ++count;
   } while (count < maxsize && c && *c != '\0' && off < size());
-  str_result.back() = '\0';
-  return str_result.c_str();
-
-}
-
-result<std::string> BinaryStream::peek_string_at(size_t offset, size_t maxsize) const {
-  size_t saved_offset = pos();
-  setpos(offset);
-  result<std::string> tmp = peek_string(maxsize);
-  setpos(saved_offset);
-  return tmp;
+  // The last character is either the '\0' or the one that reached the limit
+  str_result.pop_back();
+  return str_result;
 }
 
 result<std::u16string> BinaryStream::read_u16string() const {
@@ -213,25 +290,7 @@ result<std::u16string> BinaryStream::read_u16string() const {
 }
 
 result<std::u16string> BinaryStream::peek_u16string() const {
-  std::u16string u16_str;
-  u16_str.reserve(10);
-  result<char16_t> c = char16_t{0};
-  size_t off = pos();
-
-  if (!can_read<char16_t>()) {
-    return u16_str;
-  }
-
-  do {
-    c = peek<char16_t>(off);
-    if (!c) {
-      return make_error_code(c.error());
-    }
-    off += sizeof(char16_t);
-    u16_str.push_back(*c);
-  } while (c && *c != 0 && off < size());
-  u16_str.back() = '\0';
-  return u16_str.c_str();
+  return peek_u16string_at(pos(), SIZE_MAX);
 }
 
 
@@ -242,13 +301,36 @@ result<std::u16string> BinaryStream::read_u16string(size_t length) const {
 }
 
 result<std::u16string> BinaryStream::peek_u16string(size_t length) const {
+  return peek_u16string_at(pos(), length);
+}
+
+result<std::u16string> BinaryStream::peek_u16string_at(size_t offset, size_t length) const {
   if (length == static_cast<size_t>(SIZE_MAX)) {
-    return peek_u16string();
+    // Null-terminated string
+    std::u16string u16_str;
+    u16_str.reserve(10);
+    result<char16_t> c = char16_t{0};
+    size_t off = offset;
+
+    if (!can_read<char16_t>(offset)) {
+      return u16_str;
+    }
+
+    do {
+      c = peek<char16_t>(off);
+      if (!c) {
+        return make_error_code(c.error());
+      }
+      off += sizeof(char16_t);
+      u16_str.push_back(*c);
+    } while (c && *c != 0 && off < size());
+    u16_str.back() = '\0';
+    return u16_str.c_str();
   }
 
   std::vector<char16_t> raw_u16str;
   raw_u16str.resize(length, 0);
-  if (peek_in(raw_u16str.data(), pos(), length * sizeof(char16_t))) {
+  if (peek_in(raw_u16str.data(), offset, length * sizeof(char16_t))) {
     if (endian_swap_) {
       for (char16_t& x : raw_u16str) {
         LIEF::Convert::swap_endian(&x);
@@ -259,14 +341,6 @@ result<std::u16string> BinaryStream::peek_u16string(size_t length) const {
   return make_error_code(lief_errors::read_error);
 }
 
-result<std::u16string> BinaryStream::peek_u16string_at(size_t offset, size_t length) const {
-  size_t saved_offset = pos();
-  setpos(offset);
-  result<std::u16string> tmp = peek_u16string(length);
-  setpos(saved_offset);
-  return tmp;
-}
-
 
 size_t BinaryStream::align(size_t align_on) const {
   if (align_on == 0) {
@@ -283,9 +357,36 @@ size_t BinaryStream::align(size_t align_on) const {
 
 
 result<std::string> BinaryStream::read_mutf8(size_t maxsize) const {
+  std::string u8str;
+  size_t i = 0;
+
+  if (const uint8_t* start = contiguous_start()) {
+    // ASCII fast path: the characters < 0x80 are encoded on one byte and
+    // they are the same in UTF-8
+    const uint8_t* it  = start + std::min<uint64_t>(pos(), size());
+    const uint8_t* end = start + size();
+    const uint8_t* str = it;
+    while (i < maxsize && it < end && *it != 0 && *it < 0x80) {
+      ++it;
+      ++i;
+    }
+    u8str.assign(reinterpret_cast<const char*>(str), it - str);
+    increment_pos(it - str);
+    if (i == maxsize) {
+      return u8str;
+    }
+    if (it < end && *it == 0) {
+      increment_pos(1);
+      return u8str;
+    }
+    if (it == end) {
+      return make_error_code(lief_errors::read_error);
+    }
+  }
+
   std::u32string u32str;
 
-  for (size_t i = 0; i < maxsize; ++i) {
+  for (; i < maxsize; ++i) {
     result<uint8_t> res_a = read<char>();
     if (!res_a) {
       return make_error_code(res_a.error());
@@ -330,8 +431,6 @@ result<std::string> BinaryStream::read_mutf8(size_t maxsize) const {
     }
   }
 
-  std::string u8str;
-
   std::replace_if(std::begin(u32str), std::end(u32str),
       [] (const char32_t c) {
         return !utf8::internal::is_code_point_valid(c);
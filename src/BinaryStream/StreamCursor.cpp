@@ -0,0 +1,81 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/BinaryStream/StreamCursor.hpp"
+
+namespace LIEF {
+
+ok_error_t StreamCursor::peek_data(std::vector<uint8_t>& container,
+                                   uint64_t offset, uint64_t size) const
+{
+  if (size == 0) {
+    return ok();
+  }
+  const uint64_t stream_size = stream_->size();
+  if (offset > stream_size || size > stream_size - offset) {
+    return make_error_code(lief_errors::read_error);
+  }
+  container.resize(size);
+  if (stream_->peek_in(container.data(), offset, size)) {
+    return ok();
+  }
+  return make_error_code(lief_errors::read_error);
+}
+
+ok_error_t StreamCursor::read_data(std::vector<uint8_t>& container, uint64_t size) {
+  if (!peek_data(container, pos_, size)) {
+    return make_error_code(lief_errors::read_error);
+  }
+  pos_ += size;
+  return ok();
+}
+
+result<std::string> StreamCursor::read_string(size_t maxsize) {
+  result<std::string> str = peek_string(maxsize);
+  if (!str) {
+    return str;
+  }
+  pos_ += str->size() + 1; // +1 for'\0'
+  return str;
+}
+
+result<std::u16string> StreamCursor::read_u16string(size_t length) {
+  result<std::u16string> str = peek_u16string(length);
+  if (!str) {
+    return str;
+  }
+  pos_ += length * sizeof(char16_t);
+  return str;
+}
+
+result<uint64_t> StreamCursor::read_uleb128() {
+  size_t nb_bytes = 0;
+  result<uint64_t> value = stream_->peek_uleb128_at(pos_, nb_bytes);
+  if (value) {
+    pos_ += nb_bytes;
+  }
+  return value;
+}
+
+result<uint64_t> StreamCursor::read_sleb128() {
+  size_t nb_bytes = 0;
+  result<uint64_t> value = stream_->peek_sleb128_at(pos_, nb_bytes);
+  if (value) {
+    pos_ += nb_bytes;
+  }
+  return value;
+}
+
+}
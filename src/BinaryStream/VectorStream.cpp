@@ -52,8 +52,8 @@ result<VectorStream> VectorStream::from_file(const std::string& file) {
 
 
 VectorStream::VectorStream(std::vector<uint8_t> data) :
-  binary_{std::move(data)},
-  size_{binary_.size()}
+  binary_{std::make_shared<std::vector<uint8_t>>(std::move(data))},
+  size_{binary_->size()}
 {
   stype_ = STREAM_TYPE::VECTOR;
 }
@@ -65,11 +65,27 @@ result<const void*> VectorStream::read_at(uint64_t offset, uint64_t size) const
     LIEF_DEBUG("Can't read #{:d} bytes at 0x{:04x} (0x{:x} bytes out of bound)", size, offset, out_size);
     return make_error_code(lief_errors::read_error);
   }
-  return binary_.data() + offset;
+  return binary_->data() + offset;
+}
+
+ok_error_t VectorStream::peek_shared_data(SharedContent& content,
+                                          uint64_t offset, uint64_t size)
+{
+  if (size == 0) {
+    content = SharedContent();
+    return ok();
+  }
+
+  const uint64_t stream_size = this->size();
+  if (offset > stream_size || size > stream_size - offset) {
+    return make_error_code(lief_errors::read_error);
+  }
+  content = SharedContent(binary_, offset, size);
+  return ok();
 }
 
 const std::vector<uint8_t>& VectorStream::content() const {
-  return binary_;
+  return *binary_;
 }
 
 bool VectorStream::classof(const BinaryStream& stream) {
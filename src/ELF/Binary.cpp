@@ -18,6 +18,7 @@
 #include <numeric>
 #include <sstream>
 #include <cctype>
+#include <unordered_map>
 
 #include "LIEF/DWARF/enums.hpp"
 
@@ -50,6 +51,8 @@
 #include "LIEF/ELF/Relocation.hpp"
 #include "LIEF/ELF/Symbol.hpp"
 #include "LIEF/ELF/SymbolVersion.hpp"
+#include "LIEF/ELF/SymbolVersionAux.hpp"
+#include "LIEF/ELF/SymbolVersionAuxRequirement.hpp"
 #include "LIEF/ELF/SymbolVersionDefinition.hpp"
 #include "LIEF/ELF/SymbolVersionRequirement.hpp"
 #include "LIEF/ELF/GnuHash.hpp"
@@ -58,6 +61,7 @@
 
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/SizingInfo.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 #include "Binary.tcc"
 #include "Object.tcc"
@@ -75,8 +79,31 @@ inline size_t get_relocation_sizeof(const Binary& bin, const Relocation& R) {
          (is_rela ? sizeof(details::Elf32_Rela) : sizeof(details::Elf32_Rel));
 }
 
+inline std::unique_ptr<DynamicEntry> copy_entry(const DynamicEntry& entry) {
+  if (DynamicEntryLibrary::classof(&entry)) {
+    return std::make_unique<DynamicEntryLibrary>(*entry.as<const DynamicEntryLibrary>());
+  }
+  if (DynamicSharedObject::classof(&entry)) {
+    return std::make_unique<DynamicSharedObject>(*entry.as<const DynamicSharedObject>());
+  }
+  if (DynamicEntryRpath::classof(&entry)) {
+    return std::make_unique<DynamicEntryRpath>(*entry.as<const DynamicEntryRpath>());
+  }
+  if (DynamicEntryRunPath::classof(&entry)) {
+    return std::make_unique<DynamicEntryRunPath>(*entry.as<const DynamicEntryRunPath>());
+  }
+  if (DynamicEntryFlags::classof(&entry)) {
+    return std::make_unique<DynamicEntryFlags>(*entry.as<const DynamicEntryFlags>());
+  }
+  if (DynamicEntryArray::classof(&entry)) {
+    return std::make_unique<DynamicEntryArray>(*entry.as<const DynamicEntryArray>());
+  }
+  return std::make_unique<DynamicEntry>(entry);
+}
+
 Binary::Binary() :
-  sizing_info_{std::make_unique<sizing_info_t>()}
+  sizing_info_{std::make_unique<sizing_info_t>()},
+  modifications_{std::make_shared<details::ModificationCounter>()}
 {
   format_ = LIEF::EXE_FORMATS::FORMAT_ELF;
 }
@@ -182,30 +209,9 @@ Binary::it_const_dynamic_entries Binary::dynamic_entries() const {
 
 
 DynamicEntry& Binary::add(const DynamicEntry& entry) {
+  reset_functions_index();
 
-  std::unique_ptr<DynamicEntry> new_one;
-
-  if (DynamicEntryLibrary::classof(&entry)) {
-    new_one = std::make_unique<DynamicEntryLibrary>(*entry.as<const DynamicEntryLibrary>());
-  }
-  else if (DynamicSharedObject::classof(&entry)) {
-    new_one = std::make_unique<DynamicSharedObject>(*entry.as<const DynamicSharedObject>());
-  }
-  else if (DynamicEntryRpath::classof(&entry)) {
-    new_one = std::make_unique<DynamicEntryRpath>(*entry.as<const DynamicEntryRpath>());
-  }
-  else if (DynamicEntryRunPath::classof(&entry)) {
-    new_one = std::make_unique<DynamicEntryRunPath>(*entry.as<const DynamicEntryRunPath>());
-  }
-  else if (DynamicEntryFlags::classof(&entry)) {
-    new_one = std::make_unique<DynamicEntryFlags>(*entry.as<const DynamicEntryFlags>());
-  }
-  else if (DynamicEntryArray::classof(&entry)) {
-    new_one = std::make_unique<DynamicEntryArray>(*entry.as<const DynamicEntryArray>());
-  }
-  else {
-    new_one = std::make_unique<DynamicEntry>(entry);
-  }
+  std::unique_ptr<DynamicEntry> new_one = copy_entry(entry);
 
   const auto it_new_place = std::find_if(std::begin(dynamic_entries_), std::end(dynamic_entries_),
       [&new_one] (const std::unique_ptr<DynamicEntry>& e) {
@@ -226,6 +232,7 @@ Note& Binary::add(const Note& note) {
 
 
 void Binary::remove(const DynamicEntry& entry) {
+  reset_functions_index();
   const auto it_entry = std::find_if(std::begin(dynamic_entries_), std::end(dynamic_entries_),
       [&entry] (const std::unique_ptr<DynamicEntry>& e) {
         return *e == entry;
@@ -240,6 +247,7 @@ void Binary::remove(const DynamicEntry& entry) {
 
 
 void Binary::remove(DYNAMIC_TAGS tag) {
+  reset_functions_index();
   for (auto it = std::begin(dynamic_entries_); it != std::end(dynamic_entries_);) {
     if ((*it)->tag() == tag) {
       it = dynamic_entries_.erase(it);
@@ -250,6 +258,7 @@ void Binary::remove(DYNAMIC_TAGS tag) {
 }
 
 void Binary::remove(const Section& section, bool clear) {
+  reset_functions_index();
   const auto it_section = std::find_if(std::begin(sections_), std::end(sections_),
       [&section] (const std::unique_ptr<Section>& s) {
         return *s == section;
@@ -365,6 +374,7 @@ Binary::it_const_symbols Binary::symbols() const {
 
 
 Symbol& Binary::export_symbol(const Symbol& symbol) {
+  reset_functions_index();
 
   // Check if the symbol is in the dynamic symbol table
   const auto it_symbol = std::find_if(std::begin(dynamic_symbols_), std::end(dynamic_symbols_),
@@ -434,6 +444,7 @@ Symbol& Binary::export_symbol(const std::string& symbol_name, uint64_t value) {
 
 
 Symbol& Binary::add_exported_function(uint64_t address, const std::string& name) {
+  reset_functions_index();
   std::string funcname = name;
   if (funcname.empty()) {
     std::stringstream ss;
@@ -658,6 +669,7 @@ void Binary::remove_static_symbol(const std::string& name) {
 }
 
 void Binary::remove_static_symbol(Symbol* symbol) {
+  reset_functions_index();
   if (symbol == nullptr) {
     return;
   }
@@ -687,6 +699,7 @@ void Binary::remove_dynamic_symbol(const std::string& name) {
 }
 
 void Binary::remove_dynamic_symbol(Symbol* symbol) {
+  reset_functions_index();
   if (symbol == nullptr) {
     return;
   }
@@ -743,16 +756,19 @@ void Binary::remove_dynamic_symbol(Symbol* symbol) {
 
   if (it_relocation != std::end(relocations_)) {
     const size_t rel_sizeof = get_relocation_sizeof(*this, **it_relocation);
-    if (auto* DT = get(DYNAMIC_TAGS::DT_RELASZ)) {
-      const uint64_t sizes = DT->value();
-      if (sizes >= rel_sizeof) {
-        DT->value(sizes - rel_sizeof);
+    // The size of the packed tables (RELR, APS2) is recomputed by the Builder
+    if (!(*it_relocation)->is_packed()) {
+      if (auto* DT = get(DYNAMIC_TAGS::DT_RELASZ)) {
+        const uint64_t sizes = DT->value();
+        if (sizes >= rel_sizeof) {
+          DT->value(sizes - rel_sizeof);
+        }
       }
-    }
-    else if (auto* DT = get(DYNAMIC_TAGS::DT_RELSZ)) {
-      const uint64_t sizes = DT->value();
-      if (sizes >= rel_sizeof) {
-        DT->value(sizes - rel_sizeof);
+      else if (auto* DT = get(DYNAMIC_TAGS::DT_RELSZ)) {
+        const uint64_t sizes = DT->value();
+        if (sizes >= rel_sizeof) {
+          DT->value(sizes - rel_sizeof);
+        }
       }
     }
     relocations_.erase(it_relocation);
@@ -1087,6 +1103,7 @@ result<uint64_t> Binary::get_function_address(const std::string& func_name, bool
 }
 
 Section* Binary::add(const Section& section, bool loaded) {
+  reset_functions_index();
   if (section.is_frame()) {
     return add_frame_section(section);
   }
@@ -1157,6 +1174,7 @@ bool Binary::has_nx() const {
 }
 
 Segment* Binary::add(const Segment& segment, uint64_t base) {
+  reset_functions_index();
   const uint64_t new_base = base == 0 ? next_virtual_address() : base;
 
   switch(header().file_type()) {
@@ -1172,6 +1190,7 @@ Segment* Binary::add(const Segment& segment, uint64_t base) {
 
 
 Segment* Binary::replace(const Segment& new_segment, const Segment& original_segment, uint64_t base) {
+  reset_functions_index();
 
   const auto it_original_segment = std::find_if(std::begin(segments_), std::end(segments_),
                                     [&original_segment] (const std::unique_ptr<Segment>& s) { return *s == original_segment; });
@@ -1259,6 +1278,7 @@ Segment* Binary::replace(const Segment& new_segment, const Segment& original_seg
 
 
 void Binary::remove(const Segment& segment) {
+  reset_functions_index();
   const auto it_segment = std::find_if(std::begin(segments_), std::end(segments_),
                                        [&segment] (const std::unique_ptr<Segment>& s) {
                                           return *s == segment;
@@ -1282,6 +1302,7 @@ void Binary::remove(const Segment& segment) {
 
 
 Segment* Binary::extend(const Segment& segment, uint64_t size) {
+  reset_functions_index();
   const SEGMENT_TYPES type = segment.type();
   switch (type) {
     case SEGMENT_TYPES::PT_PHDR:
@@ -1300,6 +1321,7 @@ Segment* Binary::extend(const Segment& segment, uint64_t size) {
 
 
 Section* Binary::extend(const Section& section, uint64_t size) {
+  reset_functions_index();
   const auto it_section = std::find_if(std::begin(sections_), std::end(sections_),
                                        [&section] (const std::unique_ptr<Section>& s) {
                                          return *s == section;
@@ -1375,6 +1397,7 @@ Section* Binary::extend(const Section& section, uint64_t size) {
 // =====
 
 void Binary::patch_address(uint64_t address, const std::vector<uint8_t>& patch_value, LIEF::Binary::VA_TYPES) {
+  reset_functions_index();
 
   // Object file does not have segments
   if (header().file_type() == E_TYPE::ET_REL) {
@@ -1416,6 +1439,7 @@ void Binary::patch_address(uint64_t address, const std::vector<uint8_t>& patch_v
 
 
 void Binary::patch_address(uint64_t address, uint64_t patch_value, size_t size, LIEF::Binary::VA_TYPES) {
+  reset_functions_index();
   if (size > sizeof(patch_value)) {
     LIEF_ERR("The size of the patch value (0x{:x}) is larger that sizeof(uint64_t) which is not supported",
              size);
@@ -1645,6 +1669,7 @@ bool Binary::has_section_with_va(uint64_t va) const {
 }
 
 void Binary::strip() {
+  reset_functions_index();
   static_symbols_.clear();
   Section* symtab = get(ELF_SECTION_TYPES::SHT_SYMTAB);
   if (symtab != nullptr) {
@@ -1654,12 +1679,14 @@ void Binary::strip() {
 
 
 Symbol& Binary::add_static_symbol(const Symbol& symbol) {
+  reset_functions_index();
   static_symbols_.push_back(std::make_unique<Symbol>(symbol));
   return *static_symbols_.back();
 }
 
 
 Symbol& Binary::add_dynamic_symbol(const Symbol& symbol, const SymbolVersion* version) {
+  reset_functions_index();
   auto sym = std::make_unique<Symbol>(symbol);
   std::unique_ptr<SymbolVersion> symver;
   if (version == nullptr) {
@@ -2090,6 +2117,7 @@ void Binary::shift_dynamic_entries(uint64_t from, uint64_t shift) {
 
 
 void Binary::shift_symbols(uint64_t from, uint64_t shift) {
+  reset_functions_index();
   LIEF_DEBUG("Shift symbols by 0x{:x} from 0x{:x}", shift, from);
   for (Symbol& symbol : symbols()) {
     if (symbol.value() >= from) {
@@ -2464,6 +2492,8 @@ LIEF::Binary::functions_t Binary::eh_frame_functions() const {
   LIEF_DEBUG("  fde_count:        0x{:x}", static_cast<uint32_t>(fde_count));
 
   auto table_bias = static_cast<DWARF::EH_ENCODING>(table_enc & 0xF0);
+  std::unordered_map<uint32_t, uint8_t> cie_encodings;
+  functions.reserve(std::min<size_t>(fde_count, vs.size() / sizeof(uint64_t)));
 
   for (size_t i = 0; i < static_cast<size_t>(fde_count); ++i) {
 
@@ -2575,8 +2605,11 @@ LIEF::Binary::functions_t Binary::eh_frame_functions() const {
 
       const size_t saved_pos = vs.pos();
       uint8_t augmentation_data = 0;
-      vs.setpos(cie_offset);
-      {
+      // The FDEs usually share a few CIEs: only parse them once
+      if (auto it_cie = cie_encodings.find(cie_offset); it_cie != cie_encodings.end()) {
+        augmentation_data = it_cie->second;
+      } else {
+        vs.setpos(cie_offset);
         auto res_cie_length = vs.read<uint32_t>();
         if (!res_cie_length) {
           LIEF_ERR("Can't read cie_length");
@@ -2651,6 +2684,7 @@ LIEF::Binary::functions_t Binary::eh_frame_functions() const {
             LIEF_WARN("Augmentation string '{}' is not supported", cie_augmentation_string);
           }
         }
+        cie_encodings[cie_offset] = augmentation_data;
       }
       LIEF_DEBUG("Augmentation data 0x{:x}", static_cast<uint32_t>(augmentation_data));
 
@@ -2683,6 +2717,62 @@ LIEF::Binary::functions_t Binary::eh_frame_functions() const {
 
 
 LIEF::Binary::functions_t Binary::functions() const {
+  std::lock_guard<std::mutex> lock(functions_lock_);
+  return functions_index();
+}
+
+result<Function> Binary::function_at(uint64_t address) const {
+  std::lock_guard<std::mutex> lock(functions_lock_);
+  const LIEF::Binary::functions_t& functions = functions_index();
+  auto it = std::upper_bound(functions.begin(), functions.end(), address,
+    [] (uint64_t addr, const Function& func) {
+      return addr < func.address();
+    });
+
+  if (it == functions.begin()) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  const Function& func = *std::prev(it);
+  uint64_t end = func.address() + func.size();
+  if (func.size() == 0) {
+    end = it != functions.end() ? it->address() : func.address() + 1;
+  }
+
+  if (address >= end) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return func;
+}
+
+void Binary::reset_functions_index() {
+  modifications_->increment();
+}
+
+// Must be called with functions_lock_ held
+const LIEF::Binary::functions_t& Binary::functions_index() const {
+  // The symbols, segments, ... can be modified without going through
+  // the Binary's API. Their setters notify the counter attached below.
+  const uint64_t modification_count = modifications_->count();
+  if (functions_index_ != nullptr && functions_index_count_ == modification_count) {
+    return *functions_index_;
+  }
+
+  for (const std::unique_ptr<Symbol>& symbol : dynamic_symbols_) {
+    symbol->modifications_ = modifications_;
+  }
+  for (const std::unique_ptr<Symbol>& symbol : static_symbols_) {
+    symbol->modifications_ = modifications_;
+  }
+  for (const std::unique_ptr<Segment>& segment : segments_) {
+    segment->modifications_ = modifications_;
+  }
+  for (const std::unique_ptr<DynamicEntry>& entry : dynamic_entries_) {
+    entry->modifications_ = modifications_;
+  }
+  if (datahandler_ != nullptr) {
+    datahandler_->modifications(modifications_);
+  }
 
   static const auto func_cmd = [] (const Function& lhs, const Function& rhs) {
     return lhs.address() < rhs.address();
@@ -2714,7 +2804,10 @@ LIEF::Binary::functions_t Binary::functions() const {
   std::move(std::begin(armexid_functions), std::end(armexid_functions),
             std::inserter(functions_set, std::end(functions_set)));
 
-  return {std::begin(functions_set), std::end(functions_set)};
+  functions_index_ = std::make_unique<LIEF::Binary::functions_t>(
+      std::begin(functions_set), std::end(functions_set));
+  functions_index_count_ = modification_count;
+  return *functions_index_;
 }
 
 
@@ -3534,6 +3627,199 @@ std::ostream& Binary::print(std::ostream& os) const {
   return os;
 }
 
+Binary::Snapshot::Snapshot(std::unique_ptr<Binary> state) :
+  state_(std::move(state))
+{}
+
+Binary::Snapshot::Snapshot(Snapshot&&) noexcept = default;
+Binary::Snapshot& Binary::Snapshot::operator=(Snapshot&&) noexcept = default;
+Binary::Snapshot::~Snapshot() = default;
+
+std::unique_ptr<Binary> Binary::Snapshot::restore() const {
+  if (state_ == nullptr) {
+    LIEF_ERR("The snapshot is empty (moved?)");
+    return nullptr;
+  }
+  auto binary = std::unique_ptr<Binary>(new Binary{});
+  copy_state(*state_, *binary);
+  return binary;
+}
+
+Binary::Snapshot Binary::snapshot() {
+  auto state = std::unique_ptr<Binary>(new Binary{});
+  copy_state(*this, *state);
+  return Snapshot(std::move(state));
+}
+
+void Binary::restore(const Snapshot& snapshot) {
+  if (snapshot.state_ == nullptr) {
+    LIEF_ERR("The snapshot is empty (moved?)");
+    return;
+  }
+  copy_state(*snapshot.state_, *this);
+}
+
+void Binary::copy_state(Binary& from, Binary& to) {
+  if (&from == &to) {
+    return;
+  }
+  // The objects are copied and their pointers (section of a symbol,
+  // segments of a section, ...) are remapped on the copies. On the other
+  // hand, the content of the file is shared until it is modified.
+  std::unordered_map<const Section*, Section*> sections_map;
+  std::unordered_map<const Segment*, Segment*> segments_map;
+  std::unordered_map<const Symbol*, Symbol*> symbols_map;
+  std::unordered_map<const SymbolVersion*, SymbolVersion*> versions_map;
+  std::unordered_map<const SymbolVersionAux*, SymbolVersionAux*> aux_map;
+
+  std::unique_ptr<DataHandler::Handler> datahandler = from.datahandler_->share();
+  DataHandler::Handler* hdl = datahandler.get();
+
+  sections_t sections;
+  sections.reserve(from.sections_.size());
+  for (const std::unique_ptr<Section>& section : from.sections_) {
+    auto copy = std::make_unique<Section>(*section);
+    copy->datahandler_ = section->datahandler_ != nullptr ? hdl : nullptr;
+    sections_map[section.get()] = copy.get();
+    sections.push_back(std::move(copy));
+  }
+
+  segments_t segments;
+  segments.reserve(from.segments_.size());
+  for (const std::unique_ptr<Segment>& segment : from.segments_) {
+    auto copy = std::make_unique<Segment>(*segment);
+    copy->datahandler_ = segment->datahandler_ != nullptr ? hdl : nullptr;
+    for (Section* section : segment->sections_) {
+      copy->sections_.push_back(sections_map[section]);
+    }
+    segments_map[segment.get()] = copy.get();
+    segments.push_back(std::move(copy));
+  }
+
+  for (const std::unique_ptr<Section>& section : from.sections_) {
+    Section* copy = sections_map[section.get()];
+    for (Segment* segment : section->segments_) {
+      copy->segments_.push_back(segments_map[segment]);
+    }
+  }
+
+  symbols_version_requirement_t requirements;
+  requirements.reserve(from.symbol_version_requirements_.size());
+  for (const std::unique_ptr<SymbolVersionRequirement>& req : from.symbol_version_requirements_) {
+    auto copy = std::make_unique<SymbolVersionRequirement>(*req);
+    auto it_copy = copy->auxiliary_symbols().begin();
+    for (const SymbolVersionAuxRequirement& aux : req->auxiliary_symbols()) {
+      aux_map[&aux] = &*it_copy;
+      ++it_copy;
+    }
+    requirements.push_back(std::move(copy));
+  }
+
+  symbols_version_definition_t definitions;
+  definitions.reserve(from.symbol_version_definition_.size());
+  for (const std::unique_ptr<SymbolVersionDefinition>& def : from.symbol_version_definition_) {
+    auto copy = std::make_unique<SymbolVersionDefinition>(*def);
+    auto it_copy = copy->symbols_aux().begin();
+    for (const SymbolVersionAux& aux : def->symbols_aux()) {
+      aux_map[&aux] = &*it_copy;
+      ++it_copy;
+    }
+    definitions.push_back(std::move(copy));
+  }
+
+  symbols_version_t versions;
+  versions.reserve(from.symbol_version_table_.size());
+  for (const std::unique_ptr<SymbolVersion>& version : from.symbol_version_table_) {
+    auto copy = std::make_unique<SymbolVersion>(*version);
+    if (version->symbol_aux_ != nullptr) {
+      copy->symbol_aux_ = aux_map[version->symbol_aux_];
+    }
+    versions_map[version.get()] = copy.get();
+    versions.push_back(std::move(copy));
+  }
+
+  auto copy_symbols = [&] (const symbols_t& symbols) {
+    symbols_t copies;
+    copies.reserve(symbols.size());
+    for (const std::unique_ptr<Symbol>& symbol : symbols) {
+      auto copy = std::make_unique<Symbol>(*symbol);
+      if (symbol->section_ != nullptr) {
+        copy->section_ = sections_map[symbol->section_];
+      }
+      if (symbol->symbol_version_ != nullptr) {
+        copy->symbol_version_ = versions_map[symbol->symbol_version_];
+      }
+      symbols_map[symbol.get()] = copy.get();
+      copies.push_back(std::move(copy));
+    }
+    return copies;
+  };
+  symbols_t dynamic_symbols = copy_symbols(from.dynamic_symbols_);
+  symbols_t static_symbols = copy_symbols(from.static_symbols_);
+
+  relocations_t relocations;
+  relocations.reserve(from.relocations_.size());
+  for (const std::unique_ptr<Relocation>& reloc : from.relocations_) {
+    auto copy = std::make_unique<Relocation>(*reloc);
+    copy->purpose_ = reloc->purpose_;
+    copy->info_    = reloc->info_;
+    if (reloc->symbol_ != nullptr) {
+      copy->symbol_ = symbols_map[reloc->symbol_];
+    }
+    if (reloc->section_ != nullptr) {
+      copy->section_ = sections_map[reloc->section_];
+    }
+    if (reloc->symbol_table_ != nullptr) {
+      copy->symbol_table_ = sections_map[reloc->symbol_table_];
+    }
+    relocations.push_back(std::move(copy));
+  }
+
+  dynamic_entries_t dynamic_entries;
+  dynamic_entries.reserve(from.dynamic_entries_.size());
+  for (const std::unique_ptr<DynamicEntry>& entry : from.dynamic_entries_) {
+    dynamic_entries.push_back(copy_entry(*entry));
+  }
+
+  notes_t notes;
+  notes.reserve(from.notes_.size());
+  for (const std::unique_ptr<Note>& note : from.notes_) {
+    // The details are lazily re-created from the description
+    auto copy = std::make_unique<Note>(note->name_, static_cast<uint32_t>(note->type_),
+                                       note->description_, &to);
+    copy->is_core_ = note->is_core_;
+    notes.push_back(std::move(copy));
+  }
+
+  to.format_        = from.format_;
+  to.original_size_ = from.original_size_;
+  to.type_          = from.type_;
+  to.header_        = from.header_;
+
+  to.sections_        = std::move(sections);
+  to.segments_        = std::move(segments);
+  to.dynamic_entries_ = std::move(dynamic_entries);
+  to.dynamic_symbols_ = std::move(dynamic_symbols);
+  to.static_symbols_  = std::move(static_symbols);
+  to.relocations_     = std::move(relocations);
+
+  to.symbol_version_table_        = std::move(versions);
+  to.symbol_version_requirements_ = std::move(requirements);
+  to.symbol_version_definition_   = std::move(definitions);
+
+  to.notes_ = std::move(notes);
+
+  to.gnu_hash_  = from.gnu_hash_ != nullptr ? std::make_unique<GnuHash>(*from.gnu_hash_) : nullptr;
+  to.sysv_hash_ = from.sysv_hash_ != nullptr ? std::make_unique<SysvHash>(*from.sysv_hash_) : nullptr;
+
+  to.datahandler_     = std::move(datahandler);
+  to.phdr_reloc_info_ = from.phdr_reloc_info_;
+  to.interpreter_     = from.interpreter_;
+  to.overlay_         = from.overlay_;
+  to.sizing_info_     = std::make_unique<sizing_info_t>(*from.sizing_info_);
+  to.reset_functions_index();
+}
+
 Binary::~Binary() = default;
 
 }
@@ -18,6 +18,7 @@
 #include <fstream>
 #include <iterator>
 
+#include "LIEF/OutputSink.hpp"
 #include "LIEF/ELF/Builder.hpp"
 
 #include "LIEF/ELF/Binary.hpp"
@@ -88,6 +89,8 @@ bool Builder::should_swap() const {
 
 
 void Builder::build() {
+  // The layout might move the sections/segments
+  binary_->reset_functions_index();
   if (binary_->type() == ELF_CLASS::ELFCLASS32) {
     auto res = build<details::ELF32>();
     if (!res) {
@@ -106,12 +109,12 @@ const std::vector<uint8_t>& Builder::get_build() {
 }
 
 void Builder::write(const std::string& filename) const {
-  std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
-  if (!output_file) {
+  auto sink = FileSink::open(filename);
+  if (!sink) {
     LIEF_ERR("Can't open {}!", filename);
     return;
   }
-  write(output_file);
+  write(*sink);
 }
 
 void Builder::write(std::ostream& os) const {
@@ -120,6 +123,14 @@ void Builder::write(std::ostream& os) const {
   os.write(reinterpret_cast<const char*>(content.data()), content.size());
 }
 
+ok_error_t Builder::write(OutputSink& sink) const {
+  const std::vector<uint8_t>& content = ios_.raw();
+  if (auto res = sink.write_sparse(0, content); !res) {
+    return res;
+  }
+  return sink.finalize(content.size());
+}
+
 uint32_t Builder::sort_dynamic_symbols() {
   const auto it_begin = std::begin(binary_->dynamic_symbols_);
   const auto it_end = std::end(binary_->dynamic_symbols_);
@@ -49,6 +49,8 @@
 
 #include "ELF/Structures.hpp"
 #include "ELF/SizingInfo.hpp"
+#include "ELF/PackedRelocations.hpp"
+#include "ELF/SectionCompression.hpp"
 #include "Object.tcc"
 #include "ExeLayout.hpp"
 #include "ObjectFileLayout.hpp"
@@ -63,6 +65,10 @@ ok_error_t Builder::build() {
   const char* type = ((binary_->type_ == ELF_CLASS::ELFCLASS32) ? "ELF32" : "ELF64");
   LIEF_DEBUG("== Re-building {} ==", type);
 
+  if (!build_compressed_sections<ELF_T>()) {
+    return make_error_code(lief_errors::build_error);
+  }
+
   const E_TYPE file_type = binary_->header().file_type();
   switch (file_type) {
     case E_TYPE::ET_DYN:
@@ -98,6 +104,67 @@ ok_error_t Builder::build() {
 }
 
 
+template<typename ELF_T>
+ok_error_t Builder::build_compressed_sections() {
+  using Elf_Chdr = typename ELF_T::Elf_Chdr;
+
+  for (std::unique_ptr<Section>& section : binary_->sections_) {
+    if (!section->uncompressed_modified_ || section->uncompressed_ == nullptr) {
+      continue;
+    }
+    const Section::COMPRESSION type = section->chdr_.type;
+    auto algo = to_algorithm(type);
+    if (!algo) {
+      LIEF_ERR("The compression of the section '{}' is not supported (ch_type: {})",
+               section->name(), static_cast<uint32_t>(type));
+      return make_error_code(lief_errors::build_error);
+    }
+    const std::vector<uint8_t>& data = *section->uncompressed_;
+    auto compressed = compression::compress(*algo, data);
+    if (!compressed) {
+      LIEF_ERR("Can't compress the new content of the section '{}'", section->name());
+      return make_error_code(lief_errors::build_error);
+    }
+
+    Elf_Chdr chdr;
+    memset(&chdr, 0, sizeof(Elf_Chdr));
+    chdr.ch_type      = static_cast<uint32_t>(type);
+    chdr.ch_size      = data.size();
+    chdr.ch_addralign = section->chdr_.alignment;
+
+    vector_iostream ios(should_swap());
+    ios.reserve(sizeof(Elf_Chdr) + compressed->size());
+    ios.write_conv<Elf_Chdr>(chdr);
+    ios.write(*compressed);
+
+    if (ios.size() > section->size()) {
+      if (section->has(ELF_SECTION_FLAGS::SHF_ALLOC)) {
+        LIEF_ERR("The compressed content of '{}' (0x{:x} bytes) does not fit in "
+                 "the original section (0x{:x} bytes)", section->name(), ios.size(),
+                 section->size());
+        return make_error_code(lief_errors::build_error);
+      }
+      // The section is not loaded (e.g. .debug_info): move it at the end of the file
+      const uint64_t last_offset = std::max<uint64_t>(binary_->last_offset_section(),
+                                                      binary_->last_offset_segment());
+      const uint64_t new_offset = align(last_offset, std::max<uint64_t>(section->alignment(), 1));
+      LIEF_DEBUG("Relocate '{}' from 0x{:x} to 0x{:x} (0x{:x} -> 0x{:x} bytes)",
+                 section->name(), section->file_offset(), new_offset,
+                 section->size(), ios.size());
+      section->offset(new_offset);
+      binary_->header().section_headers_offset(new_offset + ios.size());
+    }
+
+    std::shared_ptr<const std::vector<uint8_t>> uncompressed = section->uncompressed_;
+    const Section::compression_header_t hdr = section->chdr_;
+    section->content(std::move(ios.raw()));
+    section->chdr_ = hdr;
+    section->chdr_.size = data.size();
+    section->uncompressed_ = std::move(uncompressed);
+  }
+  return ok();
+}
+
 template<typename ELF_T>
 ok_error_t Builder::build_exe_lib() {
   auto* layout = static_cast<ExeLayout*>(layout_.get());
@@ -181,6 +248,33 @@ ok_error_t Builder::build_exe_lib() {
     } else { LIEF_DEBUG("PT_DYNAMIC: -0x{:x} bytes", osize - dynamic_needed_size); }
   }
 
+  pack_dynamic_relocations<ELF_T>();
+
+  // A null sizing info means that the packed tables have not been parsed
+  // (e.g. ParserConfig::parse_relocations is disabled) and must be kept as-is
+  const bool build_relr = config_.relr && binary_->sizing_info_->relr > 0;
+  const bool build_android_rela = config_.android_rela && binary_->sizing_info_->android_rela > 0;
+
+  if (build_relr) {
+    const size_t needed_size = layout->relative_relocations_size<ELF_T>();
+    const uint64_t osize = binary_->sizing_info_->relr;
+    const bool should_relocate = needed_size > osize || config_.force_relocate;
+    if (should_relocate) {
+      LIEF_DEBUG("[-] Need to relocate DT_RELR (0x{:x} new bytes)", needed_size - osize);
+      layout->relocate_relr(true);
+    } else { LIEF_DEBUG("DT_RELR: -0x{:x} bytes", osize - needed_size); }
+  }
+
+  if (build_android_rela) {
+    const size_t needed_size = layout->android_relocations_size<ELF_T>();
+    const uint64_t osize = binary_->sizing_info_->android_rela;
+    const bool should_relocate = needed_size > osize || config_.force_relocate;
+    if (should_relocate) {
+      LIEF_DEBUG("[-] Need to relocate DT_ANDROID_REL(A) (0x{:x} new bytes)", needed_size - osize);
+      layout->relocate_android_rela(true);
+    } else { LIEF_DEBUG("DT_ANDROID_REL(A): -0x{:x} bytes", osize - needed_size); }
+  }
+
   if (binary_->has(DYNAMIC_TAGS::DT_RELA) || binary_->has(DYNAMIC_TAGS::DT_REL)) {
     const size_t dyn_reloc_needed_size = layout->dynamic_relocations_size<ELF_T>();
     if (config_.rela) {
@@ -384,6 +478,16 @@ ok_error_t Builder::build_exe_lib() {
     build_notes<ELF_T>();
   }
 
+  // The size of the packed tables must be known before writing
+  // the dynamic section
+  if (build_relr) {
+    build_relative_relocations<ELF_T>();
+  }
+
+  if (build_android_rela) {
+    build_android_relocations<ELF_T>();
+  }
+
   if (config_.dynamic_section && binary_->has(SEGMENT_TYPES::PT_DYNAMIC)) {
     build_dynamic_section<ELF_T>();
   }
@@ -1296,7 +1400,9 @@ ok_error_t Builder::build_dynamic_relocations() {
   using Elf_Rel    = typename ELF_T::Elf_Rel;
 
   Binary::it_dynamic_relocations dynamic_relocations = binary_->dynamic_relocations();
-  if (dynamic_relocations.empty()) {
+  const bool has_unpacked = std::any_of(std::begin(dynamic_relocations), std::end(dynamic_relocations),
+                                        [] (const Relocation& R) { return !R.is_packed(); });
+  if (!has_unpacked) {
     if (auto* DT = binary_->get(DYNAMIC_TAGS::DT_REL)) {
       if (auto* sec = binary_->section_from_virtual_address(DT->value())) {
         sec->size(0);
@@ -1340,6 +1446,9 @@ ok_error_t Builder::build_dynamic_relocations() {
 
   vector_iostream content(should_swap());
   for (const Relocation& relocation : binary_->dynamic_relocations()) {
+    if (relocation.is_packed()) {
+      continue;
+    }
 
     // look for symbol index
     uint32_t idx = 0;
@@ -1393,6 +1502,119 @@ ok_error_t Builder::build_dynamic_relocations() {
   return ok();
 }
 
+template<typename ELF_T>
+ok_error_t Builder::pack_dynamic_relocations() {
+  using uint__ = typename ELF_T::uint;
+
+  const bool has_relr = binary_->has(DYNAMIC_TAGS::DT_RELR) ||
+                        binary_->has(DYNAMIC_TAGS::DT_ANDROID_RELR);
+
+  // Relocations are only moved in an APS2 table if the binary
+  // does not use regular DT_REL[A] tables
+  const bool android_rela = binary_->has(DYNAMIC_TAGS::DT_ANDROID_RELA);
+  const bool has_aps2 = !binary_->has(DYNAMIC_TAGS::DT_RELA) &&
+                        !binary_->has(DYNAMIC_TAGS::DT_REL) &&
+                        (android_rela || binary_->has(DYNAMIC_TAGS::DT_ANDROID_REL));
+
+  const bool pack_relr = config_.relr && has_relr && binary_->sizing_info_->relr > 0;
+  const bool pack_aps2 = config_.android_rela && has_aps2 && binary_->sizing_info_->android_rela > 0;
+  if (!pack_relr && !pack_aps2) {
+    return ok();
+  }
+
+  const uint32_t relative_type = relative_relocation_type(binary_->header().machine_type());
+
+  for (Relocation& reloc : binary_->dynamic_relocations()) {
+    if (reloc.is_packed()) {
+      continue;
+    }
+    const bool is_relr = pack_relr && relative_type != 0 &&
+                         reloc.type() == relative_type && !reloc.has_symbol() &&
+                         reloc.address() % sizeof(uint__) == 0;
+    if (is_relr) {
+      // The addend of a RELR relocation is implicit: it must be written
+      // at the relocated location
+      if (reloc.is_rela()) {
+        binary_->patch_address(reloc.address(), reloc.addend(), sizeof(uint__));
+      }
+
+      // Mirror Binary::add_dynamic_relocation()
+      DynamicEntry* dt_sz  = binary_->get(reloc.is_rela() ? DYNAMIC_TAGS::DT_RELASZ  : DYNAMIC_TAGS::DT_RELSZ);
+      DynamicEntry* dt_ent = binary_->get(reloc.is_rela() ? DYNAMIC_TAGS::DT_RELAENT : DYNAMIC_TAGS::DT_RELENT);
+      if (dt_sz != nullptr && dt_ent != nullptr && dt_sz->value() >= dt_ent->value()) {
+        dt_sz->value(dt_sz->value() - dt_ent->value());
+      }
+
+      reloc.encoding_ = Relocation::ENCODING::RELR;
+      reloc.isRela_   = false;
+      reloc.addend_   = 0;
+      continue;
+    }
+
+    if (pack_aps2 && reloc.is_rela() == android_rela) {
+      reloc.encoding_ = Relocation::ENCODING::ANDROID_SLEB;
+    }
+  }
+  return ok();
+}
+
+template<typename ELF_T>
+ok_error_t Builder::build_relative_relocations() {
+  DynamicEntry* dt_relr   = binary_->get(DYNAMIC_TAGS::DT_RELR);
+  DynamicEntry* dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_RELRSZ);
+  if (dt_relr == nullptr) {
+    dt_relr   = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELR);
+    dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELRSZ);
+  }
+
+  if (dt_relr == nullptr) {
+    return ok();
+  }
+
+  if (dt_relrsz == nullptr) {
+    LIEF_ERR("Unable to find the DT_RELRSZ");
+    return make_error_code(lief_errors::not_found);
+  }
+
+  LIEF_DEBUG("[+] Building relative relocations (RELR)");
+  const std::vector<uint8_t>& raw_relr = static_cast<ExeLayout*>(layout_.get())->raw_relr();
+  binary_->patch_address(dt_relr->value(), raw_relr);
+  dt_relrsz->value(raw_relr.size());
+
+  if (Section* section = binary_->section_from_virtual_address(dt_relr->value())) {
+    section->size(raw_relr.size());
+  }
+  return ok();
+}
+
+template<typename ELF_T>
+ok_error_t Builder::build_android_relocations() {
+  DynamicEntry* dt_rela = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELA);
+
+  const bool is_rela = dt_rela != nullptr;
+  DynamicEntry* dt_reloc   = is_rela ? dt_rela : binary_->get(DYNAMIC_TAGS::DT_ANDROID_REL);
+  DynamicEntry* dt_relocsz = is_rela ? binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELASZ) :
+                                       binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELSZ);
+  if (dt_reloc == nullptr) {
+    return ok();
+  }
+
+  if (dt_relocsz == nullptr) {
+    LIEF_ERR("Unable to find the DT_ANDROID_REL(A)SZ");
+    return make_error_code(lief_errors::not_found);
+  }
+
+  LIEF_DEBUG("[+] Building Android packed relocations (APS2)");
+  const std::vector<uint8_t>& raw = static_cast<ExeLayout*>(layout_.get())->raw_android_rela();
+  binary_->patch_address(dt_reloc->value(), raw);
+  dt_relocsz->value(raw.size());
+
+  if (Section* section = binary_->section_from_virtual_address(dt_reloc->value())) {
+    section->size(raw.size());
+  }
+  return ok();
+}
+
 template<typename ELF_T>
 ok_error_t Builder::build_pltgot_relocations() {
   using Elf_Addr   = typename ELF_T::Elf_Addr;
@@ -80,6 +80,22 @@ void swap_endian<LIEF::ELF::details::Elf64_Shdr>(LIEF::ELF::details::Elf64_Shdr
   swap_endian_shdr(shdr);
 }
 
+/** ELF Compression Header */
+template<>
+void swap_endian<LIEF::ELF::details::Elf32_Chdr>(LIEF::ELF::details::Elf32_Chdr *chdr) {
+  chdr->ch_type      = BinaryStream::swap_endian(chdr->ch_type);
+  chdr->ch_size      = BinaryStream::swap_endian(chdr->ch_size);
+  chdr->ch_addralign = BinaryStream::swap_endian(chdr->ch_addralign);
+}
+
+template<>
+void swap_endian<LIEF::ELF::details::Elf64_Chdr>(LIEF::ELF::details::Elf64_Chdr *chdr) {
+  chdr->ch_type      = BinaryStream::swap_endian(chdr->ch_type);
+  chdr->ch_reserved  = BinaryStream::swap_endian(chdr->ch_reserved);
+  chdr->ch_size      = BinaryStream::swap_endian(chdr->ch_size);
+  chdr->ch_addralign = BinaryStream::swap_endian(chdr->ch_addralign);
+}
+
 
 /** ELF Program Header */
 template <typename Elf_Phdr>
@@ -41,6 +41,10 @@ namespace DataHandler {
 //};
 class DataHandlerStream : public BinaryStream {
   public:
+  using BinaryStream::p;
+  using BinaryStream::end;
+  using BinaryStream::start;
+
   DataHandlerStream(std::vector<uint8_t>& ref) :
     data_{ref}
   {
@@ -52,6 +56,18 @@ class DataHandlerStream : public BinaryStream {
     return data_.size();
   }
 
+  const uint8_t* p() const override {
+    return data_.data() + pos();
+  }
+
+  const uint8_t* start() const override {
+    return data_.data();
+  }
+
+  const uint8_t* end() const override {
+    return data_.data() + data_.size();
+  }
+
   inline result<const void*> read_at(uint64_t offset, uint64_t size) const override {
     if (offset > data_.size() || (offset + size) > data_.size()) {
       return make_error_code(lief_errors::read_error);
@@ -86,7 +102,7 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
 
     hdl->data_ = std::move(vs.move_content());
     const uint64_t pos = vs.pos();
-    stream = std::make_unique<DataHandlerStream>(hdl->data_);
+    stream = std::make_unique<DataHandlerStream>(hdl->data_.writable());
     stream->setpos(pos);
     return hdl;
   }
@@ -101,7 +117,7 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
     auto& vs = static_cast<FileStream&>(*stream);
     hdl->data_ = vs.content();
     const uint64_t pos = vs.pos();
-    stream = std::make_unique<DataHandlerStream>(hdl->data_);
+    stream = std::make_unique<DataHandlerStream>(hdl->data_.writable());
     stream->setpos(pos);
     return hdl;
   }
@@ -114,12 +130,20 @@ result<std::unique_ptr<Handler>> Handler::from_stream(std::unique_ptr<BinaryStre
   return make_error_code(lief_errors::not_supported);
 }
 
-const std::vector<uint8_t>& Handler::content() const {
-  return data_;
-}
-
-std::vector<uint8_t>& Handler::content() {
-  return const_cast<std::vector<uint8_t>&>(static_cast<const Handler*>(this)->content());
+std::unique_ptr<Handler> Handler::share() {
+  if (!data_.is_shared()) {
+    const size_t size = data_.size();
+    auto source = std::make_shared<const SharedContent::buffer_t>(std::move(data_.writable()));
+    data_ = SharedContent(std::move(source), 0, size);
+  }
+  auto hdl = std::unique_ptr<Handler>(new Handler{});
+  hdl->data_ = data_;
+  hdl->modified_ = modified_;
+  hdl->nodes_.reserve(nodes_.size());
+  for (const std::unique_ptr<Node>& node : nodes_) {
+    hdl->nodes_.push_back(std::make_unique<Node>(*node));
+  }
+  return hdl;
 }
 
 bool Handler::has(uint64_t offset, uint64_t size, Node::Type type) {
@@ -179,7 +203,9 @@ ok_error_t Handler::make_hole(uint64_t offset, uint64_t size) {
   if (!res) {
     return res;
   }
-  data_.insert(std::begin(data_) + offset, size, 0);
+  std::vector<uint8_t>& data = data_.writable();
+  data.insert(std::begin(data) + offset, size, 0);
+  modified_ = true;
   return ok();
 }
 
@@ -192,7 +218,7 @@ ok_error_t Handler::reserve(uint64_t offset, uint64_t size) {
     return make_error_code(lief_errors::corrupted);
   }
 
-  if (static_cast<uint64_t>(full_size) > data_.max_size()) {
+  if (static_cast<uint64_t>(full_size) > SharedContent::buffer_t{}.max_size()) {
     return make_error_code(lief_errors::corrupted);
   }
 
@@ -205,7 +231,8 @@ ok_error_t Handler::reserve(uint64_t offset, uint64_t size) {
     return ok();
   }
 
-  data_.resize(offset + size, 0);
+  data_.writable().resize(offset + size, 0);
+  modified_ = true;
   return ok();
 }
 
@@ -22,8 +22,10 @@
 #include "LIEF/visibility.h"
 #include "LIEF/utils.hpp"
 #include "LIEF/errors.hpp"
+#include "LIEF/SharedContent.hpp"
 
 #include "ELF/DataHandler/Node.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 namespace LIEF {
 class BinaryStream;
@@ -48,8 +50,37 @@ class LIEF_API Handler {
   Handler& operator=(Handler&&);
   Handler(Handler&&);
 
-  const std::vector<uint8_t>& content() const;
-  std::vector<uint8_t>& content();
+  //! Content of the file
+  span<const uint8_t> content() const {
+    return data_.content();
+  }
+
+  //! Content of the file that can be modified. If the content is shared with
+  //! a snapshot, a private copy is created.
+  std::vector<uint8_t>& writable() {
+    modified_ = true;
+    details::notify_modification(modifications_);
+    return data_.writable();
+  }
+
+  //! Counter of the Binary which is notified when the content is modified
+  void modifications(std::shared_ptr<details::ModificationCounter> counter) {
+    modifications_ = std::move(counter);
+  }
+
+  //! Whether the content has been modified (or resized) since the parsing
+  bool is_modified() const {
+    return modified_;
+  }
+
+  //! Create a new handler with the same nodes and which shares the content
+  //! of this handler until one of them is modified.
+  std::unique_ptr<Handler> share();
+
+  //! Nodes (sections and segments) registered in this handler
+  const std::vector<std::unique_ptr<Node>>& nodes() const {
+    return nodes_;
+  }
 
   Node& add(const Node& node);
 
@@ -70,8 +101,10 @@ class LIEF_API Handler {
   private:
   Handler();
   Handler(BinaryStream& stream);
-  std::vector<uint8_t> data_;
+  SharedContent data_;
   std::vector<std::unique_ptr<Node>> nodes_;
+  std::shared_ptr<details::ModificationCounter> modifications_;
+  bool modified_ = false;
 };
 } // namespace DataHandler
 } // namespace ELF
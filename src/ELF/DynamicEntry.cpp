@@ -21,15 +21,31 @@
 #include "LIEF/ELF/DynamicEntry.hpp"
 #include "LIEF/ELF/EnumToString.hpp"
 #include "ELF/Structures.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 namespace LIEF {
 namespace ELF {
 
 DynamicEntry::DynamicEntry() = default;
 
-DynamicEntry& DynamicEntry::operator=(const DynamicEntry&) = default;
+// The modification counter is not copied: the copy doesn't belong to the
+// Binary of the original entry
+DynamicEntry& DynamicEntry::operator=(const DynamicEntry& other) {
+  if (this == &other) {
+    return *this;
+  }
+  Object::operator=(other);
+  tag_   = other.tag_;
+  value_ = other.value_;
+  details::notify_modification(modifications_);
+  return *this;
+}
 
-DynamicEntry::DynamicEntry(const DynamicEntry&) = default;
+DynamicEntry::DynamicEntry(const DynamicEntry& other) :
+  Object{other},
+  tag_{other.tag_},
+  value_{other.value_}
+{}
 
 DynamicEntry::~DynamicEntry() = default;
 
@@ -62,11 +78,13 @@ uint64_t DynamicEntry::value() const {
 
 void DynamicEntry::tag(DYNAMIC_TAGS tag) {
   tag_ = tag;
+  details::notify_modification(modifications_);
 }
 
 
 void DynamicEntry::value(uint64_t value) {
   value_ = value;
+  details::notify_modification(modifications_);
 }
 
 void DynamicEntry::accept(Visitor& visitor) const {
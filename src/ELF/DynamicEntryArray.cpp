@@ -17,6 +17,7 @@
 #include "LIEF/Visitor.hpp"
 
 #include "logging.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 #include <algorithm>
 #include <numeric>
@@ -38,6 +39,8 @@ DynamicEntryArray::DynamicEntryArray(DYNAMIC_TAGS tag, array_t array) :
 
 
 DynamicEntryArray::array_t& DynamicEntryArray::array() {
+  // The array can be modified through the reference
+  details::notify_modification(modifications_);
   return const_cast<DynamicEntryArray::array_t&>(static_cast<const DynamicEntryArray*>(this)->array());
 }
 
@@ -48,10 +51,12 @@ const DynamicEntryArray::array_t& DynamicEntryArray::array() const {
 
 void DynamicEntryArray::array(const DynamicEntryArray::array_t& array) {
   array_ = array;
+  details::notify_modification(modifications_);
 }
 
 DynamicEntryArray& DynamicEntryArray::append(uint64_t function) {
   array_.push_back(function);
+  details::notify_modification(modifications_);
   return *this;
 }
 
@@ -59,6 +64,7 @@ DynamicEntryArray& DynamicEntryArray::remove(uint64_t function) {
   array_.erase(std::remove_if(std::begin(array_), std::end(array_),
                               [function] (uint64_t v) { return v == function; }),
                std::end(array_));
+  details::notify_modification(modifications_);
   return *this;
 }
 
@@ -73,6 +79,7 @@ DynamicEntryArray& DynamicEntryArray::insert(size_t pos, uint64_t function) {
   }
 
   array_.insert(std::begin(array_) + pos, function);
+  details::notify_modification(modifications_);
   return *this;
 }
 
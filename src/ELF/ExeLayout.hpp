@@ -45,6 +45,7 @@
 #include "internal_utils.hpp"
 #include "notes_utils.hpp"
 #include "logging.hpp"
+#include "ELF/PackedRelocations.hpp"
 #include "Layout.hpp"
 
 namespace LIEF {
@@ -398,13 +399,85 @@ class LIEF_LOCAL ExeLayout : public Layout {
     using Elf_Rela = typename ELF_T::Elf_Rela;
     using Elf_Rel  = typename ELF_T::Elf_Rel;
     const Binary::it_dynamic_relocations& dyn_relocs = binary_->dynamic_relocations();
+    // Packed relocations are encoded in DT_RELR / DT_ANDROID_REL[A]
+    const size_t nb_relocs = std::count_if(std::begin(dyn_relocs), std::end(dyn_relocs),
+                                           [] (const Relocation& R) { return !R.is_packed(); });
 
     const size_t computed_size = binary_->has(DYNAMIC_TAGS::DT_RELA) ?
-                                 dyn_relocs.size() * sizeof(Elf_Rela) :
-                                 dyn_relocs.size() * sizeof(Elf_Rel);
+                                 nb_relocs * sizeof(Elf_Rela) :
+                                 nb_relocs * sizeof(Elf_Rel);
     return computed_size;
   }
 
+  template<class ELF_T>
+  size_t relative_relocations_size() {
+    using uint__ = typename ELF_T::uint;
+    std::vector<uint64_t> addresses;
+    for (const Relocation& R : binary_->dynamic_relocations()) {
+      if (R.encoding() == Relocation::ENCODING::RELR) {
+        addresses.push_back(R.address());
+      }
+    }
+    auto entries = encode_relr(std::move(addresses), sizeof(uint__));
+    if (!entries) {
+      LIEF_ERR("Can't encode the RELR relocations");
+      raw_relr_.clear();
+      return 0;
+    }
+    vector_iostream raw_relr;
+    for (uint64_t entry : *entries) {
+      raw_relr.write_conv<uint__>(static_cast<uint__>(entry));
+    }
+    raw_relr.move(raw_relr_);
+    return raw_relr_.size();
+  }
+
+  template<class ELF_T>
+  size_t android_relocations_size() {
+    const uint8_t shift = std::is_same<ELF_T, details::ELF32>::value ? 8 : 32;
+    const bool is_rela = binary_->has(DYNAMIC_TAGS::DT_ANDROID_RELA);
+
+    std::unordered_map<std::string, uint32_t> symbols_idx;
+    for (size_t i = 0; i < binary_->dynamic_symbols_.size(); ++i) {
+      symbols_idx.emplace(binary_->dynamic_symbols_[i]->name(), i);
+    }
+
+    std::vector<packed_reloc_t> relocations;
+    std::vector<packed_reloc_t> relatives;
+    const uint32_t relative_type = relative_relocation_type(binary_->header().machine_type());
+    for (const Relocation& R : binary_->dynamic_relocations()) {
+      if (R.encoding() != Relocation::ENCODING::ANDROID_SLEB) {
+        continue;
+      }
+      uint64_t idx = R.info();
+      if (const Symbol* sym = R.symbol()) {
+        const auto it = symbols_idx.find(sym->name());
+        if (it != std::end(symbols_idx)) {
+          idx = it->second;
+        }
+      }
+      packed_reloc_t entry;
+      entry.offset = R.address();
+      entry.info   = (idx << shift) | R.type();
+      entry.addend = R.addend();
+      if (relative_type != 0 && R.type() == relative_type && !R.has_symbol()) {
+        relatives.push_back(entry);
+      } else {
+        relocations.push_back(entry);
+      }
+    }
+    // Sorting the relative relocations maximizes the number of entries
+    // that share the same offset delta (and thus the same APS2 group)
+    std::sort(std::begin(relatives), std::end(relatives),
+              [] (const packed_reloc_t& lhs, const packed_reloc_t& rhs) {
+                return lhs.offset < rhs.offset;
+              });
+    relatives.insert(std::end(relatives), std::begin(relocations), std::end(relocations));
+
+    raw_android_rela_ = encode_android_packed(relatives, is_rela);
+    return raw_android_rela_.size();
+  }
+
   template<class ELF_T>
   size_t pltgot_relocations_size() {
     using Elf_Rela   = typename ELF_T::Elf_Rela;
@@ -519,6 +592,14 @@ class LIEF_LOCAL ExeLayout : public Layout {
     pltgot_reloc_size_ = size;
   }
 
+  void relocate_relr(bool val) {
+    relocate_relr_ = val;
+  }
+
+  void relocate_android_rela(bool val) {
+    relocate_android_rela_ = val;
+  }
+
   void relocate_interpreter(uint64_t size) {
     interp_size_ = size;
   }
@@ -543,6 +624,14 @@ class LIEF_LOCAL ExeLayout : public Layout {
     return raw_gnu_hash_;
   }
 
+  const std::vector<uint8_t>& raw_relr() const {
+    return raw_relr_;
+  }
+
+  const std::vector<uint8_t>& raw_android_rela() const {
+    return raw_android_rela_;
+  }
+
   const std::vector<uint8_t>& raw_notes() const {
     return raw_notes_;
   }
@@ -583,6 +672,7 @@ class LIEF_LOCAL ExeLayout : public Layout {
      *    .gnu.version_d
      *    .gnu.version_r
      *    .rela.dyn
+     *    .relr.dyn
      *    .rela.plt
      * Perm: READ ONLY
      * Align: 0x1000
@@ -605,6 +695,14 @@ class LIEF_LOCAL ExeLayout : public Layout {
       read_segment += raw_gnu_hash_.size();
     }
 
+    if (relocate_relr_) {
+      read_segment += raw_relr_.size();
+    }
+
+    if (relocate_android_rela_) {
+      read_segment += raw_android_rela_.size();
+    }
+
     Segment* new_rsegment = nullptr;
 
     if (read_segment > 0) {
@@ -949,6 +1047,78 @@ class LIEF_LOCAL ExeLayout : public Layout {
       va_r_base += dynamic_reloc_size_;
     }
 
+    if (relocate_relr_) {
+      // Update:
+      // - DT_RELR / DT_RELRSZ (or their DT_ANDROID_ counterparts)
+      // - .relr.dyn
+      DynamicEntry* dt_relr   = binary_->get(DYNAMIC_TAGS::DT_RELR);
+      DynamicEntry* dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_RELRSZ);
+      if (dt_relr == nullptr) {
+        dt_relr   = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELR);
+        dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELRSZ);
+      }
+
+      if (dt_relr == nullptr || dt_relrsz == nullptr) {
+        LIEF_ERR("Can't find DT_RELR / DT_RELRSZ");
+        return make_error_code(lief_errors::file_format_error);
+      }
+
+      uint64_t offset_r_base = 0;
+      if (auto res = binary_->virtual_address_to_offset(va_r_base)) {
+        offset_r_base = *res;
+      } else {
+        return make_error_code(lief_errors::build_error);
+      }
+
+      if (Section* section = binary_->section_from_virtual_address(dt_relr->value())) {
+        section->virtual_address(va_r_base);
+        section->size(raw_relr_.size());
+        section->offset(offset_r_base);
+        section->original_size_ = raw_relr_.size();
+      }
+
+      dt_relr->value(va_r_base);
+      dt_relrsz->value(raw_relr_.size());
+
+      va_r_base += raw_relr_.size();
+    }
+
+    if (relocate_android_rela_) {
+      // Update:
+      // - DT_ANDROID_REL(A) / DT_ANDROID_REL(A)SZ
+      // - .rela.dyn (APS2)
+      DynamicEntry* dt_rela = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELA);
+
+      const bool is_rela = dt_rela != nullptr;
+      DynamicEntry* dt_reloc   = is_rela ? dt_rela : binary_->get(DYNAMIC_TAGS::DT_ANDROID_REL);
+      DynamicEntry* dt_relocsz = is_rela ? binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELASZ) :
+                                           binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELSZ);
+
+      if (dt_reloc == nullptr || dt_relocsz == nullptr) {
+        LIEF_ERR("Can't find DT_ANDROID_REL(A) / DT_ANDROID_REL(A)SZ");
+        return make_error_code(lief_errors::file_format_error);
+      }
+
+      uint64_t offset_r_base = 0;
+      if (auto res = binary_->virtual_address_to_offset(va_r_base)) {
+        offset_r_base = *res;
+      } else {
+        return make_error_code(lief_errors::build_error);
+      }
+
+      if (Section* section = binary_->section_from_virtual_address(dt_reloc->value())) {
+        section->virtual_address(va_r_base);
+        section->size(raw_android_rela_.size());
+        section->offset(offset_r_base);
+        section->original_size_ = raw_android_rela_.size();
+      }
+
+      dt_reloc->value(va_r_base);
+      dt_relocsz->value(raw_android_rela_.size());
+
+      va_r_base += raw_android_rela_.size();
+    }
+
     if (pltgot_reloc_size_ > 0) {
       // Update:
       // - DT_JMPREL / DT_PLTRELSZ
@@ -1377,6 +1547,12 @@ class LIEF_LOCAL ExeLayout : public Layout {
   std::vector<uint8_t> raw_gnu_hash_;
   bool relocate_gnu_hash_{false};
 
+  std::vector<uint8_t> raw_relr_;
+  bool relocate_relr_{false};
+
+  std::vector<uint8_t> raw_android_rela_;
+  bool relocate_android_rela_{false};
+
   uint64_t sysv_size_{0};
 
   uint64_t dynamic_size_{0};
@@ -0,0 +1,511 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <sys/mman.h>
+#define LIEF_LOADER_MMAP 1
+#endif
+
+#include "logging.hpp"
+#include "frozen.hpp"
+
+#include "LIEF/utils.hpp"
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+
+#include "LIEF/ELF/Loader.hpp"
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/EnumToString.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+
+#include "ELF/PackedRelocations.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+namespace {
+enum class KIND {
+  NONE = 0,
+  RELATIVE,    ///< B + A
+  GOT,         ///< S (+ A for RELA)
+  ABSOLUTE,    ///< S + A
+  UNSUPPORTED,
+};
+
+KIND relocation_kind(ARCH arch, uint32_t type, uint32_t relative_type, bool is64) {
+  if (relative_type != 0 && type == relative_type) {
+    return KIND::RELATIVE;
+  }
+
+  switch (arch) {
+    case ARCH::EM_X86_64:
+      {
+        switch (static_cast<RELOC_x86_64>(type)) {
+          case RELOC_x86_64::R_X86_64_NONE:      return KIND::NONE;
+          case RELOC_x86_64::R_X86_64_GLOB_DAT:
+          case RELOC_x86_64::R_X86_64_JUMP_SLOT: return KIND::GOT;
+          case RELOC_x86_64::R_X86_64_64:        return is64 ? KIND::ABSOLUTE : KIND::UNSUPPORTED;
+          default:                               return KIND::UNSUPPORTED;
+        }
+      }
+
+    case ARCH::EM_386:
+      {
+        switch (static_cast<RELOC_i386>(type)) {
+          case RELOC_i386::R_386_NONE:      return KIND::NONE;
+          case RELOC_i386::R_386_GLOB_DAT:
+          case RELOC_i386::R_386_JUMP_SLOT: return KIND::GOT;
+          case RELOC_i386::R_386_32:        return KIND::ABSOLUTE;
+          default:                          return KIND::UNSUPPORTED;
+        }
+      }
+
+    case ARCH::EM_ARM:
+      {
+        switch (static_cast<RELOC_ARM>(type)) {
+          case RELOC_ARM::R_ARM_NONE:      return KIND::NONE;
+          case RELOC_ARM::R_ARM_GLOB_DAT:
+          case RELOC_ARM::R_ARM_JUMP_SLOT: return KIND::GOT;
+          case RELOC_ARM::R_ARM_ABS32:     return KIND::ABSOLUTE;
+          default:                         return KIND::UNSUPPORTED;
+        }
+      }
+
+    case ARCH::EM_AARCH64:
+      {
+        switch (static_cast<RELOC_AARCH64>(type)) {
+          case RELOC_AARCH64::R_AARCH64_NONE:      return KIND::NONE;
+          case RELOC_AARCH64::R_AARCH64_GLOB_DAT:
+          case RELOC_AARCH64::R_AARCH64_JUMP_SLOT: return KIND::GOT;
+          case RELOC_AARCH64::R_AARCH64_ABS64:     return KIND::ABSOLUTE;
+          default:                                 return KIND::UNSUPPORTED;
+        }
+      }
+
+    default:
+      return KIND::UNSUPPORTED;
+  }
+}
+
+bool should_swap(const Binary& bin) {
+  switch (bin.header().abstract_endianness()) {
+#ifdef __BYTE_ORDER__
+#if  defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    case ENDIANNESS::ENDIAN_BIG:
+#elif defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    case ENDIANNESS::ENDIAN_LITTLE:
+#endif
+      return true;
+#endif // __BYTE_ORDER__
+    default:
+      return false;
+  }
+}
+
+template<class T, bool SWAP>
+inline T load_word(const uint8_t* p) {
+  T value = 0;
+  std::memcpy(&value, p, sizeof(T));
+  return SWAP ? BinaryStream::swap_endian<T>(value) : value;
+}
+
+template<class T, bool SWAP>
+inline void store_word(uint8_t* p, T value) {
+  if (SWAP) {
+    value = BinaryStream::swap_endian<T>(value);
+  }
+  std::memcpy(p, &value, sizeof(T));
+}
+
+// Relative relocation located at ``offset`` in the image.
+// If ``implicit`` is set, the addend is the value stored in the image (REL/RELR)
+struct relative_t {
+  uint64_t offset = 0;
+  int64_t  addend = 0;
+  bool     implicit = false;
+};
+
+// The relative relocations are sorted so that the consecutive slots (which are
+// the common case for the RELR-encoded relocations, the vtables, .init_array, ...)
+// are processed as runs over a contiguous range of the image. These loops don't
+// depend on the other slots and can be vectorized by the compiler.
+template<class T, bool SWAP>
+void apply_relative(uint8_t* image, std::vector<relative_t>& relocs, uint64_t bias) {
+  std::sort(relocs.begin(), relocs.end(),
+            [] (const relative_t& lhs, const relative_t& rhs) {
+              return lhs.offset < rhs.offset;
+            });
+  const auto delta = static_cast<T>(bias);
+  const size_t nb_relocs = relocs.size();
+  size_t i = 0;
+  while (i < nb_relocs) {
+    const bool implicit = relocs[i].implicit;
+    size_t j = i + 1;
+    while (j < nb_relocs && relocs[j].implicit == implicit &&
+           relocs[j].offset == relocs[j - 1].offset + sizeof(T)) {
+      ++j;
+    }
+
+    uint8_t* run = image + relocs[i].offset;
+    const size_t count = j - i;
+    if (implicit) {
+      for (size_t k = 0; k < count; ++k) {
+        uint8_t* p = run + k * sizeof(T);
+        store_word<T, SWAP>(p, load_word<T, SWAP>(p) + delta);
+      }
+    } else {
+      const relative_t* entries = relocs.data() + i;
+      for (size_t k = 0; k < count; ++k) {
+        store_word<T, SWAP>(run + k * sizeof(T),
+                            delta + static_cast<T>(entries[k].addend));
+      }
+    }
+    i = j;
+  }
+}
+
+template<class T>
+void apply_relative(uint8_t* image, std::vector<relative_t>& relocs,
+                    uint64_t bias, bool swap) {
+  if (swap) {
+    return apply_relative<T, true>(image, relocs, bias);
+  }
+  return apply_relative<T, false>(image, relocs, bias);
+}
+
+template<class T>
+void write_word(uint8_t* p, uint64_t value, bool swap) {
+  if (swap) {
+    return store_word<T, true>(p, static_cast<T>(value));
+  }
+  return store_word<T, false>(p, static_cast<T>(value));
+}
+
+template<class T>
+uint64_t read_word(const uint8_t* p, bool swap) {
+  return swap ? load_word<T, true>(p) : load_word<T, false>(p);
+}
+}
+
+Loader::Image::Image(Image&& other) noexcept :
+  data_{other.data_},
+  size_{other.size_},
+  base_{other.base_},
+  unresolved_{std::move(other.unresolved_)}
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+Loader::Image& Loader::Image::operator=(Image&& other) noexcept {
+  if (this != &other) {
+    release();
+    data_ = other.data_;
+    size_ = other.size_;
+    base_ = other.base_;
+    unresolved_ = std::move(other.unresolved_);
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+Loader::Image::~Image() {
+  release();
+}
+
+result<Loader::Image> Loader::Image::allocate(size_t size) {
+  Image image;
+#if defined(LIEF_LOADER_MMAP)
+  void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    LIEF_ERR("Can't map 0x{:x} bytes", size);
+    return make_error_code(lief_errors::data_too_large);
+  }
+#else
+  void* ptr = std::calloc(size, 1);
+  if (ptr == nullptr) {
+    LIEF_ERR("Can't allocate 0x{:x} bytes", size);
+    return make_error_code(lief_errors::data_too_large);
+  }
+#endif
+  image.data_ = static_cast<uint8_t*>(ptr);
+  image.size_ = size;
+  return image;
+}
+
+void Loader::Image::release() {
+  if (data_ == nullptr) {
+    return;
+  }
+#if defined(LIEF_LOADER_MMAP)
+  ::munmap(data_, size_);
+#else
+  std::free(data_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+Loader::Loader(const Binary& bin) :
+  binary_{&bin}
+{}
+
+uint64_t Loader::image_start() const {
+  uint64_t start = -1llu;
+  for (const Segment& segment : binary_->segments()) {
+    if (segment.type() == SEGMENT_TYPES::PT_LOAD) {
+      start = std::min(start, segment.virtual_address());
+    }
+  }
+  if (start == -1llu) {
+    return 0;
+  }
+  return page_size_ > 0 ? start - (start % page_size_) : start;
+}
+
+uint64_t Loader::image_size() const {
+  uint64_t end = 0;
+  bool has_load = false;
+  for (const Segment& segment : binary_->segments()) {
+    if (segment.type() == SEGMENT_TYPES::PT_LOAD) {
+      end = std::max(end, segment.virtual_address() + segment.virtual_size());
+      has_load = true;
+    }
+  }
+  if (!has_load) {
+    return 0;
+  }
+  if (page_size_ > 0) {
+    end = align(end, page_size_);
+  }
+  return end - image_start();
+}
+
+ok_error_t Loader::load_segments(span<uint8_t> buffer) const {
+  const uint64_t start = image_start();
+  for (const Segment& segment : binary_->segments()) {
+    if (segment.type() != SEGMENT_TYPES::PT_LOAD) {
+      continue;
+    }
+    const uint64_t rva = segment.virtual_address() - start;
+    span<const uint8_t> content = segment.content();
+    // The remaining part of the segment (.bss) is zero-filled
+    const uint64_t size = std::min<uint64_t>({content.size(), segment.physical_size(),
+                                              segment.virtual_size()});
+    if (rva > buffer.size() || size > buffer.size() - rva) {
+      LIEF_ERR("Segment PT_LOAD@0x{:x} is out of the image", segment.virtual_address());
+      return make_error_code(lief_errors::read_out_of_bound);
+    }
+    if (size > 0) {
+      std::memcpy(buffer.data() + rva, content.data(), size);
+    }
+  }
+  return ok();
+}
+
+std::vector<Loader::unresolved_t> Loader::relocate(span<uint8_t> buffer, uint64_t base) const {
+  const uint64_t start = image_start();
+  const uint64_t bias  = base - start;
+  const ARCH arch      = binary_->header().machine_type();
+  const bool is64      = binary_->type() == ELF_CLASS::ELFCLASS64;
+  const size_t word    = is64 ? sizeof(uint64_t) : sizeof(uint32_t);
+  const bool swap      = should_swap(*binary_);
+  const uint32_t relative_type = relative_relocation_type(arch);
+
+  std::vector<unresolved_t> unresolved;
+  std::vector<relative_t> relatives;
+  std::vector<const Relocation*> symbolics;
+
+  auto report = [&unresolved] (const Relocation& R, REASON reason) {
+    unresolved_t entry;
+    entry.address = R.address();
+    entry.type    = R.type();
+    entry.reason  = reason;
+    if (const Symbol* sym = R.symbol()) {
+      entry.symbol = sym->name();
+    }
+    unresolved.push_back(std::move(entry));
+  };
+
+  auto dispatch = [&] (const Relocation& R) {
+    const KIND kind = relocation_kind(arch, R.type(), relative_type, is64);
+    if (kind == KIND::NONE) {
+      return;
+    }
+    if (kind == KIND::UNSUPPORTED) {
+      return report(R, REASON::UNSUPPORTED);
+    }
+    const uint64_t offset = R.address() - start;
+    if (R.address() < start || offset > buffer.size() || word > buffer.size() - offset) {
+      return report(R, REASON::OUT_OF_BOUNDS);
+    }
+    if (kind == KIND::RELATIVE) {
+      relative_t entry;
+      entry.offset   = offset;
+      entry.addend   = R.addend();
+      entry.implicit = !R.is_rela();
+      relatives.push_back(entry);
+      return;
+    }
+    symbolics.push_back(&R);
+  };
+
+  for (const Relocation& R : binary_->dynamic_relocations()) {
+    dispatch(R);
+  }
+
+  for (const Relocation& R : binary_->pltgot_relocations()) {
+    dispatch(R);
+  }
+
+  LIEF_DEBUG("Applying {} relative relocations (bias: 0x{:x})", relatives.size(), bias);
+  if (is64) {
+    apply_relative<uint64_t>(buffer.data(), relatives, bias, swap);
+  } else {
+    apply_relative<uint32_t>(buffer.data(), relatives, bias, swap);
+  }
+
+  // Most of the symbols are referenced by several relocations (GLOB_DAT + ABS, ...)
+  // so that we cache the resolved values
+  std::unordered_map<const Symbol*, result<uint64_t>> resolved;
+  auto resolve = [&] (const Symbol& sym) -> result<uint64_t> {
+    auto it = resolved.find(&sym);
+    if (it != resolved.end()) {
+      return it->second;
+    }
+
+    result<uint64_t> value = make_error_code(lief_errors::not_found);
+    if (resolver_) {
+      value = resolver_(sym);
+    }
+    if (!value) {
+      const auto shndx = static_cast<SYMBOL_SECTION_INDEX>(sym.shndx());
+      if (shndx == SYMBOL_SECTION_INDEX::SHN_ABS) {
+        value = sym.value();
+      }
+      else if (shndx != SYMBOL_SECTION_INDEX::SHN_UNDEF) {
+        value = bias + sym.value();
+      }
+      else if (sym.binding() == SYMBOL_BINDINGS::STB_WEAK) {
+        // Unresolved weak symbols are resolved to 0
+        value = 0;
+      }
+    }
+    resolved.emplace(&sym, value);
+    return value;
+  };
+
+  LIEF_DEBUG("Applying {} symbolic relocations", symbolics.size());
+  for (const Relocation* R : symbolics) {
+    uint64_t S = 0;
+    if (const Symbol* sym = R->symbol()) {
+      auto value = resolve(*sym);
+      if (!value) {
+        report(*R, REASON::SYMBOL_NOT_FOUND);
+        continue;
+      }
+      S = *value;
+    }
+    uint8_t* slot = buffer.data() + (R->address() - start);
+    uint64_t value = S;
+    if (R->is_rela()) {
+      value += R->addend();
+    }
+    else if (relocation_kind(arch, R->type(), relative_type, is64) == KIND::ABSOLUTE) {
+      value += is64 ? read_word<uint64_t>(slot, swap) : read_word<uint32_t>(slot, swap);
+    }
+    if (is64) {
+      write_word<uint64_t>(slot, value, swap);
+    } else {
+      write_word<uint32_t>(slot, value, swap);
+    }
+  }
+
+  if (!unresolved.empty()) {
+    LIEF_DEBUG("{} relocations have not been applied", unresolved.size());
+  }
+  return unresolved;
+}
+
+result<std::vector<Loader::unresolved_t>> Loader::load(span<uint8_t> buffer, uint64_t base) const {
+  const uint64_t size = image_size();
+  if (size == 0) {
+    LIEF_ERR("The binary does not have a PT_LOAD segment");
+    return make_error_code(lief_errors::not_found);
+  }
+
+  if (buffer.size() < size) {
+    LIEF_ERR("The buffer is too small (0x{:x} bytes) for the image (0x{:x} bytes)",
+             buffer.size(), size);
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+
+  std::fill(buffer.begin(), buffer.end(), 0);
+  auto is_ok = load_segments(buffer);
+  if (!is_ok) {
+    return make_error_code(is_ok.error());
+  }
+  return relocate(buffer, base);
+}
+
+result<Loader::Image> Loader::map(uint64_t base) const {
+  const uint64_t size = image_size();
+  if (size == 0) {
+    LIEF_ERR("The binary does not have a PT_LOAD segment");
+    return make_error_code(lief_errors::not_found);
+  }
+
+  if (size > static_cast<uint64_t>(std::numeric_limits<size_t>::max())) {
+    return make_error_code(lief_errors::data_too_large);
+  }
+
+  auto image = Image::allocate(size);
+  if (!image) {
+    return make_error_code(image.error());
+  }
+
+  // The memory is already zero-filled
+  span<uint8_t> content = image->content();
+  auto is_ok = load_segments(content);
+  if (!is_ok) {
+    return make_error_code(is_ok.error());
+  }
+  image->base_ = base;
+  image->unresolved_ = relocate(content, base);
+  return image;
+}
+
+const char* to_string(Loader::REASON e) {
+  CONST_MAP(Loader::REASON, const char*, 4) enumStrings {
+    { Loader::REASON::UNKNOWN,          "UNKNOWN" },
+    { Loader::REASON::SYMBOL_NOT_FOUND, "SYMBOL_NOT_FOUND" },
+    { Loader::REASON::UNSUPPORTED,      "UNSUPPORTED" },
+    { Loader::REASON::OUT_OF_BOUNDS,    "OUT_OF_BOUNDS" },
+  };
+  const auto it = enumStrings.find(e);
+  return it == enumStrings.end() ? "UNKNOWN" : it->second;
+}
+
+}
+}
@@ -0,0 +1,53 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_MODIFICATION_COUNTER_H
+#define LIEF_ELF_MODIFICATION_COUNTER_H
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace LIEF {
+namespace ELF {
+namespace details {
+
+// The symbols, segments and dynamic entries don't reference the Binary
+// they belong to. When the Binary computes a cache from these objects
+// (e.g. Binary::functions_index()), it attaches its counter to them so that
+// their setters can invalidate the cache of this Binary (and only this one).
+class ModificationCounter {
+  public:
+  uint64_t count() const {
+    return count_.load(std::memory_order_acquire);
+  }
+
+  void increment() {
+    count_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  private:
+  std::atomic<uint64_t> count_{0};
+};
+
+inline void notify_modification(const std::shared_ptr<ModificationCounter>& counter) {
+  if (counter != nullptr) {
+    counter->increment();
+  }
+}
+
+}
+}
+}
+#endif
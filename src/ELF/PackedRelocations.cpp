@@ -0,0 +1,310 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+
+#include "logging.hpp"
+
+#include "LIEF/iostream.hpp"
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+
+#include "ELF/PackedRelocations.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+static constexpr char APS2_MAGIC[] = {'A', 'P', 'S', '2'};
+
+// Flags of an APS2 group
+static constexpr uint64_t GROUPED_BY_INFO         = 1;
+static constexpr uint64_t GROUPED_BY_OFFSET_DELTA = 2;
+static constexpr uint64_t GROUPED_BY_ADDEND       = 4;
+static constexpr uint64_t GROUP_HAS_ADDEND        = 8;
+
+uint32_t relative_relocation_type(ARCH arch) {
+  static constexpr uint32_t R_RISCV_RELATIVE = 3;
+  switch (arch) {
+    case ARCH::EM_386:       return RELOC_i386::R_386_RELATIVE;
+    case ARCH::EM_X86_64:    return static_cast<uint32_t>(RELOC_x86_64::R_X86_64_RELATIVE);
+    case ARCH::EM_ARM:       return static_cast<uint32_t>(RELOC_ARM::R_ARM_RELATIVE);
+    case ARCH::EM_AARCH64:   return static_cast<uint32_t>(RELOC_AARCH64::R_AARCH64_RELATIVE);
+    case ARCH::EM_PPC:       return static_cast<uint32_t>(RELOC_POWERPC32::R_PPC_RELATIVE);
+    case ARCH::EM_PPC64:     return static_cast<uint32_t>(RELOC_POWERPC64::R_PPC64_RELATIVE);
+    case ARCH::EM_S390:      return static_cast<uint32_t>(RELOC_SYSTEMZ::R_390_RELATIVE);
+    case ARCH::EM_SPARC:
+    case ARCH::EM_SPARCV9:   return static_cast<uint32_t>(RELOC_SPARC::R_SPARC_RELATIVE);
+    case ARCH::EM_HEXAGON:   return static_cast<uint32_t>(RELOC_HEXAGON::R_HEX_RELATIVE);
+    case ARCH::EM_LOONGARCH: return static_cast<uint32_t>(RELOC_LOONGARCH::R_LARCH_RELATIVE);
+    case ARCH::EM_RISCV:     return R_RISCV_RELATIVE;
+    default:                 return 0;
+  }
+}
+
+ok_error_t decode_relr(BinaryStream& stream, uint64_t size, size_t word_size,
+                       size_t max_count, std::vector<uint64_t>& addresses)
+{
+  const uint64_t nb_entries = size / word_size;
+  const size_t nb_bits = word_size * 8 - 1;
+  uint64_t base = 0;
+  bool has_base = false;
+
+  for (uint64_t i = 0; i < nb_entries; ++i) {
+    uint64_t entry = 0;
+    if (word_size == sizeof(uint32_t)) {
+      auto res = stream.read_conv<uint32_t>();
+      if (!res) {
+        return make_error_code(lief_errors::read_error);
+      }
+      entry = *res;
+    } else {
+      auto res = stream.read_conv<uint64_t>();
+      if (!res) {
+        return make_error_code(lief_errors::read_error);
+      }
+      entry = *res;
+    }
+
+    if ((entry & 1) == 0) {
+      if (addresses.size() >= max_count) {
+        return make_error_code(lief_errors::corrupted);
+      }
+      addresses.push_back(entry);
+      base = entry + word_size;
+      has_base = true;
+      continue;
+    }
+
+    if (!has_base) {
+      LIEF_DEBUG("RELR: bitmap 0x{:x} without a base address", entry);
+      return make_error_code(lief_errors::corrupted);
+    }
+
+    for (size_t bit = 0; (entry >>= 1) != 0; ++bit) {
+      if ((entry & 1) == 0) {
+        continue;
+      }
+      if (addresses.size() >= max_count) {
+        return make_error_code(lief_errors::corrupted);
+      }
+      addresses.push_back(base + bit * word_size);
+    }
+    base += nb_bits * word_size;
+  }
+  return ok();
+}
+
+result<std::vector<uint64_t>> encode_relr(std::vector<uint64_t> addresses, size_t word_size) {
+  const size_t nb_bits = word_size * 8 - 1;
+  std::sort(addresses.begin(), addresses.end());
+  addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+
+  std::vector<uint64_t> entries;
+  for (size_t i = 0; i < addresses.size();) {
+    if (addresses[i] % word_size != 0) {
+      LIEF_ERR("RELR: 0x{:x} is not aligned on {} bytes", addresses[i], word_size);
+      return make_error_code(lief_errors::build_error);
+    }
+    entries.push_back(addresses[i]);
+    uint64_t base = addresses[i] + word_size;
+    ++i;
+
+    while (true) {
+      uint64_t bitmap = 0;
+      for (; i < addresses.size(); ++i) {
+        const uint64_t delta = addresses[i] - base;
+        if (delta >= nb_bits * word_size || delta % word_size != 0) {
+          break;
+        }
+        bitmap |= uint64_t(1) << (delta / word_size);
+      }
+      if (bitmap == 0) {
+        break;
+      }
+      entries.push_back((bitmap << 1) | 1);
+      base += nb_bits * word_size;
+    }
+  }
+  return entries;
+}
+
+ok_error_t decode_android_packed(BinaryStream& stream, bool is_rela, size_t word_size,
+                                 size_t max_count, std::vector<packed_reloc_t>& relocations)
+{
+  const uint64_t mask = word_size == sizeof(uint32_t) ? 0xffffffff : ~uint64_t(0);
+
+  for (char c : APS2_MAGIC) {
+    auto res = stream.read<char>();
+    if (!res || *res != c) {
+      LIEF_DEBUG("APS2: wrong magic");
+      return make_error_code(lief_errors::file_format_error);
+    }
+  }
+
+  auto count = stream.read_sleb128();
+  auto offset = stream.read_sleb128();
+  if (!count || !offset) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  uint64_t remaining = *count;
+  if (remaining > max_count) {
+    LIEF_WARN("APS2: too many relocations ({}). Only the first {} will be parsed",
+              remaining, max_count);
+    remaining = max_count;
+  }
+
+  packed_reloc_t reloc;
+  reloc.offset = *offset & mask;
+
+  while (remaining > 0) {
+    auto group_size  = stream.read_sleb128();
+    auto group_flags = stream.read_sleb128();
+    if (!group_size || !group_flags) {
+      return make_error_code(lief_errors::read_error);
+    }
+    const uint64_t flags = *group_flags;
+    const bool by_info         = (flags & GROUPED_BY_INFO) != 0;
+    const bool by_offset_delta = (flags & GROUPED_BY_OFFSET_DELTA) != 0;
+    const bool by_addend       = (flags & GROUPED_BY_ADDEND) != 0;
+    const bool has_addend      = (flags & GROUP_HAS_ADDEND) != 0;
+
+    if (*group_size == 0 || *group_size > remaining) {
+      LIEF_DEBUG("APS2: wrong group size ({})", *group_size);
+      return make_error_code(lief_errors::corrupted);
+    }
+
+    if (has_addend && !is_rela) {
+      LIEF_DEBUG("APS2: addend in a REL table");
+      return make_error_code(lief_errors::corrupted);
+    }
+
+    uint64_t offset_delta = 0;
+    if (by_offset_delta) {
+      auto res = stream.read_sleb128();
+      if (!res) {
+        return make_error_code(lief_errors::read_error);
+      }
+      offset_delta = *res;
+    }
+
+    if (by_info) {
+      auto res = stream.read_sleb128();
+      if (!res) {
+        return make_error_code(lief_errors::read_error);
+      }
+      reloc.info = *res & mask;
+    }
+
+    if (has_addend && by_addend) {
+      auto res = stream.read_sleb128();
+      if (!res) {
+        return make_error_code(lief_errors::read_error);
+      }
+      reloc.addend += static_cast<int64_t>(*res);
+    } else if (!has_addend) {
+      reloc.addend = 0;
+    }
+
+    for (uint64_t i = 0; i < *group_size; ++i) {
+      if (by_offset_delta) {
+        reloc.offset = (reloc.offset + offset_delta) & mask;
+      } else {
+        auto res = stream.read_sleb128();
+        if (!res) {
+          return make_error_code(lief_errors::read_error);
+        }
+        reloc.offset = (reloc.offset + *res) & mask;
+      }
+
+      if (!by_info) {
+        auto res = stream.read_sleb128();
+        if (!res) {
+          return make_error_code(lief_errors::read_error);
+        }
+        reloc.info = *res & mask;
+      }
+
+      if (has_addend && !by_addend) {
+        auto res = stream.read_sleb128();
+        if (!res) {
+          return make_error_code(lief_errors::read_error);
+        }
+        reloc.addend += static_cast<int64_t>(*res);
+      }
+      relocations.push_back(reloc);
+    }
+    remaining -= *group_size;
+  }
+  return ok();
+}
+
+std::vector<uint8_t> encode_android_packed(const std::vector<packed_reloc_t>& relocations,
+                                           bool is_rela)
+{
+  vector_iostream os;
+  os.write(reinterpret_cast<const uint8_t*>(APS2_MAGIC), sizeof(APS2_MAGIC));
+  os.write_sleb128(relocations.size());
+  os.write_sleb128(0);
+
+  uint64_t offset = 0;
+  int64_t addend = 0;
+
+  // Greedy grouping of the consecutive relocations that share the same
+  // r_info and the same offset delta (typically the relative relocations
+  // of a pointer array).
+  for (size_t i = 0; i < relocations.size();) {
+    const packed_reloc_t& first = relocations[i];
+    const uint64_t delta = first.offset - offset;
+
+    size_t end = i + 1;
+    while (end < relocations.size() &&
+           relocations[end].info == first.info &&
+           relocations[end].offset - relocations[end - 1].offset == delta)
+    {
+      ++end;
+    }
+
+    bool has_addend = false;
+    if (is_rela) {
+      has_addend = std::any_of(relocations.begin() + i, relocations.begin() + end,
+                               [] (const packed_reloc_t& R) { return R.addend != 0; });
+    }
+
+    uint64_t flags = GROUPED_BY_INFO | GROUPED_BY_OFFSET_DELTA;
+    if (has_addend) {
+      flags |= GROUP_HAS_ADDEND;
+    }
+
+    os.write_sleb128(end - i)
+      .write_sleb128(flags)
+      .write_sleb128(delta)
+      .write_sleb128(first.info);
+
+    if (has_addend) {
+      for (size_t j = i; j < end; ++j) {
+        os.write_sleb128(relocations[j].addend - addend);
+        addend = relocations[j].addend;
+      }
+    } else {
+      addend = 0;
+    }
+    offset = relocations[end - 1].offset;
+    i = end;
+  }
+  return std::move(os.raw());
+}
+
+}
+}
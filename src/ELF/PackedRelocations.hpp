@@ -0,0 +1,69 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_PACKED_RELOCATIONS_H
+#define LIEF_ELF_PACKED_RELOCATIONS_H
+#include <cstdint>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+#include "LIEF/ELF/enums.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+namespace ELF {
+
+// Encoders/decoders for the compact relocation tables:
+//
+// - RELR (DT_RELR / SHT_RELR): relative relocations encoded as an address
+//   followed by bitmaps of the next word-aligned locations to relocate.
+// - Android APS2 (DT_ANDROID_REL[A] / SHT_ANDROID_REL[A]): relocations grouped
+//   by r_info / offset delta / addend and encoded with SLEB128.
+//
+// Both formats are described in https://github.com/llvm/llvm-project/blob/main/lld/ELF/SyntheticSections.cpp
+
+//! Entry of an APS2 table (r_info is not split as it depends on the ELF class)
+struct packed_reloc_t {
+  uint64_t offset = 0;
+  uint64_t info   = 0;
+  int64_t  addend = 0;
+};
+
+//! Return the R_<ARCH>_RELATIVE type associated with the given architecture
+//! (or 0 if the architecture does not have such relocation)
+uint32_t relative_relocation_type(ARCH arch);
+
+//! Decode the RELR table located at the current position of the stream.
+//! At most ``max_count`` addresses are decoded.
+ok_error_t decode_relr(BinaryStream& stream, uint64_t size, size_t word_size,
+                       size_t max_count, std::vector<uint64_t>& addresses);
+
+//! Encode the given addresses as RELR words. The addresses must be aligned
+//! on ``word_size``
+result<std::vector<uint64_t>> encode_relr(std::vector<uint64_t> addresses, size_t word_size);
+
+//! Decode the APS2 table located at the current position of the stream.
+//! At most ``max_count`` relocations are decoded.
+ok_error_t decode_android_packed(BinaryStream& stream, bool is_rela, size_t word_size,
+                                 size_t max_count, std::vector<packed_reloc_t>& relocations);
+
+//! Encode the given relocations in the APS2 format
+std::vector<uint8_t> encode_android_packed(const std::vector<packed_reloc_t>& relocations,
+                                           bool is_rela);
+
+}
+}
+#endif
@@ -45,6 +45,7 @@
 #include "ELF/Structures.hpp"
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/SizingInfo.hpp"
+#include "ELF/PackedRelocations.hpp"
 
 #include "Object.tcc"
 
@@ -149,6 +150,53 @@ ok_error_t Parser::parse_binary() {
     }
   }
 
+  // Android packed relocations (APS2)
+  // ---------------------------------
+  {
+    DynamicEntry* dt_rela   = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELA);
+    DynamicEntry* dt_relasz = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELASZ);
+    DynamicEntry* dt_rel    = binary_->get(DYNAMIC_TAGS::DT_ANDROID_REL);
+    DynamicEntry* dt_relsz  = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELSZ);
+
+    const bool is_rela = dt_rela != nullptr && dt_relasz != nullptr;
+    DynamicEntry* dt_table = is_rela ? dt_rela : dt_rel;
+    DynamicEntry* dt_size  = is_rela ? dt_relasz : dt_relsz;
+
+    if (dt_table != nullptr && dt_size != nullptr && config_.parse_relocations) {
+      const uint64_t virtual_address = dt_table->value();
+      const uint64_t size            = dt_size->value();
+      if (auto res = binary_->virtual_address_to_offset(virtual_address)) {
+        parse_packed_relocations<ELF_T>(*res, size, is_rela);
+        binary_->sizing_info_->android_rela = size;
+      } else {
+        LIEF_WARN("Can't convert DT_ANDROID_REL[A].virtual_address into an offset (0x{:x})",
+                  virtual_address);
+      }
+    }
+  }
+
+  // RELR
+  // ----
+  {
+    DynamicEntry* dt_relr   = binary_->get(DYNAMIC_TAGS::DT_RELR);
+    DynamicEntry* dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_RELRSZ);
+    if (dt_relr == nullptr || dt_relrsz == nullptr) {
+      dt_relr   = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELR);
+      dt_relrsz = binary_->get(DYNAMIC_TAGS::DT_ANDROID_RELRSZ);
+    }
+
+    if (dt_relr != nullptr && dt_relrsz != nullptr && config_.parse_relocations) {
+      const uint64_t virtual_address = dt_relr->value();
+      const uint64_t size            = dt_relrsz->value();
+      if (auto res = binary_->virtual_address_to_offset(virtual_address)) {
+        parse_relative_relocations<ELF_T>(*res, size);
+        binary_->sizing_info_->relr = size;
+      } else {
+        LIEF_WARN("Can't convert DT_RELR.virtual_address into an offset (0x{:x})", virtual_address);
+      }
+    }
+  }
+
   // Parse PLT/GOT Relocations
   // ==========================
   {
@@ -732,6 +780,7 @@ result<uint32_t> Parser::nb_dynsym_gnu_hash() const {
 template<typename ELF_T>
 ok_error_t Parser::parse_sections() {
   using Elf_Shdr = typename ELF_T::Elf_Shdr;
+  using Elf_Chdr = typename ELF_T::Elf_Chdr;
 
   using Elf_Off  = typename ELF_T::Elf_Off;
   LIEF_DEBUG("Parsing Section");
@@ -807,6 +856,17 @@ ok_error_t Parser::parse_sections() {
           section->content(std::move(sec_content));
         }
       }
+
+      if (section->is_compressed() && read_size >= static_cast<int64_t>(sizeof(Elf_Chdr))) {
+        if (auto chdr = stream_->peek_conv<Elf_Chdr>(offset_to_content)) {
+          section->chdr_.type        = static_cast<Section::COMPRESSION>(chdr->ch_type);
+          section->chdr_.size        = chdr->ch_size;
+          section->chdr_.alignment   = chdr->ch_addralign;
+          section->chdr_.header_size = sizeof(Elf_Chdr);
+          LIEF_DEBUG("  Compressed section #{:d}: type={:d}, size=0x{:x}", i,
+                     chdr->ch_type, chdr->ch_size);
+        }
+      }
     }
     sections_idx_[i] = section.get();
     sections_names[section.get()] = shdr->sh_name;
@@ -975,6 +1035,83 @@ ok_error_t Parser::parse_dynamic_relocations(uint64_t relocations_offset, uint64
 } // build_dynamic_reclocations
 
 
+template<typename ELF_T>
+ok_error_t Parser::parse_relative_relocations(uint64_t offset, uint64_t size) {
+  using uint__ = typename ELF_T::uint;
+  LIEF_DEBUG("== Parsing relative relocations (RELR) ==");
+
+  const ARCH arch = binary_->header().machine_type();
+  const uint32_t type = relative_relocation_type(arch);
+  if (type == 0) {
+    LIEF_WARN("RELR relocations are not supported for the architecture {}", to_string(arch));
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  std::vector<uint64_t> addresses;
+  stream_->setpos(offset);
+  auto is_ok = decode_relr(*stream_, size, sizeof(uint__),
+                           Parser::NB_MAX_RELOCATIONS, addresses);
+  if (!is_ok) {
+    LIEF_WARN("The RELR table is corrupted. {} relocations have been recovered",
+              addresses.size());
+  }
+
+  binary_->relocations_.reserve(binary_->relocations_.size() + addresses.size());
+  for (uint64_t address : addresses) {
+    auto reloc = std::make_unique<Relocation>(address, type, /* addend */ 0, /* isRela */ false);
+    reloc->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC);
+    reloc->architecture_ = arch;
+    reloc->encoding_     = Relocation::ENCODING::RELR;
+    binary_->relocations_.push_back(std::move(reloc));
+  }
+  return is_ok;
+}
+
+template<typename ELF_T>
+ok_error_t Parser::parse_packed_relocations(uint64_t offset, uint64_t size, bool is_rela) {
+  using uint__ = typename ELF_T::uint;
+  LIEF_DEBUG("== Parsing Android packed relocations ==");
+
+  const uint8_t shift = std::is_same<ELF_T, details::ELF32>::value ? 8 : 32;
+  const uint64_t type_mask = (uint64_t(1) << shift) - 1;
+
+  std::vector<packed_reloc_t> relocations;
+  if (offset + size > stream_->size()) {
+    LIEF_WARN("The APS2 table is out of the file's bounds");
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+  stream_->setpos(offset);
+  auto is_ok = decode_android_packed(*stream_, is_rela, sizeof(uint__),
+                                     Parser::NB_MAX_RELOCATIONS, relocations);
+  if (!is_ok) {
+    LIEF_WARN("The APS2 table is corrupted. {} relocations have been recovered",
+              relocations.size());
+  }
+
+  const ARCH arch = binary_->header().machine_type();
+  binary_->relocations_.reserve(binary_->relocations_.size() + relocations.size());
+  for (const packed_reloc_t& entry : relocations) {
+    const auto type = static_cast<uint32_t>(entry.info & type_mask);
+    auto reloc = std::make_unique<Relocation>(entry.offset, type, entry.addend, is_rela);
+    reloc->purpose(RELOCATION_PURPOSES::RELOC_PURPOSE_DYNAMIC);
+    reloc->architecture_ = arch;
+    reloc->encoding_     = Relocation::ENCODING::ANDROID_SLEB;
+    reloc->info_         = static_cast<uint32_t>(entry.info >> shift);
+
+    const uint32_t idx = reloc->info_;
+    if (config_.parse_dyn_symbols && idx > 0) {
+      if (idx < binary_->dynamic_symbols_.size()) {
+        reloc->symbol_ = binary_->dynamic_symbols_[idx].get();
+      } else {
+        LIEF_WARN("Unable to find the symbol associated with the relocation (idx: {}) {}", idx, *reloc);
+      }
+    }
+    binary_->relocations_.push_back(std::move(reloc));
+  }
+  return is_ok;
+}
+
+
 
 template<typename ELF_T>
 ok_error_t Parser::parse_static_symbols(uint64_t offset, uint32_t nb_symbols,
@@ -25,6 +25,7 @@
 #include "ELF/Structures.hpp"
 
 #include "logging.hpp"
+#include "frozen.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -37,7 +38,8 @@ Relocation::Relocation(const Relocation& other) :
   type_{other.type_},
   addend_{other.addend_},
   isRela_{other.isRela_},
-  architecture_{other.architecture_}
+  architecture_{other.architecture_},
+  encoding_{other.encoding_}
 {}
 
 
@@ -54,7 +56,8 @@ Relocation& Relocation::operator=(Relocation other) {
 Relocation::Relocation(const details::Elf32_Rel& header) :
   LIEF::Relocation{header.r_offset, 0},
   type_{static_cast<uint32_t>(header.r_info & 0xff)},
-  info_{static_cast<uint32_t>(header.r_info >> 8)}
+  info_{static_cast<uint32_t>(header.r_info >> 8)},
+  encoding_{ENCODING::REL}
 {}
 
 
@@ -63,14 +66,16 @@ Relocation::Relocation(const details::Elf32_Rela& header) :
   type_{static_cast<uint32_t>(header.r_info & 0xff)},
   addend_{header.r_addend},
   isRela_{true},
-  info_{static_cast<uint32_t>(header.r_info >> 8)}
+  info_{static_cast<uint32_t>(header.r_info >> 8)},
+  encoding_{ENCODING::RELA}
 {}
 
 
 Relocation::Relocation(const details::Elf64_Rel& header) :
   LIEF::Relocation{header.r_offset, 0},
   type_{static_cast<uint32_t>(header.r_info & 0xffffffff)},
-  info_{static_cast<uint32_t>(header.r_info >> 32)}
+  info_{static_cast<uint32_t>(header.r_info >> 32)},
+  encoding_{ENCODING::REL}
 {}
 
 
@@ -79,7 +84,8 @@ Relocation::Relocation(const details::Elf64_Rela& header)  :
   type_{static_cast<uint32_t>(header.r_info & 0xffffffff)},
   addend_{header.r_addend},
   isRela_{true},
-  info_{static_cast<uint32_t>(header.r_info >> 32)}
+  info_{static_cast<uint32_t>(header.r_info >> 32)},
+  encoding_{ENCODING::RELA}
 {}
 
 
@@ -87,7 +93,8 @@ Relocation::Relocation(uint64_t address, uint32_t type, int64_t addend, bool isR
   LIEF::Relocation{address, 0},
   type_{type},
   addend_{addend},
-  isRela_{isRela}
+  isRela_{isRela},
+  encoding_{isRela ? ENCODING::RELA : ENCODING::REL}
 {}
 
 
@@ -101,6 +108,7 @@ void Relocation::swap(Relocation& other) {
   std::swap(purpose_,      other.purpose_);
   std::swap(section_,      other.section_);
   std::swap(info_,         other.info_);
+  std::swap(encoding_,     other.encoding_);
 }
 
 int64_t Relocation::addend() const {
@@ -301,6 +309,18 @@ void Relocation::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
 
+const char* to_string(Relocation::ENCODING e) {
+  CONST_MAP(Relocation::ENCODING, const char*, 5) enumStrings {
+    { Relocation::ENCODING::UNKNOWN,      "UNKNOWN" },
+    { Relocation::ENCODING::REL,          "REL" },
+    { Relocation::ENCODING::RELA,         "RELA" },
+    { Relocation::ENCODING::RELR,         "RELR" },
+    { Relocation::ENCODING::ANDROID_SLEB, "ANDROID_SLEB" },
+  };
+  const auto it = enumStrings.find(e);
+  return it == enumStrings.end() ? "UNKNOWN" : it->second;
+}
+
 
 
 
@@ -29,12 +29,20 @@
 #include "LIEF/ELF/Section.hpp"
 #include "LIEF/ELF/Segment.hpp"
 
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/Structures.hpp"
+#include "ELF/SectionCompression.hpp"
+
+#include "compression.hpp"
 
 namespace LIEF {
 namespace ELF {
 
+// SHF_COMPRESSED (which overlaps XCORE_SHF_CP_SECTION in ELF_SECTION_FLAGS)
+static constexpr uint64_t COMPRESSED_FLAG = 0x800;
+
 Section::~Section() = default;
 Section::Section() = default;
 
@@ -96,8 +104,12 @@ Section::Section(const Section& other) :
   address_align_{other.address_align_},
   entry_size_{other.entry_size_},
   is_frame_{other.is_frame_},
-  content_c_{other.content_c_}
+  content_c_{other.content_c_},
+  chdr_{other.chdr_}
 {
+  std::lock_guard<std::mutex> guard(other.uncompressed_lock_);
+  uncompressed_          = other.uncompressed_;
+  uncompressed_modified_ = other.uncompressed_modified_;
 }
 
 void Section::swap(Section& other) {
@@ -118,6 +130,14 @@ void Section::swap(Section& other) {
   std::swap(is_frame_,       other.is_frame_);
   std::swap(datahandler_,    other.datahandler_);
   std::swap(content_c_,      other.content_c_);
+  std::swap(chdr_,           other.chdr_);
+  if (this != &other) {
+    std::lock(uncompressed_lock_, other.uncompressed_lock_);
+    std::lock_guard<std::mutex> guard(uncompressed_lock_, std::adopt_lock);
+    std::lock_guard<std::mutex> other_guard(other.uncompressed_lock_, std::adopt_lock);
+    std::swap(uncompressed_,          other.uncompressed_);
+    std::swap(uncompressed_modified_, other.uncompressed_modified_);
+  }
 }
 
 
@@ -218,7 +238,7 @@ span<const uint8_t> Section::content() const {
     }
     return {};
   }
-  const std::vector<uint8_t>& binary_content = datahandler_->content();
+  span<const uint8_t> binary_content = datahandler_->content();
   DataHandler::Node& node = res.value();
   const uint8_t* ptr = binary_content.data() + node.offset();
   return {ptr, ptr + node.size()};
@@ -228,6 +248,110 @@ uint32_t Section::link() const {
   return link_;
 }
 
+bool Section::is_compressed() const {
+  return (flags_ & COMPRESSED_FLAG) != 0;
+}
+
+uint64_t Section::uncompressed_size() const {
+  if (!is_compressed() || chdr_.type == COMPRESSION::NONE) {
+    return size();
+  }
+  return chdr_.size;
+}
+
+span<const uint8_t> Section::uncompressed_content() const {
+  if (!is_compressed() || chdr_.type == COMPRESSION::NONE) {
+    return content();
+  }
+
+  std::lock_guard<std::mutex> guard(uncompressed_lock_);
+  if (uncompressed_ != nullptr) {
+    return *uncompressed_;
+  }
+
+  span<const uint8_t> raw = content();
+  if (raw.size() < chdr_.header_size) {
+    LIEF_ERR("The content of the section '{}' is too small", name());
+    return {};
+  }
+
+  if (chdr_.size > Parser::MAX_SECTION_SIZE) {
+    LIEF_ERR("The uncompressed size of section '{}' is too large (0x{:x})",
+             name(), chdr_.size);
+    return {};
+  }
+
+  auto algo = to_algorithm(chdr_.type);
+  if (!algo) {
+    LIEF_ERR("The compression of the section '{}' is not supported (ch_type: {})",
+             name(), static_cast<uint32_t>(chdr_.type));
+    return {};
+  }
+
+  if (!compression::is_supported(*algo)) {
+    LIEF_ERR("LIEF has been compiled without {} support. Can't decompress '{}'",
+             chdr_.type == COMPRESSION::ZSTD ? "zstd" : "zlib", name());
+    return {};
+  }
+
+  auto data = compression::decompress(*algo, raw.subspan(chdr_.header_size), chdr_.size);
+  if (!data) {
+    LIEF_ERR("Can't decompress the section '{}'", name());
+    return {};
+  }
+  uncompressed_ = std::make_shared<const std::vector<uint8_t>>(std::move(*data));
+  return *uncompressed_;
+}
+
+void Section::uncompressed_content(std::vector<uint8_t> data) {
+  if (!is_compressed() || chdr_.type == COMPRESSION::NONE) {
+    content(std::move(data));
+    return;
+  }
+  auto uncompressed = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+  std::lock_guard<std::mutex> guard(uncompressed_lock_);
+  uncompressed_ = std::move(uncompressed);
+  uncompressed_modified_ = true;
+}
+
+std::unique_ptr<BinaryStream> Section::uncompressed_stream() const {
+  if (!is_compressed() || chdr_.type == COMPRESSION::NONE) {
+    return nullptr;
+  }
+
+  std::shared_ptr<const std::vector<uint8_t>> uncompressed;
+  {
+    std::lock_guard<std::mutex> guard(uncompressed_lock_);
+    if (uncompressed_modified_) {
+      uncompressed = uncompressed_;
+    }
+  }
+  if (uncompressed != nullptr) {
+    return std::make_unique<VectorStream>(*uncompressed);
+  }
+
+  span<const uint8_t> raw = content();
+  if (raw.size() < chdr_.header_size) {
+    return nullptr;
+  }
+  auto algo = to_algorithm(chdr_.type);
+  if (!algo) {
+    LIEF_ERR("The compression of the section '{}' is not supported (ch_type: {})",
+             name(), static_cast<uint32_t>(chdr_.type));
+    return nullptr;
+  }
+  span<const uint8_t> compressed = raw.subspan(chdr_.header_size);
+  return compression::decompression_stream(*algo,
+                                           {compressed.begin(), compressed.end()},
+                                           chdr_.size);
+}
+
+void Section::reset_uncompressed() {
+  std::lock_guard<std::mutex> guard(uncompressed_lock_);
+  uncompressed_.reset();
+  uncompressed_modified_ = false;
+}
+
 std::set<ELF_SECTION_FLAGS> Section::flags_list() const {
   std::set<ELF_SECTION_FLAGS> flags;
   std::copy_if(std::begin(details::section_flags_array), std::end(details::section_flags_array),
@@ -241,6 +365,7 @@ void Section::content(const std::vector<uint8_t>& data) {
   if (is_frame()) {
     return;
   }
+  reset_uncompressed();
 
   if (!data.empty() && type() == ELF_SECTION_TYPES::SHT_NOBITS) {
     LIEF_INFO("You inserted 0x{:x} bytes in section '{}' which has SHT_NOBITS type",
@@ -266,7 +391,7 @@ void Section::content(const std::vector<uint8_t>& data) {
 
   DataHandler::Node& node = res.value();
 
-  std::vector<uint8_t>& binary_content = datahandler_->content();
+  std::vector<uint8_t>& binary_content = datahandler_->writable();
   datahandler_->reserve(node.offset(), data.size());
 
   if (node.size() < data.size()) {
@@ -286,6 +411,7 @@ void Section::content(std::vector<uint8_t>&& data) {
   if (is_frame()) {
     return;
   }
+  reset_uncompressed();
   if (!data.empty() && type() == ELF_SECTION_TYPES::SHT_NOBITS) {
     LIEF_INFO("You inserted 0x{:x} bytes in section '{}' which has SHT_NOBITS type",
               data.size(), name());
@@ -308,7 +434,7 @@ void Section::content(std::vector<uint8_t>&& data) {
   }
   DataHandler::Node& node = res.value();
 
-  std::vector<uint8_t>& binary_content = datahandler_->content();
+  std::vector<uint8_t>& binary_content = datahandler_->writable();
   datahandler_->reserve(node.offset(), data.size());
 
   if (node.size() < data.size()) {
@@ -381,7 +507,7 @@ Section& Section::clear(uint8_t value) {
     return *this;
   }
 
-  std::vector<uint8_t>& binary_content = datahandler_->content();
+  std::vector<uint8_t>& binary_content = datahandler_->writable();
   auto res = datahandler_->get(file_offset(), size(), DataHandler::Node::SECTION);
   if (!res) {
     LIEF_ERR("Can't find the node. The section's content can't be cleared");
@@ -417,6 +543,10 @@ span<uint8_t> Section::writable_content() {
   if (is_frame()) {
     return {};
   }
+  if (datahandler_ != nullptr) {
+    // Detach the content from the snapshots that might share it
+    datahandler_->writable();
+  }
   span<const uint8_t> ref = static_cast<const Section*>(this)->content();
   return {const_cast<uint8_t*>(ref.data()), ref.size()};
 }
@@ -0,0 +1,38 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_ELF_SECTION_COMPRESSION_H
+#define LIEF_ELF_SECTION_COMPRESSION_H
+#include "LIEF/errors.hpp"
+#include "LIEF/ELF/Section.hpp"
+
+#include "compression.hpp"
+
+namespace LIEF {
+namespace ELF {
+
+//! Algorithm associated with the ``ch_type`` of a ``SHF_COMPRESSED`` section
+//! (lief_errors::not_supported for an unknown value)
+inline result<compression::ALGORITHM> to_algorithm(Section::COMPRESSION type) {
+  switch (type) {
+    case Section::COMPRESSION::ZLIB: return compression::ALGORITHM::ZLIB;
+    case Section::COMPRESSION::ZSTD: return compression::ALGORITHM::ZSTD;
+    default: return make_error_code(lief_errors::not_supported);
+  }
+}
+
+}
+}
+#endif
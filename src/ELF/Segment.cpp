@@ -29,6 +29,7 @@
 
 #include "ELF/DataHandler/Handler.hpp"
 #include "ELF/Structures.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 
 namespace LIEF {
@@ -37,7 +38,13 @@ namespace ELF {
 Segment::Segment() = default;
 Segment::~Segment() = default;
 
-Segment& Segment::operator=(Segment&&) = default;
+// The modification counter stays attached to the assigned segment (see swap())
+Segment& Segment::operator=(Segment&& other) {
+  swap(other);
+  details::notify_modification(modifications_);
+  return *this;
+}
+
 Segment::Segment(Segment&&) = default;
 
 Segment::Segment(const Segment& other) :
@@ -96,6 +103,7 @@ void Segment::swap(Segment& other) {
 
 Segment& Segment::operator=(Segment other) {
   swap(other);
+  details::notify_modification(modifications_);
   return *this;
 }
 
@@ -184,7 +192,7 @@ span<const uint8_t> Segment::content() const {
   DataHandler::Node& node = res.value();
 
   // Create a span based on our values
-  const std::vector<uint8_t>& binary_content = datahandler_->content();
+  span<const uint8_t> binary_content = datahandler_->content();
   const size_t size = binary_content.size();
   if (node.offset() >= size) {
     LIEF_ERR("Can't access content of segment {}:0x{:x}",
@@ -237,7 +245,7 @@ template<typename T> T Segment::get_content_value(size_t offset) const {
       memset(&ret, 0, sizeof(T));
       return ret;
     }
-    const std::vector<uint8_t>& binary_content = datahandler_->content();
+    span<const uint8_t> binary_content = datahandler_->content();
     DataHandler::Node& node = res.value();
     memcpy(&ret, binary_content.data() + node.offset() + offset, sizeof(T));
   }
@@ -265,7 +273,7 @@ template<typename T> void Segment::set_content_value(size_t offset, T value) {
       return;
     }
     DataHandler::Node& node = res.value();
-    std::vector<uint8_t>& binary_content = datahandler_->content();
+    std::vector<uint8_t>& binary_content = datahandler_->writable();
 
     if (offset + sizeof(T) > binary_content.size()) {
       datahandler_->reserve(node.offset(), offset + sizeof(T));
@@ -345,11 +353,13 @@ void Segment::file_offset(uint64_t file_offset) {
     }
   }
   file_offset_ = file_offset;
+  details::notify_modification(modifications_);
 }
 
 
 void Segment::virtual_address(uint64_t virtual_address) {
   virtual_address_ = virtual_address;
+  details::notify_modification(modifications_);
 }
 
 
@@ -369,11 +379,13 @@ void Segment::physical_size(uint64_t physical_size) {
     }
   }
   size_ = physical_size;
+  details::notify_modification(modifications_);
 }
 
 
 void Segment::virtual_size(uint64_t virtual_size) {
   virtual_size_ = virtual_size;
+  details::notify_modification(modifications_);
 }
 
 
@@ -383,6 +395,7 @@ void Segment::alignment(uint64_t alignment) {
 
 void Segment::type(SEGMENT_TYPES type) {
   type_ = type;
+  details::notify_modification(modifications_);
 }
 
 void Segment::content(std::vector<uint8_t> content) {
@@ -404,7 +417,7 @@ void Segment::content(std::vector<uint8_t> content) {
   }
   DataHandler::Node& node = res.value();
 
-  std::vector<uint8_t>& binary_content = datahandler_->content();
+  std::vector<uint8_t>& binary_content = datahandler_->writable();
   datahandler_->reserve(node.offset(), content.size());
 
   if (node.size() < content.size()) {
@@ -437,6 +450,10 @@ Segment& Segment::operator-=(ELF_SEGMENT_FLAGS flag) {
 
 
 span<uint8_t> Segment::writable_content() {
+  if (datahandler_ != nullptr) {
+    // Detach the content from the snapshots that might share it
+    datahandler_->writable();
+  }
   span<const uint8_t> ref = static_cast<const Segment*>(this)->content();
   return {const_cast<uint8_t*>(ref.data()), ref.size()};
 }
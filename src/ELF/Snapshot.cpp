@@ -0,0 +1,810 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <unordered_map>
+
+#include "logging.hpp"
+#include "snapshot.hpp"
+
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/ELF/DynamicEntryArray.hpp"
+#include "LIEF/ELF/DynamicEntryFlags.hpp"
+#include "LIEF/ELF/DynamicEntryLibrary.hpp"
+#include "LIEF/ELF/DynamicEntryRpath.hpp"
+#include "LIEF/ELF/DynamicEntryRunPath.hpp"
+#include "LIEF/ELF/DynamicSharedObject.hpp"
+#include "LIEF/ELF/GnuHash.hpp"
+#include "LIEF/ELF/Note.hpp"
+#include "LIEF/ELF/Relocation.hpp"
+#include "LIEF/ELF/Section.hpp"
+#include "LIEF/ELF/Segment.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#include "LIEF/ELF/SymbolVersion.hpp"
+#include "LIEF/ELF/SymbolVersionAux.hpp"
+#include "LIEF/ELF/SymbolVersionAuxRequirement.hpp"
+#include "LIEF/ELF/SymbolVersionDefinition.hpp"
+#include "LIEF/ELF/SymbolVersionRequirement.hpp"
+#include "LIEF/ELF/SysvHash.hpp"
+
+#include "ELF/DataHandler/Handler.hpp"
+#include "ELF/SizingInfo.hpp"
+#include "Object.tcc"
+
+namespace LIEF {
+namespace ELF {
+
+namespace {
+using snapshot::NONE;
+using snapshot::ref_t;
+using snapshot::index_of;
+using snapshot::at;
+
+enum class TABLE : uint32_t {
+  BLOBS = 0,
+  BINARY,
+  NODES,
+  SECTIONS,
+  SEGMENTS,
+  SEGMENT_SECTIONS,
+  SECTION_SEGMENTS,
+  SYMBOLS,
+  VERSIONS,
+  VERDEFS,
+  VERDEF_AUX,
+  VERREQS,
+  VERREQ_AUX,
+  RELOCATIONS,
+  DYNAMIC,
+  NOTES,
+  GNU_HASH,
+  SYSV_HASH,
+};
+
+enum class DYNAMIC_KIND : uint32_t {
+  ENTRY = 0,
+  ARRAY,
+  FLAGS,
+  LIBRARY,
+  RPATH,
+  RUNPATH,
+  SONAME,
+};
+
+enum class AUX_KIND : uint8_t {
+  NONE = 0,
+  DEFINITION,
+  REQUIREMENT,
+};
+
+struct binary_t {
+  uint8_t  identity[16];
+  uint32_t elf_class;
+  uint32_t file_type;
+  uint32_t machine_type;
+  uint32_t object_file_version;
+  uint32_t processor_flags;
+  uint32_t header_size;
+  uint32_t program_header_size;
+  uint32_t numberof_segments;
+  uint32_t section_header_size;
+  uint32_t numberof_sections;
+  uint32_t section_string_table_idx;
+  uint32_t reserved;
+  uint64_t entrypoint;
+  uint64_t program_headers_offset;
+  uint64_t section_headers_offset;
+  uint64_t original_size;
+  ref_t    interpreter;
+  ref_t    overlay;
+  uint64_t sizing_info[16];
+  uint64_t phdr_reloc_offset;
+  uint64_t phdr_reloc_nb_segments;
+};
+
+struct node_t {
+  uint64_t offset;
+  uint64_t size;
+  uint64_t type;
+};
+
+struct section_t {
+  ref_t    name;
+  uint64_t virtual_address;
+  uint64_t size;
+  uint64_t offset;
+  uint64_t flags;
+  uint64_t original_size;
+  uint64_t address_align;
+  uint64_t entry_size;
+  uint64_t chdr_size;
+  uint64_t chdr_alignment;
+  uint32_t type;
+  uint32_t link;
+  uint32_t info;
+  uint32_t chdr_type;
+  uint32_t chdr_header_size;
+  uint8_t  is_frame;
+  uint8_t  has_handler;
+  uint8_t  reserved[2];
+  ref_t    content;
+};
+
+struct segment_t {
+  uint64_t file_offset;
+  uint64_t virtual_address;
+  uint64_t physical_address;
+  uint64_t size;
+  uint64_t virtual_size;
+  uint64_t alignment;
+  uint64_t handler_size;
+  uint32_t type;
+  uint32_t flags;
+  uint64_t has_handler;
+  ref_t    content;
+};
+
+//! Association between a segment and a section
+struct link_t {
+  uint32_t segment;
+  uint32_t section;
+};
+
+struct symbol_t {
+  ref_t    name;
+  uint64_t value;
+  uint64_t size;
+  uint32_t section;
+  uint32_t version;
+  uint32_t arch;
+  uint16_t shndx;
+  uint8_t  type;
+  uint8_t  binding;
+  uint8_t  other;
+  uint8_t  is_dynamic;
+  uint8_t  reserved[6];
+};
+
+struct version_t {
+  uint32_t aux_index;
+  uint16_t value;
+  uint8_t  aux_kind;
+  uint8_t  reserved;
+};
+
+struct verdef_t {
+  uint32_t hash;
+  uint16_t version;
+  uint16_t flags;
+  uint16_t ndx;
+  uint8_t  reserved[6];
+  uint32_t aux_begin;
+  uint32_t aux_count;
+};
+
+struct verreq_t {
+  ref_t    name;
+  uint32_t aux_begin;
+  uint32_t aux_count;
+  uint16_t version;
+  uint8_t  reserved[6];
+};
+
+struct aux_t {
+  ref_t    name;
+  uint32_t hash;
+  uint16_t flags;
+  uint16_t other;
+};
+
+struct relocation_t {
+  uint64_t address;
+  int64_t  addend;
+  uint32_t type;
+  uint32_t symbol;
+  uint32_t section;
+  uint32_t symbol_table;
+  uint32_t info;
+  uint32_t arch;
+  uint32_t purpose;
+  uint32_t encoding;
+  uint8_t  size;
+  uint8_t  is_rela;
+  uint8_t  reserved[6];
+};
+
+struct dynamic_t {
+  uint64_t tag;
+  uint64_t value;
+  uint64_t kind;
+  ref_t    str;
+  ref_t    array;
+};
+
+struct note_t {
+  ref_t    name;
+  ref_t    description;
+  uint32_t type;
+  uint32_t is_core;
+};
+
+struct gnu_hash_t {
+  uint64_t c;
+  uint32_t symbol_index;
+  uint32_t shift2;
+  ref_t    bloom_filters;
+  ref_t    buckets;
+  ref_t    hash_values;
+};
+
+struct sysv_hash_t {
+  ref_t buckets;
+  ref_t chains;
+};
+
+}
+
+ok_error_t Binary::save_snapshot(const std::string& path) const {
+  // The content is not stored in the snapshot but read from the source file
+  if (datahandler_->is_modified()) {
+    LIEF_ERR("The content of the binary has been modified: can't create a snapshot");
+    return make_error_code(lief_errors::not_supported);
+  }
+  snapshot::writer_t writer(EXE_FORMATS::FORMAT_ELF, datahandler_->content());
+
+  { // Binary & header
+    binary_t bin = {};
+    std::copy(header_.identity().begin(), header_.identity().end(), bin.identity);
+    bin.elf_class                = static_cast<uint32_t>(type_);
+    bin.file_type                = static_cast<uint32_t>(header_.file_type());
+    bin.machine_type             = static_cast<uint32_t>(header_.machine_type());
+    bin.object_file_version      = static_cast<uint32_t>(header_.object_file_version());
+    bin.processor_flags          = header_.processor_flag();
+    bin.header_size              = header_.header_size();
+    bin.program_header_size      = header_.program_header_size();
+    bin.numberof_segments        = header_.numberof_segments();
+    bin.section_header_size      = header_.section_header_size();
+    bin.numberof_sections        = header_.numberof_sections();
+    bin.section_string_table_idx = header_.section_name_table_idx();
+    bin.entrypoint               = header_.entrypoint();
+    bin.program_headers_offset   = header_.program_headers_offset();
+    bin.section_headers_offset   = header_.section_headers_offset();
+    bin.original_size            = original_size_;
+    bin.interpreter              = writer.add(interpreter_);
+    bin.overlay                  = writer.add(overlay_);
+
+    const sizing_info_t& info = *sizing_info_;
+    const uint64_t sizing[] = {
+      info.dynsym, info.dynstr, info.dynamic, info.interpreter, info.gnu_hash,
+      info.hash, info.rela, info.jmprel, info.relr, info.android_rela,
+      info.versym, info.verdef, info.verneed, info.init_array, info.fini_array,
+      info.preinit_array,
+    };
+    static_assert(sizeof(sizing) == sizeof(bin.sizing_info), "Missing sizing info");
+    std::copy(std::begin(sizing), std::end(sizing), bin.sizing_info);
+
+    bin.phdr_reloc_offset      = phdr_reloc_info_.new_offset;
+    bin.phdr_reloc_nb_segments = phdr_reloc_info_.nb_segments;
+    writer.push(TABLE::BINARY, bin);
+  }
+
+  for (const std::unique_ptr<DataHandler::Node>& node : datahandler_->nodes()) {
+    writer.push(TABLE::NODES, node_t{node->offset(), node->size(), node->type()});
+  }
+
+  std::unordered_map<const Section*, uint32_t> sections_idx;
+  for (const std::unique_ptr<Section>& section : sections_) {
+    const uint32_t idx = sections_idx.size();
+    sections_idx[section.get()] = idx;
+    section_t sec = {};
+    sec.name             = writer.add(section->name());
+    sec.virtual_address  = section->virtual_address_;
+    sec.size             = section->size_;
+    sec.offset           = section->offset_;
+    sec.flags            = section->flags_;
+    sec.original_size    = section->original_size_;
+    sec.address_align    = section->address_align_;
+    sec.entry_size       = section->entry_size_;
+    sec.type             = static_cast<uint32_t>(section->type_);
+    sec.link             = section->link_;
+    sec.info             = section->info_;
+    sec.chdr_type        = static_cast<uint32_t>(section->chdr_.type);
+    sec.chdr_size        = section->chdr_.size;
+    sec.chdr_alignment   = section->chdr_.alignment;
+    sec.chdr_header_size = section->chdr_.header_size;
+    sec.is_frame         = section->is_frame_;
+    sec.has_handler      = section->datahandler_ != nullptr;
+    sec.content          = writer.add(section->content_c_);
+    writer.push(TABLE::SECTIONS, sec);
+  }
+
+  std::unordered_map<const Segment*, uint32_t> segments_idx;
+  for (const std::unique_ptr<Segment>& segment : segments_) {
+    const uint32_t idx = segments_idx.size();
+    segments_idx[segment.get()] = idx;
+    segment_t seg = {};
+    seg.file_offset      = segment->file_offset_;
+    seg.virtual_address  = segment->virtual_address_;
+    seg.physical_address = segment->physical_address_;
+    seg.size             = segment->size_;
+    seg.virtual_size     = segment->virtual_size_;
+    seg.alignment        = segment->alignment_;
+    seg.handler_size     = segment->handler_size_;
+    seg.type             = static_cast<uint32_t>(segment->type_);
+    seg.flags            = static_cast<uint32_t>(segment->flags_);
+    seg.has_handler      = segment->datahandler_ != nullptr;
+    seg.content          = writer.add(segment->content_c_);
+    writer.push(TABLE::SEGMENTS, seg);
+  }
+
+  for (const std::unique_ptr<Segment>& segment : segments_) {
+    for (const Section* section : segment->sections_) {
+      writer.push(TABLE::SEGMENT_SECTIONS,
+                  link_t{segments_idx[segment.get()], index_of(sections_idx, section)});
+    }
+  }
+  for (const std::unique_ptr<Section>& section : sections_) {
+    for (const Segment* segment : section->segments_) {
+      writer.push(TABLE::SECTION_SEGMENTS,
+                  link_t{index_of(segments_idx, segment), sections_idx[section.get()]});
+    }
+  }
+
+  // Symbol versions
+  std::unordered_map<const SymbolVersionAux*, uint32_t> def_aux_idx;
+  uint32_t nb_def_aux = 0;
+  for (const std::unique_ptr<SymbolVersionDefinition>& def : symbol_version_definition_) {
+    verdef_t entry = {};
+    entry.hash      = def->hash();
+    entry.version   = def->version();
+    entry.flags     = def->flags();
+    entry.ndx       = def->ndx();
+    entry.aux_begin = nb_def_aux;
+    for (const SymbolVersionAux& aux : def->symbols_aux()) {
+      def_aux_idx[&aux] = nb_def_aux++;
+      aux_t raw_aux = {};
+      raw_aux.name = writer.add(aux.name());
+      writer.push(TABLE::VERDEF_AUX, raw_aux);
+    }
+    entry.aux_count = nb_def_aux - entry.aux_begin;
+    writer.push(TABLE::VERDEFS, entry);
+  }
+
+  std::unordered_map<const SymbolVersionAux*, uint32_t> req_aux_idx;
+  uint32_t nb_req_aux = 0;
+  for (const std::unique_ptr<SymbolVersionRequirement>& req : symbol_version_requirements_) {
+    verreq_t entry = {};
+    entry.name      = writer.add(req->name());
+    entry.version   = req->version();
+    entry.aux_begin = nb_req_aux;
+    for (const SymbolVersionAuxRequirement& aux : req->auxiliary_symbols()) {
+      req_aux_idx[&aux] = nb_req_aux++;
+      aux_t raw_aux = {};
+      raw_aux.name  = writer.add(aux.name());
+      raw_aux.hash  = aux.hash();
+      raw_aux.flags = aux.flags();
+      raw_aux.other = aux.other();
+      writer.push(TABLE::VERREQ_AUX, raw_aux);
+    }
+    entry.aux_count = nb_req_aux - entry.aux_begin;
+    writer.push(TABLE::VERREQS, entry);
+  }
+
+  std::unordered_map<const SymbolVersion*, uint32_t> versions_idx;
+  for (const std::unique_ptr<SymbolVersion>& version : symbol_version_table_) {
+    const uint32_t idx = versions_idx.size();
+    versions_idx[version.get()] = idx;
+    version_t entry = {};
+    entry.value     = version->value_;
+    entry.aux_kind  = static_cast<uint8_t>(AUX_KIND::NONE);
+    entry.aux_index = NONE;
+    if (const SymbolVersionAux* aux = version->symbol_aux_) {
+      if (auto it = def_aux_idx.find(aux); it != def_aux_idx.end()) {
+        entry.aux_kind  = static_cast<uint8_t>(AUX_KIND::DEFINITION);
+        entry.aux_index = it->second;
+      } else if (auto it = req_aux_idx.find(aux); it != req_aux_idx.end()) {
+        entry.aux_kind  = static_cast<uint8_t>(AUX_KIND::REQUIREMENT);
+        entry.aux_index = it->second;
+      }
+    }
+    writer.push(TABLE::VERSIONS, entry);
+  }
+
+  // Symbols: the dynamic ones followed by the static ones
+  std::unordered_map<const Symbol*, uint32_t> symbols_idx;
+  auto save_symbols = [&] (const symbols_t& symbols, bool is_dynamic) {
+    for (const std::unique_ptr<Symbol>& symbol : symbols) {
+      const uint32_t idx = symbols_idx.size();
+      symbols_idx[symbol.get()] = idx;
+      symbol_t sym = {};
+      sym.name       = writer.add(symbol->name_);
+      sym.value      = symbol->value_;
+      sym.size       = symbol->size_;
+      sym.section    = index_of(sections_idx, symbol->section_);
+      sym.version    = index_of(versions_idx, symbol->symbol_version_);
+      sym.arch       = static_cast<uint32_t>(symbol->arch_);
+      sym.shndx      = symbol->shndx_;
+      sym.type       = static_cast<uint8_t>(symbol->type_);
+      sym.binding    = static_cast<uint8_t>(symbol->binding_);
+      sym.other      = symbol->other_;
+      sym.is_dynamic = is_dynamic;
+      writer.push(TABLE::SYMBOLS, sym);
+    }
+  };
+  save_symbols(dynamic_symbols_, /*is_dynamic=*/true);
+  save_symbols(static_symbols_, /*is_dynamic=*/false);
+
+  for (const std::unique_ptr<Relocation>& relocation : relocations_) {
+    relocation_t reloc = {};
+    reloc.address      = relocation->address_;
+    reloc.addend       = relocation->addend_;
+    reloc.type         = relocation->type_;
+    reloc.symbol       = index_of(symbols_idx, relocation->symbol_);
+    reloc.section      = index_of(sections_idx, relocation->section_);
+    reloc.symbol_table = index_of(sections_idx, relocation->symbol_table_);
+    reloc.info         = relocation->info_;
+    reloc.arch         = static_cast<uint32_t>(relocation->architecture_);
+    reloc.purpose      = static_cast<uint32_t>(relocation->purpose_);
+    reloc.encoding     = static_cast<uint32_t>(relocation->encoding_);
+    reloc.size         = relocation->size_;
+    reloc.is_rela      = relocation->isRela_;
+    writer.push(TABLE::RELOCATIONS, reloc);
+  }
+
+  for (const std::unique_ptr<DynamicEntry>& entry : dynamic_entries_) {
+    dynamic_t dyn = {};
+    dyn.tag   = static_cast<uint64_t>(entry->tag());
+    dyn.value = entry->value();
+    dyn.kind  = static_cast<uint64_t>(DYNAMIC_KIND::ENTRY);
+    if (DynamicEntryLibrary::classof(entry.get())) {
+      dyn.kind = static_cast<uint64_t>(DYNAMIC_KIND::LIBRARY);
+      dyn.str  = writer.add(entry->as<const DynamicEntryLibrary>()->name());
+    }
+    else if (DynamicSharedObject::classof(entry.get())) {
+      dyn.kind = static_cast<uint64_t>(DYNAMIC_KIND::SONAME);
+      dyn.str  = writer.add(entry->as<const DynamicSharedObject>()->name());
+    }
+    else if (DynamicEntryRpath::classof(entry.get())) {
+      dyn.kind = static_cast<uint64_t>(DYNAMIC_KIND::RPATH);
+      dyn.str  = writer.add(entry->as<const DynamicEntryRpath>()->rpath());
+    }
+    else if (DynamicEntryRunPath::classof(entry.get())) {
+      dyn.kind = static_cast<uint64_t>(DYNAMIC_KIND::RUNPATH);
+      dyn.str  = writer.add(entry->as<const DynamicEntryRunPath>()->runpath());
+    }
+    else if (DynamicEntryFlags::classof(entry.get())) {
+      dyn.kind = static_cast<uint64_t>(DYNAMIC_KIND::FLAGS);
+    }
+    else if (DynamicEntryArray::classof(entry.get())) {
+      dyn.kind  = static_cast<uint64_t>(DYNAMIC_KIND::ARRAY);
+      dyn.array = writer.add(entry->as<const DynamicEntryArray>()->array());
+    }
+    writer.push(TABLE::DYNAMIC, dyn);
+  }
+
+  for (const std::unique_ptr<Note>& note : notes_) {
+    note_t raw_note = {};
+    raw_note.name        = writer.add(note->name_);
+    raw_note.description = writer.add(note->description_);
+    raw_note.type        = static_cast<uint32_t>(note->type_);
+    raw_note.is_core     = note->is_core_;
+    writer.push(TABLE::NOTES, raw_note);
+  }
+
+  if (gnu_hash_ != nullptr) {
+    gnu_hash_t hash = {};
+    hash.c             = gnu_hash_->c_;
+    hash.symbol_index  = gnu_hash_->symbol_index_;
+    hash.shift2        = gnu_hash_->shift2_;
+    hash.bloom_filters = writer.add(gnu_hash_->bloom_filters_);
+    hash.buckets       = writer.add(gnu_hash_->buckets_);
+    hash.hash_values   = writer.add(gnu_hash_->hash_values_);
+    writer.push(TABLE::GNU_HASH, hash);
+  }
+
+  if (sysv_hash_ != nullptr) {
+    sysv_hash_t hash = {};
+    hash.buckets = writer.add(sysv_hash_->buckets_);
+    hash.chains  = writer.add(sysv_hash_->chains_);
+    writer.push(TABLE::SYSV_HASH, hash);
+  }
+
+  return writer.write(path);
+}
+
+std::unique_ptr<Binary> Parser::parse_snapshot(const std::string& snapshot,
+                                               const std::string& source)
+{
+  auto source_stream = VectorStream::from_file(source);
+  if (!source_stream) {
+    LIEF_ERR("Can't open {}", source);
+    return nullptr;
+  }
+
+  auto reader = snapshot::reader_t::open(snapshot, EXE_FORMATS::FORMAT_ELF,
+                                         source_stream->content());
+  if (!reader) {
+    LIEF_ERR("Can't load the snapshot {}", snapshot);
+    return nullptr;
+  }
+
+  span<const binary_t> bins = reader->records<binary_t>(TABLE::BINARY);
+  if (bins.size() != 1) {
+    LIEF_ERR("The snapshot {} is corrupted", snapshot);
+    return nullptr;
+  }
+  const binary_t& bin = bins[0];
+
+  auto binary = std::unique_ptr<Binary>(new Binary{});
+  std::unique_ptr<BinaryStream> stream = std::make_unique<VectorStream>(std::move(*source_stream));
+  auto hdl = DataHandler::Handler::from_stream(stream);
+  if (!hdl) {
+    LIEF_ERR("Can't create the data handler");
+    return nullptr;
+  }
+  binary->datahandler_ = std::move(*hdl);
+  DataHandler::Handler* handler = binary->datahandler_.get();
+
+  for (const node_t& node : reader->records<node_t>(TABLE::NODES)) {
+    handler->add({node.offset, node.size, static_cast<DataHandler::Node::Type>(node.type)});
+  }
+
+  { // Binary & header
+    Header& header = binary->header_;
+    std::copy(std::begin(bin.identity), std::end(bin.identity), header.identity_.begin());
+    header.file_type_                = static_cast<E_TYPE>(bin.file_type);
+    header.machine_type_             = static_cast<ARCH>(bin.machine_type);
+    header.object_file_version_      = static_cast<VERSION>(bin.object_file_version);
+    header.entrypoint_               = bin.entrypoint;
+    header.program_headers_offset_   = bin.program_headers_offset;
+    header.section_headers_offset_   = bin.section_headers_offset;
+    header.processor_flags_          = bin.processor_flags;
+    header.header_size_              = bin.header_size;
+    header.program_header_size_      = bin.program_header_size;
+    header.numberof_segments_        = bin.numberof_segments;
+    header.section_header_size_      = bin.section_header_size;
+    header.numberof_sections_        = bin.numberof_sections;
+    header.section_string_table_idx_ = bin.section_string_table_idx;
+
+    binary->type_          = static_cast<ELF_CLASS>(bin.elf_class);
+    binary->original_size_ = bin.original_size;
+    binary->interpreter_   = reader->str(bin.interpreter);
+    binary->overlay_       = reader->array<uint8_t>(bin.overlay);
+
+    sizing_info_t& info = *binary->sizing_info_;
+    uint64_t* sizing[] = {
+      &info.dynsym, &info.dynstr, &info.dynamic, &info.interpreter, &info.gnu_hash,
+      &info.hash, &info.rela, &info.jmprel, &info.relr, &info.android_rela,
+      &info.versym, &info.verdef, &info.verneed, &info.init_array, &info.fini_array,
+      &info.preinit_array,
+    };
+    for (size_t i = 0; i < std::size(sizing); ++i) {
+      *sizing[i] = bin.sizing_info[i];
+    }
+    binary->phdr_reloc_info_.new_offset  = bin.phdr_reloc_offset;
+    binary->phdr_reloc_info_.nb_segments = bin.phdr_reloc_nb_segments;
+  }
+
+  std::vector<Section*> sections;
+  for (const section_t& sec : reader->records<section_t>(TABLE::SECTIONS)) {
+    auto section = std::make_unique<Section>();
+    section->name_            = reader->str(sec.name);
+    section->virtual_address_ = sec.virtual_address;
+    section->size_            = sec.size;
+    section->offset_          = sec.offset;
+    section->flags_           = sec.flags;
+    section->original_size_   = sec.original_size;
+    section->address_align_   = sec.address_align;
+    section->entry_size_      = sec.entry_size;
+    section->type_            = static_cast<ELF_SECTION_TYPES>(sec.type);
+    section->link_            = sec.link;
+    section->info_            = sec.info;
+    section->chdr_.type        = static_cast<Section::COMPRESSION>(sec.chdr_type);
+    section->chdr_.size        = sec.chdr_size;
+    section->chdr_.alignment   = sec.chdr_alignment;
+    section->chdr_.header_size = sec.chdr_header_size;
+    section->is_frame_        = sec.is_frame != 0;
+    section->datahandler_     = sec.has_handler != 0 ? handler : nullptr;
+    section->content_c_       = reader->array<uint8_t>(sec.content);
+    sections.push_back(section.get());
+    binary->sections_.push_back(std::move(section));
+  }
+
+  std::vector<Segment*> segments;
+  for (const segment_t& seg : reader->records<segment_t>(TABLE::SEGMENTS)) {
+    auto segment = std::make_unique<Segment>();
+    segment->file_offset_      = seg.file_offset;
+    segment->virtual_address_  = seg.virtual_address;
+    segment->physical_address_ = seg.physical_address;
+    segment->size_             = seg.size;
+    segment->virtual_size_     = seg.virtual_size;
+    segment->alignment_        = seg.alignment;
+    segment->handler_size_     = seg.handler_size;
+    segment->type_             = static_cast<SEGMENT_TYPES>(seg.type);
+    segment->flags_            = static_cast<ELF_SEGMENT_FLAGS>(seg.flags);
+    segment->datahandler_      = seg.has_handler != 0 ? handler : nullptr;
+    segment->content_c_        = reader->array<uint8_t>(seg.content);
+    segments.push_back(segment.get());
+    binary->segments_.push_back(std::move(segment));
+  }
+
+  for (const link_t& link : reader->records<link_t>(TABLE::SEGMENT_SECTIONS)) {
+    Segment* segment = at(segments, link.segment);
+    Section* section = at(sections, link.section);
+    if (segment != nullptr && section != nullptr) {
+      segment->sections_.push_back(section);
+    }
+  }
+  for (const link_t& link : reader->records<link_t>(TABLE::SECTION_SEGMENTS)) {
+    Segment* segment = at(segments, link.segment);
+    Section* section = at(sections, link.section);
+    if (segment != nullptr && section != nullptr) {
+      section->segments_.push_back(segment);
+    }
+  }
+
+  // Symbol versions
+  std::vector<SymbolVersionAux*> def_aux;
+  {
+    span<const aux_t> aux_records = reader->records<aux_t>(TABLE::VERDEF_AUX);
+    for (const verdef_t& entry : reader->records<verdef_t>(TABLE::VERDEFS)) {
+      auto def = std::make_unique<SymbolVersionDefinition>();
+      def->version(entry.version);
+      def->flags(entry.flags);
+      def->hash(entry.hash);
+      def->ndx_ = entry.ndx;
+      for (uint64_t i = entry.aux_begin;
+           i < uint64_t(entry.aux_begin) + entry.aux_count && i < aux_records.size(); ++i)
+      {
+        auto aux = std::make_unique<SymbolVersionAux>(reader->str(aux_records[i].name));
+        def_aux.push_back(aux.get());
+        def->symbol_version_aux_.push_back(std::move(aux));
+      }
+      binary->symbol_version_definition_.push_back(std::move(def));
+    }
+  }
+
+  std::vector<SymbolVersionAux*> req_aux;
+  {
+    span<const aux_t> aux_records = reader->records<aux_t>(TABLE::VERREQ_AUX);
+    for (const verreq_t& entry : reader->records<verreq_t>(TABLE::VERREQS)) {
+      auto req = std::make_unique<SymbolVersionRequirement>();
+      req->name(reader->str(entry.name));
+      req->version(entry.version);
+      for (uint64_t i = entry.aux_begin;
+           i < uint64_t(entry.aux_begin) + entry.aux_count && i < aux_records.size(); ++i)
+      {
+        SymbolVersionAuxRequirement aux;
+        aux.name(reader->str(aux_records[i].name));
+        aux.hash(aux_records[i].hash);
+        aux.flags(aux_records[i].flags);
+        aux.other(aux_records[i].other);
+        req_aux.push_back(&req->add_aux_requirement(aux));
+      }
+      binary->symbol_version_requirements_.push_back(std::move(req));
+    }
+  }
+
+  std::vector<SymbolVersion*> versions;
+  for (const version_t& entry : reader->records<version_t>(TABLE::VERSIONS)) {
+    auto version = std::make_unique<SymbolVersion>(entry.value);
+    switch (static_cast<AUX_KIND>(entry.aux_kind)) {
+      case AUX_KIND::DEFINITION:
+        version->symbol_aux_ = at(def_aux, entry.aux_index); break;
+      case AUX_KIND::REQUIREMENT:
+        version->symbol_aux_ = at(req_aux, entry.aux_index); break;
+      case AUX_KIND::NONE:
+        break;
+    }
+    versions.push_back(version.get());
+    binary->symbol_version_table_.push_back(std::move(version));
+  }
+
+  std::vector<Symbol*> symbols;
+  for (const symbol_t& sym : reader->records<symbol_t>(TABLE::SYMBOLS)) {
+    auto symbol = std::make_unique<Symbol>();
+    symbol->name_           = reader->str(sym.name);
+    symbol->value_          = sym.value;
+    symbol->size_           = sym.size;
+    symbol->section_        = at(sections, sym.section);
+    symbol->symbol_version_ = at(versions, sym.version);
+    symbol->arch_           = static_cast<ARCH>(sym.arch);
+    symbol->shndx_          = sym.shndx;
+    symbol->type_           = static_cast<ELF_SYMBOL_TYPES>(sym.type);
+    symbol->binding_        = static_cast<SYMBOL_BINDINGS>(sym.binding);
+    symbol->other_          = sym.other;
+    symbols.push_back(symbol.get());
+    if (sym.is_dynamic != 0) {
+      binary->dynamic_symbols_.push_back(std::move(symbol));
+    } else {
+      binary->static_symbols_.push_back(std::move(symbol));
+    }
+  }
+
+  for (const relocation_t& reloc : reader->records<relocation_t>(TABLE::RELOCATIONS)) {
+    auto relocation = std::make_unique<Relocation>(static_cast<ARCH>(reloc.arch));
+    relocation->address_      = reloc.address;
+    relocation->addend_       = reloc.addend;
+    relocation->type_         = reloc.type;
+    relocation->symbol_       = at(symbols, reloc.symbol);
+    relocation->section_      = at(sections, reloc.section);
+    relocation->symbol_table_ = at(sections, reloc.symbol_table);
+    relocation->info_         = reloc.info;
+    relocation->purpose_      = static_cast<RELOCATION_PURPOSES>(reloc.purpose);
+    relocation->encoding_     = static_cast<Relocation::ENCODING>(reloc.encoding);
+    relocation->size_         = reloc.size;
+    relocation->isRela_       = reloc.is_rela != 0;
+    binary->relocations_.push_back(std::move(relocation));
+  }
+
+  for (const dynamic_t& dyn : reader->records<dynamic_t>(TABLE::DYNAMIC)) {
+    const auto tag = static_cast<DYNAMIC_TAGS>(dyn.tag);
+    std::unique_ptr<DynamicEntry> entry;
+    switch (static_cast<DYNAMIC_KIND>(dyn.kind)) {
+      case DYNAMIC_KIND::LIBRARY:
+        entry = std::make_unique<DynamicEntryLibrary>(reader->str(dyn.str)); break;
+      case DYNAMIC_KIND::SONAME:
+        entry = std::make_unique<DynamicSharedObject>(reader->str(dyn.str)); break;
+      case DYNAMIC_KIND::RPATH:
+        entry = std::make_unique<DynamicEntryRpath>(reader->str(dyn.str)); break;
+      case DYNAMIC_KIND::RUNPATH:
+        entry = std::make_unique<DynamicEntryRunPath>(reader->str(dyn.str)); break;
+      case DYNAMIC_KIND::FLAGS:
+        entry = std::make_unique<DynamicEntryFlags>(tag, dyn.value); break;
+      case DYNAMIC_KIND::ARRAY:
+        entry = std::make_unique<DynamicEntryArray>(tag, reader->array<uint64_t>(dyn.array)); break;
+      case DYNAMIC_KIND::ENTRY:
+      default:
+        entry = std::make_unique<DynamicEntry>(tag, dyn.value);
+    }
+    entry->tag(tag);
+    entry->value(dyn.value);
+    binary->dynamic_entries_.push_back(std::move(entry));
+  }
+
+  for (const note_t& raw_note : reader->records<note_t>(TABLE::NOTES)) {
+    auto note = std::make_unique<Note>(reader->str(raw_note.name), raw_note.type,
+                                       reader->array<uint8_t>(raw_note.description),
+                                       binary.get());
+    note->is_core_ = raw_note.is_core != 0;
+    binary->notes_.push_back(std::move(note));
+  }
+
+  for (const gnu_hash_t& hash : reader->records<gnu_hash_t>(TABLE::GNU_HASH)) {
+    auto gnu_hash = std::make_unique<GnuHash>();
+    gnu_hash->c_             = hash.c;
+    gnu_hash->symbol_index_  = hash.symbol_index;
+    gnu_hash->shift2_        = hash.shift2;
+    gnu_hash->bloom_filters_ = reader->array<uint64_t>(hash.bloom_filters);
+    gnu_hash->buckets_       = reader->array<uint32_t>(hash.buckets);
+    gnu_hash->hash_values_   = reader->array<uint32_t>(hash.hash_values);
+    binary->gnu_hash_ = std::move(gnu_hash);
+  }
+
+  for (const sysv_hash_t& hash : reader->records<sysv_hash_t>(TABLE::SYSV_HASH)) {
+    auto sysv_hash = std::make_unique<SysvHash>();
+    sysv_hash->buckets_ = reader->array<uint32_t>(hash.buckets);
+    sysv_hash->chains_  = reader->array<uint32_t>(hash.chains);
+    binary->sysv_hash_ = std::move(sysv_hash);
+  }
+
+  return binary;
+}
+
+}
+}
@@ -177,6 +177,7 @@ class ELF32 {
   typedef Elf32_Phdr    Elf_Phdr;
   typedef Elf32_Ehdr    Elf_Ehdr;
   typedef Elf32_Shdr    Elf_Shdr;
+  typedef Elf32_Chdr    Elf_Chdr;
   typedef Elf32_Sym     Elf_Sym;
   typedef Elf32_Rel     Elf_Rel;
   typedef Elf32_Rela    Elf_Rela;
@@ -211,6 +212,7 @@ class ELF64 {
   typedef Elf64_Phdr    Elf_Phdr;
   typedef Elf64_Ehdr    Elf_Ehdr;
   typedef Elf64_Shdr    Elf_Shdr;
+  typedef Elf64_Chdr    Elf_Chdr;
   typedef Elf64_Sym     Elf_Sym;
   typedef Elf64_Rel     Elf_Rel;
   typedef Elf64_Rela    Elf_Rela;
@@ -29,6 +29,7 @@
 #include "LIEF/ELF/SymbolVersion.hpp"
 
 #include "ELF/Structures.hpp"
+#include "ELF/ModificationCounter.hpp"
 
 namespace LIEF {
 namespace ELF {
@@ -38,6 +39,7 @@ Symbol::~Symbol() = default;
 
 Symbol& Symbol::operator=(Symbol other) {
   swap(other);
+  details::notify_modification(modifications_);
   return *this;
 }
 
@@ -144,6 +146,7 @@ SymbolVersion* Symbol::symbol_version() {
 
 void Symbol::type(ELF_SYMBOL_TYPES type) {
   type_ = type;
+  details::notify_modification(modifications_);
 }
 
 void Symbol::binding(SYMBOL_BINDINGS binding) {
@@ -166,6 +169,22 @@ void Symbol::visibility(ELF_SYMBOL_VISIBILITY visibility) {
 void Symbol::information(uint8_t info) {
   binding_ = static_cast<SYMBOL_BINDINGS>(info >> 4);
   type_    = static_cast<ELF_SYMBOL_TYPES>(info & 0x0f);
+  details::notify_modification(modifications_);
+}
+
+void Symbol::value(uint64_t value) {
+  value_ = value;
+  details::notify_modification(modifications_);
+}
+
+void Symbol::size(uint64_t size) {
+  size_ = size;
+  details::notify_modification(modifications_);
+}
+
+void Symbol::name(const std::string& name) {
+  LIEF::Symbol::name(name);
+  details::notify_modification(modifications_);
 }
 
 
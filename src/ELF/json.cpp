@@ -20,144 +20,52 @@
 namespace LIEF {
 namespace ELF {
 
-void JsonVisitor::visit(const Binary& binary) {
-  JsonVisitor header_visitor;
-  header_visitor(binary.header());
-
-  // Sections
-  std::vector<json> sections;
-  for (const Section& section : binary.sections()) {
-    JsonVisitor visitor;
-    visitor(section);
-    sections.emplace_back(visitor.get());
-  }
-
-  // Segments
-  std::vector<json> segments;
-  for (const Segment& segment : binary.segments()) {
-    JsonVisitor visitor;
-    visitor(segment);
-    segments.emplace_back(visitor.get());
-  }
-
-  // Dynamic entries
-  std::vector<json> dynamic_entries;
-  for (const DynamicEntry& entry : binary.dynamic_entries()) {
-    JsonVisitor visitor;
-    entry.accept(visitor);
-    dynamic_entries.emplace_back(visitor.get());
-  }
-
-
-  // Dynamic symbols
-  std::vector<json> dynamic_symbols;
-  for (const Symbol& symbol : binary.dynamic_symbols()) {
-    JsonVisitor visitor;
-    visitor(symbol);
-    dynamic_symbols.emplace_back(visitor.get());
-  }
-
-
-  // Static symbols
-  std::vector<json> static_symbols;
-  for (const Symbol& symbol : binary.static_symbols()) {
-    JsonVisitor visitor;
-    visitor(symbol);
-    static_symbols.emplace_back(visitor.get());
-  }
-
-
-  // Dynamic relocations
-  std::vector<json> dynamic_relocations;
-  for (const Relocation& reloc : binary.dynamic_relocations()) {
-    JsonVisitor visitor;
-    visitor(reloc);
-    dynamic_relocations.emplace_back(visitor.get());
-  }
-
-
-  // pltgot relocations
-  std::vector<json> pltgot_relocations;
-  for (const Relocation& reloc : binary.pltgot_relocations()) {
-    JsonVisitor visitor;
-    visitor(reloc);
-    pltgot_relocations.emplace_back(visitor.get());
-  }
-
-
-  // Symbol version
-  std::vector<json> symbols_version;
-  for (const SymbolVersion& s : binary.symbols_version()) {
-    JsonVisitor visitor;
-    visitor(s);
-    symbols_version.emplace_back(visitor.get());
-  }
-
-
-  // Symbols version requirement
-  std::vector<json> symbols_version_requirement;
-  for (const SymbolVersionRequirement& s : binary.symbols_version_requirement()) {
-    JsonVisitor visitor;
-    visitor(s);
-    symbols_version_requirement.emplace_back(visitor.get());
-  }
-
-
-  // Symbols version definition
-  std::vector<json> symbols_version_definition;
-  for (const SymbolVersionDefinition& s : binary.symbols_version_definition()) {
-    JsonVisitor visitor;
-    visitor(s);
-    symbols_version_definition.emplace_back(visitor.get());
-  }
-
-
-  // Notes
-  std::vector<json> notes;
-  for (const Note& note : binary.notes()) {
-    JsonVisitor visitor;
-    visitor(note);
-    notes.emplace_back(visitor.get());
-  }
-
-  node_["entrypoint"]   = binary.entrypoint();
-  node_["imagebase"]    = binary.imagebase();
-  node_["virtual_size"] = binary.virtual_size();
-  node_["is_pie"]       = binary.is_pie();
+// Top-level entries of a Binary for both JsonVisitor::visit(const Binary&)
+// (JsonTree) and stream_json() (JsonStream)
+template<class Writer>
+static void serialize(const Binary& binary, Writer& writer) {
+  writer.begin()
+    .value("entrypoint",   binary.entrypoint())
+    .value("imagebase",    binary.imagebase())
+    .value("virtual_size", binary.virtual_size())
+    .value("is_pie",       binary.is_pie());
 
   if (binary.has_interpreter()) {
-    node_["interpreter"] = binary.interpreter();
+    writer.value("interpreter", binary.interpreter());
   }
 
-  node_["header"]                      = header_visitor.get();
-  node_["sections"]                    = sections;
-  node_["segments"]                    = segments;
-  node_["dynamic_entries"]             = dynamic_entries;
-  node_["dynamic_symbols"]             = dynamic_symbols;
-  node_["static_symbols"]              = static_symbols;
-  node_["dynamic_relocations"]         = dynamic_relocations;
-  node_["pltgot_relocations"]          = pltgot_relocations;
-  node_["symbols_version"]             = symbols_version;
-  node_["symbols_version_requirement"] = symbols_version_requirement;
-  node_["symbols_version_definition"]  = symbols_version_definition;
-  node_["notes"]                       = notes;
+  writer
+    .template object<JsonVisitor>("header", binary.header())
+    .template list<JsonVisitor>("sections",                    binary.sections())
+    .template list<JsonVisitor>("segments",                    binary.segments())
+    .template accept_list<JsonVisitor>("dynamic_entries",      binary.dynamic_entries())
+    .template list<JsonVisitor>("dynamic_symbols",             binary.dynamic_symbols())
+    .template list<JsonVisitor>("static_symbols",              binary.static_symbols())
+    .template list<JsonVisitor>("dynamic_relocations",         binary.dynamic_relocations())
+    .template list<JsonVisitor>("pltgot_relocations",          binary.pltgot_relocations())
+    .template list<JsonVisitor>("symbols_version",             binary.symbols_version())
+    .template list<JsonVisitor>("symbols_version_requirement", binary.symbols_version_requirement())
+    .template list<JsonVisitor>("symbols_version_definition",  binary.symbols_version_definition())
+    .template list<JsonVisitor>("notes",                       binary.notes());
 
   if (binary.use_gnu_hash()) {
-    JsonVisitor gnu_hash_visitor;
-    gnu_hash_visitor(*binary.gnu_hash());
-
-    node_["gnu_hash"] = gnu_hash_visitor.get();
+    writer.template object<JsonVisitor>("gnu_hash", *binary.gnu_hash());
   }
 
   if (binary.use_sysv_hash()) {
-    JsonVisitor sysv_hash_visitor;
-    sysv_hash_visitor(*binary.sysv_hash());
-
-    node_["sysv_hash"] = sysv_hash_visitor.get();
+    writer.template object<JsonVisitor>("sysv_hash", *binary.sysv_hash());
   }
+  writer.end();
+}
 
+void JsonVisitor::visit(const Binary& binary) {
+  JsonTree tree(node_);
+  serialize(binary, tree);
 }
 
+void stream_json(const Binary& binary, JsonStream& stream) {
+  serialize(binary, stream);
+}
 
 void JsonVisitor::visit(const Header& header) {
   node_["file_type"]                       = to_string(header.file_type());
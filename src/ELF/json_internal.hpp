@@ -18,6 +18,7 @@
 
 #include "LIEF/visibility.h"
 #include "visitors/json.hpp"
+#include "visitors/json_stream.hpp"
 #include "LIEF/ELF.hpp"
 
 namespace LIEF {
@@ -90,6 +91,10 @@ class JsonVisitor : public LIEF::JsonVisitor {
   void visit(const SysvHash& sysvhash)              override;
 };
 
+//! Stream the JSON representation of the given binary.
+//! The top-level entries are the same as JsonVisitor::visit(const Binary&)
+void stream_json(const Binary& binary, JsonStream& stream);
+
 }
 }
 #endif
@@ -337,6 +337,10 @@ Binary::it_const_sections Binary::sections() const {
 
 // Relocations
 Binary::it_relocations Binary::relocations() {
+  if (const DyldChainedFixups* fixups = dyld_chained_fixups()) {
+    fixups->create_objects();
+  }
+
   relocations_t result;
   for (SegmentCommand* segment : segments_) {
     std::transform(std::begin(segment->relocations_), std::end(segment->relocations_),
@@ -359,6 +363,10 @@ Binary::it_relocations Binary::relocations() {
 }
 
 Binary::it_const_relocations Binary::relocations() const {
+  if (const DyldChainedFixups* fixups = dyld_chained_fixups()) {
+    fixups->create_objects();
+  }
+
   relocations_t result;
   for (const SegmentCommand* segment : segments_) {
     std::transform(std::begin(segment->relocations_), std::end(segment->relocations_),
@@ -705,6 +713,11 @@ uint32_t Binary::page_size() const {
 }
 
 void Binary::shift_command(size_t width, uint64_t from_offset) {
+  // The objects created from the chained fixups must be shifted as well
+  if (const DyldChainedFixups* fixups = dyld_chained_fixups()) {
+    fixups->create_objects();
+  }
+
   const SegmentCommand* segment = segment_from_offset(from_offset);
 
   uint64_t __text_base_addr = 0;
@@ -1148,6 +1161,13 @@ bool Binary::remove(const LoadCommand& command) {
 
   LoadCommand* cmd_rm = it->get();
 
+  // The objects created from the chained fixups reference the segments
+  if (SegmentCommand::classof(cmd_rm) || DyldChainedFixups::classof(cmd_rm)) {
+    if (const DyldChainedFixups* fixups = dyld_chained_fixups()) {
+      fixups->create_objects();
+    }
+  }
+
   if (DylibCommand::classof(cmd_rm)) {
     auto it_cache = std::find(std::begin(libraries_), std::end(libraries_), cmd_rm);
     if (it_cache == std::end(libraries_)) {
@@ -1474,8 +1494,9 @@ Section* Binary::add_section(const SegmentCommand& segment, const Section& secti
   // Copy data to segment
   const uint64_t relative_offset = new_section->offset() - target_segment->file_offset();
 
+  span<uint8_t> segment_content = target_segment->writable_content();
   std::move(std::begin(content), std::end(content),
-            std::begin(target_segment->data_) + relative_offset);
+            std::begin(segment_content) + relative_offset);
 
   target_segment->sections_.push_back(std::move(new_section));
   return target_segment->sections_.back().get();
@@ -2471,6 +2492,16 @@ const DyldExportsTrie* Binary::dyld_exports_trie() const {
   return command<DyldExportsTrie>();
 }
 
+ExportsTrieView Binary::exports_view() const {
+  if (const DyldExportsTrie* exports = dyld_exports_trie()) {
+    return exports->exports_view();
+  }
+  if (const DyldInfo* info = dyld_info()) {
+    return info->exports_view();
+  }
+  return {};
+}
+
 // Linker Optimization Hint command
 // ++++++++++++++++++++++++++++++++
 bool Binary::has_linker_opt_hint() const {
@@ -126,6 +126,11 @@ ok_error_t BinaryParser::init_and_parse() {
   }
   const auto type = static_cast<MACHO_TYPES>(*stream_->peek<uint32_t>());
 
+  // Keep a reference on the original content for Binary::save_snapshot()
+  if (VectorStream::classof(*stream_)) {
+    stream_->peek_shared_data(binary_->source_, 0, stream_->size());
+  }
+
   is64_          = type == MACHO_TYPES::MH_MAGIC_64 || type == MACHO_TYPES::MH_CIGAM_64;
   binary_->is64_ = is64_;
   type_          = type;
@@ -304,6 +309,58 @@ ok_error_t BinaryParser::parse_export_trie(exports_list_t& exports, uint64_t sta
   return ok();
 }
 
+ok_error_t BinaryParser::restore_exports(exports_list_t& exports, uint32_t table) {
+  // Symbols are referenced by their index in Binary::symbols_. As the
+  // exports are restored in the same order as they are decoded from the trie,
+  // an index equal to the number of symbols means that the symbol was created
+  // by the parser.
+  auto restore_symbol = [this] (uint32_t idx, const std::string& name) -> Symbol* {
+    if (idx < binary_->symbols_.size()) {
+      return binary_->symbols_[idx].get();
+    }
+    if (idx != binary_->symbols_.size()) {
+      return nullptr;
+    }
+    auto symbol = std::make_unique<Symbol>();
+    symbol->origin_            = SYMBOL_ORIGINS::SYM_ORIGIN_DYLD_EXPORT;
+    symbol->value_             = 0;
+    symbol->type_              = 0;
+    symbol->numberof_sections_ = 0;
+    symbol->description_       = 0;
+    symbol->name(name);
+    binary_->symbols_.push_back(std::move(symbol));
+    return binary_->symbols_.back().get();
+  };
+
+  span<const details::snapshot_export_t> records =
+    snapshot_->records<details::snapshot_export_t>(table);
+  exports.reserve(records.size());
+
+  for (const details::snapshot_export_t& raw : records) {
+    const std::string name = snapshot_->str(raw.name);
+    auto export_info = std::make_unique<ExportInfo>(raw.address, raw.flags, raw.node_offset);
+    export_info->other_ = raw.other;
+
+    if (Symbol* symbol = restore_symbol(raw.symbol, name)) {
+      export_info->symbol_ = symbol;
+      symbol->export_info_ = export_info.get();
+    }
+
+    if (export_info->has(EXPORT_SYMBOL_FLAGS::EXPORT_SYMBOL_FLAGS_REEXPORT)) {
+      if (Symbol* alias = restore_symbol(raw.alias, name)) {
+        export_info->alias_ = alias;
+        alias->export_info_ = export_info.get();
+        alias->value_       = export_info->address();
+      }
+      if (raw.other < binary_->libraries().size()) {
+        export_info->alias_location_ = &binary_->libraries()[raw.other];
+      }
+    }
+    exports.push_back(std::move(export_info));
+  }
+  return ok();
+}
+
 ok_error_t BinaryParser::parse_dyld_exports() {
   DyldExportsTrie* exports = binary_->dyld_exports_trie();
   if (exports == nullptr) {
@@ -335,6 +392,15 @@ ok_error_t BinaryParser::parse_dyld_exports() {
 
   exports->content_ = content.subspan(rel_offset, size);
 
+  if (snapshot_ != nullptr) {
+    return restore_exports(exports->export_info_,
+                           static_cast<uint32_t>(details::SNAPSHOT_TABLES::TRIE_EXPORTS));
+  }
+
+  if (!config_.parse_dyld_exports) {
+    return ok();
+  }
+
   stream_->setpos(offset);
   parse_export_trie(exports->export_info_, offset, end_offset, "");
   return ok();
@@ -373,6 +439,15 @@ ok_error_t BinaryParser::parse_dyldinfo_export() {
 
   dyldinfo->export_trie_ = content.subspan(rel_offset, size);
 
+  if (snapshot_ != nullptr) {
+    return restore_exports(dyldinfo->export_info_,
+                           static_cast<uint32_t>(details::SNAPSHOT_TABLES::DYLDINFO_EXPORTS));
+  }
+
+  if (!config_.parse_dyld_exports) {
+    return ok();
+  }
+
   stream_->setpos(offset);
   parse_export_trie(dyldinfo->export_info_, offset, end_offset, "");
   return ok();
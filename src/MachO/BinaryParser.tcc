@@ -63,8 +63,10 @@
 #include "MachO/Structures.hpp"
 #include "MachO/ChainedFixup.hpp"
 #include "MachO/ChainedBindingInfoList.hpp"
+#include "MachO/snapshot_records.hpp"
 
 #include "Object.tcc"
+#include "parallel.hpp"
 
 
 namespace LIEF {
@@ -106,10 +108,9 @@ ok_error_t BinaryParser::parse() {
   }
 
   if (binary_->has_dyld_info()) {
-
-    if (config_.parse_dyld_exports) {
-      parse_dyldinfo_export();
-    }
+    // The raw trie is always bound (for ExportsTrieView) while the ExportInfo
+    // are only decoded if config_.parse_dyld_exports is set
+    parse_dyldinfo_export();
 
     if (config_.parse_dyld_bindings) {
       parse_dyldinfo_binds<MACHO_T>();
@@ -120,7 +121,7 @@ ok_error_t BinaryParser::parse() {
     }
   }
 
-  if (config_.parse_dyld_exports && binary_->has_dyld_exports_trie()) {
+  if (binary_->has_dyld_exports_trie()) {
     parse_dyld_exports();
   }
 
@@ -280,9 +281,9 @@ ok_error_t BinaryParser::parse_load_commands() {
 
               uintptr_t address = memstream.base_address() + segment_va;
               const auto* p = reinterpret_cast<const uint8_t*>(address);
-              segment->data_ = {p, p + segment->file_size()};
+              segment->data_ = SharedContent::buffer_t(p, p + segment->file_size());
             } else {
-              if (!stream_->peek_data(segment->data_, segment->file_offset(), segment->file_size())) {
+              if (!stream_->peek_shared_data(segment->data_, segment->file_offset(), segment->file_size())) {
                 LIEF_ERR("Segment {}: content corrupted!", segment->name());
               }
             }
@@ -1177,7 +1178,7 @@ ok_error_t BinaryParser::parse_relocations(Section& section) {
 
 template<class MACHO_T>
 ok_error_t BinaryParser::parse_dyldinfo_rebases() {
-  LIEF_DEBUG("[+] LC_DYLD_INFO.rebases");
+  LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "[+] LC_DYLD_INFO.rebases");
   using pint_t = typename MACHO_T::uint;
 
   DyldInfo* dyldinfo = binary_->dyld_info();
@@ -1214,6 +1215,10 @@ ok_error_t BinaryParser::parse_dyldinfo_rebases() {
 
   dyldinfo->rebase_opcodes_ = content.subspan(rel_offset, size);
 
+  if (snapshot_ != nullptr) {
+    return restore_dyldinfo_rebases<MACHO_T>();
+  }
+
   uint64_t end_offset = offset + size;
 
   bool     done = false;
@@ -1405,12 +1410,16 @@ ok_error_t BinaryParser::parse_dyldinfo_rebases() {
 
 template<class MACHO_T>
 ok_error_t BinaryParser::parse_dyldinfo_binds() {
-  LIEF_DEBUG("[+] LC_DYLD_INFO.bindings");
+  LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "[+] LC_DYLD_INFO.bindings");
 
   parse_dyldinfo_generic_bind<MACHO_T>();
   parse_dyldinfo_weak_bind<MACHO_T>();
   parse_dyldinfo_lazy_bind<MACHO_T>();
 
+  if (snapshot_ != nullptr) {
+    return restore_dyldinfo_binds<MACHO_T>();
+  }
+
   return ok();
 }
 
@@ -1454,6 +1463,11 @@ ok_error_t BinaryParser::parse_dyldinfo_generic_bind() {
 
   dyldinfo->bind_opcodes_ = content.subspan(rel_offset, size);
 
+  // The bindings are restored from the snapshot (see: parse_dyldinfo_binds)
+  if (snapshot_ != nullptr) {
+    return ok();
+  }
+
   uint64_t end_offset = offset + size;
 
   uint8_t     type = 0;
@@ -1816,6 +1830,11 @@ ok_error_t BinaryParser::parse_dyldinfo_weak_bind() {
 
   dyldinfo->weak_bind_opcodes_ = content.subspan(rel_offset, size);
 
+  // The bindings are restored from the snapshot (see: parse_dyldinfo_binds)
+  if (snapshot_ != nullptr) {
+    return ok();
+  }
+
   uint64_t end_offset = offset + size;
 
   uint8_t     type = 0;
@@ -2065,6 +2084,11 @@ ok_error_t BinaryParser::parse_dyldinfo_lazy_bind() {
 
   dyldinfo->lazy_bind_opcodes_ = content.subspan(rel_offset, size);
 
+  // The bindings are restored from the snapshot (see: parse_dyldinfo_binds)
+  if (snapshot_ != nullptr) {
+    return ok();
+  }
+
   uint64_t end_offset = offset + size;
 
   //uint32_t    lazy_offset     = 0;
@@ -2262,7 +2286,7 @@ ok_error_t BinaryParser::do_bind(BINDING_CLASS cls,
     return make_error_code(lief_errors::not_found);
   }
   dyld_info->binding_info_.push_back(std::move(binding_info));
-  LIEF_DEBUG("{} {} - {}", to_string(cls), segment.name(), symbol_name);
+  LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "{} {} - {}", to_string(cls), segment.name(), symbol_name);
   return ok();
 }
 
@@ -2337,7 +2361,7 @@ ok_error_t BinaryParser::do_rebase(uint8_t type, uint8_t segment_idx, uint64_t s
   if (dyld_reloc_addrs_.insert(address).second) {
     segment.relocations_.push_back(std::move(reloc));
   } else {
-    LIEF_DEBUG("[!] Duplicated symbol address in the dyld rebase: 0x{:x}", address);
+    LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "[!] Duplicated symbol address in the dyld rebase: 0x{:x}", address);
   }
   return ok();
 }
@@ -2355,14 +2379,14 @@ ok_error_t BinaryParser::parse_chained_payload(SpanStream& stream) {
     return make_error_code(lief_errors::read_error);
   }
 
-  LIEF_DEBUG("fixups_version = {}", header.fixups_version);
-  LIEF_DEBUG("starts_offset  = {}", header.starts_offset);
-  LIEF_DEBUG("imports_offset = {}", header.imports_offset);
-  LIEF_DEBUG("symbols_offset = {}", header.symbols_offset);
-  LIEF_DEBUG("imports_count  = {}", header.imports_count);
-  LIEF_DEBUG("imports_format = {} ({})", header.imports_format,
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "fixups_version = {}", header.fixups_version);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "starts_offset  = {}", header.starts_offset);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "imports_offset = {}", header.imports_offset);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "symbols_offset = {}", header.symbols_offset);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "imports_count  = {}", header.imports_count);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "imports_format = {} ({})", header.imports_format,
                                          to_string(static_cast<DYLD_CHAINED_FORMAT>(header.imports_format)));
-  LIEF_DEBUG("symbols_format = {}", header.symbols_format);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "symbols_format = {}", header.symbols_format);
   chained_fixups_->update_with(header);
 
   auto res_symbols_pools = stream.slice(header.symbols_offset);
@@ -2421,7 +2445,7 @@ ok_error_t BinaryParser::parse_chained_import(const details::dyld_chained_fixups
                       to_string(get_error(res)));
             break;
           }
-          LIEF_DEBUG("dyld chained import[{}]", i);
+          LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "dyld chained import[{}]", i);
           if (auto res = symbol_pool.peek_string_at(import.name_offset)) {
             symbol_name = std::move(*res);
           } else {
@@ -2524,8 +2548,8 @@ ok_error_t BinaryParser::parse_chained_fixup(const details::dyld_chained_fixups_
     return make_error_code(res.error());
   }
 
-  LIEF_DEBUG("chained starts in image");
-  LIEF_DEBUG("  seg_count = {}", starts.seg_count);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "chained starts in image");
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "  seg_count = {}", starts.seg_count);
 
   uint32_t nb_segments = starts.seg_count;
   if (nb_segments > binary_->segments_.size()) {
@@ -2534,6 +2558,9 @@ ok_error_t BinaryParser::parse_chained_fixup(const details::dyld_chained_fixups_
     nb_segments = binary_->segments_.size();
   }
 
+  std::vector<details::chain_start_t> chains;
+  std::vector<details::dyld_chained_starts_in_segment> seg_infos(nb_segments);
+
   for (uint32_t seg_idx = 0; seg_idx < nb_segments; ++seg_idx) {
     uint32_t seg_info_offset = 0;
     if (auto res = stream.read<uint32_t>()) {
@@ -2544,33 +2571,134 @@ ok_error_t BinaryParser::parse_chained_fixup(const details::dyld_chained_fixups_
       break;
     }
 
-    LIEF_DEBUG("    seg_offset[{}] = {} ({})", seg_idx, seg_info_offset, binary_->segments_[seg_idx]->name());
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "    seg_offset[{}] = {} ({})", seg_idx, seg_info_offset, binary_->segments_[seg_idx]->name());
     if (seg_info_offset == 0) {
       struct DyldChainedFixups::chained_starts_in_segment info(0, {}, *binary_->segments_[seg_idx]);
       chained_fixups_->chained_starts_in_segment_.push_back(std::move(info));
       continue;
     }
-    LIEF_DEBUG("    #{} processing dyld_chained_starts_in_segment", seg_idx);
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "    #{} processing dyld_chained_starts_in_segment", seg_idx);
     const uint64_t offset = header.starts_offset + seg_info_offset;
-    if (!parse_fixup_seg<MACHO_T>(stream, seg_info_offset, offset, seg_idx)) {
+    if (!parse_fixup_seg<MACHO_T>(stream, seg_info_offset, offset, seg_idx,
+                                  chains, seg_infos[seg_idx]))
+    {
       LIEF_WARN("Error while parsing fixup in segment: {}", binary_->segments_[seg_idx]->name());
     }
   }
 
+  if (!decode_chains<MACHO_T>(chains)) {
+    return make_error_code(lief_errors::parsing_error);
+  }
+
+  // The RelocationFixup / ChainedBindingInfo objects are lazily created
+  // from the table (see: DyldChainedFixups::create_objects)
+  chained_fixups_->fixups_segments_.resize(nb_segments);
+  for (uint32_t seg_idx = 0; seg_idx < nb_segments; ++seg_idx) {
+    DyldChainedFixups::fixups_segment_t& info = chained_fixups_->fixups_segments_[seg_idx];
+    info.segment           = binary_->segments_[seg_idx];
+    info.pointer_format    = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_infos[seg_idx].pointer_format);
+    info.max_valid_pointer = seg_infos[seg_idx].max_valid_pointer;
+  }
+
+  if (!chained_fixups_->fixups_.empty()) {
+    chained_fixups_->binary_ = binary_.get();
+    for (const DyldChainedFixups::fixups_segment_t& info : chained_fixups_->fixups_segments_) {
+      info.segment->chained_fixups_ = chained_fixups_;
+    }
+  }
+  return ok();
+}
+
+template<class MACHO_T>
+ok_error_t BinaryParser::decode_chains(const std::vector<details::chain_start_t>& chains) {
+  static constexpr size_t CHAINS_PER_THREAD = 64;
+  if (chains.empty()) {
+    return ok();
+  }
+
+  // The chains are decoded concurrently so we can't go through stream_
+  // (BinaryStream::peek() is not thread-safe). Instead, we directly work on
+  // the raw buffer if the stream is backed by a contiguous area. Otherwise
+  // (e.g. FileStream or a Mach-O parsed from memory whose segments are
+  // remapped), each segment's content is read once in a dedicated buffer.
+  struct window_t {
+    span<const uint8_t> content;
+    uint64_t offset = 0;
+  };
+  const size_t nb_segments = binary_->segments_.size();
+  std::vector<window_t> windows(nb_segments);
+  std::vector<std::vector<uint8_t>> copies;
+
+  if (const uint8_t* start = stream_->contiguous_start()) {
+    const window_t all = {{start, static_cast<size_t>(stream_->size())}, 0};
+    std::fill(windows.begin(), windows.end(), all);
+  } else {
+    copies.resize(nb_segments);
+    for (const details::chain_start_t& chain : chains) {
+      window_t& window = windows[chain.segment];
+      if (!window.content.empty()) {
+        continue;
+      }
+      const SegmentCommand& segment = *binary_->segments_[chain.segment];
+      std::vector<uint8_t>& copy = copies[chain.segment];
+      if (!stream_->peek_data(copy, segment.file_offset(), segment.file_size())) {
+        LIEF_WARN("Can't read the content of the segment '{}'", segment.name());
+        continue;
+      }
+      window = {copy, segment.file_offset()};
+    }
+  }
+
+  const uint64_t imagebase = binary_->imagebase();
+  const size_t nb_chunks = parallel::nb_chunks(chains.size(), CHAINS_PER_THREAD);
+
+  std::vector<DyldChainedFixups::fixups_table_t> tables(nb_chunks);
+  std::vector<std::vector<size_t>> errors(nb_chunks);
+
+  parallel::for_each_chunk(chains.size(), nb_chunks,
+    [&] (size_t chunk, size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const window_t& window = windows[chains[i].segment];
+        if (!details::decode_chain(window.content, window.offset, imagebase,
+                                   chains[i], tables[chunk]))
+        {
+          errors[chunk].push_back(i);
+        }
+      }
+    }
+  );
+
+  DyldChainedFixups::fixups_table_t& fixups = chained_fixups_->fixups_;
+  size_t nb_fixups = 0;
+  for (const DyldChainedFixups::fixups_table_t& table : tables) {
+    nb_fixups += table.size();
+  }
+  fixups.reserve(nb_fixups);
+  for (size_t chunk = 0; chunk < nb_chunks; ++chunk) {
+    fixups.append(tables[chunk]);
+    for (size_t idx : errors[chunk]) {
+      const details::chain_start_t& chain = chains[idx];
+      LIEF_WARN("Error while walking through the chained fixup of the segment '{}' (offset: 0x{:x})",
+                binary_->segments_[chain.segment]->name(), chain.offset);
+    }
+  }
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{} chains decoded into {} fixups ({} threads)",
+                 chains.size(), fixups.size(), nb_chunks);
   return ok();
 }
 
 template<class MACHO_T>
 ok_error_t BinaryParser::parse_fixup_seg(SpanStream& stream, uint32_t seg_info_offset,
-                                         uint64_t offset, uint32_t seg_idx)
+                                         uint64_t offset, uint32_t seg_idx,
+                                         std::vector<details::chain_start_t>& chains,
+                                         details::dyld_chained_starts_in_segment& seg_info)
 {
   static constexpr const char DPREFIX[] = "    ";
   static constexpr auto DYLD_CHAINED_PTR_START_NONE  = 0xFFFF;
   static constexpr auto DYLD_CHAINED_PTR_START_MULTI = 0x8000;
   static constexpr auto DYLD_CHAINED_PTR_START_LAST  = 0x8000;
 
-  details::dyld_chained_starts_in_segment seg_info;
-  if (auto res = stream.peek<decltype(seg_info)>(offset)) {
+  if (auto res = stream.peek<details::dyld_chained_starts_in_segment>(offset)) {
     seg_info = *res;
   } else {
     LIEF_WARN("Can't read dyld_chained_starts_in_segment for #{}: {}", seg_idx,
@@ -2586,12 +2714,12 @@ ok_error_t BinaryParser::parse_fixup_seg(SpanStream& stream, uint32_t seg_info_o
   SpanStream seg_stream = std::move(*res_seg_stream);
   seg_stream.read<details::dyld_chained_starts_in_segment>();
 
-  LIEF_DEBUG("{}size              = {}",      DPREFIX, seg_info.size);
-  LIEF_DEBUG("{}page_size         = 0x{:x}",  DPREFIX, seg_info.page_size);
-  LIEF_DEBUG("{}pointer_format    = {} ({})", DPREFIX, seg_info.pointer_format, to_string(static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format)));
-  LIEF_DEBUG("{}segment_offset    = 0x{:x}",  DPREFIX, seg_info.segment_offset);
-  LIEF_DEBUG("{}max_valid_pointer = {}",      DPREFIX, seg_info.max_valid_pointer);
-  LIEF_DEBUG("{}page_count        = {}",      DPREFIX, seg_info.page_count);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}size              = {}",      DPREFIX, seg_info.size);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}page_size         = 0x{:x}",  DPREFIX, seg_info.page_size);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}pointer_format    = {} ({})", DPREFIX, seg_info.pointer_format, to_string(static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format)));
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}segment_offset    = 0x{:x}",  DPREFIX, seg_info.segment_offset);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}max_valid_pointer = {}",      DPREFIX, seg_info.max_valid_pointer);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}page_count        = {}",      DPREFIX, seg_info.page_count);
 
   SegmentCommand* segment = binary_->segments_[seg_idx];
 
@@ -2608,7 +2736,7 @@ ok_error_t BinaryParser::parse_fixup_seg(SpanStream& stream, uint32_t seg_info_o
     }
     info.page_start.push_back(offset_in_page);
 
-    LIEF_DEBUG("{}    page_start[{}]: {}", DPREFIX, page_idx, offset_in_page);
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "{}    page_start[{}]: {}", DPREFIX, page_idx, offset_in_page);
 
     if (offset_in_page == DYLD_CHAINED_PTR_START_NONE) {
       continue;
@@ -2630,20 +2758,16 @@ ok_error_t BinaryParser::parse_fixup_seg(SpanStream& stream, uint32_t seg_info_o
         offset_in_page = overflow_val & ~DYLD_CHAINED_PTR_START_LAST;
         uint64_t page_content_start = seg_info.segment_offset + (page_idx * seg_info.page_size);
         uint64_t chain_offset = page_content_start + offset_in_page;
-        auto is_ok = walk_chain<MACHO_T>(*segment, chain_offset, seg_info);
-        if (!is_ok) {
-          LIEF_WARN("Error while walking through the chained fixup of the segment '{}'", segment->name());
-        }
+        chains.push_back({chain_offset, seg_idx, seg_info.max_valid_pointer,
+                          seg_info.pointer_format});
         ++overflow_index;
       }
 
     } else {
       uint64_t page_content_start = seg_info.segment_offset + (page_idx * seg_info.page_size);
       uint64_t chain_offset = page_content_start + offset_in_page;
-      auto is_ok = walk_chain<MACHO_T>(*segment, chain_offset, seg_info);
-      if (!is_ok) {
-        LIEF_WARN("Error while walking through the chained fixup of the segment '{}'", segment->name());
-      }
+      chains.push_back({chain_offset, seg_idx, seg_info.max_valid_pointer,
+                        seg_info.pointer_format});
     }
   }
 
@@ -2661,13 +2785,13 @@ ok_error_t BinaryParser::do_fixup(DYLD_CHAINED_FORMAT fmt, int32_t ord, const st
   binding_info->library_ordinal_ = ord;
   if (0 < ord && static_cast<size_t>(ord) <= binding_libs_.size()) {
     binding_info->library_ = binding_libs_[ord - 1];
-    LIEF_DEBUG("  lib_ordinal: {} ({})", ord, binding_libs_[ord - 1]->name());
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "  lib_ordinal: {} ({})", ord, binding_libs_[ord - 1]->name());
   } else {
-    LIEF_DEBUG("  lib_ordinal: {}", ord);
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "  lib_ordinal: {}", ord);
   }
 
-  LIEF_DEBUG("  weak_import: {}", is_weak);
-  LIEF_DEBUG("  name:        {}", symbol_name);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "  weak_import: {}", is_weak);
+  LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "  name:        {}", symbol_name);
 
   auto search = memoized_symbols_.find(symbol_name);
 
@@ -2697,587 +2821,6 @@ ok_error_t BinaryParser::do_fixup(DYLD_CHAINED_FORMAT fmt, int32_t ord, const st
 }
 
 
-template<class MACHO_T>
-ok_error_t BinaryParser::walk_chain(SegmentCommand& segment, uint64_t chain_offset,
-                                    const details::dyld_chained_starts_in_segment& seg_info)
-{
-  bool stop      = false;
-  bool chain_end = false;
-  while (!stop && !chain_end) {
-    if (!process_fixup<MACHO_T>(segment, chain_offset, seg_info)) {
-      LIEF_WARN("Error while processing the chain at offset: 0x{:x}", chain_offset);
-      return make_error_code(lief_errors::parsing_error);
-    }
-    if (auto res = next_chain<MACHO_T>(chain_offset, seg_info)) {
-      chain_offset = *res;
-    } else {
-      LIEF_WARN("Error while computing the next chain for the offset: 0x{:x}", chain_offset);
-      return make_error_code(lief_errors::parsing_error);
-    }
-
-    if (chain_offset == 0) {
-      chain_end = true;
-    }
-  }
-  return ok();
-}
-
-
-inline uintptr_t stride_size(DYLD_CHAINED_PTR_FORMAT fmt) {
-  switch (fmt) {
-      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
-        return 8;
-
-      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_FIRMWARE:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_32_FIRMWARE:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_64:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_32:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_32_CACHE:
-      case DYLD_CHAINED_PTR_FORMAT::PTR_64_KERNEL_CACHE:
-          return 4;
-
-      case DYLD_CHAINED_PTR_FORMAT::PTR_X86_64_KERNEL_CACHE:
-          return 1;
-  }
-  return 0;
-}
-
-template<class MACHO_T>
-result<uint64_t> BinaryParser::next_chain(uint64_t chain_offset,
-                                          const details::dyld_chained_starts_in_segment& seg_info)
-{
-  const auto ptr_fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format);
-  static constexpr uint64_t CHAIN_END = 0;
-  const uintptr_t stride = stride_size(ptr_fmt);
-
-  switch (ptr_fmt) {
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_FIRMWARE:
-      {
-        /* offset point to a dyld_chained_ptr_arm64e_* structure */
-        details::dyld_chained_ptr_arm64e chain;
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        if (chain.rebase.next == 0) {
-          return CHAIN_END;
-        }
-        return chain_offset + chain.rebase.next * stride;
-      }
-
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
-      {
-        details::dyld_chained_ptr_generic64 chain;
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        if (chain.rebase.next == 0) {
-          return CHAIN_END;
-        }
-        return chain_offset + chain.rebase.next * 4;
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_32:
-      {
-        details::dyld_chained_ptr_generic32 chain;
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        if (chain.rebase.next == 0) {
-          return CHAIN_END;
-        }
-        chain_offset += chain.rebase.next * 4;
-
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return CHAIN_END;
-        }
-
-        while (chain.rebase.bind == 0 && chain.rebase.target > seg_info.max_valid_pointer) {
-          chain_offset += chain.rebase.next * 4;
-          if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-            chain = *res;
-          } else {
-            LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-            return CHAIN_END;
-          }
-        }
-        return chain_offset;
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64_KERNEL_CACHE:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_X86_64_KERNEL_CACHE:
-      {
-        details::dyld_chained_ptr_kernel64 chain;
-
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        if (chain.next == 0) {
-          return CHAIN_END;
-        }
-        return chain.next * stride;
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_32_FIRMWARE:
-      {
-        details::dyld_chained_ptr_firm32 chain;
-
-        if (auto res = stream_->peek<decltype(chain)>(chain_offset)) {
-          chain = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        if (chain.next == 0) {
-          return CHAIN_END;
-        }
-        return chain.next * 4;
-      }
-    default:
-      {
-        LIEF_ERR("Unknown pointer format: 0x{:04x}", seg_info.pointer_format);
-        return make_error_code(lief_errors::not_supported);
-      }
-  }
-  return make_error_code(lief_errors::not_supported);
-}
-
-
-template<class MACHO_T>
-ok_error_t BinaryParser::process_fixup(SegmentCommand& segment, uint64_t chain_offset,
-                                       const details::dyld_chained_starts_in_segment& seg_info)
-{
-  const auto ptr_fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format);
-  //LIEF_DEBUG("0x{:04x}: {}", chain_offset, to_string(ptr_fmt));
-  switch (ptr_fmt) {
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
-      {
-        /* offset point to a dyld_chained_ptr_arm64e_* structure */
-        details::dyld_chained_ptr_arm64e fixup;
-        if (auto res = stream_->peek<decltype(fixup)>(chain_offset)) {
-          fixup = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-
-        auto is_ok = do_chained_fixup(segment, chain_offset, seg_info, fixup);
-        if (!is_ok) {
-          LIEF_WARN("Can't process the fixup {} - 0x{:x}", segment.name(), chain_offset);
-          return make_error_code(is_ok.error());
-        }
-        return ok();
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
-      {
-        details::dyld_chained_ptr_generic64 fixup;
-        if (auto res = stream_->peek<decltype(fixup)>(chain_offset)) {
-          fixup = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-        auto is_ok = do_chained_fixup(segment, chain_offset, seg_info, fixup);
-        if (!is_ok) {
-          LIEF_WARN("Can't process the fixup {} - 0x{:x}", segment.name(), chain_offset);
-          return make_error_code(is_ok.error());
-        }
-        return ok();
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_32:
-      {
-        details::dyld_chained_ptr_generic32 fixup;
-        if (auto res = stream_->peek<decltype(fixup)>(chain_offset)) {
-          fixup = *res;
-        } else {
-          LIEF_ERR("Can't read the dyld chain at 0x{:x}", chain_offset);
-          return make_error_code(res.error());
-        }
-        auto is_ok = do_chained_fixup(segment, chain_offset, seg_info, fixup);
-        if (!is_ok) {
-          LIEF_WARN("Can't process the fixup {} - 0x{:x}", segment.name(), chain_offset);
-          return make_error_code(is_ok.error());
-        }
-        return ok();
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_64_KERNEL_CACHE:
-    case DYLD_CHAINED_PTR_FORMAT::PTR_X86_64_KERNEL_CACHE:
-      {
-        LIEF_INFO("DYLD_CHAINED_PTR_FORMAT: {} is not implemented. Please consider opening an issue with "
-                  "the attached binary", to_string(ptr_fmt));
-        return make_error_code(lief_errors::not_implemented);
-      }
-    case DYLD_CHAINED_PTR_FORMAT::PTR_32_FIRMWARE:
-      {
-        LIEF_INFO("DYLD_CHAINED_PTR_FORMAT: {} is not implemented. Please consider opening an issue with "
-                  "the attached binary", to_string(ptr_fmt));
-        return make_error_code(lief_errors::not_implemented);
-      }
-    default:
-      {
-        LIEF_ERR("Unknown pointer format: 0x{:04x}", seg_info.pointer_format);
-        return make_error_code(lief_errors::not_supported);
-      }
-  }
-  return ok();
-}
-
-
-/* ARM64E Fixup
- * =====================================
- */
-ok_error_t BinaryParser::do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                                          const details::dyld_chained_starts_in_segment& seg_info,
-                                          const details::dyld_chained_ptr_arm64e& fixup)
-{
-  static constexpr const char DPREFIX[] = "          ";
-  const auto ptr_fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format);
-  const uint64_t imagebase = binary_->imagebase();
-
-  const uint64_t address = imagebase + chain_offset;
-  if (fixup.auth_rebase.auth) {
-    if (fixup.auth_bind.bind) {
-      uint32_t bind_ordinal = ptr_fmt == DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24 ?
-                              fixup.auth_bind24.ordinal :
-                              fixup.auth_bind.ordinal;
-      if (bind_ordinal >= chained_fixups_->internal_bindings_.size()) {
-        LIEF_WARN("Out of range bind ordinal {} (max {})",
-                  bind_ordinal, chained_fixups_->internal_bindings_.size());
-        return make_error_code(lief_errors::read_error);
-      }
-      std::unique_ptr<ChainedBindingInfoList>& local_binding = chained_fixups_->internal_bindings_[bind_ordinal];
-      local_binding->segment_    = &segment;
-      local_binding->ptr_format_ = ptr_fmt;
-      local_binding->set(fixup.auth_bind);
-
-      chained_fixups_->all_bindings_.push_back(std::make_unique<ChainedBindingInfo>(*local_binding));
-      auto& binding_extra_info = chained_fixups_->all_bindings_.back();
-      copy_from(*binding_extra_info, *local_binding);
-
-      binding_extra_info->offset_ = chain_offset;
-      /*
-       * We use the BindingInfo::address_ to store the imagebase
-       * to avoid creating a new attribute in ChainedBindingInfo
-       */
-      binding_extra_info->address_ = imagebase;
-      local_binding->elements_.push_back(binding_extra_info.get());
-
-      if (Symbol* sym = binding_extra_info->symbol()) {
-        LIEF_DEBUG("{}[  BIND] {}@0x{:x}: {} / sign ext: {:x}",
-                   DPREFIX, segment.name(), address, sym->name(), fixup.sign_extended_addend());
-        return ok();
-      }
-      LIEF_DEBUG("{}[  BIND] {}@0x{:x}: <missing symbol> / sign ext: {:x}",
-                 DPREFIX, segment.name(), address, fixup.sign_extended_addend());
-      LIEF_ERR("Missing symbol for binding at ordinal {}", bind_ordinal);
-      return make_error_code(lief_errors::not_found);
-    }
-    const uint64_t target = imagebase + fixup.auth_rebase.target;
-
-    auto reloc = std::make_unique<RelocationFixup>(ptr_fmt, imagebase);
-    reloc->set(fixup.auth_rebase);
-    reloc->architecture_ = binary_->header().cpu_type();
-    reloc->segment_      = &segment;
-    reloc->size_         = stride_size(ptr_fmt) * BYTE_BITS;
-    reloc->offset_       = chain_offset;
-
-    if (Section* section = binary_->section_from_virtual_address(address)) {
-      reloc->section_ = section;
-    } else {
-      LIEF_ERR("Can't find the section associated with the virtual address 0x{:x}", address);
-    }
-
-    const auto it_symbol = memoized_symbols_by_address_.find(address);
-    if (it_symbol != memoized_symbols_by_address_.end()) {
-      reloc->symbol_ = it_symbol->second;
-    }
-
-    LIEF_DEBUG("{}[REBASE] {}@0x{:x}: 0x{:x}",
-               DPREFIX, segment.name(), address, target);
-
-    segment.relocations_.push_back(std::move(reloc));
-
-    return ok();
-  }
-
-  if (fixup.auth_bind.bind) {
-      uint32_t bind_ordinal = ptr_fmt == DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24 ?
-                              fixup.auth_bind24.ordinal :
-                              fixup.auth_bind.ordinal;
-
-      if (bind_ordinal >= chained_fixups_->internal_bindings_.size()) {
-        LIEF_WARN("Out of range bind ordinal {} (max {})",
-                  bind_ordinal, chained_fixups_->internal_bindings_.size());
-        return make_error_code(lief_errors::read_error);
-      }
-
-      std::unique_ptr<ChainedBindingInfoList>& local_binding = chained_fixups_->internal_bindings_[bind_ordinal];
-      local_binding->segment_    = &segment;
-      local_binding->ptr_format_ = ptr_fmt;
-      ptr_fmt == DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24 ?
-                 local_binding->set(fixup.auth_bind24) : local_binding->set(fixup.auth_bind);
-
-      chained_fixups_->all_bindings_.push_back(std::make_unique<ChainedBindingInfo>(*local_binding));
-      auto& binding_extra_info = chained_fixups_->all_bindings_.back();
-      copy_from(*binding_extra_info, *local_binding);
-
-      binding_extra_info->offset_ = chain_offset;
-      /*
-       * We use the BindingInfo::address_ to store the imagebase
-       * to avoid creating a new attribute in ChainedBindingInfo
-       */
-      binding_extra_info->address_ = imagebase;
-      local_binding->elements_.push_back(binding_extra_info.get());
-
-      if (Symbol* sym = binding_extra_info->symbol()) {
-        LIEF_DEBUG("{}[  BIND] {}@0x{:x}: {} / sign ext: {:x}",
-                   DPREFIX, segment.name(), address, sym->name(), fixup.sign_extended_addend());
-        return ok();
-      }
-
-      LIEF_DEBUG("{}[  BIND] {}@0x{:x}: <missing symbol> / sign ext: {:x}",
-                 DPREFIX, segment.name(), address, fixup.sign_extended_addend());
-      LIEF_ERR("Missing symbol for binding at ordinal {}", bind_ordinal);
-      return make_error_code(lief_errors::not_found);
-  }
-
-  // See comment for: dyld_chained_ptr_generic64
-  const uint64_t target = ptr_fmt == DYLD_CHAINED_PTR_FORMAT::PTR_64 ?
-                          fixup.unpack_target() :
-                          fixup.unpack_target() + imagebase;
-
-  auto reloc = std::make_unique<RelocationFixup>(ptr_fmt, imagebase);
-  reloc->set(fixup.rebase);
-  reloc->architecture_ = binary_->header().cpu_type();
-  reloc->segment_      = &segment;
-  reloc->size_         = stride_size(ptr_fmt) * BYTE_BITS;
-  reloc->offset_       = chain_offset;
-
-  if (Section* section = binary_->section_from_virtual_address(address)) {
-    reloc->section_ = section;
-  } else {
-    LIEF_ERR("Can't find the section associated with the virtual address 0x{:x}", address);
-  }
-
-  const auto it_symbol = memoized_symbols_by_address_.find(address);
-  if (it_symbol != memoized_symbols_by_address_.end()) {
-    reloc->symbol_ = it_symbol->second;
-  }
-
-  LIEF_DEBUG("{}[REBASE] {}@0x{:x}: 0x{:x}",
-             DPREFIX, segment.name(), address, target);
-
-  segment.relocations_.push_back(std::move(reloc));
-  return ok();
-}
-
-/* Generic64 Fixup
- * =====================================
- */
-ok_error_t BinaryParser::do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                                          const details::dyld_chained_starts_in_segment& seg_info,
-                                          const details::dyld_chained_ptr_generic64& fixup)
-{
-  static constexpr const char DPREFIX[] = "          ";
-  const auto ptr_fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format);
-  const uint64_t imagebase = binary_->imagebase();
-
-  const uint64_t address = imagebase + chain_offset;
-  if (fixup.bind.bind > 0) {
-    const uint64_t ordinal = fixup.bind.ordinal;
-    if (ordinal >= chained_fixups_->internal_bindings_.size()) {
-      LIEF_WARN("Out of range bind ordinal {} (max {})",
-                ordinal, chained_fixups_->internal_bindings_.size());
-      return make_error_code(lief_errors::read_error);
-    }
-
-    std::unique_ptr<ChainedBindingInfoList>& local_binding = chained_fixups_->internal_bindings_[ordinal];
-    local_binding->segment_    = &segment;
-    local_binding->ptr_format_ = ptr_fmt;
-    local_binding->set(fixup.bind);
-
-    chained_fixups_->all_bindings_.push_back(std::make_unique<ChainedBindingInfo>(*local_binding));
-    auto& binding_extra_info = chained_fixups_->all_bindings_.back();
-    copy_from(*binding_extra_info, *local_binding);
-
-    binding_extra_info->offset_ = chain_offset;
-    /*
-     * We use the BindingInfo::address_ to store the imagebase
-     * to avoid creating a new attribute in ChainedBindingInfo
-     */
-    binding_extra_info->address_ = imagebase;
-    local_binding->elements_.push_back(binding_extra_info.get());
-
-    if (Symbol* sym = binding_extra_info->symbol()) {
-      LIEF_DEBUG("{}[  BIND] {}@0x{:x}: {} / sign ext: {:x}",
-                 DPREFIX, segment.name(), address, sym->name(), fixup.sign_extended_addend());
-      return ok();
-    }
-    LIEF_DEBUG("{}[  BIND] {}@0x{:x}: <missing symbol> / sign ext: {:x}",
-               DPREFIX, segment.name(), address, fixup.sign_extended_addend());
-    LIEF_ERR("Missing symbol for binding at ordinal {}", ordinal);
-    return make_error_code(lief_errors::not_found);
-  }
-
-
-  // The fixup is a rebase.
-
-  /* In the dyld source code (MachOLoaded.cpp) there is
-   * a distinction between with DYLD_CHAINED_PTR_64:
-   *
-   *  // plain rebase (old format target is vmaddr, new format target is offset)
-   *  if ( segInfo->pointer_format == DYLD_CHAINED_PTR_64 )
-   *      newValue = (void*)(fixupLoc->generic64.unpackedTarget()+slide);
-   *  else
-   *      newValue = (void*)((uintptr_t)this + fixupLoc->generic64.unpackedTarget());
-   *
-   * Not sure if it really matters in our case
-   */
-  const uint64_t target = ptr_fmt == DYLD_CHAINED_PTR_FORMAT::PTR_64 ?
-                          fixup.unpack_target() :
-                          fixup.unpack_target() + imagebase;
-  auto reloc = std::make_unique<RelocationFixup>(ptr_fmt, imagebase);
-  reloc->set(fixup.rebase);
-  reloc->architecture_ = binary_->header().cpu_type();
-  reloc->segment_      = &segment;
-  reloc->size_         = stride_size(ptr_fmt) * BYTE_BITS;
-  reloc->offset_       = chain_offset;
-
-  if (Section* section = binary_->section_from_virtual_address(address)) {
-    reloc->section_ = section;
-  } else {
-    LIEF_ERR("Can't find the section associated with the virtual address 0x{:x}", address);
-  }
-
-  const auto it_symbol = memoized_symbols_by_address_.find(address);
-  if (it_symbol != memoized_symbols_by_address_.end()) {
-    reloc->symbol_ = it_symbol->second;
-  }
-
-  LIEF_DEBUG("{}[REBASE] {}@0x{:x}: 0x{:x}",
-             DPREFIX, segment.name(), address, target);
-
-  segment.relocations_.push_back(std::move(reloc));
-  return ok();
-}
-
-
-ok_error_t BinaryParser::do_chained_fixup(SegmentCommand& segment, uint32_t chain_offset,
-                                          const details::dyld_chained_starts_in_segment& seg_info,
-                                          const details::dyld_chained_ptr_generic32& fixup)
-{
-  static constexpr const char DPREFIX[] = "          ";
-  const auto ptr_fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(seg_info.pointer_format);
-  const uint64_t imagebase = binary_->imagebase();
-
-  const uint64_t address = imagebase + chain_offset;
-  if (fixup.bind.bind > 0) {
-    const uint64_t ordinal = fixup.bind.ordinal;
-
-    if (ordinal >= chained_fixups_->internal_bindings_.size()) {
-      LIEF_WARN("Out of range bind ordinal {} (max {})",
-                ordinal, chained_fixups_->internal_bindings_.size());
-      return make_error_code(lief_errors::read_error);
-    }
-
-    std::unique_ptr<ChainedBindingInfoList>& local_binding = chained_fixups_->internal_bindings_[ordinal];
-    local_binding->segment_    = &segment;
-    local_binding->ptr_format_ = ptr_fmt;
-    local_binding->set(fixup.bind);
-
-    chained_fixups_->all_bindings_.push_back(std::make_unique<ChainedBindingInfo>(*local_binding));
-    auto& binding_extra_info = chained_fixups_->all_bindings_.back();
-    copy_from(*binding_extra_info, *local_binding);
-
-    binding_extra_info->offset_ = chain_offset;
-    /*
-     * We use the BindingInfo::address_ to store the imagebase
-     * to avoid creating a new attribute in ChainedBindingInfo
-     */
-    binding_extra_info->address_ = imagebase;
-    local_binding->elements_.push_back(binding_extra_info.get());
-
-    if (Symbol* sym = binding_extra_info->symbol()) {
-      LIEF_DEBUG("{}[  BIND] {}@0x{:x}: {} / sign ext: {:x}",
-                 DPREFIX, segment.name(), address, sym->name(), fixup.bind.addend);
-      return ok();
-    }
-    LIEF_DEBUG("{}[  BIND] {}@0x{:x}: <missing symbol> / sign ext: {:x}",
-               DPREFIX, segment.name(), address, fixup.bind.addend);
-    LIEF_ERR("Missing symbol for binding at ordinal {}", ordinal);
-    return make_error_code(lief_errors::not_found);
-  }
-  // Rebase
-  std::unique_ptr<RelocationFixup> reloc;
-  if (fixup.rebase.target > seg_info.max_valid_pointer) {
-    const uint32_t bias = (0x04000000 + seg_info.max_valid_pointer) / 2;
-    const uint64_t target = fixup.rebase.target - bias;
-
-    /* This is used to avoid storing bias information */
-    const uint64_t fake_bias   = target - fixup.rebase.target;
-    const uint64_t fake_target = target - fake_bias;
-    details::dyld_chained_ptr_32_rebase fake_fixup = fixup.rebase;
-    fake_fixup.target = fake_target;
-    reloc = std::make_unique<RelocationFixup>(ptr_fmt, fake_bias);
-    reloc->set(fake_fixup);
-  } else {
-    reloc = std::make_unique<RelocationFixup>(ptr_fmt, imagebase);
-    reloc->set(fixup.rebase);
-  }
-
-  reloc->architecture_ = binary_->header().cpu_type();
-  reloc->segment_      = &segment;
-  reloc->size_         = stride_size(ptr_fmt) * BYTE_BITS;
-  reloc->offset_       = chain_offset;
-
-  if (Section* section = binary_->section_from_virtual_address(address)) {
-    reloc->section_ = section;
-  } else {
-    LIEF_ERR("Can't find the section associated with the virtual address 0x{:x}", address);
-  }
-
-  const auto it_symbol = memoized_symbols_by_address_.find(address);
-  if (it_symbol != memoized_symbols_by_address_.end()) {
-    reloc->symbol_ = it_symbol->second;
-  }
-
-  LIEF_DEBUG("{}[REBASE] {}@0x{:x}: 0x{:x}",
-             DPREFIX, segment.name(), address, reloc->target());
-
-  segment.relocations_.push_back(std::move(reloc));
-  return ok();
-}
-
-
 template<class MACHO_T>
 ok_error_t BinaryParser::post_process(SymbolCommand& cmd) {
   LIEF_DEBUG("[^] Post processing LC_SYMTAB");
@@ -3532,6 +3075,7 @@ ok_error_t BinaryParser::post_process(CodeSignature& cmd) {
   }
 
   cmd.content_ = content.subspan(rel_offset, cmd.data_size());
+  cmd.parse_code_directories();
 
   if (LinkEdit::segmentof(*linkedit)) {
     static_cast<LinkEdit*>(linkedit)->code_sig_ = &cmd;
@@ -3597,16 +3141,31 @@ ok_error_t BinaryParser::post_process(TwoLevelHints& cmd) {
   return ok();
 }
 
+template<class MACHO_T>
+ok_error_t BinaryParser::restore_dyldinfo_binds() {
+  // The bindings are replayed in the order of the dyld opcodes so that
+  // do_bind() creates the same symbols as the regular parsing
+  Binary::it_segments segments = binary_->segments();
+  for (const details::snapshot_binding_t& raw :
+       snapshot_->records<details::snapshot_binding_t>(details::SNAPSHOT_TABLES::BINDINGS))
+  {
+    do_bind<MACHO_T>(static_cast<BINDING_CLASS>(raw.binding_class), raw.type,
+                     raw.segment, raw.segment_offset, snapshot_->str(raw.name),
+                     raw.library_ordinal, raw.addend, raw.is_weak != 0,
+                     raw.is_non_weak_definition != 0, &segments, raw.offset);
+  }
+  return ok();
+}
 
-/* This method is needed since the C++ copy constructor of ChainedBindingInfo
- * does not (on purpose) copy the pointers associated with the object.
- * Thus we need this helper to maker sure that in the context on the parser,
- * the pointers are correctly copied.
- */
-void BinaryParser::copy_from(ChainedBindingInfo& to, ChainedBindingInfo& from) {
-  to.segment_ = from.segment_;
-  to.symbol_  = from.symbol_;
-  to.library_ = from.library_;
+template<class MACHO_T>
+ok_error_t BinaryParser::restore_dyldinfo_rebases() {
+  Binary::it_segments segments = binary_->segments();
+  for (const details::snapshot_rebase_t& raw :
+       snapshot_->records<details::snapshot_rebase_t>(details::SNAPSHOT_TABLES::REBASES))
+  {
+    do_rebase<MACHO_T>(raw.type, raw.segment, raw.segment_offset, &segments);
+  }
+  return ok();
 }
 
 }
@@ -22,8 +22,11 @@
 
 
 #include "LIEF/BinaryStream/BinaryStream.hpp"
+#include "LIEF/BinaryStream/SpanStream.hpp"
 
+#include "LIEF/OutputSink.hpp"
 #include "LIEF/MachO/Builder.hpp"
+#include "LIEF/MachO/CodeSignature.hpp"
 #include "LIEF/MachO/FatBinary.hpp"
 #include "LIEF/MachO/UUIDCommand.hpp"
 
@@ -120,6 +123,10 @@ ok_error_t Builder::build() {
   build_load_commands();
 
   build_header();
+
+  if (config_.code_signature_hashes) {
+    build_code_signature_hashes();
+  }
   return ok();
 }
 
@@ -275,6 +282,39 @@ ok_error_t Builder::build_uuid() {
   return ok();
 }
 
+ok_error_t Builder::build_code_signature_hashes() {
+  CodeSignature* sig = binary_->code_signature();
+  if (sig == nullptr) {
+    LIEF_DEBUG("[-] No code signature");
+    return ok();
+  }
+
+  // The LC_CODE_SIGNATURE command (with the final offset) has been written
+  // in original_data_ by build<T>(CodeSignature&)
+  if (sig->original_data_.size() < sizeof(details::linkedit_data_command)) {
+    return make_error_code(lief_errors::build_error);
+  }
+  details::linkedit_data_command raw_cmd;
+  std::memcpy(&raw_cmd, sig->original_data_.data(), sizeof(details::linkedit_data_command));
+
+  span<const uint8_t> content = sig->content();
+  std::vector<uint8_t>& raw = raw_.raw();
+  if (raw_cmd.datasize != content.size() || raw_cmd.dataoff > raw.size() ||
+      raw_cmd.dataoff + content.size() > raw.size())
+  {
+    LIEF_ERR("The LC_CODE_SIGNATURE is out of bounds of the rebuilt binary");
+    return make_error_code(lief_errors::build_error);
+  }
+
+  SpanStream stream(raw.data(), raw_cmd.dataoff);
+  if (auto res = sig->update_code_hashes(stream, raw_cmd.dataoff); !res) {
+    LIEF_WARN("Can't update the hashes of the code signature");
+    return make_error_code(res.error());
+  }
+  std::copy(content.begin(), content.end(), raw.begin() + raw_cmd.dataoff);
+  return ok();
+}
+
 const std::vector<uint8_t>& Builder::get_build() {
   return raw_.raw();
 }
@@ -303,6 +343,17 @@ ok_error_t Builder::write(Binary& binary, std::ostream& out, config_t config) {
   return ok();
 }
 
+ok_error_t Builder::write(Binary& binary, OutputSink& out) {
+  config_t config;
+  return write(binary, out, std::move(config));
+}
+
+ok_error_t Builder::write(Binary& binary, OutputSink& out, config_t config) {
+  Builder builder{binary, std::move(config)};
+  builder.build();
+  return builder.write(out);
+}
+
 ok_error_t Builder::write(Binary& binary, std::vector<uint8_t>& out) {
   config_t config;
   return write(binary, out, config);
@@ -373,6 +424,25 @@ ok_error_t Builder::write(FatBinary& fat, std::ostream& out, config_t config) {
   return ok();
 }
 
+ok_error_t Builder::write(FatBinary& fat, OutputSink& out) {
+  config_t config;
+  return write(fat, out, std::move(config));
+}
+
+ok_error_t Builder::write(FatBinary& fat, OutputSink& out, config_t config) {
+  std::vector<Binary*> binaries;
+  binaries.reserve(fat.binaries_.size());
+  std::transform(std::begin(fat.binaries_), std::end(fat.binaries_),
+                 std::back_inserter(binaries),
+                 [] (const std::unique_ptr<Binary>& bin) {
+                   return bin.get();
+                 });
+
+  Builder builder{std::move(binaries), std::move(config)};
+  builder.build_fat();
+  return builder.write(out);
+}
+
 std::vector<uint8_t> Builder::build_raw(Binary& binary, config_t config) {
   Builder builder{binary, std::move(config)};
   builder.build();
@@ -380,12 +450,12 @@ std::vector<uint8_t> Builder::build_raw(Binary& binary, config_t config) {
 }
 
 ok_error_t Builder::write(const std::string& filename) const {
-  std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
-  if (!output_file) {
+  auto sink = FileSink::open(filename);
+  if (!sink) {
     LIEF_ERR("Can't write back the LIEF Mach-O object into '{}'", filename);
     return make_error_code(lief_errors::build_error);
   }
-  return write(output_file);
+  return write(*sink);
 }
 
 ok_error_t Builder::write(std::ostream& os) const {
@@ -395,5 +465,13 @@ ok_error_t Builder::write(std::ostream& os) const {
   return ok();
 }
 
+ok_error_t Builder::write(OutputSink& sink) const {
+  const std::vector<uint8_t>& content = raw_.raw();
+  if (auto res = sink.write_sparse(0, content); !res) {
+    return res;
+  }
+  return sink.finalize(content.size());
+}
+
 }
 }
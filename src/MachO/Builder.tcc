@@ -1040,6 +1040,9 @@ ok_error_t Builder::build(DyldChainedFixups& fixups) {
    */
   LIEF_DEBUG("[->] Writing DyldChainedFixups");
 
+  // The encoding relies on the RelocationFixup / ChainedBindingInfo objects
+  fixups.create_objects();
+
   // First, we have to re-write the fixups
   if (!update_fixups<T>(fixups)) {
     LIEF_WARN("Error while re-writing chained fixups");
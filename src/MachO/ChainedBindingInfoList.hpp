@@ -23,11 +23,13 @@ namespace LIEF {
 namespace MachO {
 class BinaryParser;
 class Builder;
+class DyldChainedFixups;
 
 class ChainedBindingInfoList : public ChainedBindingInfo {
 
   friend class BinaryParser;
   friend class Builder;
+  friend class DyldChainedFixups;
 
   public:
   ChainedBindingInfoList() = delete;
@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstring>
+
 #include "logging.hpp"
 #include "LIEF/MachO/enums.hpp"
 #include "MachO/ChainedFixup.hpp"
@@ -119,6 +121,181 @@ bool chained_fixup::is_rebase(uint16_t ptr_format) const {
   }
 }
 
+namespace {
+using fixups_table_t = DyldChainedFixups::fixups_table_t;
+using KIND = fixups_table_t::KIND;
+
+// Read a value at the given (Mach-O) offset from a buffer that starts at
+// the offset ``base``
+template<class T>
+bool read_at(span<const uint8_t> content, uint64_t base, uint64_t offset, T& value) {
+  if (offset < base) {
+    return false;
+  }
+  offset -= base;
+  if (offset > content.size() || content.size() - offset < sizeof(T)) {
+    return false;
+  }
+  std::memcpy(&value, content.data() + offset, sizeof(T));
+  return true;
+}
+
+// Raw value of the fixup as stored in the table (fixups_table_t::raw)
+template<class T>
+uint64_t raw_value(const T& fixup) {
+  uint64_t raw = 0;
+  std::memcpy(&raw, &fixup, sizeof(T));
+  return raw;
+}
+
+// Mirror DyldChainedFixups::create_objects (and RelocationFixup::target)
+void decode(const dyld_chained_ptr_arm64e& fixup, DYLD_CHAINED_PTR_FORMAT fmt,
+            uint64_t offset, uint64_t imagebase, uint32_t segment,
+            fixups_table_t& table)
+{
+  const uint64_t raw = raw_value(fixup);
+  const bool is_24 = fmt == DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24;
+  if (fixup.auth_rebase.auth) {
+    if (fixup.auth_bind.bind) {
+      const uint32_t ordinal = is_24 ? fixup.auth_bind24.ordinal : fixup.auth_bind.ordinal;
+      table.push_back(offset, 0, KIND::AUTH_BIND, ordinal, 0, segment, raw);
+      return;
+    }
+    table.push_back(offset, imagebase + fixup.auth_rebase.target,
+                    KIND::AUTH_REBASE, 0, 0, segment, raw);
+    return;
+  }
+
+  if (fixup.bind.bind) {
+    const uint32_t ordinal = is_24 ? fixup.bind24.ordinal : fixup.bind.ordinal;
+    const uint64_t addend  = is_24 ? sign_extended_addend(fixup.bind24) :
+                                     sign_extended_addend(fixup.bind);
+    table.push_back(offset, 0, KIND::BIND, ordinal, static_cast<int64_t>(addend), segment, raw);
+    return;
+  }
+  table.push_back(offset, imagebase + fixup.unpack_target(), KIND::REBASE, 0, 0, segment, raw);
+}
+
+void decode(const dyld_chained_ptr_generic64& fixup, DYLD_CHAINED_PTR_FORMAT fmt,
+            uint64_t offset, uint64_t imagebase, uint32_t segment,
+            fixups_table_t& table)
+{
+  const uint64_t raw = raw_value(fixup);
+  if (fixup.bind.bind > 0) {
+    table.push_back(offset, 0, KIND::BIND, fixup.bind.ordinal,
+                    static_cast<int64_t>(fixup.sign_extended_addend()), segment, raw);
+    return;
+  }
+  const uint64_t target = fmt == DYLD_CHAINED_PTR_FORMAT::PTR_64 ?
+                          fixup.unpack_target() :
+                          fixup.unpack_target() + imagebase;
+  table.push_back(offset, target, KIND::REBASE, 0, 0, segment, raw);
+}
+
+void decode(const dyld_chained_ptr_generic32& fixup, uint32_t max_valid_pointer,
+            uint64_t offset, uint64_t imagebase, uint32_t segment,
+            fixups_table_t& table)
+{
+  const uint64_t raw = raw_value(fixup);
+  if (fixup.bind.bind > 0) {
+    table.push_back(offset, 0, KIND::BIND, fixup.bind.ordinal, fixup.bind.addend, segment, raw);
+    return;
+  }
+  if (fixup.rebase.target > max_valid_pointer) {
+    const uint32_t bias = (0x04000000 + max_valid_pointer) / 2;
+    table.push_back(offset, fixup.rebase.target - bias, KIND::REBASE, 0, 0, segment, raw);
+    return;
+  }
+  table.push_back(offset, imagebase + fixup.rebase.target, KIND::REBASE, 0, 0, segment, raw);
+}
+}
+
+ok_error_t decode_chain(span<const uint8_t> content, uint64_t content_offset,
+                        uint64_t imagebase, const chain_start_t& chain,
+                        fixups_table_t& table)
+{
+  const auto fmt = static_cast<DYLD_CHAINED_PTR_FORMAT>(chain.pointer_format);
+  const uint64_t stride = stride_size(fmt);
+  uint64_t offset = chain.offset;
+
+  switch (fmt) {
+    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
+      {
+        while (true) {
+          dyld_chained_ptr_arm64e fixup;
+          if (!read_at(content, content_offset, offset, fixup)) {
+            return make_error_code(lief_errors::read_error);
+          }
+          decode(fixup, fmt, offset, imagebase, chain.segment, table);
+          if (fixup.rebase.next == 0) {
+            return ok();
+          }
+          offset += fixup.rebase.next * stride;
+        }
+      }
+
+    case DYLD_CHAINED_PTR_FORMAT::PTR_64:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
+      {
+        while (true) {
+          dyld_chained_ptr_generic64 fixup;
+          if (!read_at(content, content_offset, offset, fixup)) {
+            return make_error_code(lief_errors::read_error);
+          }
+          decode(fixup, fmt, offset, imagebase, chain.segment, table);
+          if (fixup.rebase.next == 0) {
+            return ok();
+          }
+          offset += fixup.rebase.next * 4;
+        }
+      }
+
+    case DYLD_CHAINED_PTR_FORMAT::PTR_32:
+      {
+        dyld_chained_ptr_generic32 fixup;
+        if (!read_at(content, content_offset, offset, fixup)) {
+          return make_error_code(lief_errors::read_error);
+        }
+        while (true) {
+          decode(fixup, chain.max_valid_pointer, offset, imagebase, chain.segment, table);
+          if (fixup.rebase.next == 0) {
+            return ok();
+          }
+          offset += fixup.rebase.next * 4;
+          if (!read_at(content, content_offset, offset, fixup)) {
+            return ok();
+          }
+          // Skip the non-pointers (see: dyld's ChainedFixupPointerOnDisk)
+          while (fixup.rebase.bind == 0 && fixup.rebase.target > chain.max_valid_pointer) {
+            if (fixup.rebase.next == 0) {
+              return ok();
+            }
+            offset += fixup.rebase.next * 4;
+            if (!read_at(content, content_offset, offset, fixup)) {
+              return ok();
+            }
+          }
+        }
+      }
+
+    case DYLD_CHAINED_PTR_FORMAT::PTR_64_KERNEL_CACHE:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_X86_64_KERNEL_CACHE:
+    case DYLD_CHAINED_PTR_FORMAT::PTR_32_FIRMWARE:
+      {
+        return make_error_code(lief_errors::not_implemented);
+      }
+
+    default:
+      {
+        return make_error_code(lief_errors::not_supported);
+      }
+  }
+  return make_error_code(lief_errors::not_supported);
+}
+
 }
 }
 }
@@ -15,6 +15,11 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/MachO/enums.hpp"
+#include "LIEF/MachO/DyldChainedFixups.hpp"
+
 namespace LIEF {
 namespace MachO {
 namespace details {
@@ -273,6 +278,47 @@ union chained_fixup {
   bool is_rebase(uint16_t ptr_format) const;
 };
 
+inline uintptr_t stride_size(DYLD_CHAINED_PTR_FORMAT fmt) {
+  switch (fmt) {
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
+        return 8;
+
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_FIRMWARE:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_32_FIRMWARE:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_32:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_32_CACHE:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64_KERNEL_CACHE:
+          return 4;
+
+      case DYLD_CHAINED_PTR_FORMAT::PTR_X86_64_KERNEL_CACHE:
+          return 1;
+  }
+  return 0;
+}
+
+//! Start of a chain with the information of the segment it belongs to
+struct chain_start_t {
+  uint64_t offset            = 0;
+  uint32_t segment           = 0;
+  uint32_t max_valid_pointer = 0;
+  uint16_t pointer_format    = 0;
+};
+
+//! Decode the fixups of the given chain and append them to ``table``.
+//!
+//! ``content`` is the data located at the offset ``content_offset`` of the
+//! Mach-O (it must cover the segment of the chain). This function only
+//! reads ``content`` so that different chains can be decoded concurrently
+//! (in different tables).
+ok_error_t decode_chain(span<const uint8_t> content, uint64_t content_offset,
+                        uint64_t imagebase, const chain_start_t& chain,
+                        DyldChainedFixups::fixups_table_t& table);
+
 } // Namespace details
 } // Namespace MachO
 } // Namespace LIEF
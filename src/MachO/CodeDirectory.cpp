@@ -0,0 +1,295 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+#include "logging.hpp"
+#include "parallel.hpp"
+#include "hash_stream.hpp"
+
+#include "LIEF/utils.hpp"
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+#include "LIEF/MachO/CodeDirectory.hpp"
+#include "LIEF/MachO/EnumToString.hpp"
+
+#include "MachO/CodeSignatureBlobs.hpp"
+
+namespace LIEF {
+namespace MachO {
+
+// Number of bytes read (and hashed in parallel) at once when the stream
+// is not backed by a contiguous buffer
+static constexpr uint64_t HASH_WINDOW_SIZE = 16 * 1024 * 1024;
+
+// Minimum number of pages processed by a thread
+static constexpr size_t HASH_GRAIN = 64;
+
+CodeDirectory::CodeDirectory() = default;
+CodeDirectory::CodeDirectory(const CodeDirectory&) = default;
+CodeDirectory& CodeDirectory::operator=(const CodeDirectory&) = default;
+CodeDirectory::~CodeDirectory() = default;
+
+static uint8_t digest_size(CodeDirectory::HASH_TYPES type) {
+  switch (type) {
+    case CodeDirectory::HASH_TYPES::SHA1:
+    case CodeDirectory::HASH_TYPES::SHA256_TRUNCATED:
+      return 20;
+    case CodeDirectory::HASH_TYPES::SHA256:
+      return 32;
+    case CodeDirectory::HASH_TYPES::SHA384:
+      return 48;
+    case CodeDirectory::HASH_TYPES::NONE:
+      return 0;
+  }
+  return 0;
+}
+
+static std::string read_cstring(span<const uint8_t> blob, uint32_t offset) {
+  if (offset == 0 || offset >= blob.size()) {
+    return "";
+  }
+  const auto* start = reinterpret_cast<const char*>(blob.data() + offset);
+  const auto* end   = reinterpret_cast<const char*>(blob.data() + blob.size());
+  return std::string(start, std::find(start, end, '\0'));
+}
+
+result<CodeDirectory> CodeDirectory::parse(span<const uint8_t> blob) {
+  using namespace details::cs;
+  if (blob.size() < CD_MIN_SIZE || read_be32(blob, 0) != CSMAGIC_CODEDIRECTORY) {
+    LIEF_DEBUG("Not a CodeDirectory blob");
+    return make_error_code(lief_errors::file_format_error);
+  }
+
+  const uint32_t length = read_be32(blob, 4);
+  if (length < CD_MIN_SIZE || length > blob.size()) {
+    LIEF_WARN("CodeDirectory: wrong length (0x{:x})", length);
+    return make_error_code(lief_errors::corrupted);
+  }
+  blob = blob.subspan(0, length);
+
+  CodeDirectory cd;
+  cd.version_          = read_be32(blob, CD_VERSION);
+  cd.flags_            = read_be32(blob, CD_FLAGS);
+  cd.hash_offset_      = read_be32(blob, CD_HASH_OFFSET);
+  cd.nb_special_slots_ = read_be32(blob, CD_NB_SPECIAL_SLOTS);
+  cd.nb_code_slots_    = read_be32(blob, CD_NB_CODE_SLOTS);
+  cd.code_limit_       = read_be32(blob, CD_CODE_LIMIT);
+  cd.hash_size_        = blob[CD_HASH_SIZE];
+  cd.hash_type_        = static_cast<HASH_TYPES>(blob[CD_HASH_TYPE]);
+  cd.platform_         = blob[CD_PLATFORM];
+  cd.page_size_log2_   = blob[CD_PAGE_SIZE];
+  cd.identifier_       = read_cstring(blob, read_be32(blob, CD_IDENT_OFFSET));
+
+  if (cd.version_ >= CD_VERSION_TEAM_ID && blob.size() >= CD_TEAM_OFFSET + sizeof(uint32_t)) {
+    cd.team_id_ = read_cstring(blob, read_be32(blob, CD_TEAM_OFFSET));
+  }
+
+  if (cd.version_ >= CD_VERSION_CODE_LIMIT64 && blob.size() >= CD_CODE_LIMIT64 + sizeof(uint64_t)) {
+    cd.has_code_limit64_ = true;
+    if (const uint64_t limit64 = read_be64(blob, CD_CODE_LIMIT64)) {
+      cd.code_limit_ = limit64;
+    }
+  }
+
+  if (cd.version_ >= CD_VERSION_EXEC_SEG && blob.size() >= CD_EXEC_SEG_FLAGS + sizeof(uint64_t)) {
+    cd.exec_seg_base_  = read_be64(blob, CD_EXEC_SEG_BASE);
+    cd.exec_seg_limit_ = read_be64(blob, CD_EXEC_SEG_LIMIT);
+    cd.exec_seg_flags_ = read_be64(blob, CD_EXEC_SEG_FLAGS);
+  }
+
+  if (cd.hash_size_ == 0 || cd.hash_size_ != digest_size(cd.hash_type_)) {
+    LIEF_WARN("CodeDirectory: unsupported hash type ({}) / size ({})",
+              static_cast<uint32_t>(cd.hash_type_), cd.hash_size_);
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  if (cd.page_size_log2_ >= 32) {
+    LIEF_WARN("CodeDirectory: wrong page size (2^{})", cd.page_size_log2_);
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  const uint64_t special_size = uint64_t(cd.nb_special_slots_) * cd.hash_size_;
+  const uint64_t code_size    = uint64_t(cd.nb_code_slots_) * cd.hash_size_;
+  if (special_size > cd.hash_offset_ || cd.hash_offset_ + code_size > blob.size()) {
+    LIEF_WARN("CodeDirectory: the slots are out of bounds");
+    return make_error_code(lief_errors::corrupted);
+  }
+
+  const uint64_t expected_slots = align(cd.code_limit_, cd.page_size()) / std::max<uint64_t>(cd.page_size(), 1);
+  if (cd.nb_code_slots_ != expected_slots) {
+    LIEF_WARN("CodeDirectory: {} code slots for a code limit of 0x{:x} (expecting {})",
+              cd.nb_code_slots_, cd.code_limit_, expected_slots);
+  }
+
+  const uint8_t* slots = blob.data() + cd.hash_offset_ - special_size;
+  cd.slots_.assign(slots, slots + special_size + code_size);
+  return cd;
+}
+
+uint64_t CodeDirectory::page_size(uint64_t code_limit) const {
+  return page_size_log2_ == 0 ? code_limit : uint64_t(1) << page_size_log2_;
+}
+
+uint64_t CodeDirectory::page_size() const {
+  return page_size(code_limit_);
+}
+
+span<const uint8_t> CodeDirectory::code_hash(uint32_t page) const {
+  if (page >= nb_code_slots_) {
+    return {};
+  }
+  const size_t offset = (size_t(nb_special_slots_) + page) * hash_size_;
+  return {slots_.data() + offset, hash_size_};
+}
+
+span<const uint8_t> CodeDirectory::special_hash(SPECIAL_SLOTS slot) const {
+  const auto idx = static_cast<uint32_t>(slot);
+  if (idx == 0 || idx > nb_special_slots_) {
+    return {};
+  }
+  const size_t offset = size_t(nb_special_slots_ - idx) * hash_size_;
+  return {slots_.data() + offset, hash_size_};
+}
+
+std::vector<uint8_t> CodeDirectory::hash(span<const uint8_t> data) const {
+  hashstream::HASH algo = hashstream::HASH::SHA256;
+  switch (hash_type_) {
+    case HASH_TYPES::SHA1:   algo = hashstream::HASH::SHA1;   break;
+    case HASH_TYPES::SHA384: algo = hashstream::HASH::SHA384; break;
+    case HASH_TYPES::SHA256:
+    case HASH_TYPES::SHA256_TRUNCATED:
+    case HASH_TYPES::NONE:
+      break;
+  }
+  hashstream hs(algo);
+  hs.write(data.data(), data.size());
+  std::vector<uint8_t> output = std::move(hs.raw());
+  output.resize(hash_size_);
+  return output;
+}
+
+result<std::vector<uint8_t>>
+CodeDirectory::compute_hashes(BinaryStream& stream, uint64_t code_limit) const {
+  const uint64_t psize = page_size(code_limit);
+  if (psize == 0) {
+    return std::vector<uint8_t>{};
+  }
+  if (code_limit > stream.size()) {
+    LIEF_ERR("The code limit (0x{:x}) is beyond the end of the file (0x{:x})",
+             code_limit, stream.size());
+    return make_error_code(lief_errors::read_out_of_bound);
+  }
+
+  const uint64_t nb_pages = align(code_limit, psize) / psize;
+  std::vector<uint8_t> hashes(nb_pages * hash_size_);
+
+  // Hash the pages of [start, start + size) which is located at
+  // ``data`` in memory.
+  const auto hash_range = [&] (const uint8_t* data, uint64_t start, uint64_t size) {
+    const uint64_t first = start / psize;
+    const size_t count = align(size, psize) / psize;
+    parallel::for_each_chunk(count, parallel::nb_chunks(count, HASH_GRAIN),
+      [&] (size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          const uint64_t offset = i * psize;
+          const uint64_t len = std::min(psize, size - offset);
+          const std::vector<uint8_t> digest = hash({data + offset, static_cast<size_t>(len)});
+          std::copy(digest.begin(), digest.end(), hashes.begin() + (first + i) * hash_size_);
+        }
+      });
+  };
+
+  if (const uint8_t* start = stream.contiguous_start()) {
+    hash_range(start, 0, code_limit);
+    return hashes;
+  }
+
+  const uint64_t window = std::max(psize, HASH_WINDOW_SIZE - HASH_WINDOW_SIZE % psize);
+  std::vector<uint8_t> buffer;
+  for (uint64_t offset = 0; offset < code_limit; offset += window) {
+    const uint64_t size = std::min(window, code_limit - offset);
+    if (!stream.peek_data(buffer, offset, size)) {
+      LIEF_ERR("Can't read the content at 0x{:x}", offset);
+      return make_error_code(lief_errors::read_error);
+    }
+    hash_range(buffer.data(), offset, size);
+  }
+  return hashes;
+}
+
+result<std::vector<uint32_t>> CodeDirectory::verify(BinaryStream& stream) const {
+  auto hashes = compute_hashes(stream, code_limit_);
+  if (!hashes) {
+    return make_error_code(hashes.error());
+  }
+
+  std::vector<uint32_t> mismatches;
+  const size_t nb_pages = hashes->size() / std::max<size_t>(hash_size_, 1);
+  for (size_t i = 0; i < std::max<size_t>(nb_pages, nb_code_slots_); ++i) {
+    span<const uint8_t> expected = code_hash(i);
+    if (i >= nb_pages || expected.empty() ||
+        std::memcmp(expected.data(), hashes->data() + i * hash_size_, hash_size_) != 0)
+    {
+      mismatches.push_back(i);
+    }
+  }
+  return mismatches;
+}
+
+ok_error_t CodeDirectory::update(BinaryStream& stream, uint64_t code_limit) {
+  const uint64_t psize = page_size(code_limit);
+  const uint64_t nb_pages = psize == 0 ? 0 : align(code_limit, psize) / psize;
+  if (nb_pages != nb_code_slots_) {
+    LIEF_ERR("The new code limit (0x{:x}) requires {} code slots while the "
+             "CodeDirectory has {} slots", code_limit, nb_pages, nb_code_slots_);
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  if (!has_code_limit64_ && code_limit > UINT32_MAX) {
+    LIEF_ERR("The code limit 0x{:x} can't be encoded in this CodeDirectory", code_limit);
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  auto hashes = compute_hashes(stream, code_limit);
+  if (!hashes) {
+    return make_error_code(hashes.error());
+  }
+  const size_t special_size = size_t(nb_special_slots_) * hash_size_;
+  std::copy(hashes->begin(), hashes->end(), slots_.begin() + special_size);
+  code_limit_ = code_limit;
+  return ok();
+}
+
+std::ostream& operator<<(std::ostream& os, const CodeDirectory& cd) {
+  os << std::hex << std::left;
+  os << std::setw(18) << "Identifier"    << ": " << cd.identifier() << '\n';
+  if (!cd.team_id().empty()) {
+    os << std::setw(18) << "Team ID"     << ": " << cd.team_id() << '\n';
+  }
+  os << std::setw(18) << "Slot type"     << ": 0x" << cd.slot_type() << '\n'
+     << std::setw(18) << "Version"       << ": 0x" << cd.version() << '\n'
+     << std::setw(18) << "Flags"         << ": 0x" << cd.flags() << '\n'
+     << std::setw(18) << "Hash type"     << ": " << to_string(cd.hash_type()) << '\n'
+     << std::setw(18) << "Page size"     << ": 0x" << cd.page_size() << '\n'
+     << std::setw(18) << "Code limit"    << ": 0x" << cd.code_limit() << '\n'
+     << std::setw(18) << "Code slots"    << ": " << std::dec << cd.nb_code_slots() << '\n'
+     << std::setw(18) << "Special slots" << ": " << cd.nb_special_slots() << '\n';
+  return os;
+}
+
+}
+}
@@ -15,10 +15,13 @@
  */
 #include <iomanip>
 
+#include "logging.hpp"
+
 #include "LIEF/MachO/hash.hpp"
 
 #include "LIEF/MachO/CodeSignature.hpp"
 #include "MachO/Structures.hpp"
+#include "MachO/CodeSignatureBlobs.hpp"
 
 namespace LIEF {
 namespace MachO {
@@ -54,6 +57,73 @@ void CodeSignature::data_offset(uint32_t offset) {
 void CodeSignature::data_size(uint32_t size) {
   data_size_ = size;
 }
+void CodeSignature::parse_code_directories() {
+  using namespace details::cs;
+  code_directories_.clear();
+  span<const uint8_t> content = content_;
+  if (content.size() < SUPERBLOB_HEADER_SIZE ||
+      read_be32(content, 0) != CSMAGIC_EMBEDDED_SIGNATURE)
+  {
+    LIEF_DEBUG("LC_CODE_SIGNATURE: no embedded signature SuperBlob");
+    return;
+  }
+
+  const uint32_t count = read_be32(content, 8);
+  if (count > (content.size() - SUPERBLOB_HEADER_SIZE) / BLOB_INDEX_SIZE) {
+    LIEF_WARN("LC_CODE_SIGNATURE: too many blobs ({})", count);
+    return;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const size_t index = SUPERBLOB_HEADER_SIZE + i * BLOB_INDEX_SIZE;
+    const uint32_t type   = read_be32(content, index);
+    const uint32_t offset = read_be32(content, index + sizeof(uint32_t));
+    if (!is_code_directory_slot(type)) {
+      continue;
+    }
+    if (offset >= content.size()) {
+      LIEF_WARN("LC_CODE_SIGNATURE: CodeDirectory #{} is out of bounds", i);
+      continue;
+    }
+    auto cd = CodeDirectory::parse(content.subspan(offset));
+    if (!cd) {
+      LIEF_WARN("LC_CODE_SIGNATURE: can't parse the CodeDirectory #{}", i);
+      continue;
+    }
+    cd->slot_type_ = type;
+    cd->offset_    = offset;
+    code_directories_.push_back(std::move(*cd));
+  }
+}
+
+ok_error_t CodeSignature::update_code_hashes(BinaryStream& stream) {
+  return update_code_hashes(stream, data_offset());
+}
+
+ok_error_t CodeSignature::update_code_hashes(BinaryStream& stream, uint64_t code_limit) {
+  using namespace details::cs;
+  for (CodeDirectory& cd : code_directories_) {
+    if (auto res = cd.update(stream, code_limit); !res) {
+      return make_error_code(res.error());
+    }
+    span<uint8_t> blob = content_.subspan(cd.offset());
+    const size_t special_size = size_t(cd.nb_special_slots()) * cd.hash_size();
+    std::copy(cd.slots_.begin() + special_size, cd.slots_.end(),
+              blob.begin() + cd.hash_offset_);
+
+    if (cd.has_code_limit64_ && code_limit > UINT32_MAX) {
+      write_be32(blob, CD_CODE_LIMIT, 0);
+      write_be64(blob, CD_CODE_LIMIT64, code_limit);
+    } else {
+      write_be32(blob, CD_CODE_LIMIT, static_cast<uint32_t>(code_limit));
+      if (cd.has_code_limit64_) {
+        write_be64(blob, CD_CODE_LIMIT64, 0);
+      }
+    }
+  }
+  return ok();
+}
+
 void CodeSignature::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
@@ -75,6 +145,9 @@ std::ostream& CodeSignature::print(std::ostream& os) const {
   os << "Code Signature location:" << std::endl;
   os << std::setw(8) << "Offset" << ": 0x" << data_offset() << std::endl;
   os << std::setw(8) << "Size"   << ": 0x" << data_size()   << std::endl;
+  for (const CodeDirectory& cd : code_directories()) {
+    os << std::endl << cd;
+  }
   return os;
 }
 
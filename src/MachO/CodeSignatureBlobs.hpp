@@ -0,0 +1,100 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MACHO_CODE_SIGNATURE_BLOBS_H
+#define LIEF_MACHO_CODE_SIGNATURE_BLOBS_H
+#include <cstdint>
+#include <cstddef>
+
+#include "LIEF/span.hpp"
+
+// Layout of the (big-endian) blobs referenced by LC_CODE_SIGNATURE.
+// See xnu: osfmk/kern/cs_blobs.h
+namespace LIEF {
+namespace MachO {
+namespace details {
+namespace cs {
+
+static constexpr uint32_t CSMAGIC_EMBEDDED_SIGNATURE = 0xfade0cc0;
+static constexpr uint32_t CSMAGIC_CODEDIRECTORY      = 0xfade0c02;
+
+// SuperBlob: magic, length, count and then ``count`` {type, offset}
+static constexpr size_t SUPERBLOB_HEADER_SIZE = 3 * sizeof(uint32_t);
+static constexpr size_t BLOB_INDEX_SIZE       = 2 * sizeof(uint32_t);
+
+static constexpr uint32_t CSSLOT_CODEDIRECTORY                 = 0;
+static constexpr uint32_t CSSLOT_ALTERNATE_CODEDIRECTORIES     = 0x1000;
+static constexpr uint32_t CSSLOT_ALTERNATE_CODEDIRECTORY_LIMIT = 0x1005;
+
+// Offsets of the CodeDirectory's fields
+static constexpr size_t CD_VERSION          = 8;
+static constexpr size_t CD_FLAGS            = 12;
+static constexpr size_t CD_HASH_OFFSET      = 16;
+static constexpr size_t CD_IDENT_OFFSET     = 20;
+static constexpr size_t CD_NB_SPECIAL_SLOTS = 24;
+static constexpr size_t CD_NB_CODE_SLOTS    = 28;
+static constexpr size_t CD_CODE_LIMIT       = 32;
+static constexpr size_t CD_HASH_SIZE        = 36;
+static constexpr size_t CD_HASH_TYPE        = 37;
+static constexpr size_t CD_PLATFORM         = 38;
+static constexpr size_t CD_PAGE_SIZE        = 39;
+static constexpr size_t CD_TEAM_OFFSET      = 48;
+static constexpr size_t CD_CODE_LIMIT64     = 56;
+static constexpr size_t CD_EXEC_SEG_BASE    = 64;
+static constexpr size_t CD_EXEC_SEG_LIMIT   = 72;
+static constexpr size_t CD_EXEC_SEG_FLAGS   = 80;
+
+// Size of the fields present in all the versions (up to spare2)
+static constexpr size_t CD_MIN_SIZE = 44;
+
+static constexpr uint32_t CD_VERSION_TEAM_ID      = 0x20200;
+static constexpr uint32_t CD_VERSION_CODE_LIMIT64 = 0x20300;
+static constexpr uint32_t CD_VERSION_EXEC_SEG     = 0x20400;
+
+// The callers are expected to check the bounds
+inline uint32_t read_be32(span<const uint8_t> data, size_t offset) {
+  const uint8_t* p = data.data() + offset;
+  return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+         (uint32_t(p[2]) << 8)  |  uint32_t(p[3]);
+}
+
+inline uint64_t read_be64(span<const uint8_t> data, size_t offset) {
+  return (uint64_t(read_be32(data, offset)) << 32) | read_be32(data, offset + 4);
+}
+
+inline void write_be32(span<uint8_t> data, size_t offset, uint32_t value) {
+  uint8_t* p = data.data() + offset;
+  p[0] = value >> 24;
+  p[1] = value >> 16;
+  p[2] = value >> 8;
+  p[3] = value;
+}
+
+inline void write_be64(span<uint8_t> data, size_t offset, uint64_t value) {
+  write_be32(data, offset, value >> 32);
+  write_be32(data, offset + 4, value & 0xffffffff);
+}
+
+inline bool is_code_directory_slot(uint32_t type) {
+  return type == CSSLOT_CODEDIRECTORY ||
+         (CSSLOT_ALTERNATE_CODEDIRECTORIES <= type &&
+          type < CSSLOT_ALTERNATE_CODEDIRECTORY_LIMIT);
+}
+
+}
+}
+}
+}
+#endif
@@ -13,7 +13,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "logging.hpp"
 #include "spdlog/fmt/fmt.h"
+#include "LIEF/MachO/Binary.hpp"
 #include "LIEF/MachO/DyldChainedFixups.hpp"
 #include "LIEF/MachO/ChainedBindingInfo.hpp"
 #include "LIEF/MachO/hash.hpp"
@@ -43,7 +49,8 @@ DyldChainedFixups& DyldChainedFixups::operator=(const DyldChainedFixups& other)
 DyldChainedFixups::DyldChainedFixups(const DyldChainedFixups& other) :
   LoadCommand::LoadCommand(other),
   data_offset_{other.data_offset_},
-  data_size_{other.data_size_}
+  data_size_{other.data_size_},
+  fixups_{other.fixups_}
 {}
 
 DyldChainedFixups::DyldChainedFixups(const details::linkedit_data_command& cmd) :
@@ -63,6 +70,49 @@ void DyldChainedFixups::update_with(const details::dyld_chained_fixups_header& h
   imports_format_  = static_cast<DYLD_CHAINED_FORMAT>(header.imports_format);
 }
 
+void DyldChainedFixups::fixups_table_t::reserve(size_t size) {
+  offset.reserve(size);
+  target.reserve(size);
+  kind.reserve(size);
+  ordinal.reserve(size);
+  addend.reserve(size);
+  segment.reserve(size);
+  raw.reserve(size);
+}
+
+void DyldChainedFixups::fixups_table_t::clear() {
+  offset.clear();
+  target.clear();
+  kind.clear();
+  ordinal.clear();
+  addend.clear();
+  segment.clear();
+  raw.clear();
+}
+
+void DyldChainedFixups::fixups_table_t::push_back(uint64_t off, uint64_t tgt, KIND k,
+                                                  uint32_t ord, int64_t add, uint32_t seg,
+                                                  uint64_t value)
+{
+  offset.push_back(off);
+  target.push_back(tgt);
+  kind.push_back(k);
+  ordinal.push_back(ord);
+  addend.push_back(add);
+  segment.push_back(seg);
+  raw.push_back(value);
+}
+
+void DyldChainedFixups::fixups_table_t::append(const fixups_table_t& other) {
+  offset.insert(offset.end(),   other.offset.begin(),  other.offset.end());
+  target.insert(target.end(),   other.target.begin(),  other.target.end());
+  kind.insert(kind.end(),       other.kind.begin(),    other.kind.end());
+  ordinal.insert(ordinal.end(), other.ordinal.begin(), other.ordinal.end());
+  addend.insert(addend.end(),   other.addend.begin(),  other.addend.end());
+  segment.insert(segment.end(), other.segment.begin(), other.segment.end());
+  raw.insert(raw.end(),         other.raw.begin(),     other.raw.end());
+}
+
 uint32_t DyldChainedFixups::data_offset() const {
   return data_offset_;
 }
@@ -82,6 +132,208 @@ DyldChainedFixups* DyldChainedFixups::clone() const {
   return new DyldChainedFixups(*this);
 }
 
+DyldChainedFixups::it_binding_info DyldChainedFixups::bindings() {
+  create_objects();
+  return all_bindings_;
+}
+
+DyldChainedFixups::it_const_binding_info DyldChainedFixups::bindings() const {
+  create_objects();
+  return all_bindings_;
+}
+
+void DyldChainedFixups::create_objects() const {
+  static constexpr uint8_t BYTE_BITS = std::numeric_limits<uint8_t>::digits;
+  using KIND = fixups_table_t::KIND;
+  std::lock_guard<std::mutex> lock(objects_lock_);
+  if (binary_ == nullptr) {
+    return;
+  }
+  Binary& binary = *binary_;
+  binary_ = nullptr;
+  for (const fixups_segment_t& info : fixups_segments_) {
+    if (info.segment != nullptr) {
+      info.segment->chained_fixups_ = nullptr;
+    }
+  }
+
+  const uint64_t imagebase = binary.imagebase();
+  const CPU_TYPES arch = binary.header().cpu_type();
+
+  std::unordered_map<uint64_t, Symbol*> symbols_by_address;
+  for (Symbol& sym : binary.symbols()) {
+    if (sym.origin() == SYMBOL_ORIGINS::SYM_ORIGIN_LC_SYMTAB) {
+      symbols_by_address[sym.value()] = &sym;
+    }
+  }
+
+  const auto set_bind = [] (ChainedBindingInfo& info, DYLD_CHAINED_PTR_FORMAT fmt,
+                            uint64_t raw)
+  {
+    switch (fmt) {
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
+        {
+          const bool is_24 = fmt == DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24;
+          details::dyld_chained_ptr_arm64e fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          if (fixup.auth_bind.auth) {
+            is_24 ? info.set(fixup.auth_bind24) : info.set(fixup.auth_bind);
+          } else {
+            is_24 ? info.set(fixup.bind24) : info.set(fixup.bind);
+          }
+          return;
+        }
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
+        {
+          details::dyld_chained_ptr_generic64 fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          info.set(fixup.bind);
+          return;
+        }
+      case DYLD_CHAINED_PTR_FORMAT::PTR_32:
+        {
+          details::dyld_chained_ptr_generic32 fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          info.set(fixup.bind);
+          return;
+        }
+      default:
+        return;
+    }
+  };
+
+  const auto make_rebase = [imagebase] (DYLD_CHAINED_PTR_FORMAT fmt, uint64_t raw,
+                                        uint32_t max_valid_pointer)
+    -> std::unique_ptr<RelocationFixup>
+  {
+    switch (fmt) {
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_KERNEL:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_ARM64E_USERLAND24:
+        {
+          details::dyld_chained_ptr_arm64e fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          auto reloc = std::make_unique<RelocationFixup>(fmt, imagebase);
+          fixup.auth_rebase.auth ? reloc->set(fixup.auth_rebase) : reloc->set(fixup.rebase);
+          return reloc;
+        }
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64:
+      case DYLD_CHAINED_PTR_FORMAT::PTR_64_OFFSET:
+        {
+          details::dyld_chained_ptr_generic64 fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          auto reloc = std::make_unique<RelocationFixup>(fmt, imagebase);
+          reloc->set(fixup.rebase);
+          return reloc;
+        }
+      case DYLD_CHAINED_PTR_FORMAT::PTR_32:
+        {
+          details::dyld_chained_ptr_generic32 fixup;
+          std::memcpy(&fixup, &raw, sizeof(fixup));
+          if (fixup.rebase.target <= max_valid_pointer) {
+            auto reloc = std::make_unique<RelocationFixup>(fmt, imagebase);
+            reloc->set(fixup.rebase);
+            return reloc;
+          }
+          const uint32_t bias = (0x04000000 + max_valid_pointer) / 2;
+          const uint64_t target = fixup.rebase.target - bias;
+
+          /* This is used to avoid storing bias information */
+          const uint64_t fake_bias   = target - fixup.rebase.target;
+          const uint64_t fake_target = target - fake_bias;
+          details::dyld_chained_ptr_32_rebase fake_fixup = fixup.rebase;
+          fake_fixup.target = fake_target;
+          auto reloc = std::make_unique<RelocationFixup>(fmt, fake_bias);
+          reloc->set(fake_fixup);
+          return reloc;
+        }
+      default:
+        return nullptr;
+    }
+  };
+
+  for (size_t i = 0; i < fixups_.size(); ++i) {
+    const uint32_t seg_idx = fixups_.segment[i];
+    if (seg_idx >= fixups_segments_.size() || fixups_segments_[seg_idx].segment == nullptr) {
+      LIEF_WARN("Chained fixup at offset 0x{:x}: missing segment #{}", fixups_.offset[i], seg_idx);
+      continue;
+    }
+    const fixups_segment_t& info = fixups_segments_[seg_idx];
+    SegmentCommand& segment = *info.segment;
+    const uint64_t offset  = fixups_.offset[i];
+    const uint64_t address = imagebase + offset;
+    const KIND kind = fixups_.kind[i];
+
+    if (kind == KIND::BIND || kind == KIND::AUTH_BIND) {
+      const uint32_t ordinal = fixups_.ordinal[i];
+      if (ordinal >= internal_bindings_.size()) {
+        LIEF_WARN("Out of range bind ordinal {} (max {})", ordinal, internal_bindings_.size());
+        continue;
+      }
+      ChainedBindingInfoList& local_binding = *internal_bindings_[ordinal];
+      local_binding.segment_    = &segment;
+      local_binding.ptr_format_ = info.pointer_format;
+      set_bind(local_binding, info.pointer_format, fixups_.raw[i]);
+
+      /* The copy constructor of ChainedBindingInfo does not (on purpose)
+       * copy the pointers associated with the object
+       */
+      auto binding = std::make_unique<ChainedBindingInfo>(local_binding);
+      binding->segment_ = local_binding.segment_;
+      binding->symbol_  = local_binding.symbol_;
+      binding->library_ = local_binding.library_;
+      binding->offset_  = offset;
+      /*
+       * We use the BindingInfo::address_ to store the imagebase
+       * to avoid creating a new attribute in ChainedBindingInfo
+       */
+      binding->address_ = imagebase;
+      local_binding.elements_.push_back(binding.get());
+
+      if (const Symbol* sym = binding->symbol()) {
+        LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "[  BIND] {}@0x{:x}: {}",
+                       segment.name(), address, sym->name());
+      } else {
+        LIEF_ERR("Missing symbol for binding at ordinal {}", ordinal);
+      }
+      all_bindings_.push_back(std::move(binding));
+      continue;
+    }
+
+    std::unique_ptr<RelocationFixup> reloc =
+      make_rebase(info.pointer_format, fixups_.raw[i], info.max_valid_pointer);
+    if (reloc == nullptr) {
+      LIEF_WARN("Chained fixup at offset 0x{:x}: unsupported format {}",
+                offset, to_string(info.pointer_format));
+      continue;
+    }
+    reloc->architecture_ = arch;
+    reloc->segment_      = &segment;
+    reloc->size_         = details::stride_size(info.pointer_format) * BYTE_BITS;
+    reloc->offset_       = offset;
+
+    if (Section* section = binary.section_from_virtual_address(address)) {
+      reloc->section_ = section;
+    } else {
+      LIEF_ERR("Can't find the section associated with the virtual address 0x{:x}", address);
+    }
+
+    const auto it_symbol = symbols_by_address.find(address);
+    if (it_symbol != symbols_by_address.end()) {
+      reloc->symbol_ = it_symbol->second;
+    }
+
+    LIEF_MOD_DEBUG(MACHO_CHAINED_FIXUPS, "[REBASE] {}@0x{:x}: 0x{:x}",
+                   segment.name(), address, reloc->target());
+    segment.relocations_.push_back(std::move(reloc));
+  }
+}
+
 
 
 
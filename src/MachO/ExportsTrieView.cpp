@@ -0,0 +1,300 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LIEF/MachO/ExportsTrieView.hpp"
+
+#include "logging.hpp"
+
+namespace LIEF {
+namespace MachO {
+
+namespace {
+// Minimal cursor over the raw trie. The trie is walked for every lookup so
+// we don't go through a BinaryStream: the reads are bounds-checked pointer
+// increments and nothing is allocated.
+struct cursor_t {
+  const uint8_t* start = nullptr;
+  const uint8_t* end   = nullptr;
+  const uint8_t* p     = nullptr;
+
+  uint64_t offset() const {
+    return p - start;
+  }
+
+  bool uleb128(uint64_t& value) {
+    value = 0;
+    uint32_t shift = 0;
+    while (true) {
+      if (p >= end) {
+        return false;
+      }
+      const uint8_t byte = *p++;
+      if (shift < 64) {
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      }
+      shift += 7;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+  }
+
+  bool byte(uint8_t& value) {
+    if (p >= end) {
+      return false;
+    }
+    value = *p++;
+    return true;
+  }
+
+  // Return a pointer on the null-terminated string at the current position
+  // (and check that the '\0' is within the bounds)
+  bool cstr(const char*& str) {
+    const uint8_t* it = p;
+    while (it < end && *it != '\0') {
+      ++it;
+    }
+    if (it >= end) {
+      return false;
+    }
+    str = reinterpret_cast<const char*>(p);
+    p = it + 1;
+    return true;
+  }
+};
+
+cursor_t make_cursor(span<const uint8_t> trie, uint64_t offset = 0) {
+  return {trie.data(), trie.data() + trie.size(), trie.data() + offset};
+}
+
+// Decode the terminal information located at the cursor's position. It
+// follows the same logic as BinaryParser::parse_export_trie
+bool read_terminal(cursor_t& cursor, ExportsTrieView::export_t& info) {
+  info = ExportsTrieView::export_t();
+  info.node_offset = cursor.offset();
+
+  if (!cursor.uleb128(info.flags)) {
+    return false;
+  }
+
+  if (info.has(EXPORT_SYMBOL_FLAGS::EXPORT_SYMBOL_FLAGS_REEXPORT)) {
+    return cursor.uleb128(info.other) &&
+           cursor.cstr(info.imported_name);
+  }
+
+  if (!cursor.uleb128(info.address)) {
+    return false;
+  }
+
+  if (info.has(EXPORT_SYMBOL_FLAGS::EXPORT_SYMBOL_FLAGS_STUB_AND_RESOLVER)) {
+    return cursor.uleb128(info.other);
+  }
+  return true;
+}
+}
+
+result<ExportsTrieView::export_t> ExportsTrieView::find(const std::string& name) const {
+  if (trie_.empty()) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  cursor_t cursor = make_cursor(trie_);
+  size_t pos = 0;
+
+  // A well-formed trie consumes at least one character per edge. The number of
+  // visited nodes is bounded to not loop forever on a corrupted trie.
+  for (size_t nb_nodes = 0; nb_nodes <= trie_.size(); ++nb_nodes) {
+    uint64_t terminal_size = 0;
+    if (!cursor.uleb128(terminal_size)) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (terminal_size > static_cast<uint64_t>(cursor.end - cursor.p)) {
+      LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "Export trie: terminal size out of bounds (0x{:x})",
+                     cursor.offset());
+      return make_error_code(lief_errors::read_error);
+    }
+
+    if (pos == name.size()) {
+      if (terminal_size == 0) {
+        return make_error_code(lief_errors::not_found);
+      }
+      cursor_t terminal = cursor;
+      terminal.end = cursor.p + terminal_size;
+      export_t info;
+      if (!read_terminal(terminal, info)) {
+        return make_error_code(lief_errors::read_error);
+      }
+      return info;
+    }
+
+    cursor.p += terminal_size;
+    uint8_t nb_children = 0;
+    if (!cursor.byte(nb_children)) {
+      return make_error_code(lief_errors::read_error);
+    }
+
+    uint64_t child_offset = 0;
+    bool found = false;
+    for (size_t i = 0; i < nb_children && !found; ++i) {
+      size_t edge_pos = pos;
+      bool match = true;
+      while (true) {
+        uint8_t c = 0;
+        if (!cursor.byte(c)) {
+          return make_error_code(lief_errors::read_error);
+        }
+        if (c == '\0') {
+          break;
+        }
+        if (match) {
+          match = edge_pos < name.size() && static_cast<uint8_t>(name[edge_pos]) == c;
+          ++edge_pos;
+        }
+      }
+
+      if (!cursor.uleb128(child_offset)) {
+        return make_error_code(lief_errors::read_error);
+      }
+
+      if (match) {
+        found = true;
+        pos = edge_pos;
+      }
+    }
+
+    if (!found) {
+      return make_error_code(lief_errors::not_found);
+    }
+
+    if (child_offset == 0 || child_offset >= trie_.size()) {
+      return make_error_code(lief_errors::read_error);
+    }
+    cursor.p = cursor.start + child_offset;
+  }
+  return make_error_code(lief_errors::read_error);
+}
+
+ExportsTrieView::iterator::iterator(span<const uint8_t> trie) :
+  trie_(trie)
+{
+  if (trie_.empty()) {
+    return;
+  }
+  is_end_ = false;
+  visited_.insert(0);
+  if (!enter(0) && !is_end_) {
+    next();
+  }
+}
+
+ExportsTrieView::iterator& ExportsTrieView::iterator::operator++() {
+  if (!is_end_) {
+    next();
+  }
+  return *this;
+}
+
+bool ExportsTrieView::iterator::enter(uint64_t offset) {
+  cursor_t cursor = make_cursor(trie_, offset);
+
+  uint64_t terminal_size = 0;
+  if (!cursor.uleb128(terminal_size) ||
+      terminal_size > static_cast<uint64_t>(cursor.end - cursor.p))
+  {
+    LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "Export trie: corrupted node at 0x{:x}", offset);
+    finish();
+    return false;
+  }
+
+  bool is_terminal = false;
+  if (terminal_size != 0) {
+    cursor_t terminal = cursor;
+    terminal.end = cursor.p + terminal_size;
+    if (!read_terminal(terminal, entry_.info)) {
+      LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "Export trie: corrupted terminal at 0x{:x}", offset);
+      finish();
+      return false;
+    }
+    is_terminal = true;
+  }
+
+  cursor.p += terminal_size;
+  uint8_t nb_children = 0;
+  if (!cursor.byte(nb_children)) {
+    finish();
+    return false;
+  }
+
+  if (nb_children > 0) {
+    frame_t frame;
+    frame.children_offset = cursor.offset();
+    frame.remaining       = nb_children;
+    frame.prefix_size     = entry_.name.size();
+    stack_.push_back(frame);
+  }
+  return is_terminal;
+}
+
+void ExportsTrieView::iterator::next() {
+  while (!stack_.empty()) {
+    frame_t& top = stack_.back();
+    if (top.remaining == 0) {
+      stack_.pop_back();
+      continue;
+    }
+    --top.remaining;
+
+    cursor_t cursor = make_cursor(trie_, top.children_offset);
+    const char* edge = nullptr;
+    uint64_t child_offset = 0;
+    if (!cursor.cstr(edge) || !cursor.uleb128(child_offset)) {
+      LIEF_MOD_DEBUG(MACHO_DYLD_INFO, "Export trie: corrupted edge at 0x{:x}",
+                     top.children_offset);
+      break;
+    }
+    top.children_offset = cursor.offset();
+
+    if (child_offset == 0 || child_offset >= trie_.size()) {
+      continue;
+    }
+
+    if (!visited_.insert(child_offset).second) {
+      continue;
+    }
+
+    entry_.name.resize(top.prefix_size);
+    entry_.name += edge;
+
+    if (enter(child_offset)) {
+      return;
+    }
+
+    if (is_end_) {
+      return;
+    }
+  }
+  finish();
+}
+
+void ExportsTrieView::iterator::finish() {
+  is_end_ = true;
+  stack_.clear();
+  visited_.clear();
+  entry_ = entry_t();
+}
+
+}
+}
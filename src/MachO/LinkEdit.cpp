@@ -132,84 +132,85 @@ void LinkEdit::update_data(update_fnc_t f) {
   const auto original_data_addr     = reinterpret_cast<uintptr_t>(data_.data());
   const auto original_data_size     = static_cast<size_t>(data_.size());
   const uintptr_t original_data_end = original_data_addr + original_data_size;
-  f(data_);
+  std::vector<uint8_t>& data = data_.writable();
+  f(data);
   if (dyld_ != nullptr) {
-    if (!update_span(dyld_->rebase_opcodes_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(dyld_->rebase_opcodes_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning rebase opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->bind_opcodes_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(dyld_->bind_opcodes_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->weak_bind_opcodes_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(dyld_->weak_bind_opcodes_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning weak bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->lazy_bind_opcodes_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(dyld_->lazy_bind_opcodes_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning lazy bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->export_trie_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(dyld_->export_trie_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the export trie in segment {}", name_);
     }
   }
 
   if (chained_fixups_ != nullptr) {
-    if (!update_span(chained_fixups_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(chained_fixups_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the Dyld Chained fixups in segment {}", name_);
     }
   }
 
   if (exports_trie_ != nullptr) {
-    if (!update_span(exports_trie_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(exports_trie_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the Dyld Exports Trie in segment {}", name_);
     }
   }
 
   if (symtab_ != nullptr) {
-    if (!update_span(symtab_->symbol_table_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(symtab_->symbol_table_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_SYMTAB.n_list in segment {}", name_);
     }
-    if (!update_span(symtab_->string_table_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(symtab_->string_table_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_SYMTAB.string_table in segment {}", name_);
     }
   }
 
   if (fstarts_ != nullptr) {
-    if (!update_span(fstarts_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(fstarts_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_FUNCTION_STARTS in segment {}", name_);
     }
   }
 
   if (data_code_ != nullptr) {
-    if (!update_span(data_code_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(data_code_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_DATA_IN_CODE in segment {}", name_);
     }
   }
 
   if (seg_split_ != nullptr) {
-    if (!update_span(seg_split_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(seg_split_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_SEGMENT_SPLIT_INFO in segment {}", name_);
     }
   }
 
   if (two_lvl_hint_ != nullptr) {
-    if (!update_span(two_lvl_hint_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(two_lvl_hint_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_TWOLEVEL_HINTS in segment {}", name_);
     }
   }
 
   if (linker_opt_ != nullptr) {
-    if (!update_span(linker_opt_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(linker_opt_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_LINKER_OPTIMIZATION_HINT in segment {}", name_);
     }
   }
 
   if (code_sig_ != nullptr) {
-    if (!update_span(code_sig_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(code_sig_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_CODE_SIGNATURE in segment {}", name_);
     }
   }
 
   if (code_sig_dir_ != nullptr) {
-    if (!update_span(code_sig_dir_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(code_sig_dir_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_DYLIB_CODE_SIGN_DRS in segment {}", name_);
     }
   }
@@ -219,84 +220,85 @@ void LinkEdit::update_data(update_fnc_ws_t f, size_t where, size_t size) {
   const auto original_data_addr     = reinterpret_cast<uintptr_t>(data_.data());
   const auto original_data_size     = static_cast<size_t>(data_.size());
   const uintptr_t original_data_end = original_data_addr + original_data_size;
-  f(data_, where, size);
+  std::vector<uint8_t>& data = data_.writable();
+  f(data, where, size);
   if (dyld_ != nullptr) {
-    if (!update_span(dyld_->rebase_opcodes_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(dyld_->rebase_opcodes_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning rebase opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->bind_opcodes_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(dyld_->bind_opcodes_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->weak_bind_opcodes_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(dyld_->weak_bind_opcodes_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning weak bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->lazy_bind_opcodes_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(dyld_->lazy_bind_opcodes_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning lazy bind opcodes in segment {}", name_);
     }
-    if (!update_span(dyld_->export_trie_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(dyld_->export_trie_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the export trie in segment {}", name_);
     }
   }
 
   if (chained_fixups_ != nullptr) {
-    if (!update_span(chained_fixups_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(chained_fixups_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the Dyld Chained fixups in segment {}", name_);
     }
   }
 
   if (exports_trie_ != nullptr) {
-    if (!update_span(exports_trie_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(exports_trie_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the Dyld Exports Trie in segment {}", name_);
     }
   }
 
   if (symtab_ != nullptr) {
-    if (!update_span(symtab_->symbol_table_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(symtab_->symbol_table_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_SYMTAB.n_list in segment {}", name_);
     }
-    if (!update_span(symtab_->string_table_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(symtab_->string_table_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_SYMTAB.string_table in segment {}", name_);
     }
   }
 
   if (fstarts_ != nullptr) {
-    if (!update_span(fstarts_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(fstarts_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_FUNCTION_STARTS in segment {}", name_);
     }
   }
 
   if (data_code_ != nullptr) {
-    if (!update_span(data_code_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(data_code_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_DATA_IN_CODE in segment {}", name_);
     }
   }
 
   if (seg_split_ != nullptr) {
-    if (!update_span(seg_split_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(seg_split_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_SEGMENT_SPLIT_INFO in segment {}", name_);
     }
   }
 
   if (two_lvl_hint_ != nullptr) {
-    if (!update_span(two_lvl_hint_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(two_lvl_hint_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_TWOLEVEL_HINTS in segment {}", name_);
     }
   }
 
   if (linker_opt_ != nullptr) {
-    if (!update_span(linker_opt_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(linker_opt_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_LINKER_OPTIMIZATION_HINT in segment {}", name_);
     }
   }
 
   if (code_sig_ != nullptr) {
-    if (!update_span(code_sig_->content_, original_data_addr, original_data_end, where, size, data_)) {
+    if (!update_span(code_sig_->content_, original_data_addr, original_data_end, where, size, data)) {
       LIEF_WARN("Error while re-spanning the LC_CODE_SIGNATURE in segment {}", name_);
     }
   }
 
   if (code_sig_dir_ != nullptr) {
-    if (!update_span(code_sig_dir_->content_, original_data_addr, original_data_end, data_)) {
+    if (!update_span(code_sig_dir_->content_, original_data_addr, original_data_end, data)) {
       LIEF_WARN("Error while re-spanning the LC_DYLIB_CODE_SIGN_DRS in segment {}", name_);
     }
   }
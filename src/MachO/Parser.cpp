@@ -172,7 +172,13 @@ ok_error_t Parser::build_fat() {
       continue;
     }
 
-    std::unique_ptr<Binary> bin = BinaryParser::parse(std::move(macho_data), offset, config_);
+    // The stream takes the ownership of the data so that the segments can
+    // share it instead of copying it
+    std::unique_ptr<Binary> bin;
+    if (is_macho(macho_data)) {
+      bin = BinaryParser::parse(std::make_unique<VectorStream>(std::move(macho_data)),
+                                offset, config_);
+    }
     if (bin == nullptr) {
       LIEF_ERR("Can't parse the binary at the index #{:d}", i);
       continue;
@@ -22,6 +22,7 @@
 #include "LIEF/MachO/Section.hpp"
 #include "LIEF/MachO/SegmentCommand.hpp"
 #include "LIEF/MachO/Relocation.hpp"
+#include "LIEF/MachO/DyldChainedFixups.hpp"
 #include "MachO/Structures.hpp"
 
 namespace LIEF {
@@ -173,10 +174,16 @@ SegmentCommand::it_const_sections SegmentCommand::sections() const {
 
 
 SegmentCommand::it_relocations SegmentCommand::relocations() {
+  if (chained_fixups_ != nullptr) {
+    chained_fixups_->create_objects();
+  }
   return relocations_;
 }
 
 SegmentCommand::it_const_relocations SegmentCommand::relocations() const {
+  if (chained_fixups_ != nullptr) {
+    chained_fixups_->create_objects();
+  }
   return relocations_;
 }
 
@@ -252,8 +259,9 @@ Section& SegmentCommand::add_section(const Section& section) {
                 inner_data.resize(w + s);
               }, relative_offset, content.size());
 
+  span<uint8_t> segment_content = writable_content();
   std::copy(std::begin(content), std::end(content),
-            std::begin(data_) + relative_offset);
+            std::begin(segment_content) + relative_offset);
 
   file_size(data_.size());
   sections_.push_back(std::move(new_section));
@@ -357,12 +365,19 @@ std::ostream& SegmentCommand::print(std::ostream& os) const {
   return os;
 }
 
+span<uint8_t> SegmentCommand::writable_content() {
+  if (data_.is_shared()) {
+    update_data([] (std::vector<uint8_t>&) {});
+  }
+  return data_.writable();
+}
+
 void SegmentCommand::update_data(SegmentCommand::update_fnc_t f) {
-  f(data_);
+  f(data_.writable());
 }
 
 void SegmentCommand::update_data(SegmentCommand::update_fnc_ws_t f, size_t where, size_t size) {
-  f(data_, where, size);
+  f(data_.writable(), where, size);
 }
 
 }
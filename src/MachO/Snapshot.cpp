@@ -0,0 +1,201 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <unordered_map>
+
+#include "logging.hpp"
+#include "snapshot.hpp"
+
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/BinaryParser.hpp"
+#include "LIEF/MachO/DyldBindingInfo.hpp"
+#include "LIEF/MachO/DyldExportsTrie.hpp"
+#include "LIEF/MachO/DyldInfo.hpp"
+#include "LIEF/MachO/ExportInfo.hpp"
+#include "LIEF/MachO/Parser.hpp"
+#include "LIEF/MachO/RelocationDyld.hpp"
+#include "LIEF/MachO/SegmentCommand.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+#include "LIEF/MachO/utils.hpp"
+
+#include "MachO/snapshot_records.hpp"
+
+namespace LIEF {
+namespace MachO {
+
+using details::SNAPSHOT_TABLES;
+
+ok_error_t Binary::save_snapshot(const std::string& path) const {
+  if (source_.empty()) {
+    LIEF_ERR("The binary has not been parsed from a file: can't create a snapshot");
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  // __LINKEDIT is copied by the parser, so the segments which are not shared
+  // with the source are compared with their original content
+  span<const uint8_t> source = source_.content();
+  for (const SegmentCommand* segment : segments_) {
+    const SharedContent& data = segment->data_;
+    if (data.empty() || data.source() == source_.source()) {
+      continue;
+    }
+    const uint64_t offset = segment->file_offset();
+    if (offset > source.size() || data.size() > source.size() - offset ||
+        !std::equal(data.data(), data.data() + data.size(), source.data() + offset))
+    {
+      LIEF_ERR("The content of the segment '{}' has been modified: can't create a snapshot",
+               segment->name());
+      return make_error_code(lief_errors::not_supported);
+    }
+  }
+
+  std::unordered_map<const Symbol*, uint32_t> symbols_idx;
+  symbols_idx.reserve(symbols_.size());
+  for (size_t i = 0; i < symbols_.size(); ++i) {
+    symbols_idx[symbols_[i].get()] = i;
+  }
+
+  std::unordered_map<const SegmentCommand*, uint32_t> segments_idx;
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    segments_idx[segments_[i]] = i;
+  }
+
+  snapshot::writer_t writer(EXE_FORMATS::FORMAT_MACHO, source);
+  writer.push(SNAPSHOT_TABLES::BINARY, details::snapshot_binary_t{fat_offset_});
+
+  auto save_exports = [&] (SNAPSHOT_TABLES table, const std::vector<std::unique_ptr<ExportInfo>>& exports) {
+    for (const std::unique_ptr<ExportInfo>& info : exports) {
+      const Symbol* symbol = info->symbol() != nullptr ? info->symbol() : info->alias();
+      details::snapshot_export_t raw = {};
+      raw.name        = writer.add(symbol != nullptr ? symbol->name() : "");
+      raw.node_offset = info->node_offset();
+      raw.flags       = info->flags();
+      raw.address     = info->address();
+      raw.other       = info->other();
+      raw.symbol      = snapshot::index_of(symbols_idx, info->symbol());
+      raw.alias       = snapshot::index_of(symbols_idx, info->alias());
+      writer.push(table, raw);
+    }
+  };
+
+  if (const DyldInfo* dyld_info = this->dyld_info()) {
+    save_exports(SNAPSHOT_TABLES::DYLDINFO_EXPORTS, dyld_info->export_info_);
+
+    for (const std::unique_ptr<DyldBindingInfo>& info : dyld_info->binding_info_) {
+      const SegmentCommand* segment = info->segment();
+      const uint32_t seg_idx = snapshot::index_of(segments_idx, segment);
+      if (seg_idx == snapshot::NONE) {
+        continue;
+      }
+      details::snapshot_binding_t raw = {};
+      raw.name                   = writer.add(info->has_symbol() ? info->symbol()->name() : "");
+      raw.segment_offset         = info->address() - segment->virtual_address();
+      raw.addend                 = info->addend();
+      raw.offset                 = info->original_offset();
+      raw.library_ordinal        = info->library_ordinal();
+      raw.binding_class          = static_cast<uint8_t>(info->binding_class());
+      raw.type                   = static_cast<uint8_t>(info->binding_type());
+      raw.segment                = seg_idx;
+      raw.is_weak                = info->is_weak_import();
+      raw.is_non_weak_definition = info->is_non_weak_definition();
+      writer.push(SNAPSHOT_TABLES::BINDINGS, raw);
+    }
+  }
+
+  if (const DyldExportsTrie* trie = dyld_exports_trie()) {
+    save_exports(SNAPSHOT_TABLES::TRIE_EXPORTS, trie->export_info_);
+  }
+
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    const SegmentCommand& segment = *segments_[i];
+    for (const std::unique_ptr<Relocation>& reloc : segment.relocations_) {
+      if (reloc->origin() != RELOCATION_ORIGINS::ORIGIN_DYLDINFO) {
+        continue;
+      }
+      details::snapshot_rebase_t raw = {};
+      raw.segment_offset = reloc->address() - segment.virtual_address();
+      raw.type           = reloc->type();
+      raw.segment        = i;
+      writer.push(SNAPSHOT_TABLES::REBASES, raw);
+    }
+  }
+
+  return writer.write(path);
+}
+
+std::unique_ptr<Binary> Parser::parse_snapshot(const std::string& snapshot,
+                                               const std::string& source)
+{
+  auto reader = snapshot::reader_t::open(snapshot, EXE_FORMATS::FORMAT_MACHO);
+  if (!reader) {
+    LIEF_ERR("Can't load the snapshot {}", snapshot);
+    return nullptr;
+  }
+
+  span<const details::snapshot_binary_t> info =
+    reader->records<details::snapshot_binary_t>(SNAPSHOT_TABLES::BINARY);
+  if (info.size() != 1) {
+    LIEF_ERR("The snapshot {} is corrupted", snapshot);
+    return nullptr;
+  }
+
+  auto stream = VectorStream::from_file(source);
+  if (!stream) {
+    LIEF_ERR("Can't open {}", source);
+    return nullptr;
+  }
+
+  // The snapshot describes a slice of a FAT binary
+  const uint64_t fat_offset = info[0].fat_offset;
+  const uint64_t size = reader->header().source_size;
+  const std::vector<uint8_t>& raw = stream->content();
+  if (fat_offset > raw.size() || size > raw.size() - fat_offset) {
+    LIEF_ERR("The snapshot {} is stale: the source binary has been modified", snapshot);
+    return nullptr;
+  }
+
+  if (!reader->check_source({raw.data() + fat_offset, static_cast<size_t>(size)})) {
+    return nullptr;
+  }
+
+  std::vector<uint8_t> macho_data;
+  if (fat_offset == 0 && size == raw.size()) {
+    macho_data = stream->move_content();
+  } else {
+    macho_data.assign(raw.begin() + fat_offset, raw.begin() + fat_offset + size);
+  }
+
+  if (!is_macho(macho_data)) {
+    return nullptr;
+  }
+
+  BinaryParser parser;
+  parser.config_   = ParserConfig::deep();
+  parser.stream_   = std::make_unique<VectorStream>(std::move(macho_data));
+  parser.binary_   = std::unique_ptr<Binary>(new Binary{});
+  parser.snapshot_ = &*reader;
+  parser.binary_->fat_offset_ = fat_offset;
+
+  if (!parser.init_and_parse()) {
+    LIEF_WARN("Parsing with error. The binary might be in an inconsistent state");
+  }
+  return std::move(parser.binary_);
+}
+
+}
+}
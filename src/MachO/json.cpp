@@ -24,83 +24,50 @@ namespace LIEF {
 namespace MachO {
 
 
-template<class T>
-inline void process_command(json& node, const Binary& bin, const char* key) {
-  auto* cmd = bin.command<T>();
-  if (cmd != nullptr) {
-    JsonVisitor v;
-    v(*cmd);
-    node[key] = v.get();
+template<class T, class Writer>
+inline void write_command(Writer& writer, const Binary& bin, const char* key) {
+  if (const auto* cmd = bin.command<T>()) {
+    writer.template object<JsonVisitor>(key, *cmd);
   }
 }
 
+// Top-level entries of a Binary for both JsonVisitor::visit(const Binary&)
+// (JsonTree) and stream_json() (JsonStream)
+template<class Writer>
+static void serialize(const Binary& binary, Writer& writer) {
+  writer.begin()
+    .template object<JsonVisitor>("header",    binary.header())
+    .template list<JsonVisitor>("sections",    binary.sections())
+    .template list<JsonVisitor>("segments",    binary.segments())
+    .template list<JsonVisitor>("symbols",     binary.symbols())
+    .template list<JsonVisitor>("relocations", binary.relocations())
+    .template list<JsonVisitor>("libraries",   binary.libraries());
+
+  write_command<UUIDCommand>(writer, binary, "uuid");
+  write_command<MainCommand>(writer, binary, "main_command");
+  write_command<DylinkerCommand>(writer, binary, "dylinker");
+  write_command<DyldInfo>(writer, binary, "dyld_info");
+  write_command<FunctionStarts>(writer, binary, "function_starts");
+  write_command<SourceVersion>(writer, binary, "source_version");
+  write_command<VersionMin>(writer, binary, "version_min");
+  write_command<ThreadCommand>(writer, binary, "thread_command");
+  write_command<RPathCommand>(writer, binary, "rpath");
+  write_command<SymbolCommand>(writer, binary, "symbol_command");
+  write_command<DynamicSymbolCommand>(writer, binary, "dynamic_symbol_command");
+  write_command<CodeSignature>(writer, binary, "code_signature");
+  write_command<DataInCode>(writer, binary, "data_in_code");
+  write_command<EncryptionInfo>(writer, binary, "encryption_info");
+  write_command<BuildVersion>(writer, binary, "build_verison");
+  writer.end();
+}
 
 void JsonVisitor::visit(const Binary& binary) {
-  JsonVisitor header_visitor;
-  header_visitor(binary.header());
-
-  // Sections
-  std::vector<json> sections;
-  for (const Section& section : binary.sections()) {
-    JsonVisitor visitor;
-    visitor(section);
-    sections.emplace_back(visitor.get());
-  }
-
-  // Segments
-  std::vector<json> segments;
-  for (const SegmentCommand& segment : binary.segments()) {
-    JsonVisitor visitor;
-    visitor(segment);
-    segments.emplace_back(visitor.get());
-  }
-
-  // Symbols
-  std::vector<json> symbols;
-  for (const Symbol& sym : binary.symbols()) {
-    JsonVisitor visitor;
-    visitor(sym);
-    symbols.emplace_back(visitor.get());
-  }
-
-  // Relocations
-  std::vector<json> relocations;
-  for (const Relocation& r : binary.relocations()) {
-    JsonVisitor visitor;
-    visitor(r);
-    relocations.emplace_back(visitor.get());
-  }
-
-  std::vector<json> libraries;
-  for (const DylibCommand& lib : binary.libraries()) {
-    JsonVisitor visitor;
-    visitor(lib);
-    libraries.emplace_back(visitor.get());
-  }
-
+  JsonTree tree(node_);
+  serialize(binary, tree);
+}
 
-  node_["header"]      = header_visitor.get();
-  node_["sections"]    = sections;
-  node_["segments"]    = segments;
-  node_["symbols"]     = symbols;
-  node_["relocations"] = relocations;
-  node_["libraries"]   = libraries;
-
-  process_command<UUIDCommand>(node_, binary, "uuid");
-  process_command<MainCommand>(node_, binary, "main_command");
-  process_command<DylinkerCommand>(node_, binary, "dylinker");
-  process_command<DyldInfo>(node_, binary, "dyld_info");
-  process_command<FunctionStarts>(node_, binary, "function_starts");
-  process_command<SourceVersion>(node_, binary, "source_version");
-  process_command<VersionMin>(node_, binary, "version_min");
-  process_command<ThreadCommand>(node_, binary, "thread_command");
-  process_command<RPathCommand>(node_, binary, "rpath");
-  process_command<SymbolCommand>(node_, binary, "symbol_command");
-  process_command<DynamicSymbolCommand>(node_, binary, "dynamic_symbol_command");
-  process_command<CodeSignature>(node_, binary, "code_signature");
-  process_command<DataInCode>(node_, binary, "data_in_code");
-  process_command<EncryptionInfo>(node_, binary, "encryption_info");
-  process_command<BuildVersion>(node_, binary, "build_verison");
+void stream_json(const Binary& binary, JsonStream& stream) {
+  serialize(binary, stream);
 }
 
 
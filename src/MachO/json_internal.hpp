@@ -18,6 +18,7 @@
 
 #include "LIEF/visibility.h"
 #include "visitors/json.hpp" // internal
+#include "visitors/json_stream.hpp" // internal
 #include "LIEF/MachO.hpp"
 
 namespace LIEF {
@@ -111,6 +112,10 @@ class JsonVisitor : public LIEF::JsonVisitor {
   void visit(const VersionMin& vmin)                      override;
 };
 
+//! Stream the JSON representation of the given binary.
+//! The top-level entries are the same as JsonVisitor::visit(const Binary&)
+void stream_json(const Binary& binary, JsonStream& stream);
+
 }
 }
 
@@ -0,0 +1,80 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_MACHO_SNAPSHOT_RECORDS_H
+#define LIEF_MACHO_SNAPSHOT_RECORDS_H
+#include <cstdint>
+
+#include "snapshot.hpp"
+
+// Records of a Mach-O snapshot (see: Binary::save_snapshot).
+//
+// The snapshot only contains the objects that are decoded from the dyld
+// opcodes and the exports tries. They are restored by the BinaryParser in
+// the same order as they are decoded so that the symbols created along the
+// way keep their indexes.
+
+namespace LIEF {
+namespace MachO {
+namespace details {
+
+enum class SNAPSHOT_TABLES : uint32_t {
+  BLOBS = snapshot::BLOBS,
+  BINARY,
+  DYLDINFO_EXPORTS,
+  TRIE_EXPORTS,
+  BINDINGS,
+  REBASES,
+};
+
+struct snapshot_binary_t {
+  uint64_t fat_offset;
+};
+
+struct snapshot_export_t {
+  snapshot::ref_t name;
+  uint64_t node_offset;
+  uint64_t flags;
+  uint64_t address;
+  uint64_t other;
+  uint32_t symbol; // Index in Binary::symbols_ (NONE if not set)
+  uint32_t alias;  // Index in Binary::symbols_ (NONE if not set)
+};
+
+struct snapshot_binding_t {
+  snapshot::ref_t name;
+  uint64_t segment_offset;
+  int64_t  addend;
+  uint64_t offset;
+  int32_t  library_ordinal;
+  uint8_t  binding_class;
+  uint8_t  type;
+  uint8_t  segment;
+  uint8_t  is_weak;
+  uint8_t  is_non_weak_definition;
+  uint8_t  reserved[7];
+};
+
+struct snapshot_rebase_t {
+  uint64_t segment_offset;
+  uint8_t  type;
+  uint8_t  segment;
+  uint8_t  reserved[6];
+};
+
+}
+}
+}
+#endif
@@ -0,0 +1,379 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LIEF_OUTPUT_POSIX 1
+#endif
+
+#include "logging.hpp"
+
+#include "LIEF/OutputSink.hpp"
+
+namespace LIEF {
+
+namespace {
+static constexpr size_t BLOCK_SIZE = 0x1000;
+static constexpr uint8_t ZERO_BLOCK[BLOCK_SIZE] = {0};
+
+inline bool is_zero(const uint8_t* data, size_t size) {
+  return std::memcmp(data, ZERO_BLOCK, size) == 0;
+}
+
+#if !defined(LIEF_OUTPUT_POSIX)
+// std::fseek takes a ``long`` offset which is 32 bits on Windows
+inline int seek(FILE* file, uint64_t offset) {
+#if defined(_WIN32)
+  return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#else
+  return fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+}
+#endif
+}
+
+OutputSink::~OutputSink() = default;
+
+ok_error_t OutputSink::zeros(uint64_t offset, uint64_t size) {
+  while (size > 0) {
+    const size_t chunk = std::min<uint64_t>(size, BLOCK_SIZE);
+    if (auto res = write(offset, {ZERO_BLOCK, chunk}); !res) {
+      return res;
+    }
+    offset += chunk;
+    size   -= chunk;
+  }
+  return ok();
+}
+
+ok_error_t OutputSink::write_sparse(uint64_t offset, span<const uint8_t> data) {
+  const size_t size = data.size();
+  size_t pos = 0;
+  while (pos < size) {
+    // Data up to the next block full of zeros
+    size_t end = pos;
+    while (end < size) {
+      const size_t len = std::min(BLOCK_SIZE, size - end);
+      if (len == BLOCK_SIZE && is_zero(data.data() + end, len)) {
+        break;
+      }
+      end += len;
+    }
+    if (end > pos) {
+      if (auto res = write(offset + pos, data.subspan(pos, end - pos)); !res) {
+        return res;
+      }
+    }
+
+    // Run of zeros
+    size_t zend = end;
+    while (zend + BLOCK_SIZE <= size && is_zero(data.data() + zend, BLOCK_SIZE)) {
+      zend += BLOCK_SIZE;
+    }
+    if (zend > end) {
+      if (auto res = zeros(offset + end, zend - end); !res) {
+        return res;
+      }
+    }
+    pos = zend;
+  }
+  return ok();
+}
+
+// ===========================================================================
+// FileSink
+// ===========================================================================
+result<FileSink> FileSink::open(const std::string& path) {
+  FileSink sink;
+#if defined(LIEF_OUTPUT_POSIX)
+  sink.fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (sink.fd_ < 0) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  struct stat info;
+  sink.is_regular_ = ::fstat(sink.fd_, &info) == 0 && S_ISREG(info.st_mode);
+#else
+  sink.file_ = std::fopen(path.c_str(), "wb");
+  if (sink.file_ == nullptr) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+#endif
+  return sink;
+}
+
+FileSink::FileSink(FileSink&& other) :
+  fd_(other.fd_),
+  file_(other.file_),
+  is_regular_(other.is_regular_),
+  end_(other.end_)
+{
+  other.fd_ = -1;
+  other.file_ = nullptr;
+}
+
+FileSink& FileSink::operator=(FileSink&& other) {
+  if (&other != this) {
+    close();
+    fd_ = other.fd_;
+    file_ = other.file_;
+    is_regular_ = other.is_regular_;
+    end_ = other.end_;
+    other.fd_ = -1;
+    other.file_ = nullptr;
+  }
+  return *this;
+}
+
+FileSink::~FileSink() {
+  close();
+}
+
+void FileSink::close() {
+#if defined(LIEF_OUTPUT_POSIX)
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+  if (file_ != nullptr) {
+    std::fclose(file_);
+  }
+  fd_ = -1;
+  file_ = nullptr;
+}
+
+ok_error_t FileSink::write(uint64_t offset, span<const uint8_t> data) {
+  if (!is_regular_) {
+    if (offset < end_) {
+      LIEF_ERR("Can't write at offset 0x{:x} in a sequential output (current offset: 0x{:x})",
+               offset, end_);
+      return make_error_code(lief_errors::file_error);
+    }
+    if (offset > end_) {
+      if (auto res = OutputSink::zeros(end_, offset - end_); !res) {
+        return res;
+      }
+    }
+  }
+#if defined(LIEF_OUTPUT_POSIX)
+  const uint8_t* ptr = data.data();
+  size_t size = data.size();
+  uint64_t pos = offset;
+  while (size > 0) {
+    const ssize_t written = is_regular_ ? ::pwrite(fd_, ptr, size, pos) :
+                                          ::write(fd_, ptr, size);
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      LIEF_ERR("Can't write 0x{:x} bytes at offset 0x{:x}", size, pos);
+      return make_error_code(lief_errors::file_error);
+    }
+    ptr  += written;
+    size -= written;
+    pos  += written;
+  }
+#else
+  // Seeking fails on pipes but the sequential writes don't need it
+  if (file_ == nullptr ||
+      (seek(file_, offset) != 0 && offset != end_) ||
+      std::fwrite(data.data(), 1, data.size(), file_) != data.size())
+  {
+    LIEF_ERR("Can't write 0x{:x} bytes at offset 0x{:x}", data.size(), offset);
+    return make_error_code(lief_errors::file_error);
+  }
+#endif
+  end_ = std::max<uint64_t>(end_, offset + data.size());
+  return ok();
+}
+
+ok_error_t FileSink::zeros(uint64_t offset, uint64_t size) {
+#if defined(LIEF_OUTPUT_POSIX)
+  if (is_regular_) {
+    // The file is truncated when opened: the range that has not been written
+    // yet is read as zeros once finalize() sets the final size. The range
+    // that has already been written must be overwritten.
+    if (offset < end_) {
+      return OutputSink::zeros(offset, std::min<uint64_t>(size, end_ - offset));
+    }
+    return ok();
+  }
+#endif
+  return OutputSink::zeros(offset, size);
+}
+
+ok_error_t FileSink::finalize(uint64_t size) {
+#if defined(LIEF_OUTPUT_POSIX)
+  if (!is_regular_) {
+    if (size > end_) {
+      return OutputSink::zeros(end_, size - end_);
+    }
+    return ok();
+  }
+  if (::ftruncate(fd_, size) != 0) {
+    LIEF_ERR("Can't resize the output file to 0x{:x} bytes", size);
+    return make_error_code(lief_errors::file_error);
+  }
+#else
+  if (file_ != nullptr && std::fflush(file_) != 0) {
+    return make_error_code(lief_errors::file_error);
+  }
+  (void)size;
+#endif
+  return ok();
+}
+
+// ===========================================================================
+// MmapSink
+// ===========================================================================
+result<MmapSink> MmapSink::open(const std::string& path, uint64_t size) {
+#if defined(LIEF_OUTPUT_POSIX)
+  MmapSink sink;
+  sink.fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+  if (sink.fd_ < 0) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  if (size == 0) {
+    return sink;
+  }
+  if (::ftruncate(sink.fd_, size) != 0) {
+    LIEF_ERR("Can't resize '{}' to 0x{:x} bytes", path, size);
+    return make_error_code(lief_errors::file_error);
+  }
+  void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, sink.fd_, 0);
+  if (ptr == MAP_FAILED) {
+    LIEF_ERR("Can't map '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  sink.data_ = static_cast<uint8_t*>(ptr);
+  sink.size_ = size;
+  return sink;
+#else
+  LIEF_ERR("MmapSink is not supported on this platform ({}, 0x{:x})", path, size);
+  return make_error_code(lief_errors::not_supported);
+#endif
+}
+
+MmapSink::MmapSink(MmapSink&& other) :
+  fd_(other.fd_),
+  data_(other.data_),
+  size_(other.size_)
+{
+  other.fd_ = -1;
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+MmapSink& MmapSink::operator=(MmapSink&& other) {
+  if (&other != this) {
+    close();
+    fd_ = other.fd_;
+    data_ = other.data_;
+    size_ = other.size_;
+    other.fd_ = -1;
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+MmapSink::~MmapSink() {
+  close();
+}
+
+void MmapSink::close() {
+#if defined(LIEF_OUTPUT_POSIX)
+  if (data_ != nullptr) {
+    ::munmap(data_, size_);
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+  fd_ = -1;
+  data_ = nullptr;
+  size_ = 0;
+}
+
+ok_error_t MmapSink::write(uint64_t offset, span<const uint8_t> data) {
+  if (offset > size_ || data.size() > size_ - offset) {
+    LIEF_ERR("Write out of the mapping (offset: 0x{:x}, size: 0x{:x})", offset, data.size());
+    return make_error_code(lief_errors::data_too_large);
+  }
+  std::copy(data.begin(), data.end(), data_ + offset);
+  return ok();
+}
+
+ok_error_t MmapSink::zeros(uint64_t offset, uint64_t size) {
+  // The mapping is backed by a truncated (and then extended) file
+  if (offset > size_ || size > size_ - offset) {
+    return make_error_code(lief_errors::data_too_large);
+  }
+  return ok();
+}
+
+ok_error_t MmapSink::finalize(uint64_t size) {
+  if (size != size_) {
+    LIEF_ERR("The size of the output (0x{:x}) does not match the mapping (0x{:x})",
+             size, size_);
+    return make_error_code(lief_errors::build_error);
+  }
+#if defined(LIEF_OUTPUT_POSIX)
+  if (data_ != nullptr && ::msync(data_, size_, MS_SYNC) != 0) {
+    return make_error_code(lief_errors::file_error);
+  }
+#endif
+  return ok();
+}
+
+// ===========================================================================
+// BufferSink
+// ===========================================================================
+ok_error_t BufferSink::write(uint64_t offset, span<const uint8_t> data) {
+  if (offset > buffer_.size() || data.size() > buffer_.size() - offset) {
+    LIEF_ERR("Write out of the buffer (offset: 0x{:x}, size: 0x{:x})", offset, data.size());
+    return make_error_code(lief_errors::data_too_large);
+  }
+  std::copy(data.begin(), data.end(), buffer_.data() + offset);
+  return ok();
+}
+
+ok_error_t BufferSink::zeros(uint64_t offset, uint64_t size) {
+  if (offset > buffer_.size() || size > buffer_.size() - offset) {
+    return make_error_code(lief_errors::data_too_large);
+  }
+  std::fill_n(buffer_.data() + offset, size, 0);
+  return ok();
+}
+
+ok_error_t BufferSink::finalize(uint64_t size) {
+  if (size > buffer_.size()) {
+    return make_error_code(lief_errors::data_too_large);
+  }
+  size_ = size;
+  return ok();
+}
+
+}
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <iterator>
 #include <map>
+#include <unordered_map>
 #include <numeric>
 #include <limits>
 
@@ -37,7 +38,7 @@
 #include "LIEF/PE/Export.hpp"
 #include "LIEF/PE/ExportEntry.hpp"
 #include "LIEF/PE/ImportEntry.hpp"
-#include "LIEF/PE/LoadConfigurations/LoadConfiguration.hpp"
+#include "LIEF/PE/LoadConfigurations.hpp"
 #include "LIEF/PE/Relocation.hpp"
 #include "LIEF/PE/RelocationEntry.hpp"
 #include "LIEF/PE/ResourceData.hpp"
@@ -59,6 +60,170 @@ namespace PE {
 
 Binary::~Binary() = default;
 
+namespace {
+std::unique_ptr<LoadConfiguration> copy_load_config(const LoadConfiguration& config) {
+  switch (config.version()) {
+    case LoadConfigurationV0::VERSION:
+      return std::make_unique<LoadConfigurationV0>(static_cast<const LoadConfigurationV0&>(config));
+    case LoadConfigurationV1::VERSION:
+      return std::make_unique<LoadConfigurationV1>(static_cast<const LoadConfigurationV1&>(config));
+    case LoadConfigurationV2::VERSION:
+      return std::make_unique<LoadConfigurationV2>(static_cast<const LoadConfigurationV2&>(config));
+    case LoadConfigurationV3::VERSION:
+      return std::make_unique<LoadConfigurationV3>(static_cast<const LoadConfigurationV3&>(config));
+    case LoadConfigurationV4::VERSION:
+      return std::make_unique<LoadConfigurationV4>(static_cast<const LoadConfigurationV4&>(config));
+    case LoadConfigurationV5::VERSION:
+      return std::make_unique<LoadConfigurationV5>(static_cast<const LoadConfigurationV5&>(config));
+    case LoadConfigurationV6::VERSION:
+      return std::make_unique<LoadConfigurationV6>(static_cast<const LoadConfigurationV6&>(config));
+    case LoadConfigurationV7::VERSION:
+      return std::make_unique<LoadConfigurationV7>(static_cast<const LoadConfigurationV7&>(config));
+    case LoadConfigurationV8::VERSION:
+      return std::make_unique<LoadConfigurationV8>(static_cast<const LoadConfigurationV8&>(config));
+    case LoadConfigurationV9::VERSION:
+      return std::make_unique<LoadConfigurationV9>(static_cast<const LoadConfigurationV9&>(config));
+    case LoadConfigurationV10::VERSION:
+      return std::make_unique<LoadConfigurationV10>(static_cast<const LoadConfigurationV10&>(config));
+    case LoadConfigurationV11::VERSION:
+      return std::make_unique<LoadConfigurationV11>(static_cast<const LoadConfigurationV11&>(config));
+    default:
+      return std::make_unique<LoadConfiguration>(config);
+  }
+}
+}
+
+Binary::Snapshot::Snapshot(std::unique_ptr<Binary> state) :
+  state_(std::move(state))
+{}
+
+Binary::Snapshot::Snapshot(Snapshot&&) noexcept = default;
+Binary::Snapshot& Binary::Snapshot::operator=(Snapshot&&) noexcept = default;
+Binary::Snapshot::~Snapshot() = default;
+
+std::unique_ptr<Binary> Binary::Snapshot::restore() const {
+  if (state_ == nullptr) {
+    LIEF_ERR("The snapshot is empty (moved?)");
+    return nullptr;
+  }
+  auto binary = std::unique_ptr<Binary>(new Binary{});
+  copy_state(*state_, *binary);
+  return binary;
+}
+
+Binary::Snapshot Binary::snapshot() const {
+  auto state = std::unique_ptr<Binary>(new Binary{});
+  copy_state(*this, *state);
+  return Snapshot(std::move(state));
+}
+
+void Binary::restore(const Snapshot& snapshot) {
+  if (snapshot.state_ == nullptr) {
+    LIEF_ERR("The snapshot is empty (moved?)");
+    return;
+  }
+  copy_state(*snapshot.state_, *this);
+}
+
+void Binary::copy_state(const Binary& from, Binary& to) {
+  if (&from == &to) {
+    return;
+  }
+  // The objects are copied and the pointers on the sections and the data
+  // directories are remapped on the copies. The content of the sections
+  // (SharedContent) is shared until it is modified.
+  std::unordered_map<const Section*, Section*> sections_map;
+  std::unordered_map<const DataDirectory*, DataDirectory*> directories_map;
+
+  sections_t sections;
+  sections.reserve(from.sections_.size());
+  for (const std::unique_ptr<Section>& section : from.sections_) {
+    auto copy = std::make_unique<Section>(*section);
+    sections_map[section.get()] = copy.get();
+    sections.push_back(std::move(copy));
+  }
+  auto section_of = [&sections_map] (const Section* section) -> Section* {
+    return section != nullptr ? sections_map[section] : nullptr;
+  };
+
+  data_directories_t directories;
+  directories.reserve(from.data_directories_.size());
+  for (const std::unique_ptr<DataDirectory>& dir : from.data_directories_) {
+    auto copy = std::make_unique<DataDirectory>(*dir);
+    copy->section_ = section_of(dir->section_);
+    directories_map[dir.get()] = copy.get();
+    directories.push_back(std::move(copy));
+  }
+  auto directory_of = [&directories_map] (const DataDirectory* dir) -> DataDirectory* {
+    return dir != nullptr ? directories_map[dir] : nullptr;
+  };
+
+  symbols_t symbols = from.symbols_;
+  for (Symbol& symbol : symbols) {
+    symbol.section_ = section_of(symbol.section_);
+  }
+
+  imports_t imports = from.imports_;
+  for (Import& import : imports) {
+    import.directory_     = directory_of(import.directory_);
+    import.iat_directory_ = directory_of(import.iat_directory_);
+  }
+
+  relocations_t relocations;
+  relocations.reserve(from.relocations_.size());
+  for (const std::unique_ptr<Relocation>& reloc : from.relocations_) {
+    relocations.push_back(std::make_unique<Relocation>(*reloc));
+  }
+
+  debug_entries_t debug;
+  debug.reserve(from.debug_.size());
+  for (const std::unique_ptr<Debug>& entry : from.debug_) {
+    debug.push_back(entry->clone());
+  }
+
+  std::unique_ptr<TLS> tls;
+  if (from.tls_ != nullptr) {
+    tls = std::make_unique<TLS>(*from.tls_);
+    tls->directory_ = directory_of(from.tls_->directory_);
+    tls->section_   = section_of(from.tls_->section_);
+  }
+
+  to.format_        = from.format_;
+  to.original_size_ = from.original_size_;
+
+  to.type_            = from.type_;
+  to.dos_header_      = from.dos_header_;
+  to.header_          = from.header_;
+  to.optional_header_ = from.optional_header_;
+
+  to.available_sections_space_ = from.available_sections_space_;
+
+  to.signatures_       = from.signatures_;
+  to.sections_         = std::move(sections);
+  to.data_directories_ = std::move(directories);
+  to.symbols_          = std::move(symbols);
+  to.strings_table_    = from.strings_table_;
+  to.relocations_      = std::move(relocations);
+  to.imports_          = std::move(imports);
+  to.delay_imports_    = from.delay_imports_;
+  to.debug_            = std::move(debug);
+
+  to.overlay_offset_         = from.overlay_offset_;
+  to.overlay_                = from.overlay_;
+  to.dos_stub_               = from.dos_stub_;
+  to.section_offset_padding_ = from.section_offset_padding_;
+  to.source_                 = from.source_;
+
+  to.rich_header_ = from.rich_header_ != nullptr ?
+                    std::make_unique<RichHeader>(*from.rich_header_) : nullptr;
+  to.export_      = from.export_ != nullptr ?
+                    std::make_unique<Export>(*from.export_) : nullptr;
+  to.resources_   = from.resources_ != nullptr ? from.resources_->clone() : nullptr;
+  to.tls_         = std::move(tls);
+  to.load_configuration_ = from.load_configuration_ != nullptr ?
+                           copy_load_config(*from.load_configuration_) : nullptr;
+}
+
 Binary::Binary() :
   LIEF::Binary{EXE_FORMATS::FORMAT_PE},
   dos_header_{DosHeader::create(PE_TYPE::PE32)},
@@ -849,7 +1014,7 @@ std::vector<uint8_t> Binary::authentihash(ALGORITHMS algo) const {
     if (sec->sizeof_raw_data() == 0) {
       continue;
     }
-    const std::vector<uint8_t>& pad     = sec->padding();
+    span<const uint8_t> pad     = sec->padding_content();
     span<const uint8_t> content = sec->content();
     LIEF_DEBUG("Authentihash:  Append section {:<8}: [0x{:04x}, 0x{:04x}] + [0x{:04x}] = [0x{:04x}, 0x{:04x}]",
                sec->name(),
@@ -977,6 +1142,19 @@ const std::vector<Symbol>& Binary::symbols() const {
 }
 
 
+result<uint64_t> Binary::get_function_address(const std::string& func_name) const {
+  const Export* exp = get_export();
+  if (exp == nullptr) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  const ExportEntry* entry = exp->find_entry(func_name);
+  if (entry == nullptr || entry->is_extern()) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return entry->address();
+}
+
 LIEF::Binary::functions_t Binary::get_abstract_exported_functions() const {
   LIEF::Binary::functions_t result;
   if (const Export* exp = get_export()) {
@@ -1036,78 +1214,12 @@ std::vector<std::string> Binary::get_abstract_imported_libraries() const {
 
 LIEF::Header Binary::get_abstract_header() const {
   LIEF::Header header;
-  using modes_t = std::pair<ARCHITECTURES, std::set<MODES>>;
-  static const std::unordered_map<Header::MACHINE_TYPES, modes_t> ARCH_PE_TO_LIEF {
-    {Header::MACHINE_TYPES::UNKNOWN,   {ARCH_NONE,  {}}},
-    {Header::MACHINE_TYPES::AMD64,     {ARCH_X86,   {MODE_64}}},
-    {Header::MACHINE_TYPES::ARM,       {ARCH_ARM,   {MODE_32}}}, // MODE_LITTLE_ENDIAN
-    {Header::MACHINE_TYPES::ARMNT,     {ARCH_ARM,   {MODE_32, MODE_V7, MODE_THUMB}}},
-    {Header::MACHINE_TYPES::ARM64,     {ARCH_ARM64, {MODE_64, MODE_V8}}},
-    {Header::MACHINE_TYPES::I386,      {ARCH_X86,   {MODE_32}}},
-    {Header::MACHINE_TYPES::IA64,      {ARCH_INTEL, {MODE_64}}},
-    {Header::MACHINE_TYPES::THUMB,     {ARCH_ARM,   {MODE_32, MODE_THUMB}}},
-  };
-
-  CONST_MAP(Header::MACHINE_TYPES, ENDIANNESS, 25) arch_pe_to_endi_lief {
-    {Header::MACHINE_TYPES::UNKNOWN,   ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::AM33,      ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::AMD64,     ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::ARM,       ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::ARMNT,     ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::ARM64,     ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::EBC,       ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::I386,      ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::IA64,      ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::M32R,      ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::MIPS16,    ENDIANNESS::ENDIAN_BIG},
-    {Header::MACHINE_TYPES::MIPSFPU,   ENDIANNESS::ENDIAN_BIG},
-    {Header::MACHINE_TYPES::MIPSFPU16, ENDIANNESS::ENDIAN_BIG},
-    {Header::MACHINE_TYPES::POWERPC,   ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::POWERPCFP, ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::R4000,     ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::RISCV32,   ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::RISCV64,   ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::RISCV128,  ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::SH3,       ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::SH3DSP,    ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::SH4,       ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::SH5,       ENDIANNESS::ENDIAN_NONE},
-    {Header::MACHINE_TYPES::THUMB,     ENDIANNESS::ENDIAN_LITTLE},
-    {Header::MACHINE_TYPES::WCEMIPSV2, ENDIANNESS::ENDIAN_LITTLE},
-  };
-
-  const Header::MACHINE_TYPES machine = this->header().machine();
-  auto it_arch = ARCH_PE_TO_LIEF.find(machine);
-  if (it_arch == std::end(ARCH_PE_TO_LIEF)) {
-    LIEF_ERR("Can't abstract the architecture {}", to_string(machine));
-    header.architecture(ARCHITECTURES::ARCH_NONE);
-    header.modes({});
-  } else {
-    const auto& p = it_arch->second;
-    header.architecture(p.first);
-    header.modes(p.second);
-  }
-
-
+  const std::pair<ARCHITECTURES, std::set<MODES>> arch = this->header().abstract_architecture();
+  header.architecture(arch.first);
+  header.modes(arch.second);
   header.entrypoint(entrypoint());
-
-  if (this->header().has_characteristic(Header::CHARACTERISTICS::DLL)) {
-    header.object_type(OBJECT_TYPES::TYPE_LIBRARY);
-  } else if (this->header().has_characteristic(Header::CHARACTERISTICS::EXECUTABLE_IMAGE)) {
-    header.object_type(OBJECT_TYPES::TYPE_EXECUTABLE);
-  } else {
-    header.object_type(OBJECT_TYPES::TYPE_NONE);
-  }
-
-  auto it_endi = arch_pe_to_endi_lief.find(machine);
-
-  if (it_endi == std::end(arch_pe_to_endi_lief)) {
-    LIEF_ERR("Can't find the endianness for {}", to_string(machine));
-    header.endianness(ENDIANNESS::ENDIAN_NONE);
-  } else {
-    header.endianness(it_endi->second);
-  }
-
+  header.object_type(this->header().abstract_object_type());
+  header.endianness(this->header().abstract_endianness());
   return header;
 }
 
@@ -24,6 +24,7 @@
 #include "third-party/utfcpp.hpp"
 
 
+#include "LIEF/OutputSink.hpp"
 #include "LIEF/PE/Builder.hpp"
 #include "LIEF/PE/ResourceData.hpp"
 #include "LIEF/PE/utils.hpp"
@@ -87,19 +88,25 @@ Builder& Builder::build_dos_stub(bool flag) {
 }
 
 void Builder::write(const std::string& filename) const {
-  std::ofstream output_file{filename, std::ios::out | std::ios::binary | std::ios::trunc};
-  if (!output_file) {
+  auto sink = FileSink::open(filename);
+  if (!sink) {
     LIEF_ERR("Can't write in {}", filename);
     return;
   }
-  write(output_file);
+  write(*sink);
 }
 
 void Builder::write(std::ostream& os) const {
-  std::vector<uint8_t> content;
-  ios_.get(content);
-  std::copy(std::begin(content), std::end(content),
-            std::ostreambuf_iterator<char>(os));
+  const std::vector<uint8_t>& content = ios_.raw();
+  os.write(reinterpret_cast<const char*>(content.data()), content.size());
+}
+
+ok_error_t Builder::write(OutputSink& sink) const {
+  const std::vector<uint8_t>& content = ios_.raw();
+  if (auto res = sink.write_sparse(0, content); !res) {
+    return res;
+  }
+  return sink.finalize(content.size());
 }
 
 ok_error_t Builder::build() {
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <iomanip>
 
 #include "LIEF/PE/hash.hpp"
@@ -38,6 +39,35 @@ Export::Export(const details::pe_export_directory_table& header) :
   ordinal_base_{header.OrdinalBase}
 {}
 
+const ExportEntry* Export::find_entry(const std::string& name) const {
+  // The entries can be renamed through entries() so that there is no
+  // index of the names to keep in sync
+  if (name.empty()) {
+    return nullptr;
+  }
+  const auto it = std::find_if(entries_.begin(), entries_.end(),
+    [&name] (const ExportEntry& entry) {
+      return entry.name() == name;
+    });
+  return it == entries_.end() ? nullptr : &*it;
+}
+
+const ExportEntry* Export::find_entry_at_ordinal(uint32_t ordinal) const {
+  // The Parser creates the entries following the order of the
+  // export address table which is indexed by the ordinals
+  if (ordinal >= ordinal_base_) {
+    const size_t idx = ordinal - ordinal_base_;
+    if (idx < entries_.size() && entries_[idx].ordinal() == ordinal) {
+      return &entries_[idx];
+    }
+  }
+  const auto it = std::find_if(entries_.begin(), entries_.end(),
+    [ordinal] (const ExportEntry& entry) {
+      return entry.ordinal() == ordinal;
+    });
+  return it == entries_.end() ? nullptr : &*it;
+}
+
 void Export::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
@@ -15,6 +15,9 @@
  */
 #include <sstream>
 #include <algorithm>
+#include <unordered_map>
+
+#include "logging.hpp"
 
 #include "LIEF/Visitor.hpp"
 
@@ -89,6 +92,74 @@ std::vector<Header::CHARACTERISTICS> Header::characteristics_list() const {
   return list;
 }
 
+OBJECT_TYPES Header::abstract_object_type() const {
+  if (has_characteristic(CHARACTERISTICS::DLL)) {
+    return OBJECT_TYPES::TYPE_LIBRARY;
+  }
+  if (has_characteristic(CHARACTERISTICS::EXECUTABLE_IMAGE)) {
+    return OBJECT_TYPES::TYPE_EXECUTABLE;
+  }
+  return OBJECT_TYPES::TYPE_NONE;
+}
+
+std::pair<ARCHITECTURES, std::set<MODES>> Header::abstract_architecture() const {
+  using modes_t = std::pair<ARCHITECTURES, std::set<MODES>>;
+  static const std::unordered_map<MACHINE_TYPES, modes_t> ARCH_PE_TO_LIEF {
+    {MACHINE_TYPES::UNKNOWN,   {ARCH_NONE,  {}}},
+    {MACHINE_TYPES::AMD64,     {ARCH_X86,   {MODE_64}}},
+    {MACHINE_TYPES::ARM,       {ARCH_ARM,   {MODE_32}}}, // MODE_LITTLE_ENDIAN
+    {MACHINE_TYPES::ARMNT,     {ARCH_ARM,   {MODE_32, MODE_V7, MODE_THUMB}}},
+    {MACHINE_TYPES::ARM64,     {ARCH_ARM64, {MODE_64, MODE_V8}}},
+    {MACHINE_TYPES::I386,      {ARCH_X86,   {MODE_32}}},
+    {MACHINE_TYPES::IA64,      {ARCH_INTEL, {MODE_64}}},
+    {MACHINE_TYPES::THUMB,     {ARCH_ARM,   {MODE_32, MODE_THUMB}}},
+  };
+
+  const auto it = ARCH_PE_TO_LIEF.find(machine());
+  if (it == std::end(ARCH_PE_TO_LIEF)) {
+    LIEF_ERR("Can't abstract the architecture {}", to_string(machine()));
+    return {ARCHITECTURES::ARCH_NONE, {}};
+  }
+  return it->second;
+}
+
+ENDIANNESS Header::abstract_endianness() const {
+  CONST_MAP(MACHINE_TYPES, ENDIANNESS, 25) arch_pe_to_endi_lief {
+    {MACHINE_TYPES::UNKNOWN,   ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::AM33,      ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::AMD64,     ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::ARM,       ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::ARMNT,     ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::ARM64,     ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::EBC,       ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::I386,      ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::IA64,      ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::M32R,      ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::MIPS16,    ENDIANNESS::ENDIAN_BIG},
+    {MACHINE_TYPES::MIPSFPU,   ENDIANNESS::ENDIAN_BIG},
+    {MACHINE_TYPES::MIPSFPU16, ENDIANNESS::ENDIAN_BIG},
+    {MACHINE_TYPES::POWERPC,   ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::POWERPCFP, ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::R4000,     ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::RISCV32,   ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::RISCV64,   ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::RISCV128,  ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::SH3,       ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::SH3DSP,    ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::SH4,       ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::SH5,       ENDIANNESS::ENDIAN_NONE},
+    {MACHINE_TYPES::THUMB,     ENDIANNESS::ENDIAN_LITTLE},
+    {MACHINE_TYPES::WCEMIPSV2, ENDIANNESS::ENDIAN_LITTLE},
+  };
+
+  const auto it = arch_pe_to_endi_lief.find(machine());
+  if (it == std::end(arch_pe_to_endi_lief)) {
+    LIEF_ERR("Can't find the endianness for {}", to_string(machine()));
+    return ENDIANNESS::ENDIAN_NONE;
+  }
+  return it->second;
+}
+
 void Header::accept(LIEF::Visitor& visitor) const {
   visitor.visit(*this);
 }
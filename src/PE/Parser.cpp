@@ -92,6 +92,12 @@ void Parser::init(const ParserConfig& config) {
   binary_->type_ = type_;
   config_ = config;
 
+  // Keep a reference on the original content (needed by save_snapshot()).
+  // It does not copy the content which is already shared with the sections.
+  if (VectorStream::classof(*stream_)) {
+    stream_->peek_shared_data(binary_->source_, 0, stream_->size());
+  }
+
   if (type_ == PE_TYPE::PE32) {
     parse<details::PE32>();
   } else {
@@ -243,7 +249,7 @@ ok_error_t Parser::parse_sections() {
       LIEF_WARN("Data of section section '{}' is too large (0x{:x})", section->name(), size_to_read);
     } else {
 
-      if (!stream_->peek_data(section->content_, offset, size_to_read)) {
+      if (!stream_->peek_shared_data(section->content_, offset, size_to_read)) {
         LIEF_ERR("Section #{:d} ({}) is corrupted", i, section->name());
       }
 
@@ -272,7 +278,7 @@ ok_error_t Parser::parse_sections() {
         padding_to_read = Parser::MAX_PADDING_SIZE;
       }
 
-      if (!stream_->peek_data(section->padding_, offset + size_to_read, padding_to_read)) {
+      if (!stream_->peek_shared_data(section->padding_, offset + size_to_read, padding_to_read)) {
         LIEF_ERR("Can't read the padding content of section '{}'", section->name());
       }
     }
@@ -1001,6 +1007,31 @@ ok_error_t Parser::parse_signature() {
   LIEF_DEBUG("Signature Offset: 0x{:04x}", signature_offset);
   LIEF_DEBUG("Signature Size:   0x{:04x}", signature_size);
 
+  // The certificate table is copied once in its own buffer which is shared
+  // by the signatures (and their certificates). While the binary is alive,
+  // the whole file is also referenced by binary_->source_ but the signatures
+  // (which can outlive the binary) only retain this table.
+  //
+  // The table can be truncated: only the entries which are in the file
+  // are parsed.
+  if (signature_offset >= stream_->size()) {
+    LIEF_INFO("The certificate table is outside of the file (offset: 0x{:x})", signature_offset);
+    return make_error_code(lief_errors::read_error);
+  }
+  uint64_t table_size = signature_size;
+  if (table_size > stream_->size() - signature_offset) {
+    table_size = stream_->size() - signature_offset;
+    LIEF_INFO("The certificate table is truncated (0x{:x} bytes instead of 0x{:x})",
+              table_size, signature_size);
+  }
+
+  std::vector<uint8_t> raw_table;
+  if (!stream_->peek_data(raw_table, signature_offset, table_size)) {
+    LIEF_INFO("Can't read the certificate table (0x{:x} bytes)", table_size);
+    return make_error_code(lief_errors::read_error);
+  }
+  const auto table = std::make_shared<const SharedContent::buffer_t>(std::move(raw_table));
+
   stream_->setpos(signature_offset);
   while (stream_->pos() < end_p) {
     const uint64_t current_p = stream_->pos();
@@ -1036,13 +1067,16 @@ ok_error_t Parser::parse_signature() {
 
     LIEF_DEBUG("Signature {}r0x{:x} (0x{:x} bytes)", certificate_type, revision, length);
 
-    std::vector<uint8_t> raw_signature;
-    if (!stream_->read_data(raw_signature, length - SIZEOF_HEADER)) {
+    const uint64_t blob_offset = stream_->pos() - signature_offset;
+    const uint64_t blob_size = length - SIZEOF_HEADER;
+    if (blob_offset > table->size() || blob_size > table->size() - blob_offset) {
       LIEF_INFO("Can't read 0x{:x} bytes", length);
       break;
     }
+    SharedContent raw_signature(table, blob_offset, blob_size);
+    stream_->increment_pos(blob_size);
 
-    if (auto sign = SignatureParser::parse(std::move(raw_signature))) {
+    if (auto sign = SignatureParser::parse_blob(raw_signature, /* skip header */ false)) {
       binary_->signatures_.push_back(std::move(*sign));
     } else {
       LIEF_INFO("Unable to parse the signature");
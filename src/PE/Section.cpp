@@ -139,7 +139,7 @@ std::vector<Section::CHARACTERISTICS> Section::characteristics_list() const {
 }
 
 void Section::content(const std::vector<uint8_t>& data) {
-  content_ = data;
+  content_.assign(data);
 }
 
 void Section::pointerto_raw_data(uint32_t pointerToRawData) {
@@ -167,7 +167,8 @@ void Section::accept(LIEF::Visitor& visitor) const {
 }
 
 void Section::clear(uint8_t c) {
-  std::fill(std::begin(content_), std::end(content_), c);
+  std::vector<uint8_t>& content = content_.writable();
+  std::fill(std::begin(content), std::end(content), c);
 }
 
 std::ostream& operator<<(std::ostream& os, const Section& section) {
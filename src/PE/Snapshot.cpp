@@ -0,0 +1,312 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "logging.hpp"
+#include "snapshot.hpp"
+
+#include "LIEF/BinaryStream/VectorStream.hpp"
+
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Parser.hpp"
+#include "LIEF/PE/Export.hpp"
+#include "LIEF/PE/ExportEntry.hpp"
+#include "LIEF/PE/Relocation.hpp"
+#include "LIEF/PE/RelocationEntry.hpp"
+#include "LIEF/PE/Section.hpp"
+#include "LIEF/PE/utils.hpp"
+
+// The PE snapshot only contains the structures whose parsing is expensive
+// (imports, exports and base relocations). The other structures are parsed
+// from the source file with ParserConfig::parse_{imports,exports,reloc}
+// disabled.
+
+namespace LIEF {
+namespace PE {
+
+namespace {
+using snapshot::ref_t;
+
+enum class TABLE : uint32_t {
+  BLOBS = snapshot::BLOBS,
+  IMPORTS,
+  IMPORT_ENTRIES,
+  EXPORT,
+  EXPORT_ENTRIES,
+  RELOCATIONS,
+  RELOCATION_ENTRIES,
+};
+
+struct import_t {
+  ref_t    name;
+  uint32_t import_lookup_table_rva;
+  uint32_t timedatestamp;
+  uint32_t forwarder_chain;
+  uint32_t name_rva;
+  uint32_t import_address_table_rva;
+  uint32_t nb_entries;
+};
+
+struct import_entry_t {
+  ref_t    name;
+  uint64_t data;
+  uint64_t iat_value;
+  uint64_t rva;
+  uint16_t hint;
+  uint8_t  reserved[6];
+};
+
+struct export_t {
+  ref_t    name;
+  uint32_t export_flags;
+  uint32_t timestamp;
+  uint32_t ordinal_base;
+  uint16_t major_version;
+  uint16_t minor_version;
+};
+
+struct export_entry_t {
+  ref_t    name;
+  ref_t    forward_library;
+  ref_t    forward_function;
+  uint32_t function_rva;
+  uint32_t address;
+  uint16_t ordinal;
+  uint8_t  is_extern;
+  uint8_t  reserved[5];
+};
+
+struct relocation_t {
+  uint32_t virtual_address;
+  uint32_t block_size;
+  uint32_t nb_entries;
+  uint32_t reserved;
+};
+
+struct relocation_entry_t {
+  uint16_t position;
+  uint16_t type;
+  uint8_t  reserved[4];
+};
+}
+
+ok_error_t Binary::save_snapshot(const std::string& path) const {
+  if (source_.empty()) {
+    LIEF_ERR("The binary has not been parsed from a file: can't create a snapshot");
+    return make_error_code(lief_errors::not_supported);
+  }
+
+  // The content of the sections is read from the source file
+  for (const std::unique_ptr<Section>& section : sections_) {
+    if (!section->content_.empty() && section->content_.source() != source_.source()) {
+      LIEF_ERR("The content of the section '{}' has been modified: can't create a snapshot",
+               section->name());
+      return make_error_code(lief_errors::not_supported);
+    }
+  }
+
+  snapshot::writer_t writer(EXE_FORMATS::FORMAT_PE, source_.content());
+
+  for (const Import& import : imports_) {
+    import_t imp = {};
+    imp.name                     = writer.add(import.name_);
+    imp.import_lookup_table_rva  = import.import_lookup_table_RVA_;
+    imp.timedatestamp            = import.timedatestamp_;
+    imp.forwarder_chain          = import.forwarder_chain_;
+    imp.name_rva                 = import.name_RVA_;
+    imp.import_address_table_rva = import.import_address_table_RVA_;
+    imp.nb_entries               = import.entries_.size();
+    writer.push(TABLE::IMPORTS, imp);
+
+    for (const ImportEntry& entry : import.entries()) {
+      import_entry_t raw = {};
+      raw.name      = writer.add(entry.name());
+      raw.data      = entry.data();
+      raw.iat_value = entry.iat_value();
+      raw.rva       = entry.iat_address();
+      raw.hint      = entry.hint();
+      writer.push(TABLE::IMPORT_ENTRIES, raw);
+    }
+  }
+
+  if (export_ != nullptr) {
+    export_t exp = {};
+    exp.name          = writer.add(export_->name());
+    exp.export_flags  = export_->export_flags();
+    exp.timestamp     = export_->timestamp();
+    exp.ordinal_base  = export_->ordinal_base();
+    exp.major_version = export_->major_version();
+    exp.minor_version = export_->minor_version();
+    writer.push(TABLE::EXPORT, exp);
+
+    for (const ExportEntry& entry : export_->entries()) {
+      const ExportEntry::forward_information_t fwd = entry.forward_information();
+      export_entry_t raw = {};
+      raw.name             = writer.add(entry.name());
+      raw.forward_library  = writer.add(fwd.library);
+      raw.forward_function = writer.add(fwd.function);
+      raw.function_rva     = entry.function_rva();
+      raw.address          = entry.address();
+      raw.ordinal          = entry.ordinal();
+      raw.is_extern        = entry.is_extern();
+      writer.push(TABLE::EXPORT_ENTRIES, raw);
+    }
+  }
+
+  for (const std::unique_ptr<Relocation>& reloc : relocations_) {
+    relocation_t raw = {};
+    raw.virtual_address = reloc->virtual_address();
+    raw.block_size      = reloc->block_size();
+    raw.nb_entries      = reloc->entries().size();
+    writer.push(TABLE::RELOCATIONS, raw);
+
+    for (const RelocationEntry& entry : reloc->entries()) {
+      relocation_entry_t raw_entry = {};
+      raw_entry.position = entry.position();
+      raw_entry.type     = static_cast<uint16_t>(entry.type());
+      writer.push(TABLE::RELOCATION_ENTRIES, raw_entry);
+    }
+  }
+
+  return writer.write(path);
+}
+
+std::unique_ptr<Binary> Parser::parse_snapshot(const std::string& snapshot,
+                                               const std::string& source)
+{
+  auto stream = VectorStream::from_file(source);
+  if (!stream) {
+    LIEF_ERR("Can't open {}", source);
+    return nullptr;
+  }
+
+  auto reader = snapshot::reader_t::open(snapshot, EXE_FORMATS::FORMAT_PE,
+                                         stream->content());
+  if (!reader) {
+    LIEF_ERR("Can't load the snapshot {}", snapshot);
+    return nullptr;
+  }
+
+  if (!is_pe(*stream)) {
+    return nullptr;
+  }
+
+  ParserConfig config = ParserConfig::all();
+  config.parse_imports = false;
+  config.parse_exports = false;
+  config.parse_reloc   = false;
+
+  Parser parser{std::make_unique<VectorStream>(std::move(*stream))};
+  parser.init(config);
+  if (parser.binary_ == nullptr) {
+    return nullptr;
+  }
+  Binary& binary = *parser.binary_;
+
+  // Imports
+  DataDirectory* import_dir = binary.data_directory(DataDirectory::TYPES::IMPORT_TABLE);
+  DataDirectory* iat_dir    = binary.data_directory(DataDirectory::TYPES::IAT);
+  if (import_dir != nullptr && import_dir->RVA() > 0) {
+    if (Section* section = import_dir->section()) {
+      section->add_type(PE_SECTION_TYPES::IMPORT);
+    }
+  }
+
+  span<const import_entry_t> import_entries =
+    reader->records<import_entry_t>(TABLE::IMPORT_ENTRIES);
+  size_t entry_idx = 0;
+  for (const import_t& imp : reader->records<import_t>(TABLE::IMPORTS)) {
+    Import import;
+    import.name_                     = reader->str(imp.name);
+    import.import_lookup_table_RVA_  = imp.import_lookup_table_rva;
+    import.timedatestamp_            = imp.timedatestamp;
+    import.forwarder_chain_          = imp.forwarder_chain;
+    import.name_RVA_                 = imp.name_rva;
+    import.import_address_table_RVA_ = imp.import_address_table_rva;
+    import.directory_                = import_dir;
+    import.iat_directory_            = iat_dir;
+    import.type_                     = parser.type_;
+
+    import.entries_.reserve(imp.nb_entries);
+    for (uint32_t i = 0; i < imp.nb_entries && entry_idx < import_entries.size(); ++i) {
+      const import_entry_t& raw = import_entries[entry_idx++];
+      ImportEntry entry;
+      entry.name_      = reader->str(raw.name);
+      entry.data_      = raw.data;
+      entry.iat_value_ = raw.iat_value;
+      entry.rva_       = raw.rva;
+      entry.hint_      = raw.hint;
+      entry.type_      = parser.type_;
+      import.entries_.push_back(std::move(entry));
+    }
+    binary.imports_.push_back(std::move(import));
+  }
+
+  // Exports
+  for (const export_t& exp : reader->records<export_t>(TABLE::EXPORT)) {
+    auto export_object = std::make_unique<Export>();
+    export_object->name_          = reader->str(exp.name);
+    export_object->export_flags_  = exp.export_flags;
+    export_object->timestamp_     = exp.timestamp;
+    export_object->ordinal_base_  = exp.ordinal_base;
+    export_object->major_version_ = exp.major_version;
+    export_object->minor_version_ = exp.minor_version;
+
+    span<const export_entry_t> entries = reader->records<export_entry_t>(TABLE::EXPORT_ENTRIES);
+    export_object->entries_.reserve(entries.size());
+    for (const export_entry_t& raw : entries) {
+      ExportEntry entry{raw.address, raw.is_extern != 0, raw.ordinal, raw.function_rva};
+      entry.name_ = reader->str(raw.name);
+      std::string library = reader->str(raw.forward_library);
+      std::string function = reader->str(raw.forward_function);
+      if (!library.empty() || !function.empty()) {
+        entry.set_forward_info(std::move(library), std::move(function));
+      }
+      export_object->entries_.push_back(std::move(entry));
+    }
+    binary.export_ = std::move(export_object);
+  }
+
+  // Relocations
+  if (DataDirectory* dir = binary.data_directory(DataDirectory::TYPES::BASE_RELOCATION_TABLE)) {
+    if (dir->RVA() > 0) {
+      if (Section* section = dir->section()) {
+        section->add_type(PE_SECTION_TYPES::RELOCATION);
+      }
+    }
+  }
+
+  span<const relocation_entry_t> reloc_entries =
+    reader->records<relocation_entry_t>(TABLE::RELOCATION_ENTRIES);
+  entry_idx = 0;
+  for (const relocation_t& raw : reader->records<relocation_t>(TABLE::RELOCATIONS)) {
+    auto relocation = std::make_unique<Relocation>();
+    relocation->virtual_address_ = raw.virtual_address;
+    relocation->block_size_      = raw.block_size;
+    relocation->entries_.reserve(raw.nb_entries);
+    for (uint32_t i = 0; i < raw.nb_entries && entry_idx < reloc_entries.size(); ++i) {
+      const relocation_entry_t& raw_entry = reloc_entries[entry_idx++];
+      auto entry = std::make_unique<RelocationEntry>(
+          raw_entry.position, static_cast<RELOCATIONS_BASE_TYPES>(raw_entry.type));
+      entry->relocation_ = relocation.get();
+      relocation->entries_.push_back(std::move(entry));
+    }
+    binary.relocations_.push_back(std::move(relocation));
+  }
+
+  return std::move(parser.binary_);
+}
+
+}
+}
@@ -45,159 +45,83 @@ std::string escape_non_ascii(const std::string& s) {
   return result;
 }
 
-void JsonVisitor::visit(const Binary& binary) {
-  node_["entrypoint"]   = binary.entrypoint();
-  node_["virtual_size"] = binary.virtual_size();
-
-  // DOS Header
-  JsonVisitor dos_header_visitor;
-  dos_header_visitor(binary.dos_header());
+// Top-level entries of a Binary for both JsonVisitor::visit(const Binary&)
+// (JsonTree) and stream_json() (JsonStream)
+template<class Writer>
+static void serialize(const Binary& binary, Writer& writer) {
+  writer.begin()
+    .value("entrypoint",   binary.entrypoint())
+    .value("virtual_size", binary.virtual_size());
 
-  // Rich Header
   if (const RichHeader* rheader = binary.rich_header()) {
-    JsonVisitor visitor;
-    visitor(*rheader);
-    node_["rich_header"] = visitor.get();
-  }
-
-  // PE header
-  JsonVisitor header_visitor;
-  header_visitor(binary.header());
-
-  // PE Optional Header
-  JsonVisitor optional_header_visitor;
-  optional_header_visitor(binary.optional_header());
-
-  node_["dos_header"]      = dos_header_visitor.get();
-  node_["header"]          = header_visitor.get();
-  node_["optional_header"] = optional_header_visitor.get();
-
-  // Data directories
-  std::vector<json> data_directories;
-  for (const DataDirectory& data_directory : binary.data_directories()) {
-    JsonVisitor visitor;
-    visitor(data_directory);
-    data_directories.emplace_back(visitor.get());
+    writer.template object<JsonVisitor>("rich_header", *rheader);
   }
-  node_["data_directories"] = data_directories;
 
+  writer
+    .template object<JsonVisitor>("dos_header",      binary.dos_header())
+    .template object<JsonVisitor>("header",          binary.header())
+    .template object<JsonVisitor>("optional_header", binary.optional_header())
+    .template list<JsonVisitor>("data_directories",  binary.data_directories())
+    .template list<JsonVisitor>("sections",          binary.sections());
 
-  // Section
-  std::vector<json> sections;
-  for (const Section& section : binary.sections()) {
-    JsonVisitor visitor;
-    visitor(section);
-    sections.emplace_back(visitor.get());
-  }
-  node_["sections"] = sections;
-
-  // Relocations
   if (binary.has_relocations()) {
-    std::vector<json> relocations;
-    for (const Relocation& relocation : binary.relocations()) {
-      JsonVisitor visitor;
-      visitor(relocation);
-      relocations.emplace_back(visitor.get());
-    }
-    node_["relocations"] = relocations;
+    writer.template list<JsonVisitor>("relocations", binary.relocations());
   }
 
-  // TLS
   if (const TLS* tls_object = binary.tls()) {
-    JsonVisitor visitor;
-    visitor(*tls_object);
-    node_["tls"] = visitor.get();
+    writer.template object<JsonVisitor>("tls", *tls_object);
   }
 
-
-  // Exports
   if (const Export* exp = binary.get_export()) {
-    JsonVisitor visitor;
-    visitor(*exp);
-    node_["export"] = visitor.get();
+    writer.template object<JsonVisitor>("export", *exp);
   }
 
-
-  // Debug
   if (binary.has_debug()) {
-    std::vector<json> debug_entries;
-    for (const Debug& debug : binary.debug()) {
-      JsonVisitor visitor;
-      visitor(debug);
-      debug_entries.emplace_back(visitor.get());
-    }
-    node_["debug"] = debug_entries;
+    writer.template list<JsonVisitor>("debug", binary.debug());
   }
 
-  // Imports
   if (binary.has_imports()) {
-    std::vector<json> imports;
-    for (const Import& import : binary.imports()) {
-      JsonVisitor visitor;
-      visitor(import);
-      imports.emplace_back(visitor.get());
-    }
-    node_["imports"] = imports;
+    writer.template list<JsonVisitor>("imports", binary.imports());
   }
 
-  // Delay Imports
   if (binary.has_delay_imports()) {
-    std::vector<json> imports;
-    for (const DelayImport& import : binary.delay_imports()) {
-      JsonVisitor visitor;
-      visitor(import);
-      imports.emplace_back(visitor.get());
-    }
-    node_["delay_imports"] = imports;
+    writer.template list<JsonVisitor>("delay_imports", binary.delay_imports());
   }
 
-  // Resources
   if (binary.has_resources()) {
-    JsonVisitor visitor;
-    binary.resources()->accept(visitor);
+    writer.template accept_object<JsonVisitor>("resources_tree", *binary.resources());
 
     JsonVisitor manager_visitor;
-
-    if (auto manager = binary.resources_manager()) {
-      manager->accept(manager_visitor);
+    if (writer.enabled("resources_manager")) {
+      if (auto manager = binary.resources_manager()) {
+        manager->accept(manager_visitor);
+      }
     }
-
-    node_["resources_tree"]    = visitor.get();
-    node_["resources_manager"] = manager_visitor.get();
+    writer.entry("resources_manager", manager_visitor.get());
   }
 
-
-  // Signatures
-  std::vector<json> sigs;
   if (binary.has_signatures()) {
-    for (const Signature& sig : binary.signatures()) {
-      JsonVisitor visitor;
-      visitor(sig);
-      sigs.push_back(visitor.get());
-    }
-    node_["signatures"] = sigs;
+    writer.template list<JsonVisitor>("signatures", binary.signatures());
   }
 
-  std::vector<json> symbols;
-  for (const Symbol& symbol : binary.symbols()) {
-    JsonVisitor visitor;
-    visitor(symbol);
-    symbols.emplace_back(visitor.get());
-  }
-  if (!symbols.empty()) {
-    node_["symbols"] = symbols;
+  if (!binary.symbols().empty()) {
+    writer.template list<JsonVisitor>("symbols", binary.symbols());
   }
 
-  // Load Configuration
   if (binary.has_configuration()) {
-    JsonVisitor visitor;
-    const LoadConfiguration* config = binary.load_configuration();
-    config->accept(visitor);
-    node_["load_configuration"] = visitor.get();
+    writer.template accept_object<JsonVisitor>("load_configuration", *binary.load_configuration());
   }
+  writer.end();
+}
 
+void JsonVisitor::visit(const Binary& binary) {
+  JsonTree tree(node_);
+  serialize(binary, tree);
 }
 
+void stream_json(const Binary& binary, JsonStream& stream) {
+  serialize(binary, stream);
+}
 
 void JsonVisitor::visit(const DosHeader& dos_header) {
   node_["magic"]                       = dos_header.magic();
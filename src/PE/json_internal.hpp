@@ -19,6 +19,7 @@
 
 #include "LIEF/visibility.h"
 #include "visitors/json.hpp"
+#include "visitors/json_stream.hpp"
 
 namespace LIEF {
 
@@ -179,6 +180,10 @@ class JsonVisitor : public LIEF::JsonVisitor {
   void visit(const LIEF::Section& section) override;
 };
 
+//! Stream the JSON representation of the given binary.
+//! The top-level entries are the same as JsonVisitor::visit(const Binary&)
+void stream_json(const Binary& binary, JsonStream& stream);
+
 }
 }
 
@@ -311,14 +311,15 @@ Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const
     return flags | VERIFICATION_FLAGS::CORRUPTED_CONTENT_INFO;
   }
 
-  if (original_raw_signature_.empty()) {
+  if (raw_.empty()) {
     LIEF_WARN("Original raw signature is empty");
     return flags | VERIFICATION_FLAGS::CORRUPTED_CONTENT_INFO;
   }
 
+  const span<const uint8_t> raw = raw_.content();
   std::vector<uint8_t> raw_content_info = {
-    std::begin(original_raw_signature_) + content_info_start_,
-    std::begin(original_raw_signature_) + content_info_end_
+    raw.begin() + content_info_start_,
+    raw.begin() + content_info_end_
   };
 
   const std::vector<uint8_t> content_info_hash = Signature::hash(std::move(raw_content_info), digest_algo);
@@ -412,8 +413,8 @@ Signature::VERIFICATION_FLAGS Signature::check(VERIFICATION_CHECKS checks) const
 }
 
 
-const std::vector<uint8_t>& Signature::raw_der() const {
-  return original_raw_signature_;
+span<const uint8_t> Signature::raw_der() const {
+  return raw_.content();
 }
 
 
@@ -78,39 +78,82 @@ result<Signature> SignatureParser::parse(const std::string& path) {
   return SignatureParser::parse(std::move(raw_blob));
 }
 
+// The certificates reference the DER blob of the signature: make sure that it
+// is backed by a refcounted buffer
+inline SharedContent make_shared_blob(SharedContent blob) {
+  if (blob.is_shared()) {
+    return blob;
+  }
+  const size_t size = blob.size();
+  auto source = std::make_shared<const SharedContent::buffer_t>(std::move(blob.writable()));
+  return SharedContent(std::move(source), 0, size);
+}
+
+// The overloads which don't take the blob (kept for compatibility) parse a
+// copy of the stream's content which is then shared by the parsed objects
+template<class Func>
+auto parse_with_blob(BinaryStream& stream, Func&& func) -> decltype(func(stream, SharedContent{})) {
+  SharedContent content;
+  if (!stream.peek_shared_data(content, 0, stream.size())) {
+    return make_error_code(lief_errors::read_error);
+  }
+  const SharedContent blob = make_shared_blob(std::move(content));
+  SpanStream span_stream(blob.content());
+  span_stream.setpos(stream.pos());
+  auto res = func(span_stream, blob);
+  stream.setpos(span_stream.pos());
+  return res;
+}
+
 result<Signature> SignatureParser::parse(std::vector<uint8_t> data, bool skip_header) {
-  if (data.size() < 10) {
+  return parse_blob(SharedContent(std::move(data)), skip_header);
+}
+
+result<Signature> SignatureParser::parse_blob(SharedContent content, bool skip_header) {
+  const SharedContent blob = make_shared_blob(std::move(content));
+  if (blob.size() < 10) {
     return make_error_code(lief_errors::read_error);
   }
-  auto stream = std::make_unique<VectorStream>(std::move(data));
+  SpanStream stream(blob.content());
   if (skip_header) {
-    stream->increment_pos(8);
+    stream.increment_pos(8);
   }
 
-  SignatureParser parser;
-  auto sig = SignatureParser::parse_signature(*stream);
+  auto sig = SignatureParser::parse_signature(stream, blob);
   if (!sig) {
     LIEF_ERR("Error while parsing the signature");
     return make_error_code(sig.error());
   }
-  return sig.value();
+  return std::move(*sig);
 }
 
-
 result<Signature> SignatureParser::parse(BinaryStream& stream, bool skip_header) {
+  // The signature references the stream's content which is shared if the
+  // stream supports it and copied otherwise
+  SharedContent content;
+  if (!stream.peek_shared_data(content, 0, stream.size())) {
+    return make_error_code(lief_errors::read_error);
+  }
+  const SharedContent blob = make_shared_blob(std::move(content));
+  SpanStream span_stream(blob.content());
+  span_stream.setpos(stream.pos());
   if (skip_header) {
-    stream.increment_pos(8);
+    span_stream.increment_pos(8);
   }
-  return parse_signature(stream);
+  auto sig = parse_signature(span_stream, blob);
+  stream.setpos(span_stream.pos());
+  return sig;
 }
 
 result<Signature> SignatureParser::parse_signature(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_signature(stream, blob);
+  });
+}
+
+result<Signature> SignatureParser::parse_signature(BinaryStream& stream, const SharedContent& blob) {
   Signature signature;
-  if (VectorStream::classof(stream)) {
-    signature.original_raw_signature_ = static_cast<VectorStream&>(stream).content();
-  } else if (SpanStream::classof(stream)) {
-    signature.original_raw_signature_ = static_cast<SpanStream&>(stream).content();
-  }
+  signature.raw_ = blob.slice(stream.start() - blob.data(), stream.size());
   ASN1Reader asn1r(stream);
   auto tag = asn1r.read_tag(MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE);
   if (!tag) {
@@ -282,7 +325,7 @@ result<Signature> SignatureParser::parse_signature(BinaryStream& stream) {
     SpanStream certificate_stream{stream.p(), tag.value()};
     stream.increment_pos(tag.value());
 
-    auto certificates = parse_certificates(certificate_stream);
+    auto certificates = parse_certificates(certificate_stream, blob);
     if (certificates) {
       // Makes chain
       signature.certificates_ = std::move(*certificates);
@@ -310,7 +353,7 @@ result<Signature> SignatureParser::parse_signature(BinaryStream& stream) {
     const size_t raw_content_size = tag.value();
     SpanStream signers_stream{stream.p(), raw_content_size};
     stream.increment_pos(raw_content_size);
-    auto signer_info = parse_signer_infos(signers_stream);
+    auto signer_info = parse_signer_infos(signers_stream, blob);
     if (!signer_info) {
       LIEF_INFO("Fail to parse pkcs7-signed-data.signer-infos");
     } else {
@@ -508,19 +551,28 @@ SignatureParser::parse_spc_indirect_data(BinaryStream& stream, range_t& range) {
               stream.pos());
     return make_error_code(digest.error());
   }
-  indirect_data->digest_ = std::move(digest.value());
+  indirect_data->digest_ = {digest->begin(), digest->end()};
   LIEF_DEBUG("spc-indirect-data-content.digest: {}",
              hex_dump(indirect_data->digest_));
   return indirect_data;
 }
 
-result<SignatureParser::x509_certificates_t> SignatureParser::parse_certificates(BinaryStream& stream) {
+result<SignatureParser::x509_certificates_t>
+SignatureParser::parse_certificates(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_certificates(stream, blob);
+  });
+}
+
+result<SignatureParser::x509_certificates_t>
+SignatureParser::parse_certificates(BinaryStream& stream, const SharedContent& blob) {
   ASN1Reader asn1r(stream);
 
   x509_certificates_t certificates;
   const uint64_t cert_end_p = stream.size();
   while (stream.pos() < cert_end_p) {
-    auto cert = asn1r.read_cert();
+    // The certificate references the DER blob of the signature
+    auto cert = asn1r.read_cert(/* copy */ false);
     if (!cert) {
       LIEF_INFO("Can't parse X509 cert pkcs7-signed-data.certificates (pos: {:d})", stream.pos());
       return make_error_code(cert.error());
@@ -533,13 +585,21 @@ result<SignatureParser::x509_certificates_t> SignatureParser::parse_certificates
       mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", cert_p.get());
       LIEF_DEBUG("\n{}\n", buffer.data());
     }
-    certificates.emplace_back(cert_p.release());
+    certificates.push_back(x509(cert_p.release(), blob.source()));
   }
   return certificates;
 }
 
 
-result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(BinaryStream& stream) {
+result<SignatureParser::signer_infos_t>
+SignatureParser::parse_signer_infos(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_signer_infos(stream, blob);
+  });
+}
+
+result<SignatureParser::signer_infos_t>
+SignatureParser::parse_signer_infos(BinaryStream& stream, const SharedContent& blob) {
   const uintptr_t end_set = stream.size();
 
   signer_infos_t infos;
@@ -611,7 +671,7 @@ result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(Bina
     }
 
     LIEF_DEBUG("pkcs7-signed-data.signer-infos.issuer-and-serial-number.serial-number {}", hex_dump(sn.value()));
-    signer.serialno_ = std::move(sn.value());
+    signer.serialno_ = {sn->begin(), sn->end()};
 
     // =======================================================
     // Digest Encryption Algorithm
@@ -645,7 +705,7 @@ result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(Bina
         const uint64_t auth_attr_end = stream.pos() + tag.value();
         SpanStream auth_stream(stream.p(), tag.value());
         stream.increment_pos(auth_stream.size());
-        auto authenticated_attributes = parse_attributes(auth_stream);
+        auto authenticated_attributes = parse_attributes(auth_stream, blob);
         if (!authenticated_attributes) {
           LIEF_INFO("Fail to parse pkcs7-signed-data.signer-infos.authenticated-attributes");
         } else {
@@ -687,7 +747,7 @@ result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(Bina
       }
       LIEF_DEBUG("pkcs7-signed-data.signer-infos.encrypted-digest: {}",
                  hex_dump(enc_digest.value()).substr(0, 10));
-      signer.encrypted_digest_ = enc_digest.value();
+      signer.encrypted_digest_ = {enc_digest->begin(), enc_digest->end()};
     }
 
     // =======================================================
@@ -700,7 +760,7 @@ result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(Bina
       if (tag) {
         SpanStream unauth_stream(stream.p(), tag.value());
         stream.increment_pos(unauth_stream.size());
-        auto unauthenticated_attributes = parse_attributes(unauth_stream);
+        auto unauthenticated_attributes = parse_attributes(unauth_stream, blob);
         if (!unauthenticated_attributes) {
           LIEF_INFO("Fail to parse pkcs7-signed-data.signer-infos.unauthenticated-attributes");
         } else {
@@ -720,6 +780,13 @@ result<SignatureParser::signer_infos_t> SignatureParser::parse_signer_infos(Bina
 
 result<SignatureParser::attributes_t>
 SignatureParser::parse_attributes(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_attributes(stream, blob);
+  });
+}
+
+result<SignatureParser::attributes_t>
+SignatureParser::parse_attributes(BinaryStream& stream, const SharedContent& blob) {
   // Attributes ::= SET OF Attribute
   //
   // Attribute ::= SEQUENCE
@@ -788,23 +855,23 @@ SignatureParser::parse_attributes(BinaryStream& stream) {
       // }
 
       else if (oid_str == /* pkcs9-CounterSignature */ "1.2.840.113549.1.9.6") {
-        auto res = parse_pkcs9_counter_sign(value_stream);
+        auto res = parse_pkcs9_counter_sign(value_stream, blob);
         if (!res) {
           LIEF_INFO("Can't parse pkcs9-counter-sign attribute");
         } else {
-          const std::vector<SignerInfo>& signers = res.value();
+          std::vector<SignerInfo>& signers = res.value();
           if (signers.empty()) {
             LIEF_INFO("Can't parse signer info associated with the pkcs9-counter-sign");
           } else if (signers.size() > 1) {
             LIEF_INFO("More than one signer info associated with the pkcs9-counter-sign");
           } else {
-            attributes.push_back(std::make_unique<PKCS9CounterSignature>(signers.back()));
+            attributes.push_back(std::make_unique<PKCS9CounterSignature>(std::move(signers.back())));
           }
         }
       }
 
       else if (oid_str == /* Ms-SpcNestedSignature */ "1.3.6.1.4.1.311.2.4.1") {
-        auto res = parse_ms_spc_nested_signature(value_stream);
+        auto res = parse_ms_spc_nested_signature(value_stream, blob);
         if (!res) {
           LIEF_INFO("Can't parse ms-spc-nested-signature attribute");
         } else {
@@ -938,31 +1005,47 @@ result<std::unique_ptr<Attribute>> SignatureParser::parse_ms_counter_sign(Binary
   return {};
 }
 
-result<SignatureParser::signer_infos_t> SignatureParser::parse_pkcs9_counter_sign(BinaryStream& stream) {
+result<SignatureParser::signer_infos_t>
+SignatureParser::parse_pkcs9_counter_sign(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_pkcs9_counter_sign(stream, blob);
+  });
+}
+
+result<SignatureParser::signer_infos_t>
+SignatureParser::parse_pkcs9_counter_sign(BinaryStream& stream, const SharedContent& blob) {
   // counterSignature ATTRIBUTE ::= {
   //          WITH SYNTAX SignerInfo
   //          ID pkcs-9-at-counterSignature
   //  }
   LIEF_DEBUG("Parsing pkcs9-CounterSign ({} bytes)", stream.size());
-  auto counter_sig = parse_signer_infos(stream);
+  auto counter_sig = parse_signer_infos(stream, blob);
   if (!counter_sig) {
     LIEF_INFO("Fail to parse pkcs9-counter-signature");
     return make_error_code(counter_sig.error());
   }
   LIEF_DEBUG("pkcs9-counter-signature remaining bytes: {}", stream.size() - stream.pos());
-  return counter_sig.value();
+  return std::move(*counter_sig);
+}
+
+result<Signature>
+SignatureParser::parse_ms_spc_nested_signature(BinaryStream& stream) {
+  return parse_with_blob(stream, [] (BinaryStream& stream, const SharedContent& blob) {
+    return parse_ms_spc_nested_signature(stream, blob);
+  });
 }
 
-result<Signature> SignatureParser::parse_ms_spc_nested_signature(BinaryStream& stream) {
+result<Signature>
+SignatureParser::parse_ms_spc_nested_signature(BinaryStream& stream, const SharedContent& blob) {
   // SET of pkcs7-signed data
   LIEF_DEBUG("Parsing Ms-SpcNestedSignature ({} bytes)", stream.size());
-  auto sign = SignatureParser::parse(stream, /* skip header */ false);
+  auto sign = SignatureParser::parse_signature(stream, blob);
   if (!sign) {
     LIEF_INFO("Ms-SpcNestedSignature finished with errors");
     return make_error_code(sign.error());
   }
   LIEF_DEBUG("ms-spc-nested-signature remaining bytes: {}", stream.size() - stream.pos());
-  return sign.value();
+  return std::move(*sign);
 }
 
 result<std::vector<uint8_t>> SignatureParser::parse_pkcs9_message_digest(BinaryStream& stream) {
@@ -973,10 +1056,9 @@ result<std::vector<uint8_t>> SignatureParser::parse_pkcs9_message_digest(BinaryS
               stream.pos());
     return make_error_code(digest.error());
   }
-  const std::vector<uint8_t>& raw_digest = digest.value();
-  LIEF_DEBUG("attribute.pkcs9-message-digest {}", hex_dump(raw_digest));
+  LIEF_DEBUG("attribute.pkcs9-message-digest {}", hex_dump(*digest));
   LIEF_DEBUG("pkcs9-message-digest remaining bytes: {}", stream.size() - stream.pos());
-  return raw_digest;
+  return std::vector<uint8_t>{digest->begin(), digest->end()};
 }
 
 result<oid_t> SignatureParser::parse_ms_spc_statement_type(BinaryStream& stream) {
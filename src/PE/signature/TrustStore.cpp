@@ -0,0 +1,214 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mbedtls/x509_crt.h"
+#include "mbedtls/error.h"
+
+#include "logging.hpp"
+#include "hash_stream.hpp"
+
+#include "LIEF/PE/signature/TrustStore.hpp"
+#include "LIEF/PE/signature/Signature.hpp"
+#include "LIEF/PE/signature/SignerInfo.hpp"
+
+namespace LIEF {
+namespace PE {
+
+namespace {
+// Append the (already parsed) certificate to the given chain. The DER blob is
+// not copied: it is owned by the x509 object which must outlive the chain
+inline int append(mbedtls_x509_crt& chain, const mbedtls_x509_crt& crt) {
+  return mbedtls_x509_crt_parse_der_nocopy(&chain, crt.raw.p, crt.raw.len);
+}
+
+inline std::string error_str(int ret) {
+  std::string strerr(1024, 0);
+  mbedtls_strerror(ret, const_cast<char*>(strerr.data()), strerr.size());
+  return strerr.c_str();
+}
+
+void free_chain(mbedtls_x509_crt* chain) {
+  mbedtls_x509_crt_free(chain);
+  delete chain;
+}
+}
+
+TrustStore::TrustStore(certificates_t roots) :
+  roots_(std::move(roots))
+{}
+
+TrustStore::~TrustStore() {
+  clear_chains();
+}
+
+void TrustStore::add(const x509& cert) {
+  roots_.push_back(cert);
+  clear_chains();
+  clear_cache();
+}
+
+void TrustStore::clear_chains() {
+  std::lock_guard<std::mutex> guard(lock_);
+  for (mbedtls_x509_crt* chain : chains_) {
+    free_chain(chain);
+  }
+  chains_.clear();
+}
+
+size_t TrustStore::cache_size() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return cache_.size();
+}
+
+size_t TrustStore::max_cache_size() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return max_cache_size_;
+}
+
+void TrustStore::max_cache_size(size_t size) {
+  std::lock_guard<std::mutex> guard(lock_);
+  max_cache_size_ = size;
+  evict();
+}
+
+void TrustStore::clear_cache() {
+  std::lock_guard<std::mutex> guard(lock_);
+  cache_.clear();
+  cache_order_.clear();
+}
+
+void TrustStore::evict() const {
+  // Must be called with lock_ held
+  while (cache_.size() > max_cache_size_) {
+    cache_.erase(cache_order_.front());
+    cache_order_.pop_front();
+  }
+}
+
+mbedtls_x509_crt* TrustStore::acquire() const {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!chains_.empty()) {
+      mbedtls_x509_crt* chain = chains_.back();
+      chains_.pop_back();
+      return chain;
+    }
+  }
+  // mbedtls lazily updates the internal state of the keys (e.g. RSA's RN)
+  // during the verification. Hence, a chain can't be used by two threads at
+  // the same time and we create a new one if all of them are in use.
+  auto* chain = new mbedtls_x509_crt{};
+  mbedtls_x509_crt_init(chain);
+  for (const x509& root : roots_) {
+    if (root.x509_cert_ == nullptr) {
+      continue;
+    }
+    if (int ret = append(*chain, *root.x509_cert_); ret != 0) {
+      LIEF_WARN("Can't add '{}' to the trust store: {}", root.subject(), error_str(ret));
+    }
+  }
+  return chain;
+}
+
+void TrustStore::release(mbedtls_x509_crt* chain) const {
+  std::lock_guard<std::mutex> guard(lock_);
+  chains_.push_back(chain);
+}
+
+x509::VERIFICATION_FLAGS TrustStore::verify(const x509& cert,
+                                            const certificates_t& intermediates) const
+{
+  using VERIFICATION_FLAGS = x509::VERIFICATION_FLAGS;
+  if (roots_.empty()) {
+    LIEF_WARN("Certificate chain is empty");
+    return VERIFICATION_FLAGS::BADCERT_MISSING;
+  }
+
+  if (cert.x509_cert_ == nullptr) {
+    return VERIFICATION_FLAGS::BADCERT_MISSING;
+  }
+
+  hashstream hs(hashstream::HASH::SHA256);
+  hs.write(cert.x509_cert_->raw.p, cert.x509_cert_->raw.len);
+  for (const x509& crt : intermediates) {
+    if (crt.x509_cert_ != nullptr) {
+      hs.write(crt.x509_cert_->raw.p, crt.x509_cert_->raw.len);
+    }
+  }
+  const std::vector<uint8_t>& digest = hs.raw();
+  std::string fingerprint(digest.begin(), digest.end());
+
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = cache_.find(fingerprint);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+  }
+
+  // The chain to verify: the certificate followed by the intermediates
+  mbedtls_x509_crt chain;
+  mbedtls_x509_crt_init(&chain);
+  if (int ret = append(chain, *cert.x509_cert_); ret != 0) {
+    LIEF_WARN("Can't load '{}': {}", cert.subject(), error_str(ret));
+    mbedtls_x509_crt_free(&chain);
+    return VERIFICATION_FLAGS::BADCERT_MISSING;
+  }
+  for (const x509& crt : intermediates) {
+    if (crt.x509_cert_ == nullptr || crt.x509_cert_ == cert.x509_cert_) {
+      continue;
+    }
+    // On error, mbedtls keeps the certificates already present in the chain
+    if (int ret = append(chain, *crt.x509_cert_); ret != 0) {
+      LIEF_WARN("Can't load the intermediate '{}': {}", crt.subject(), error_str(ret));
+    }
+  }
+
+  mbedtls_x509_crt* trusted = acquire();
+  const VERIFICATION_FLAGS result = x509::verify_chain(chain, *trusted);
+  release(trusted);
+  mbedtls_x509_crt_free(&chain);
+
+  std::lock_guard<std::mutex> guard(lock_);
+  if (max_cache_size_ > 0 && cache_.emplace(fingerprint, result).second) {
+    cache_order_.push_back(std::move(fingerprint));
+    evict();
+  }
+  return result;
+}
+
+x509::VERIFICATION_FLAGS TrustStore::verify(const Signature& sig) const {
+  using VERIFICATION_FLAGS = x509::VERIFICATION_FLAGS;
+  VERIFICATION_FLAGS result = VERIFICATION_FLAGS::OK;
+  for (const SignerInfo& signer : sig.signers()) {
+    const x509* cert = signer.cert();
+    if (cert == nullptr) {
+      LIEF_WARN("Can't find the certificate of the signer '{}'", signer.issuer());
+      result |= VERIFICATION_FLAGS::BADCERT_MISSING;
+      continue;
+    }
+    certificates_t intermediates;
+    for (const x509& crt : sig.certificates()) {
+      if (crt.x509_cert_ != cert->x509_cert_) {
+        intermediates.push_back(crt);
+      }
+    }
+    result |= verify(*cert, intermediates);
+  }
+  return result;
+}
+
+}
+}
@@ -16,6 +16,7 @@
 #include <cstring>
 #include <map>
 #include <fstream>
+#include <mutex>
 
 #include <mbedtls/platform.h>
 #include "mbedtls/x509_crt.h"
@@ -29,6 +30,7 @@
 #include "LIEF/Visitor.hpp"
 
 #include "LIEF/PE/signature/x509.hpp"
+#include "LIEF/PE/signature/TrustStore.hpp"
 #include "LIEF/PE/signature/RsaInfo.hpp"
 #include "LIEF/PE/EnumToString.hpp"
 
@@ -332,24 +334,20 @@ bool x509::time_is_future(const date_t& from) {
 x509::x509() = default;
 
 x509::x509(mbedtls_x509_crt* ca) :
-  x509_cert_{ca}
+  x509_cert_{ca, [] (mbedtls_x509_crt* crt) {
+    mbedtls_x509_crt_free(crt);
+    delete crt;
+  }}
 {}
 
-x509::x509(const x509& other) :
-  Object::Object{other}
-{
-  auto* crt = new mbedtls_x509_crt{};
-  mbedtls_x509_crt_init(crt);
-  int ret = mbedtls_x509_crt_parse_der(crt, other.x509_cert_->raw.p,
-                                       other.x509_cert_->raw.len);
-  if (ret != 0) {
-    LIEF_WARN("Failed to copy x509 certificate");
+x509::x509(mbedtls_x509_crt* ca, std::shared_ptr<const void> owner) :
+  x509_cert_{ca, [owner] (mbedtls_x509_crt* crt) {
+    mbedtls_x509_crt_free(crt);
     delete crt;
-    return;
-  }
+  }}
+{}
 
-  x509_cert_ = crt;
-}
+x509::x509(const x509& other) = default;
 
 x509& x509::operator=(x509 other) {
   swap(other);
@@ -519,11 +517,32 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
     LIEF_WARN("Certificate chain is empty");
     return VERIFICATION_FLAGS::BADCERT_MISSING;
   }
-  std::vector<x509> ca_list = ca; // Explicit copy since we will modify mbedtls_x509_crt->next
-  for (size_t i = 0; i < ca_list.size() - 1; ++i) {
-    ca_list[i].x509_cert_->next = ca_list[i + 1].x509_cert_;
+
+  // is_trusted_by() is usually called several times with the same CA list:
+  // the store (and its chains of roots) of the last list is re-used.
+  static std::mutex lock;
+  static std::shared_ptr<TrustStore> last_store;
+
+  std::shared_ptr<TrustStore> store;
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    const bool is_same = last_store != nullptr &&
+      std::equal(ca.begin(), ca.end(),
+                 last_store->roots().begin(), last_store->roots().end(),
+                 [] (const x509& lhs, const x509& rhs) {
+                   return lhs.x509_cert_ == rhs.x509_cert_;
+                 });
+    if (!is_same) {
+      last_store = std::make_shared<TrustStore>(ca);
+      // The results depend on the current time
+      last_store->max_cache_size(0);
+    }
+    store = last_store;
   }
+  return store->verify(*this);
+}
 
+x509::VERIFICATION_FLAGS x509::verify_chain(mbedtls_x509_crt& chain, mbedtls_x509_crt& trusted) {
   VERIFICATION_FLAGS result = VERIFICATION_FLAGS::OK;
   uint32_t flags = 0;
   mbedtls_x509_crt_profile profile = {
@@ -539,8 +558,8 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
   };
 
   int ret = mbedtls_x509_crt_verify_with_profile(
-      /* crt          */ x509_cert_,
-      /* Trusted CA   */ ca_list.front().x509_cert_,
+      /* crt          */ &chain,
+      /* Trusted CA   */ &trusted,
       /* CA's CRLs    */ nullptr,
       /* profile      */ &profile,
       /* Common Name  */ nullptr,
@@ -556,11 +575,6 @@ x509::VERIFICATION_FLAGS x509::is_trusted_by(const std::vector<x509>& ca) const
     LIEF_WARN("X509 verify failed with: {} (0x{:x})\n{}", strerr, ret, out);
     result = from_mbedtls_err(flags);
   }
-
-  // Clear the chain since ~x509() will delete each object
-  for (size_t i = 0; i < ca_list.size(); ++i) {
-    ca_list[i].x509_cert_->next = nullptr;
-  }
   return result;
 }
 
@@ -578,9 +592,19 @@ x509::VERIFICATION_FLAGS x509::verify(const x509& ca) const {
     1          /* Min RSA key */,
   };
 
+  if (x509_cert_ == nullptr || ca.x509_cert_ == nullptr) {
+    return VERIFICATION_FLAGS::BADCERT_MISSING;
+  }
+
+  // The mbedtls_x509_crt is shared by the copies of a x509 object and mbedtls
+  // lazily updates the internal state of the keys (e.g. RSA's RN) during the
+  // verification. Hence, the verifications on the shared certificates are
+  // serialized.
+  static std::mutex lock;
+  std::lock_guard<std::mutex> guard(lock);
   int ret = mbedtls_x509_crt_verify_with_profile(
-      /* crt          */ ca.x509_cert_,
-      /* Trusted CA   */ x509_cert_,
+      /* crt          */ ca.x509_cert_.get(),
+      /* Trusted CA   */ x509_cert_.get(),
       /* CA's CRLs    */ nullptr,
       /* profile      */ &profile,
       /* Common Name  */ nullptr,
@@ -693,14 +717,11 @@ void x509::accept(Visitor& visitor) const {
   visitor.visit(*this);
 }
 
-x509::~x509() {
-  mbedtls_x509_crt_free(x509_cert_);
-  delete x509_cert_;
-}
+x509::~x509() = default;
 
 std::ostream& operator<<(std::ostream& os, const x509& x509_cert) {
   std::vector<char> buffer(2048, 0);
-  int ret = mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", x509_cert.x509_cert_);
+  int ret = mbedtls_x509_crt_info(buffer.data(), buffer.size(), "", x509_cert.x509_cert_.get());
   if (ret < 0) {
     os << "Can't print certificate information\n";
     return os;
@@ -155,16 +155,17 @@ result<PE_TYPE> get_type(const std::vector<uint8_t>& raw) {
 }
 
 
-std::string get_imphash_std(const Binary& binary) {
+template<class IMPORTS>
+std::string get_imphash_std(const IMPORTS& imports) {
   static const std::set<std::string> ALLOWED_EXT = {"dll", "ocx", "sys"};
   std::vector<uint8_t> md5_buffer(16);
-  if (!binary.has_imports()) {
+  if (std::begin(imports) == std::end(imports)) {
     return "";
   }
   std::string lstr;
   bool first_entry = true;
   hashstream hs(hashstream::HASH::MD5);
-  for (const Import& imp : binary.imports()) {
+  for (const Import& imp : imports) {
     std::string libname = imp.name();
     Import resolved = imp;
     if (auto resolution = resolve_ordinals(imp, /* strict */ false, /* use_std */ true)) {
@@ -211,14 +212,13 @@ std::string get_imphash_std(const Binary& binary) {
 }
 
 
-std::string get_imphash_lief(const Binary& binary) {
+template<class IMPORTS>
+std::string get_imphash_lief(const IMPORTS& imports) {
   std::vector<uint8_t> md5_buffer(16);
-  if (!binary.has_imports()) {
+  if (std::begin(imports) == std::end(imports)) {
     return std::to_string(0);
   }
 
-  Binary::it_const_imports imports = binary.imports();
-
   std::string import_list;
   for (const Import& imp : imports) {
     Import resolved = imp;
@@ -262,11 +262,25 @@ std::string get_imphash(const Binary& binary, IMPHASH_MODE mode) {
   switch (mode) {
     case IMPHASH_MODE::LIEF:
       {
-        return get_imphash_lief(binary);
+        return get_imphash_lief(binary.imports());
       }
     case IMPHASH_MODE::PEFILE:
       {
-        return get_imphash_std(binary);
+        return get_imphash_std(binary.imports());
+      }
+  }
+  return "";
+}
+
+std::string get_imphash(const std::vector<Import>& imports, IMPHASH_MODE mode) {
+  switch (mode) {
+    case IMPHASH_MODE::LIEF:
+      {
+        return get_imphash_lief(imports);
+      }
+    case IMPHASH_MODE::PEFILE:
+      {
+        return get_imphash_std(imports);
       }
   }
   return "";
@@ -389,6 +403,221 @@ ALGORITHMS algo_from_oid(const std::string& oid) {
   return it->second;
 }
 
+// Location of the export directory and of the information needed
+// to translate its RVAs into offsets
+struct raw_exports_t {
+  details::pe_export_directory_table table;
+  uint32_t export_rva        = 0;
+  uint32_t export_size       = 0;
+  uint64_t sections_offset   = 0;
+  uint32_t nb_sections       = 0;
+  uint32_t section_alignment = 0;
+  uint32_t file_alignment    = 0;
+};
+
+static uint64_t raw_rva_to_offset(BinaryStream& stream, const raw_exports_t& exports,
+                                  uint32_t rva)
+{
+  // Same logic as Binary::rva_to_offset()
+  for (size_t i = 0; i < exports.nb_sections; ++i) {
+    const uint64_t offset = exports.sections_offset + i * sizeof(details::pe_section);
+    auto section = stream.peek<details::pe_section>(offset);
+    if (!section) {
+      break;
+    }
+    const uint64_t vsize_adj = std::max<uint64_t>(section->VirtualSize, section->SizeOfRawData);
+    if (section->VirtualAddress <= rva && rva < section->VirtualAddress + vsize_adj) {
+      uint32_t section_alignment = exports.section_alignment;
+      if (section_alignment < 0x1000) {
+        section_alignment = exports.file_alignment;
+      }
+      const uint64_t section_va     = align(section->VirtualAddress, section_alignment);
+      const uint64_t section_offset = align(section->PointerToRawData, exports.file_alignment);
+      return (rva - section_va) + section_offset;
+    }
+  }
+  return rva;
+}
+
+template<class T>
+static void read_alignments(BinaryStream& stream, uint64_t offset, raw_exports_t& exports,
+                            uint64_t& data_dir_offset, uint32_t& nb_data_dir)
+{
+  if (auto opt_hdr = stream.peek<T>(offset)) {
+    exports.section_alignment = opt_hdr->SectionAlignment;
+    exports.file_alignment    = opt_hdr->FileAlignment;
+    data_dir_offset = offset + sizeof(T);
+    nb_data_dir     = opt_hdr->NumberOfRvaAndSize;
+  }
+}
+
+static result<raw_exports_t> read_raw_exports(BinaryStream& stream) {
+  raw_exports_t exports;
+  auto dos_hdr = stream.peek<details::pe_dos_header>(0);
+  if (!dos_hdr || dos_hdr->Magic != /* MZ */0x5a4d) {
+    return make_error_code(lief_errors::file_format_error);
+  }
+
+  const uint64_t hdr_offset = dos_hdr->AddressOfNewExeHeader;
+  auto hdr = stream.peek<details::pe_header>(hdr_offset);
+  if (!hdr || !std::equal(std::begin(hdr->signature), std::end(hdr->signature),
+                          std::begin(details::PE_Magic)))
+  {
+    return make_error_code(lief_errors::file_format_error);
+  }
+
+  const uint64_t opt_hdr_offset = hdr_offset + sizeof(details::pe_header);
+  auto magic = stream.peek<uint16_t>(opt_hdr_offset);
+  if (!magic) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  // Same heuristic as get_type_from_stream() for a corrupted magic
+  bool is64 = *magic == static_cast<uint16_t>(PE_TYPE::PE32_PLUS);
+  if (*magic != static_cast<uint16_t>(PE_TYPE::PE32) && !is64) {
+    is64 = hdr->SizeOfOptionalHeader == SIZEOF_OPT_HEADER_64;
+  }
+
+  uint64_t data_dir_offset = 0;
+  uint32_t nb_data_dir = 0;
+  if (is64) {
+    read_alignments<details::pe64_optional_header>(stream, opt_hdr_offset, exports,
+                                                  data_dir_offset, nb_data_dir);
+  } else {
+    read_alignments<details::pe32_optional_header>(stream, opt_hdr_offset, exports,
+                                                  data_dir_offset, nb_data_dir);
+  }
+
+  if (nb_data_dir == 0) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  // The export table is the first data directory
+  auto export_dir = stream.peek<details::pe_data_directory>(data_dir_offset);
+  if (!export_dir || export_dir->RelativeVirtualAddress == 0) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  exports.export_rva      = export_dir->RelativeVirtualAddress;
+  exports.export_size     = export_dir->Size;
+  exports.sections_offset = opt_hdr_offset + hdr->SizeOfOptionalHeader;
+  exports.nb_sections     = hdr->NumberOfSections;
+
+  const uint64_t table_offset = raw_rva_to_offset(stream, exports, exports.export_rva);
+  auto table = stream.peek<details::pe_export_directory_table>(table_offset);
+  if (!table) {
+    return make_error_code(lief_errors::read_error);
+  }
+  exports.table = *table;
+  return exports;
+}
+
+// strcmp() between the null-terminated string located at the given
+// offset and the given name.
+static result<int> compare_export_name(BinaryStream& stream, uint64_t offset,
+                                       const std::string& name)
+{
+  const uint8_t* start = stream.contiguous_start();
+  const uint64_t size = stream.size();
+  for (size_t i = 0; i <= name.size(); ++i) {
+    uint8_t lhs = 0;
+    if (start != nullptr) {
+      if (offset + i >= size) {
+        return make_error_code(lief_errors::read_error);
+      }
+      lhs = start[offset + i];
+    } else if (auto res = stream.peek<uint8_t>(offset + i)) {
+      lhs = *res;
+    } else {
+      return make_error_code(lief_errors::read_error);
+    }
+    const auto rhs = static_cast<uint8_t>(i < name.size() ? name[i] : '\0');
+    if (lhs != rhs) {
+      return lhs < rhs ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+static result<export_lookup_t> make_export_lookup(BinaryStream& stream,
+                                                  const raw_exports_t& exports,
+                                                  uint32_t index)
+{
+  const details::pe_export_directory_table& table = exports.table;
+  if (index >= table.AddressTableEntries) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  const uint64_t address_table = raw_rva_to_offset(stream, exports, table.ExportAddressTableRVA);
+  auto address = stream.peek<uint32_t>(address_table + index * sizeof(uint32_t));
+  if (!address) {
+    return make_error_code(lief_errors::read_error);
+  }
+
+  if (*address == 0) {
+    return make_error_code(lief_errors::not_found);
+  }
+
+  export_lookup_t lookup;
+  lookup.ordinal   = table.OrdinalBase + index;
+  lookup.address   = *address;
+  lookup.is_extern = exports.export_rva <= *address &&
+                     *address < exports.export_rva + exports.export_size;
+  return lookup;
+}
+
+result<export_lookup_t> find_export(BinaryStream& stream, const std::string& name) {
+  auto exports = read_raw_exports(stream);
+  if (!exports) {
+    return make_error_code(exports.error());
+  }
+
+  const details::pe_export_directory_table& table = exports->table;
+  const uint64_t name_table    = raw_rva_to_offset(stream, *exports, table.NamePointerRVA);
+  const uint64_t ordinal_table = raw_rva_to_offset(stream, *exports, table.OrdinalTableRVA);
+
+  // The name pointer table is sorted in the lexical order
+  // so that the loader can perform a binary search on it.
+  uint64_t lo = 0;
+  uint64_t hi = table.NumberOfNamePointers;
+  while (lo < hi) {
+    const uint64_t mid = lo + (hi - lo) / 2;
+    auto name_rva = stream.peek<uint32_t>(name_table + mid * sizeof(uint32_t));
+    if (!name_rva) {
+      return make_error_code(lief_errors::read_error);
+    }
+    auto cmp = compare_export_name(stream, raw_rva_to_offset(stream, *exports, *name_rva), name);
+    if (!cmp) {
+      return make_error_code(cmp.error());
+    }
+
+    if (*cmp < 0) {
+      lo = mid + 1;
+    } else if (*cmp > 0) {
+      hi = mid;
+    } else {
+      auto index = stream.peek<uint16_t>(ordinal_table + mid * sizeof(uint16_t));
+      if (!index) {
+        return make_error_code(lief_errors::read_error);
+      }
+      return make_export_lookup(stream, *exports, *index);
+    }
+  }
+  return make_error_code(lief_errors::not_found);
+}
+
+result<export_lookup_t> find_export(BinaryStream& stream, uint32_t ordinal) {
+  auto exports = read_raw_exports(stream);
+  if (!exports) {
+    return make_error_code(exports.error());
+  }
+
+  if (ordinal < exports->table.OrdinalBase) {
+    return make_error_code(lief_errors::not_found);
+  }
+  return make_export_lookup(stream, *exports, ordinal - exports->table.OrdinalBase);
+}
+
 
 }
 }
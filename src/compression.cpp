@@ -0,0 +1,283 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <climits>
+
+#include "LIEF/config.h"
+#include "LIEF/BinaryStream/BinaryStream.hpp"
+
+#include "logging.hpp"
+#include "compression.hpp"
+
+#if defined(LIEF_ZLIB_SUPPORT)
+#include <zlib.h>
+#endif
+
+#if defined(LIEF_ZSTD_SUPPORT)
+#include <zstd.h>
+#endif
+
+namespace LIEF {
+namespace compression {
+
+// Size of the chunks inflated by the decompression streams
+static constexpr size_t STREAM_CHUNK_SIZE = 0x10000;
+
+//! Base class of the streams which decompress the data on demand:
+//! the decompressed data are buffered up to the furthest offset read.
+class DecompressionStream : public BinaryStream {
+  public:
+  DecompressionStream(std::vector<uint8_t> input, size_t size) :
+    input_(std::move(input)),
+    size_(size)
+  {}
+
+  uint64_t size() const override {
+    return size_;
+  }
+
+  ~DecompressionStream() override = default;
+
+  protected:
+  result<const void*> read_at(uint64_t offset, uint64_t size) const override {
+    const uint64_t end = offset + size;
+    if (offset > size_ || end > size_ || end < offset) {
+      return make_error_code(lief_errors::read_error);
+    }
+    if (end > produced_) {
+      const size_t target = std::min<size_t>(size_, std::max<size_t>(end, produced_ + STREAM_CHUNK_SIZE));
+      buffer_.resize(target);
+      if (!decompress_until(target)) {
+        return make_error_code(lief_errors::read_error);
+      }
+    }
+    return buffer_.data() + offset;
+  }
+
+  //! Decompress the input in ``buffer_`` until ``produced_ >= end``
+  virtual ok_error_t decompress_until(size_t end) const = 0;
+
+  std::vector<uint8_t> input_;
+  size_t size_ = 0;
+  mutable std::vector<uint8_t> buffer_;
+  mutable size_t produced_ = 0;
+};
+
+#if defined(LIEF_ZLIB_SUPPORT)
+class ZlibStream : public DecompressionStream {
+  public:
+  ZlibStream(std::vector<uint8_t> input, size_t size) :
+    DecompressionStream(std::move(input), size)
+  {
+    zstream_.next_in  = input_.data();
+    zstream_.avail_in = static_cast<uInt>(std::min<size_t>(input_.size(), UINT_MAX));
+    is_init_ = inflateInit(&zstream_) == Z_OK;
+  }
+
+  ~ZlibStream() override {
+    if (is_init_) {
+      inflateEnd(&zstream_);
+    }
+  }
+
+  protected:
+  ok_error_t decompress_until(size_t end) const override {
+    if (!is_init_) {
+      return make_error_code(lief_errors::read_error);
+    }
+    while (produced_ < end) {
+      zstream_.next_out  = buffer_.data() + produced_;
+      zstream_.avail_out = static_cast<uInt>(std::min<size_t>(buffer_.size() - produced_, UINT_MAX));
+      const int ret = inflate(&zstream_, Z_NO_FLUSH);
+      produced_ = buffer_.size() - zstream_.avail_out;
+      if (ret == Z_STREAM_END) {
+        break;
+      }
+      if (ret != Z_OK) {
+        LIEF_DEBUG("zlib: inflate error ({})", ret);
+        return make_error_code(lief_errors::read_error);
+      }
+    }
+    if (produced_ < end) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return ok();
+  }
+
+  private:
+  mutable z_stream zstream_ = {};
+  bool is_init_ = false;
+};
+#endif
+
+#if defined(LIEF_ZSTD_SUPPORT)
+class ZstdStream : public DecompressionStream {
+  public:
+  ZstdStream(std::vector<uint8_t> input, size_t size) :
+    DecompressionStream(std::move(input), size),
+    dctx_(ZSTD_createDCtx())
+  {}
+
+  ~ZstdStream() override {
+    ZSTD_freeDCtx(dctx_);
+  }
+
+  protected:
+  ok_error_t decompress_until(size_t end) const override {
+    if (dctx_ == nullptr) {
+      return make_error_code(lief_errors::read_error);
+    }
+    while (produced_ < end && in_pos_ < input_.size()) {
+      ZSTD_inBuffer in = {input_.data(), input_.size(), in_pos_};
+      ZSTD_outBuffer out = {buffer_.data(), buffer_.size(), produced_};
+      const size_t ret = ZSTD_decompressStream(dctx_, &out, &in);
+      if (ZSTD_isError(ret)) {
+        LIEF_DEBUG("zstd: {}", ZSTD_getErrorName(ret));
+        return make_error_code(lief_errors::read_error);
+      }
+      in_pos_   = in.pos;
+      produced_ = out.pos;
+      if (ret == 0) {
+        break;
+      }
+    }
+    if (produced_ < end) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return ok();
+  }
+
+  private:
+  ZSTD_DCtx* dctx_ = nullptr;
+  mutable size_t in_pos_ = 0;
+};
+#endif
+
+bool is_supported(ALGORITHM algo) {
+  switch (algo) {
+    case ALGORITHM::ZLIB:
+      #if defined(LIEF_ZLIB_SUPPORT)
+        return true;
+      #else
+        return false;
+      #endif
+    case ALGORITHM::ZSTD:
+      #if defined(LIEF_ZSTD_SUPPORT)
+        return true;
+      #else
+        return false;
+      #endif
+  }
+  return false;
+}
+
+result<std::vector<uint8_t>> decompress(ALGORITHM algo, span<const uint8_t> input, size_t size) {
+  std::vector<uint8_t> output(size);
+  switch (algo) {
+    case ALGORITHM::ZLIB:
+      {
+      #if defined(LIEF_ZLIB_SUPPORT)
+        uLongf dst_size = output.size();
+        const int ret = uncompress(output.data(), &dst_size, input.data(), input.size());
+        if (ret != Z_OK || dst_size != output.size()) {
+          LIEF_DEBUG("zlib: uncompress error ({})", ret);
+          return make_error_code(lief_errors::corrupted);
+        }
+        return output;
+      #else
+        return make_error_code(lief_errors::not_supported);
+      #endif
+      }
+
+    case ALGORITHM::ZSTD:
+      {
+      #if defined(LIEF_ZSTD_SUPPORT)
+        const size_t ret = ZSTD_decompress(output.data(), output.size(), input.data(), input.size());
+        if (ZSTD_isError(ret) || ret != output.size()) {
+          LIEF_DEBUG("zstd: decompress error");
+          return make_error_code(lief_errors::corrupted);
+        }
+        return output;
+      #else
+        return make_error_code(lief_errors::not_supported);
+      #endif
+      }
+  }
+  return make_error_code(lief_errors::not_supported);
+}
+
+result<std::vector<uint8_t>> compress(ALGORITHM algo, span<const uint8_t> input) {
+  switch (algo) {
+    case ALGORITHM::ZLIB:
+      {
+      #if defined(LIEF_ZLIB_SUPPORT)
+        std::vector<uint8_t> output(compressBound(input.size()));
+        uLongf dst_size = output.size();
+        const int ret = compress2(output.data(), &dst_size, input.data(), input.size(),
+                                  Z_DEFAULT_COMPRESSION);
+        if (ret != Z_OK) {
+          LIEF_DEBUG("zlib: compress error ({})", ret);
+          return make_error_code(lief_errors::build_error);
+        }
+        output.resize(dst_size);
+        return output;
+      #else
+        return make_error_code(lief_errors::not_supported);
+      #endif
+      }
+
+    case ALGORITHM::ZSTD:
+      {
+      #if defined(LIEF_ZSTD_SUPPORT)
+        std::vector<uint8_t> output(ZSTD_compressBound(input.size()));
+        const size_t ret = ZSTD_compress(output.data(), output.size(), input.data(), input.size(),
+                                         ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(ret)) {
+          LIEF_DEBUG("zstd: {}", ZSTD_getErrorName(ret));
+          return make_error_code(lief_errors::build_error);
+        }
+        output.resize(ret);
+        return output;
+      #else
+        return make_error_code(lief_errors::not_supported);
+      #endif
+      }
+  }
+  return make_error_code(lief_errors::not_supported);
+}
+
+std::unique_ptr<BinaryStream> decompression_stream(ALGORITHM algo, std::vector<uint8_t> input,
+                                                   size_t size)
+{
+  switch (algo) {
+    case ALGORITHM::ZLIB:
+      #if defined(LIEF_ZLIB_SUPPORT)
+        return std::make_unique<ZlibStream>(std::move(input), size);
+      #else
+        return nullptr;
+      #endif
+    case ALGORITHM::ZSTD:
+      #if defined(LIEF_ZSTD_SUPPORT)
+        return std::make_unique<ZstdStream>(std::move(input), size);
+      #else
+        return nullptr;
+      #endif
+  }
+  return nullptr;
+}
+
+}
+}
@@ -0,0 +1,51 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_COMPRESSION_H
+#define LIEF_COMPRESSION_H
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "LIEF/errors.hpp"
+#include "LIEF/span.hpp"
+
+namespace LIEF {
+class BinaryStream;
+
+// Thin wrappers over zlib / zstd. These functions return
+// lief_errors::not_supported if LIEF has been compiled without the library
+namespace compression {
+enum class ALGORITHM {
+  ZLIB,
+  ZSTD,
+};
+
+bool is_supported(ALGORITHM algo);
+
+//! Decompress ``input`` which is expected to inflate to ``size`` bytes
+result<std::vector<uint8_t>> decompress(ALGORITHM algo, span<const uint8_t> input,
+                                        size_t size);
+
+result<std::vector<uint8_t>> compress(ALGORITHM algo, span<const uint8_t> input);
+
+//! Return a stream over the ``size`` bytes of decompressed ``input``. The data
+//! are decompressed as the stream is read.
+std::unique_ptr<BinaryStream> decompression_stream(ALGORITHM algo,
+                                                   std::vector<uint8_t> input,
+                                                   size_t size);
+}
+}
+#endif
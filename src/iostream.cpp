@@ -60,6 +60,13 @@ vector_iostream& vector_iostream::put(uint8_t c) {
 }
 vector_iostream& vector_iostream::write(const uint8_t* s, std::streamsize n) {
   const auto pos = static_cast<size_t>(tellp());
+  if (pos == raw_.size()) {
+    // Append: avoid zero-filling the new bytes before copying them
+    raw_.insert(std::end(raw_), s, s + n);
+    current_pos_ += n;
+    return *this;
+  }
+
   if (raw_.size() < (pos + n)) {
     raw_.resize(pos + n);
   }
@@ -73,17 +80,7 @@ vector_iostream& vector_iostream::write(const uint8_t* s, std::streamsize n) {
 }
 
 vector_iostream& vector_iostream::write(std::vector<uint8_t> s) {
-  const auto pos = static_cast<size_t>(tellp());
-  if (raw_.size() < (pos + s.size())) {
-    raw_.resize(pos + s.size());
-  }
-
-  auto it = std::begin(raw_);
-  std::advance(it, pos);
-  std::move(std::begin(s), std::end(s), it);
-
-  current_pos_ += s.size();
-  return *this;
+  return write(s.data(), s.size());
 }
 
 vector_iostream& vector_iostream::write_sized_int(uint64_t value, size_t size) {
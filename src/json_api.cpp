@@ -20,14 +20,17 @@
 #if defined(LIEF_JSON_SUPPORT)
   #if defined(LIEF_PE_SUPPORT)
     #include "PE/json_internal.hpp"
+    #include "LIEF/PE/Binary.hpp"
   #endif
 
   #if defined(LIEF_ELF_SUPPORT)
     #include "ELF/json_internal.hpp"
+    #include "LIEF/ELF/Binary.hpp"
   #endif
 
   #if defined(LIEF_MACHO_SUPPORT)
     #include "MachO/json_internal.hpp"
+    #include "LIEF/MachO/Binary.hpp"
   #endif
 
   #if defined(LIEF_OAT_SUPPORT)
@@ -45,14 +48,15 @@
   #if defined(LIEF_VDEX_SUPPORT)
     #include "VDEX/json_internal.hpp"
   #endif
+  #include "visitors/json_stream.hpp"
 #else
   #include "logging.hpp"
 #endif // LIEF_JSON_SUPPORT
 
 namespace LIEF {
 
-std::string to_json(const Object& v) {
 #if defined(LIEF_JSON_SUPPORT)
+static json to_json_node(const Object& v) {
   json node;
 #if defined(LIEF_PE_SUPPORT)
   PE::JsonVisitor pe_visitor;
@@ -120,11 +124,58 @@ std::string to_json(const Object& v) {
   }
 #endif
 
-  return node.dump();
+  return node;
+}
+#endif
+
+std::string to_json(const Object& v) {
+#if defined(LIEF_JSON_SUPPORT)
+  return to_json_node(v).dump();
 #else /* JSON not enabled */
   LIEF_WARN("JSON support is not enabled");
   return "";
 #endif
 }
 
+void to_json(const Object& v, std::ostream& os, const JsonConfig& config) {
+#if defined(LIEF_JSON_SUPPORT)
+  JsonStream stream(os, config);
+#if defined(LIEF_PE_SUPPORT)
+  if (const auto* pe = dynamic_cast<const PE::Binary*>(&v)) {
+    PE::stream_json(*pe, stream);
+    return;
+  }
+#endif
+
+#if defined(LIEF_ELF_SUPPORT)
+  if (const auto* elf = dynamic_cast<const ELF::Binary*>(&v)) {
+    ELF::stream_json(*elf, stream);
+    return;
+  }
+#endif
+
+#if defined(LIEF_MACHO_SUPPORT)
+  if (const auto* macho = dynamic_cast<const MachO::Binary*>(&v)) {
+    MachO::stream_json(*macho, stream);
+    return;
+  }
+#endif
+  // Other objects are small enough to be serialized through the regular
+  // visitors. Their top-level entries still go through the stream so that
+  // the only/skip filters of the config apply.
+  const json node = to_json_node(v);
+  if (!node.is_object()) {
+    os << node;
+    return;
+  }
+  stream.begin();
+  for (auto it = node.begin(); it != node.end(); ++it) {
+    stream.entry(it.key().c_str(), it.value());
+  }
+  stream.end();
+#else /* JSON not enabled */
+  LIEF_WARN("JSON support is not enabled");
+#endif
+}
+
 }
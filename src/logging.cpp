@@ -15,6 +15,7 @@
  */
 
 #include <map>
+#include <algorithm>
 #include "LIEF/config.h"
 #include "LIEF/logging.hpp"
 #include "LIEF/platforms.hpp"
@@ -49,19 +50,16 @@ Logger::Logger() {
     }
 
 
-    sink_->set_level(spdlog::level::warn);
     sink_->set_pattern("%v");
-    sink_->flush_on(spdlog::level::warn);
+    sync_sink_level();
   }
 }
 
 
 Logger::Logger(const std::string& filepath) {
   sink_ = spdlog::basic_logger_mt("LIEF", filepath, /* truncate */ true);
-  sink_->set_level(spdlog::level::warn);
   sink_->set_pattern("%v");
-  sink_->flush_on(spdlog::level::warn);
-
+  sync_sink_level();
 }
 
 Logger& Logger::instance() {
@@ -73,6 +71,7 @@ Logger& Logger::instance() {
 }
 
 void Logger::reset() {
+  set_levels(LOG_WARN);
   Logger::destroy();
   Logger::instance();
 }
@@ -94,8 +93,7 @@ Logger& Logger::set_log_path(const std::string& path) {
   logger.sink_ = spdlog::basic_logger_mt("LIEF", path,
                                          /*truncate=*/true);
   logger.sink_->set_pattern("%v");
-  logger.sink_->set_level(spdlog::level::warn);
-  logger.sink_->flush_on(spdlog::level::warn);
+  logger.sync_sink_level();
   return logger;
 }
 
@@ -109,8 +107,7 @@ void Logger::set_logger(const spdlog::logger& logger) {
 
   instance.sink_ = std::make_shared<spdlog::logger>(logger);
   instance.sink_->set_pattern("%v");
-  instance.sink_->set_level(spdlog::level::warn);
-  instance.sink_->flush_on(spdlog::level::warn);
+  instance.sync_sink_level();
 }
 
 const char* to_string(LOGGING_LEVEL e) {
@@ -127,15 +124,64 @@ const char* to_string(LOGGING_LEVEL e) {
 }
 
 
+const char* to_string(MODULE e) {
+  switch (e) {
+    case MODULE::GENERIC:              return "GENERIC";
+    case MODULE::ELF:                  return "ELF";
+    case MODULE::PE:                   return "PE";
+    case MODULE::MACHO:                return "MACHO";
+    case MODULE::MACHO_DYLD_INFO:      return "MACHO_DYLD_INFO";
+    case MODULE::MACHO_CHAINED_FIXUPS: return "MACHO_CHAINED_FIXUPS";
+    case MODULE::OAT:                  return "OAT";
+    case MODULE::DEX:                  return "DEX";
+    case MODULE::VDEX:                 return "VDEX";
+    case MODULE::ART:                  return "ART";
+  }
+  return "UNDEFINED";
+}
+
+void Logger::set_levels(uint8_t level) {
+  for (std::atomic<uint8_t>& lvl : levels_) {
+    lvl.store(level, std::memory_order_relaxed);
+  }
+}
+
+void Logger::sync_sink_level() {
+  if (sink_ == nullptr) {
+    return;
+  }
+  uint8_t min_level = LEVEL_OFF;
+  for (const std::atomic<uint8_t>& lvl : levels_) {
+    min_level = std::min(min_level, lvl.load(std::memory_order_relaxed));
+  }
+
+  spdlog::level::level_enum spdlvl = spdlog::level::off;
+  switch (min_level) {
+    case LOG_TRACE:    spdlvl = spdlog::level::trace;    break;
+    case LOG_DEBUG:    spdlvl = spdlog::level::debug;    break;
+    case LOG_INFO:     spdlvl = spdlog::level::info;     break;
+    case LOG_WARN:     spdlvl = spdlog::level::warn;     break;
+    case LOG_ERR:      spdlvl = spdlog::level::err;      break;
+    case LOG_CRITICAL: spdlvl = spdlog::level::critical; break;
+    default:           spdlvl = spdlog::level::off;      break;
+  }
+  sink_->set_level(spdlvl);
+  if (spdlvl != spdlog::level::off) {
+    sink_->flush_on(spdlvl);
+  }
+}
+
 void Logger::disable() {
   if constexpr (lief_logging_support) {
-    Logger::instance().sink_->set_level(spdlog::level::off);
+    set_levels(LEVEL_OFF);
+    Logger::instance().sync_sink_level();
   }
 }
 
 void Logger::enable() {
   if constexpr (lief_logging_support) {
-    Logger::instance().sink_->set_level(spdlog::level::warn);
+    set_levels(LOG_WARN);
+    Logger::instance().sync_sink_level();
   }
 }
 
@@ -143,50 +189,20 @@ void Logger::set_level(LOGGING_LEVEL level) {
   if constexpr (!lief_logging_support) {
     return;
   }
-  switch (level) {
-    case LOG_TRACE:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::trace);
-        Logger::instance().sink_->flush_on(spdlog::level::trace);
-        break;
-      }
-
-    case LOG_DEBUG:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::debug);
-        Logger::instance().sink_->flush_on(spdlog::level::debug);
-        break;
-      }
-
-    case LOG_INFO:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::info);
-        Logger::instance().sink_->flush_on(spdlog::level::info);
-        break;
-      }
-
-    default:
-    case LOG_WARN:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::warn);
-        Logger::instance().sink_->flush_on(spdlog::level::warn);
-        break;
-      }
-
-    case LOG_ERR:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::err);
-        Logger::instance().sink_->flush_on(spdlog::level::err);
-        break;
-      }
+  set_levels(level);
+  Logger::instance().sync_sink_level();
+}
 
-    case LOG_CRITICAL:
-      {
-        Logger::instance().sink_->set_level(spdlog::level::critical);
-        Logger::instance().sink_->flush_on(spdlog::level::critical);
-        break;
-      }
+void Logger::set_level(MODULE module, LOGGING_LEVEL level) {
+  if constexpr (!lief_logging_support) {
+    return;
+  }
+  const auto idx = static_cast<size_t>(module);
+  if (idx >= NB_MODULES) {
+    return;
   }
+  levels_[idx].store(level, std::memory_order_relaxed);
+  Logger::instance().sync_sink_level();
 }
 
 // Public interface
@@ -203,6 +219,10 @@ void set_level(LOGGING_LEVEL level) {
   Logger::set_level(level);
 }
 
+void set_level(MODULE module, LOGGING_LEVEL level) {
+  Logger::set_level(module, level);
+}
+
 void set_path(const std::string& path) {
   Logger::set_log_path(path);
 }
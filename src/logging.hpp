@@ -16,6 +16,7 @@
 #ifndef LIEF_PRIVATE_LOGGING_H
 #define LIEF_PRIVATE_LOGGING_H
 #include <memory>
+#include <atomic>
 #include "LIEF/logging.hpp" // Public interface
 #include "LIEF/types.hpp"
 #include "LIEF/config.h"
@@ -24,11 +25,31 @@
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/fmt/fmt.h>
 
-#define LIEF_TRACE(...) LIEF::logging::Logger::trace(__VA_ARGS__)
-#define LIEF_DEBUG(...) LIEF::logging::Logger::debug(__VA_ARGS__)
-#define LIEF_INFO(...)  LIEF::logging::Logger::info(__VA_ARGS__)
-#define LIEF_WARN(...)  LIEF::logging::Logger::warn(__VA_ARGS__)
-#define LIEF_ERR(...)   LIEF::logging::Logger::err(__VA_ARGS__)
+// The logging macros check the level of the current module *before*
+// evaluating their arguments so that a disabled message does not pay for
+// its formatting (e.g. to_string(), std::string copies, ...).
+//
+// The module is resolved through the ``lief_log_module`` constant visible
+// from the call site (see below) and ``LIEF_MOD_*`` can be used to log
+// within a specific sub-module (e.g. MACHO_CHAINED_FIXUPS)
+#define LIEF_LOG_(MOD, LVL, FUNC, ...)                                        \
+  do {                                                                        \
+    if (LIEF::logging::Logger::enabled<LIEF::logging::LVL>(MOD)) {            \
+      LIEF::logging::Logger::FUNC(__VA_ARGS__);                               \
+    }                                                                         \
+  } while (false)
+
+#define LIEF_TRACE(...) LIEF_LOG_(lief_log_module, LOG_TRACE, trace, __VA_ARGS__)
+#define LIEF_DEBUG(...) LIEF_LOG_(lief_log_module, LOG_DEBUG, debug, __VA_ARGS__)
+#define LIEF_INFO(...)  LIEF_LOG_(lief_log_module, LOG_INFO,  info,  __VA_ARGS__)
+#define LIEF_WARN(...)  LIEF_LOG_(lief_log_module, LOG_WARN,  warn,  __VA_ARGS__)
+#define LIEF_ERR(...)   LIEF_LOG_(lief_log_module, LOG_ERR,   err,   __VA_ARGS__)
+
+#define LIEF_MOD_TRACE(MOD, ...) \
+  LIEF_LOG_(LIEF::logging::MODULE::MOD, LOG_TRACE, trace, __VA_ARGS__)
+
+#define LIEF_MOD_DEBUG(MOD, ...) \
+  LIEF_LOG_(LIEF::logging::MODULE::MOD, LOG_DEBUG, debug, __VA_ARGS__)
 
 #define CHECK(X, ...)        \
   do {                       \
@@ -65,6 +86,23 @@ class Logger {
   //! @brief Change the logging level (**hierarchical**)
   static void set_level(LOGGING_LEVEL level);
 
+  //! @brief Change the logging level of the given module
+  static void set_level(MODULE module, LOGGING_LEVEL level);
+
+  //! Check (without taking any lock) whether a message of the given level
+  //! should be emitted for the given module
+  template<LOGGING_LEVEL LVL>
+  static bool enabled(MODULE module) {
+    if constexpr (!lief_logging_support) {
+      return false;
+    }
+    if constexpr (!lief_logging_debug && (LVL == LOG_TRACE || LVL == LOG_DEBUG)) {
+      return false;
+    }
+    const auto idx = static_cast<size_t>(module);
+    return LVL >= levels_[idx].load(std::memory_order_relaxed);
+  }
+
   static Logger& set_log_path(const std::string& path);
 
   static void reset();
@@ -114,11 +152,40 @@ class Logger {
   Logger& operator=(Logger&&);
 
   static void destroy();
+  static void set_levels(uint8_t level);
+
+  // Align the level of the spdlog sink on the most verbose module
+  void sync_sink_level();
+
+  static constexpr size_t NB_MODULES = static_cast<size_t>(MODULE::ART) + 1;
+  static constexpr uint8_t LEVEL_OFF = LOG_CRITICAL + 1;
+
   static inline Logger* instance_ = nullptr;
+
+  // Minimal level (LOGGING_LEVEL or LEVEL_OFF) for each module
+  static inline std::atomic<uint8_t> levels_[NB_MODULES] = {
+    LOG_WARN, LOG_WARN, LOG_WARN, LOG_WARN, LOG_WARN,
+    LOG_WARN, LOG_WARN, LOG_WARN, LOG_WARN, LOG_WARN,
+  };
+  static_assert(NB_MODULES == 10, "levels_ must be initialized for all the modules");
+
   std::shared_ptr<spdlog::logger> sink_;
 };
 
 }
+
+// Module used by the LIEF_{TRACE, DEBUG, ...} macros. It is resolved
+// by the regular C++ name lookup so that the code within a format's namespace
+// is automatically attached to this format.
+static constexpr logging::MODULE lief_log_module = logging::MODULE::GENERIC;
+
+namespace ELF   { static constexpr logging::MODULE lief_log_module = logging::MODULE::ELF;   }
+namespace PE    { static constexpr logging::MODULE lief_log_module = logging::MODULE::PE;    }
+namespace MachO { static constexpr logging::MODULE lief_log_module = logging::MODULE::MACHO; }
+namespace OAT   { static constexpr logging::MODULE lief_log_module = logging::MODULE::OAT;   }
+namespace DEX   { static constexpr logging::MODULE lief_log_module = logging::MODULE::DEX;   }
+namespace VDEX  { static constexpr logging::MODULE lief_log_module = logging::MODULE::VDEX;  }
+namespace ART   { static constexpr logging::MODULE lief_log_module = logging::MODULE::ART;   }
 }
 
 #endif
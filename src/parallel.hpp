@@ -0,0 +1,93 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_PARALLEL_HEADER
+#define LIEF_PARALLEL_HEADER
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace LIEF {
+namespace parallel {
+
+//! Number of hardware threads that can be used by the helpers below
+inline size_t nb_threads() {
+  const unsigned nb = std::thread::hardware_concurrency();
+  return nb == 0 ? 1 : nb;
+}
+
+//! Number of chunks to split ``count`` tasks such as each chunk processes
+//! at least ``grain`` tasks
+inline size_t nb_chunks(size_t count, size_t grain) {
+  if (grain == 0) {
+    grain = 1;
+  }
+  return std::max<size_t>(1, std::min(count / grain, nb_threads()));
+}
+
+//! Split [0, count) in ``chunks`` contiguous ranges and call
+//! ``fn(chunk_idx, begin, end)`` for each of them in a dedicated thread.
+//!
+//! The chunk index can be used to store per-thread results that are merged
+//! (in order) by the caller once this function returns. If a thread can't be
+//! created, the chunk is processed by the calling thread.
+template<class F>
+void for_each_chunk(size_t count, size_t chunks, F&& fn) {
+  if (count == 0) {
+    return;
+  }
+  chunks = std::max<size_t>(1, std::min(chunks, count));
+  const size_t chunk_size = (count + chunks - 1) / chunks;
+
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  for (size_t idx = 1; idx < chunks; ++idx) {
+    const size_t begin = std::min(count, idx * chunk_size);
+    const size_t end   = std::min(count, begin + chunk_size);
+    try {
+      workers.emplace_back([&fn, idx, begin, end] { fn(idx, begin, end); });
+    } catch (const std::system_error&) {
+      fn(idx, begin, end);
+    }
+  }
+
+  fn(0, 0, std::min(count, chunk_size));
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+//! Call ``fn(i)`` for each i in [0, count) with (at most) ``threads`` threads.
+//!
+//! Contrary to for_each_chunk, the indexes are dispatched one by one (in
+//! increasing order) to the first thread available which balances tasks
+//! with very different costs.
+template<class F>
+void for_each_index(size_t count, size_t threads, F&& fn) {
+  threads = std::max<size_t>(1, std::min(threads, count));
+  std::atomic<size_t> next{0};
+  for_each_chunk(threads, threads, [&fn, &next, count] (size_t, size_t, size_t) {
+    for (size_t idx = next++; idx < count; idx = next++) {
+      fn(idx);
+    }
+  });
+}
+
+}
+}
+#endif
@@ -0,0 +1,286 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LIEF_SNAPSHOT_MMAP 1
+#endif
+
+#include "logging.hpp"
+#include "hash_stream.hpp"
+#include "snapshot.hpp"
+
+#include "LIEF/iostream.hpp"
+#include "LIEF/utils.hpp"
+#include "LIEF/Abstract/EnumToString.hpp"
+
+namespace LIEF {
+namespace snapshot {
+
+namespace {
+static constexpr char MAGIC[] = {'L', 'I', 'E', 'F', 'S', 'N', 'A', 'P'};
+
+inline uint64_t align8(uint64_t value) {
+  return (value + 7) & ~static_cast<uint64_t>(7);
+}
+}
+
+// ===========================================================================
+// mapped_file_t
+// ===========================================================================
+result<mapped_file_t> mapped_file_t::open(const std::string& path) {
+  mapped_file_t file;
+#if defined(LIEF_SNAPSHOT_MMAP)
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    LIEF_ERR("Can't stat '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  if (st.st_size > 0) {
+    void* ptr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr != MAP_FAILED) {
+      file.data_ = static_cast<const uint8_t*>(ptr);
+      file.size_ = st.st_size;
+    }
+  }
+  ::close(fd);
+  if (file.data_ != nullptr || st.st_size == 0) {
+    return file;
+  }
+  // Fallback on a regular read (e.g. the file is a pipe)
+#endif
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) {
+    LIEF_ERR("Can't open '{}'", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  file.buffer_ = {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+  return file;
+}
+
+mapped_file_t::mapped_file_t(mapped_file_t&& other) :
+  data_(other.data_),
+  size_(other.size_),
+  buffer_(std::move(other.buffer_))
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+mapped_file_t& mapped_file_t::operator=(mapped_file_t&& other) {
+  if (&other != this) {
+    close();
+    data_ = other.data_;
+    size_ = other.size_;
+    buffer_ = std::move(other.buffer_);
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+mapped_file_t::~mapped_file_t() {
+  close();
+}
+
+void mapped_file_t::close() {
+#if defined(LIEF_SNAPSHOT_MMAP)
+  if (data_ != nullptr) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  buffer_.clear();
+}
+
+// ===========================================================================
+// Helpers
+// ===========================================================================
+void sha256(span<const uint8_t> content, uint8_t (&out)[32]) {
+  hashstream hs(hashstream::HASH::SHA256);
+  hs.write(content.data(), content.size());
+  const std::vector<uint8_t>& digest = hs.raw();
+  std::copy_n(digest.begin(), std::min<size_t>(digest.size(), sizeof(out)), out);
+}
+
+bool is_source(const header_t& hdr, span<const uint8_t> source) {
+  if (source.size() != hdr.source_size) {
+    return false;
+  }
+  uint8_t digest[32] = {};
+  sha256(source, digest);
+  return std::memcmp(digest, hdr.source_sha256, sizeof(digest)) == 0;
+}
+
+// ===========================================================================
+// writer_t
+// ===========================================================================
+writer_t::writer_t(EXE_FORMATS format, span<const uint8_t> source) {
+  std::copy(std::begin(MAGIC), std::end(MAGIC), hdr_.magic);
+  hdr_.version     = VERSION;
+  hdr_.endianness  = ENDIANNESS;
+  hdr_.format      = static_cast<uint32_t>(format);
+  hdr_.source_size = source.size();
+  sha256(source, hdr_.source_sha256);
+}
+
+ref_t writer_t::add(const uint8_t* data, size_t size) {
+  blobs_.resize(align8(blobs_.size()), 0);
+  ref_t ref = {blobs_.size(), size};
+  blobs_.insert(blobs_.end(), data, data + size);
+  return ref;
+}
+
+ok_error_t writer_t::write(const std::string& path) {
+  tables_[BLOBS].entry_size = 1;
+  tables_[BLOBS].data = std::move(blobs_);
+
+  header_t hdr = hdr_;
+  hdr.nb_tables = tables_.size();
+
+  std::vector<table_t> directory;
+  uint64_t offset = align8(sizeof(header_t) + tables_.size() * sizeof(table_t));
+  for (const auto& [kind, table] : tables_) {
+    table_t entry;
+    entry.kind       = kind;
+    entry.entry_size = table.entry_size;
+    entry.count      = table.data.size() / table.entry_size;
+    entry.offset     = offset;
+    directory.push_back(entry);
+    offset = align8(offset + table.data.size());
+  }
+
+  vector_iostream os;
+  os.reserve(offset);
+  os.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+  for (const table_t& entry : directory) {
+    os.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry));
+  }
+  for (const auto& [kind, table] : tables_) {
+    os.align(8);
+    os.write(table.data);
+  }
+  os.align(8);
+
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    LIEF_ERR("Can't open {}", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  const std::vector<uint8_t>& raw = os.raw();
+  ofs.write(reinterpret_cast<const char*>(raw.data()), raw.size());
+  if (!ofs) {
+    LIEF_ERR("Error while writing {}", path);
+    return make_error_code(lief_errors::file_error);
+  }
+  return ok();
+}
+
+// ===========================================================================
+// reader_t
+// ===========================================================================
+result<reader_t> reader_t::open(const std::string& path, EXE_FORMATS format,
+                                span<const uint8_t> source)
+{
+  auto reader = open(path, format);
+  if (!reader) {
+    return make_error_code(get_error(reader));
+  }
+  if (auto res = reader->check_source(source); !res) {
+    return make_error_code(get_error(res));
+  }
+  return reader;
+}
+
+result<reader_t> reader_t::open(const std::string& path, EXE_FORMATS format) {
+  auto file = mapped_file_t::open(path);
+  if (!file) {
+    return make_error_code(get_error(file));
+  }
+  reader_t reader(std::move(*file));
+  if (auto res = reader.init(path, format); !res) {
+    return make_error_code(get_error(res));
+  }
+  return reader;
+}
+
+ok_error_t reader_t::check_source(span<const uint8_t> source) const {
+  if (!is_source(hdr_, source)) {
+    LIEF_ERR("The snapshot {} is stale: the source binary has been modified", path_);
+    return make_error_code(lief_errors::file_format_error);
+  }
+  return ok();
+}
+
+ok_error_t reader_t::init(const std::string& path, EXE_FORMATS format) {
+  span<const uint8_t> raw = file_.content();
+  if (raw.size() < sizeof(header_t)) {
+    LIEF_ERR("{} is not a snapshot", path);
+    return make_error_code(lief_errors::file_format_error);
+  }
+  header_t hdr;
+  std::memcpy(&hdr, raw.data(), sizeof(hdr));
+  if (std::memcmp(hdr.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    LIEF_ERR("{} is not a snapshot", path);
+    return make_error_code(lief_errors::file_format_error);
+  }
+  if (hdr.version != VERSION || hdr.endianness != ENDIANNESS) {
+    LIEF_ERR("Unsupported snapshot version ({})", hdr.version);
+    return make_error_code(lief_errors::not_supported);
+  }
+  if (hdr.format != static_cast<uint32_t>(format)) {
+    LIEF_ERR("{} is not a snapshot of a {} binary", path, to_string(format));
+    return make_error_code(lief_errors::file_format_error);
+  }
+  const uint64_t dir_end = sizeof(header_t) + uint64_t(hdr.nb_tables) * sizeof(table_t);
+  if (dir_end > raw.size()) {
+    return make_error_code(lief_errors::corrupted);
+  }
+  for (size_t i = 0; i < hdr.nb_tables; ++i) {
+    table_t table;
+    std::memcpy(&table, raw.data() + sizeof(header_t) + i * sizeof(table_t), sizeof(table));
+    // The offset must be aligned as the records are accessed in place
+    if (table.entry_size == 0 || table.offset > raw.size() || table.offset % 8 != 0 ||
+        table.count > (raw.size() - table.offset) / table.entry_size)
+    {
+      LIEF_ERR("Snapshot table #{} is corrupted", i);
+      return make_error_code(lief_errors::corrupted);
+    }
+    tables_[table.kind] = table;
+  }
+  auto it = tables_.find(BLOBS);
+  if (it != tables_.end()) {
+    blobs_ = raw.subspan(it->second.offset, it->second.count);
+  }
+  path_ = path;
+  hdr_ = hdr;
+  return ok();
+}
+}
+}
@@ -0,0 +1,232 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_SNAPSHOT_H
+#define LIEF_SNAPSHOT_H
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "LIEF/span.hpp"
+#include "LIEF/errors.hpp"
+#include "LIEF/Abstract/enums.hpp"
+
+// Layout of a snapshot file:
+//
+//   header_t
+//   table_t[nb_tables]
+//   tables (8-bytes aligned arrays of fixed-size records)
+//
+// The strings and the variable-length data are stored in the table 0 (blobs)
+// and referenced with a ref_t. The records are naturally aligned so that they
+// are accessed in place from the mapped snapshot. The content of the binary
+// is not stored: it is read from the source file whose SHA-256 must match the
+// one recorded in the snapshot.
+//
+// The tables are format-specific: their kinds are defined by the
+// ELF/PE/Mach-O snapshot implementations.
+
+namespace LIEF {
+namespace snapshot {
+static constexpr uint32_t VERSION = 2;
+static constexpr uint32_t ENDIANNESS = 0x01020304;
+static constexpr uint32_t NONE = static_cast<uint32_t>(-1);
+
+//! Kind of the table which contains the strings and the variable-length data
+static constexpr uint32_t BLOBS = 0;
+
+struct header_t {
+  char     magic[8];
+  uint32_t version;
+  uint32_t endianness;
+  uint64_t source_size;
+  uint8_t  source_sha256[32];
+  uint32_t nb_tables;
+  uint32_t format; // EXE_FORMATS
+};
+
+struct table_t {
+  uint32_t kind;
+  uint32_t entry_size;
+  uint64_t count;
+  uint64_t offset;
+};
+
+struct ref_t {
+  uint64_t offset;
+  uint64_t size;
+};
+
+static_assert(sizeof(header_t) == 64, "Unexpected padding");
+
+//! Read-only view of a file: the file is mapped in memory when the platform
+//! supports it, otherwise its content is read in a buffer.
+class mapped_file_t {
+  public:
+  static result<mapped_file_t> open(const std::string& path);
+
+  mapped_file_t(const mapped_file_t&) = delete;
+  mapped_file_t& operator=(const mapped_file_t&) = delete;
+
+  mapped_file_t(mapped_file_t&& other);
+  mapped_file_t& operator=(mapped_file_t&& other);
+
+  ~mapped_file_t();
+
+  span<const uint8_t> content() const {
+    return data_ != nullptr ? span<const uint8_t>{data_, size_} :
+                              span<const uint8_t>{buffer_};
+  }
+
+  private:
+  mapped_file_t() = default;
+  void close();
+
+  const uint8_t* data_ = nullptr;
+  uint64_t size_ = 0;
+  std::vector<uint8_t> buffer_;
+};
+
+//! Compute the SHA-256 of the given content
+void sha256(span<const uint8_t> content, uint8_t (&out)[32]);
+
+//! Check that ``source`` is the content described by the snapshot's header
+bool is_source(const header_t& hdr, span<const uint8_t> source);
+
+class writer_t {
+  public:
+  //! Create a writer for a snapshot of a binary whose original content
+  //! is ``source``
+  writer_t(EXE_FORMATS format, span<const uint8_t> source);
+
+  ref_t add(const uint8_t* data, size_t size);
+
+  ref_t add(const std::string& str) {
+    return add(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+  }
+
+  template<class T>
+  ref_t add(const std::vector<T>& values) {
+    static_assert(std::is_integral<T>::value, "Require an integer");
+    return add(reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(T));
+  }
+
+  template<class K, class T>
+  void push(K kind, const T& record) {
+    static_assert(sizeof(T) % 8 == 0, "Records must be padded to 8 bytes");
+    table_data_t& table = tables_[static_cast<uint32_t>(kind)];
+    table.entry_size = sizeof(T);
+    const auto* raw = reinterpret_cast<const uint8_t*>(&record);
+    table.data.insert(table.data.end(), raw, raw + sizeof(T));
+  }
+
+  //! Serialize the snapshot in the file ``path``
+  ok_error_t write(const std::string& path);
+
+  private:
+  struct table_data_t {
+    uint32_t entry_size = 0;
+    std::vector<uint8_t> data;
+  };
+  header_t hdr_ = {};
+  std::vector<uint8_t> blobs_;
+  std::map<uint32_t, table_data_t> tables_;
+};
+
+class reader_t {
+  public:
+  //! Parse the snapshot ``path`` of a binary of the given format and check
+  //! that ``source`` is the binary described by the snapshot
+  static result<reader_t> open(const std::string& path, EXE_FORMATS format,
+                               span<const uint8_t> source);
+
+  //! Parse the snapshot ``path`` without checking the source binary
+  //! (it must be checked afterwards with check_source())
+  static result<reader_t> open(const std::string& path, EXE_FORMATS format);
+
+  //! Check that ``source`` is the binary described by the snapshot
+  ok_error_t check_source(span<const uint8_t> source) const;
+
+  const header_t& header() const {
+    return hdr_;
+  }
+
+  //! Records of the given table, accessed in place (empty if the table is
+  //! missing or if the records don't have the expected size)
+  template<class T, class K>
+  span<const T> records(K kind) const {
+    auto it = tables_.find(static_cast<uint32_t>(kind));
+    if (it == tables_.end() || it->second.entry_size != sizeof(T)) {
+      return {};
+    }
+    return {reinterpret_cast<const T*>(file_.content().data() + it->second.offset),
+            static_cast<size_t>(it->second.count)};
+  }
+
+  span<const uint8_t> blob(const ref_t& ref) const {
+    if (ref.offset > blobs_.size() || ref.size > blobs_.size() - ref.offset) {
+      return {};
+    }
+    return blobs_.subspan(ref.offset, ref.size);
+  }
+
+  std::string str(const ref_t& ref) const {
+    span<const uint8_t> raw = blob(ref);
+    return {reinterpret_cast<const char*>(raw.data()), raw.size()};
+  }
+
+  template<class T>
+  std::vector<T> array(const ref_t& ref) const {
+    span<const uint8_t> raw = blob(ref);
+    std::vector<T> out(raw.size() / sizeof(T));
+    if (!out.empty()) {
+      std::memcpy(out.data(), raw.data(), out.size() * sizeof(T));
+    }
+    return out;
+  }
+
+  private:
+  reader_t(mapped_file_t file) :
+    file_(std::move(file))
+  {}
+  ok_error_t init(const std::string& path, EXE_FORMATS format);
+
+  std::string path_;
+  header_t hdr_ = {};
+  mapped_file_t file_;
+  span<const uint8_t> blobs_;
+  std::map<uint32_t, table_t> tables_;
+};
+
+template<class T>
+inline uint32_t index_of(const std::unordered_map<const T*, uint32_t>& map, const T* ptr) {
+  if (ptr == nullptr) {
+    return NONE;
+  }
+  auto it = map.find(ptr);
+  return it == map.end() ? NONE : it->second;
+}
+
+template<class T>
+inline T* at(std::vector<T*>& objects, uint32_t idx) {
+  return idx < objects.size() ? objects[idx] : nullptr;
+}
+}
+}
+#endif
@@ -0,0 +1,60 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "visitors/json_stream.hpp"
+
+namespace LIEF {
+
+JsonStream::JsonStream(std::ostream& os, const JsonConfig& config) :
+  os_{os},
+  config_{config}
+{}
+
+JsonStream& JsonStream::begin() {
+  os_ << '{';
+  first_ = true;
+  return *this;
+}
+
+JsonStream& JsonStream::end() {
+  os_ << '}';
+  return *this;
+}
+
+bool JsonStream::enabled(const char* key) const {
+  if (!config_.only.empty() && config_.only.find(key) == config_.only.end()) {
+    return false;
+  }
+  return config_.skip.find(key) == config_.skip.end();
+}
+
+JsonStream& JsonStream::entry(const char* key, const json& node) {
+  if (!enabled(key)) {
+    return *this;
+  }
+  write_key(key);
+  os_ << node;
+  return *this;
+}
+
+void JsonStream::write_key(const char* key) {
+  if (!first_) {
+    os_ << ',';
+  }
+  os_ << json(key) << ':';
+  first_ = false;
+}
+
+}
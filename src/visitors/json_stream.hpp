@@ -0,0 +1,210 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LIEF_VISITOR_JSON_STREAM_H
+#define LIEF_VISITOR_JSON_STREAM_H
+#include <ostream>
+#include <vector>
+
+#include "LIEF/json.hpp"
+#include "visitors/json.hpp"
+
+namespace LIEF {
+
+//! Writer that emits the top-level object of a JSON document directly
+//! into an output stream.
+//!
+//! Only the *elements* of the top-level entries are built as nlohmann::json
+//! nodes (through the regular JsonVisitor) and they are released as soon as
+//! they have been written.
+class JsonStream {
+  public:
+  JsonStream(std::ostream& os, const JsonConfig& config);
+
+  JsonStream(const JsonStream&) = delete;
+  JsonStream& operator=(const JsonStream&) = delete;
+
+  //! Start the top-level object
+  JsonStream& begin();
+
+  //! Close the top-level object
+  JsonStream& end();
+
+  //! Check whether the top-level entry ``key`` must be serialized
+  //! according to the JsonConfig
+  bool enabled(const char* key) const;
+
+  //! Write ``"key": node``
+  JsonStream& entry(const char* key, const json& node);
+
+  //! Write ``"key": value``
+  template<class T>
+  JsonStream& value(const char* key, const T& value) {
+    if (!enabled(key)) {
+      return *this;
+    }
+    write_key(key);
+    os_ << json(value);
+    return *this;
+  }
+
+  //! Write ``"key": {...}`` with the JSON representation of ``obj`` produced
+  //! by the visitor ``V``
+  template<class V, class T>
+  JsonStream& object(const char* key, const T& obj) {
+    return object_impl<V>(key, obj, [] (V& visitor, const T& o) { visitor(o); });
+  }
+
+  //! Same as object() but the object is visited through its (virtual)
+  //! ``accept()`` function
+  template<class V, class T>
+  JsonStream& accept_object(const char* key, const T& obj) {
+    return object_impl<V>(key, obj, [] (V& visitor, const T& o) { o.accept(visitor); });
+  }
+
+  //! Write ``"key": [...]`` where each element of the range is serialized
+  //! with the visitor ``V`` and written before visiting the next one
+  template<class V, class It>
+  JsonStream& list(const char* key, const It& range) {
+    return list_impl<V>(key, range, [] (V& visitor, const auto& o) { visitor(o); });
+  }
+
+  //! Same as list() but the elements are visited through their (virtual)
+  //! ``accept()`` function
+  template<class V, class It>
+  JsonStream& accept_list(const char* key, const It& range) {
+    return list_impl<V>(key, range, [] (V& visitor, const auto& o) { o.accept(visitor); });
+  }
+
+  private:
+  template<class V, class T, class F>
+  JsonStream& object_impl(const char* key, const T& obj, F&& visit) {
+    if (!enabled(key)) {
+      return *this;
+    }
+    V visitor;
+    visit(visitor, obj);
+    return entry(key, visitor.get());
+  }
+
+  template<class V, class It, class F>
+  JsonStream& list_impl(const char* key, const It& range, F&& visit) {
+    if (!enabled(key)) {
+      return *this;
+    }
+    write_key(key);
+    os_ << '[';
+    bool first = true;
+    for (const auto& obj : range) {
+      V visitor;
+      visit(visitor, obj);
+      if (!first) {
+        os_ << ',';
+      }
+      os_ << visitor.get();
+      first = false;
+    }
+    os_ << ']';
+    return *this;
+  }
+
+  void write_key(const char* key);
+
+  std::ostream& os_;
+  const JsonConfig& config_;
+  bool first_ = true;
+};
+
+//! Writer with the same interface as JsonStream which builds the top-level
+//! object as a nlohmann::json node (for JsonVisitor::visit(const Binary&)).
+//!
+//! The formats describe the top-level entries of a binary once, with a
+//! function template on the writer, so that the DOM-based and the streaming
+//! serializations produce the same document.
+class JsonTree {
+  public:
+  JsonTree(json& node) :
+    node_(node)
+  {}
+
+  JsonTree& begin() {
+    return *this;
+  }
+
+  JsonTree& end() {
+    return *this;
+  }
+
+  bool enabled(const char*) const {
+    return true;
+  }
+
+  JsonTree& entry(const char* key, const json& node) {
+    node_[key] = node;
+    return *this;
+  }
+
+  template<class T>
+  JsonTree& value(const char* key, const T& value) {
+    node_[key] = value;
+    return *this;
+  }
+
+  template<class V, class T>
+  JsonTree& object(const char* key, const T& obj) {
+    V visitor;
+    visitor(obj);
+    node_[key] = visitor.get();
+    return *this;
+  }
+
+  template<class V, class T>
+  JsonTree& accept_object(const char* key, const T& obj) {
+    V visitor;
+    obj.accept(visitor);
+    node_[key] = visitor.get();
+    return *this;
+  }
+
+  template<class V, class It>
+  JsonTree& list(const char* key, const It& range) {
+    std::vector<json> elements;
+    for (const auto& obj : range) {
+      V visitor;
+      visitor(obj);
+      elements.emplace_back(visitor.get());
+    }
+    node_[key] = std::move(elements);
+    return *this;
+  }
+
+  template<class V, class It>
+  JsonTree& accept_list(const char* key, const It& range) {
+    std::vector<json> elements;
+    for (const auto& obj : range) {
+      V visitor;
+      obj.accept(visitor);
+      elements.emplace_back(visitor.get());
+    }
+    node_[key] = std::move(elements);
+    return *this;
+  }
+
+  private:
+  json& node_;
+};
+
+}
+#endif
@@ -105,3 +105,106 @@ def test_entropy():
 
     assert weird_section_0 >= 0
     assert weird_section_1 >= 0
+
+def test_export_index(tmp_path):
+    index = lief.ExportIndex()
+    libadd = lief.parse(get_sample('ELF/ELF64_x86-64_library_libadd.so'))
+    assert index.add(libadd, "libadd.so")
+
+    providers = index.find("add")
+    assert len(providers) == 1
+    assert providers[0].library == "libadd.so"
+    assert providers[0].address == 0x6a0
+    assert len(index.find("foo")) == 0
+
+    kernel32 = get_sample('PE/PE32_x86_library_kernel32.dll')
+    assert index.add([kernel32]) == 1
+    assert len(index.libraries) == 2
+
+    # Forwarded exports are indexed with their exported name
+    providers = index.find("InterlockedPushListSList")
+    assert len(providers) == 1
+    assert providers[0].is_forwarded
+    assert providers[0].forward_library == "NTDLL"
+    assert providers[0].forward_name == "RtlInterlockedPushListSList"
+
+    # Lookup by ordinal (case and extension insensitive as for forwarders)
+    kernel32_pe = lief.PE.parse(kernel32)
+    for entry in kernel32_pe.get_export().entries[:20]:
+        for library in ("KERNEL32", "kernel32.dll"):
+            providers = index.find(library, entry.ordinal)
+            assert len(providers) == 1
+            assert providers[0].ordinal == entry.ordinal
+            assert providers[0].address == entry.function_rva
+    assert len(index.find("ntdll", 1)) == 0
+
+    output = tmp_path / "exports.idx"
+    assert isinstance(index.save(output.as_posix()), lief.ok_t)
+
+    loaded = lief.ExportIndex.load(output.as_posix())
+    assert len(loaded) == len(index)
+    assert loaded.libraries == index.libraries
+    assert loaded.find("add")[0].address == 0x6a0
+
+    for name in ("GetProcAddress", "InterlockedPushListSList"):
+        assert [p.address for p in loaded.find(name)] == \
+               [p.address for p in index.find(name)]
+
+def test_export_index_resolve():
+    index = lief.ExportIndex()
+    kernel32 = lief.PE.parse(get_sample('PE/PE32_x86_library_kernel32.dll'))
+    assert index.add(kernel32)
+    exports = {e.name: e for e in kernel32.get_export().entries if not e.is_forwarded}
+
+    hello = lief.PE.parse(get_sample('PE/PE32_x86_binary_HelloWorld.exe'))
+    imports = index.resolve(hello)
+    assert len(imports) == sum(len(imp.entries) for imp in hello.imports)
+
+    resolved = [imp for imp in imports if len(imp.providers) > 0]
+    assert len(resolved) > 0
+    for imp in resolved:
+        assert imp.library.lower() == "kernel32.dll"
+        assert len(imp.providers) == 1
+        provider = imp.providers[0]
+        assert provider.library == kernel32.get_export().name
+        if not provider.is_forwarded:
+            assert provider.address == exports[imp.name].function_rva
+
+    # Forwarder: KERNEL32.InterlockedPushListSList -> NTDLL.RtlInterlockedPushListSList
+    app = lief.PE.Binary(lief.PE.PE_TYPE.PE32)
+    app.add_library("KERNEL32.dll").add_entry("InterlockedPushListSList")
+
+    # NTDLL is not in the index: the forwarder is returned as is
+    [imp] = index.resolve(app)
+    assert len(imp.providers) == 1
+    assert imp.providers[0].is_forwarded
+    assert imp.providers[0].forward_name == "RtlInterlockedPushListSList"
+
+    ntdll = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_library_libadd.so'))
+    ntdll.get_dynamic_symbol("add").name = "RtlInterlockedPushListSList"
+    assert index.add(ntdll, "ntdll.dll")
+
+    [imp] = index.resolve(app)
+    assert imp.name == "InterlockedPushListSList"
+    assert len(imp.providers) == 1
+    assert imp.providers[0].library == "ntdll.dll"
+    assert not imp.providers[0].is_forwarded
+    assert imp.providers[0].address == 0x6a0
+
+def test_parallel_sections():
+    for sample in ('ELF/ELF64_x86-64_binary_gcc.bin',
+                   'PE/PE64_x86-64_binary_mfc-application.exe',
+                   'MachO/MachO64_x86-64_binary_sshd.bin'):
+        binary: lief.Binary = lief.parse(get_sample(sample)).abstract
+        sections = list(binary.sections)
+
+        assert binary.sections_entropy_parallel() == [s.entropy for s in sections]
+        assert binary.sections_hash_parallel() == [lief.hash(s) for s in sections]
+
+        for address in (binary.entrypoint, binary.imagebase):
+            assert binary.xref_parallel(address) == binary.xref(address)
+
+    binary = lief.parse(get_sample('ELF/ELF64_x86-64_binary_gcc.bin'))
+    rodata = binary.get_section(".rodata")
+    addresses = binary.abstract.search_all_parallel("kernel-address")
+    assert rodata.virtual_address + 4 in addresses
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+import pytest
+import numpy as np
+
+import lief
+from utils import get_sample
+
+SAMPLES = [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "ELF/ELF32_x86_binary_ls.bin",
+    "PE/PE64_x86-64_binary_winhello64-mingw.exe",
+    "PE/PE64_x86-64_binary_mfc-application.exe",
+    "MachO/MachO64_x86-64_binary_sshd.bin",
+]
+
+def relocations(binary: lief.Binary):
+    if isinstance(binary, lief.PE.Binary):
+        return [entry for reloc in binary.relocations for entry in reloc.entries]
+    return list(binary.relocations)
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_symbols(sample: str):
+    binary = lief.parse(get_sample(sample))
+    columns = lief.SymbolColumns.extract(binary)
+    syms = list(binary.symbols)
+
+    assert len(columns) == len(syms)
+    assert len(columns.names) == len(syms)
+    assert columns.values.dtype == np.uint64
+    assert columns.section_indexes.dtype == np.int32
+    assert columns.names.offsets[-1] == len(columns.names.data)
+
+    for idx, sym in enumerate(syms):
+        name = sym.name if isinstance(sym.name, str) else sym.name.decode()
+        assert columns.names[idx] == name
+        assert columns.values[idx] == sym.value
+        assert columns.sizes[idx] == sym.size
+        if isinstance(binary, lief.ELF.Binary):
+            assert columns.types[idx] == int(sym.type)
+            assert columns.bindings[idx] == int(sym.binding)
+            assert columns.section_indexes[idx] == sym.shndx
+        elif isinstance(binary, lief.PE.Binary):
+            assert columns.bindings[idx] == int(sym.storage_class)
+            assert columns.section_indexes[idx] == sym.section_number
+        else:
+            assert columns.types[idx] == sym.type
+            assert columns.bindings[idx] == sym.description
+            assert columns.section_indexes[idx] == sym.numberof_sections
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_relocations(sample: str):
+    binary = lief.parse(get_sample(sample))
+    columns = lief.RelocationColumns.extract(binary)
+    relocs = relocations(binary)
+
+    assert len(columns) == len(relocs)
+    assert len(columns.symbols) == len(relocs)
+
+    for idx, reloc in enumerate(relocs):
+        assert columns.addresses[idx] == reloc.address
+        assert columns.sizes[idx] == reloc.size
+        assert columns.types[idx] == int(reloc.type)
+        if isinstance(binary, lief.ELF.Binary):
+            assert columns.addends[idx] == reloc.addend
+        else:
+            assert columns.addends[idx] == 0
+
+        if not isinstance(binary, lief.PE.Binary) and reloc.has_symbol:
+            assert columns.symbols[idx] == reloc.symbol.name
+        else:
+            assert columns.symbols[idx] == ""
+
+def test_lifetime():
+    binary = lief.parse(get_sample("ELF/ELF64_x86-64_binary_ls.bin"))
+    values = lief.SymbolColumns.extract(binary).values
+    names = lief.SymbolColumns.extract(binary).names
+    # The arrays keep the columns alive
+    assert not values.flags.writeable
+    assert values.tolist() == [s.value for s in binary.symbols]
+    assert [names[i] for i in range(len(names))] == [s.name for s in binary.symbols]
+
+    with pytest.raises(IndexError):
+        names[len(names)]
@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+import hashlib
+import pytest
+from pathlib import Path
+
+import lief
+from utils import get_sample
+
+def test_pe():
+    path = Path(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
+    raw = path.read_bytes()
+    pe = lief.PE.parse(raw)
+
+    fp = lief.Fingerprint.compute(pe, raw)
+    assert fp.size == len(raw)
+    assert fp.file.md5 == hashlib.md5(raw).digest()
+    assert fp.file.sha1 == hashlib.sha1(raw).digest()
+    assert fp.file.sha256 == hashlib.sha256(raw).digest()
+
+    assert fp.imphash == lief.PE.get_imphash(pe)
+    assert fp.authentihash.md5 == pe.authentihash_md5
+    assert fp.authentihash.sha1 == pe.authentihash_sha1
+    assert fp.authentihash.sha256 == pe.authentihash_sha256
+
+    assert len(fp.sections) == len(pe.sections)
+    for section, entry in zip(pe.sections, fp.sections):
+        content = bytes(section.content)
+        assert entry.name == section.name
+        assert entry.offset == section.offset
+        assert entry.digests.sha256 == hashlib.sha256(content).digest()
+        assert entry.entropy == pytest.approx(section.entropy)
+
+    assert lief.Fingerprint.compute(pe, path.as_posix()).file.sha256 == fp.file.sha256
+
+def test_config():
+    path = Path(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+    raw = path.read_bytes()
+    elf = lief.ELF.parse(raw)
+
+    config = lief.Fingerprint.config_t()
+    config.md5 = False
+    config.sha1 = False
+    config.entropy = False
+    config.sections = False
+    config.segments = True
+
+    fp = lief.Fingerprint.compute(elf, raw, config)
+    assert fp.file.md5 == bytes(16)
+    assert fp.file.sha256 == hashlib.sha256(raw).digest()
+    assert fp.entropy == 0
+    assert fp.authentihash is None
+    assert len(fp.sections) == 0
+    assert len(fp.segments) == len(elf.segments)
+
+    for segment, entry in zip(elf.segments, fp.segments):
+        content = raw[segment.file_offset:segment.file_offset + segment.physical_size]
+        assert entry.digests.sha256 == hashlib.sha256(content).digest()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+import pytest
+from pathlib import Path
+
+import lief
+from utils import get_sample
+
+SAMPLES = [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "ELF/ELF32_x86_binary_ls.bin",
+    "ELF/ELF64_AArch64_piebinary_linker64.pie",
+    "PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe",
+    "PE/PE64_x86-64_binary_mfc-application.exe",
+    "PE/PE32_x86_library_kernel32.dll",
+    "MachO/MachO64_x86-64_binary_id.bin",
+    "MachO/MachO64_x86-64_binary_sshd.bin",
+    "MachO/FAT_MachO_x86_x86-64_library_libc.dylib",
+]
+
+def build_id(binary: lief.Binary) -> bytes:
+    if isinstance(binary, lief.ELF.Binary):
+        for note in binary.notes:
+            if note.type == lief.ELF.NOTE_TYPES.BUILD_ID:
+                return bytes(note.description)
+    if isinstance(binary, lief.MachO.Binary) and binary.has_uuid:
+        return bytes(binary.uuid.uuid)
+    return b""
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_consistency(sample: str):
+    path = Path(get_sample(sample))
+    summary = lief.quick_scan(path)
+    binary = lief.parse(path.as_posix())
+
+    assert summary.format == binary.format
+    assert summary.architecture == binary.header.architecture
+    assert summary.modes == binary.header.modes
+    assert summary.endianness == binary.header.endianness
+    assert summary.object_type == binary.header.object_type
+    assert summary.entrypoint == binary.entrypoint
+    assert summary.imagebase == binary.imagebase
+    assert summary.is_pie == binary.is_pie
+    assert summary.has_nx == binary.has_nx
+    assert summary.nb_sections == len(binary.sections)
+    assert summary.imported_libraries == binary.libraries
+    assert summary.build_id == build_id(binary)
+
+    if isinstance(binary, lief.PE.Binary):
+        assert summary.imphash == lief.PE.get_imphash(binary)
+        assert summary.nb_segments == 0
+    elif isinstance(binary, lief.ELF.Binary):
+        assert summary.nb_segments == len(binary.segments)
+    else:
+        assert summary.nb_segments == len(binary.segments)
+        assert summary.imphash == ""
+
+def test_raw():
+    path = Path(get_sample("ELF/ELF64_x86-64_binary_ls.bin"))
+    from_raw = lief.quick_scan(path.read_bytes())
+    from_path = lief.quick_scan(path.as_posix())
+
+    assert from_raw.is_64
+    assert from_raw.entrypoint == from_path.entrypoint
+    assert from_raw.imported_libraries == from_path.imported_libraries
+    assert from_raw.build_id == from_path.build_id
+
+def test_errors():
+    assert lief.quick_scan(b"\x00" * 0x100) == lief.lief_errors.file_format_error
+    assert isinstance(lief.quick_scan("/this/file/does/not/exist"), lief.lief_errors)
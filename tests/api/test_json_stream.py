@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+import json
+from pathlib import Path
+
+import pytest
+
+import lief
+from utils import get_sample
+
+SAMPLES = [
+    "ELF/ELF64_x86-64_binary_ls.bin",
+    "PE/PE64_x86-64_binary_mfc-application.exe",
+    "MachO/MachO64_x86-64_binary_id.bin",
+]
+
+def _parse(sample: str):
+    binary = lief.parse(get_sample(sample))
+    assert binary is not None
+    return binary
+
+def _stream(tmp_path: Path, binary, **kwargs):
+    output = tmp_path / "out.json"
+    assert lief.to_json(binary, output.as_posix(), **kwargs)
+    with open(output, "r") as f:
+        return json.load(f)
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_stream(tmp_path: Path, sample: str):
+    binary = _parse(sample)
+    # The streaming serialization produces the same document as the DOM-based one
+    assert _stream(tmp_path, binary) == json.loads(lief.to_json(binary))
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_only(tmp_path: Path, sample: str):
+    binary = _parse(sample)
+    expected = json.loads(lief.to_json(binary))
+
+    out = _stream(tmp_path, binary, only={"header", "sections"})
+    assert set(out.keys()) == {"header", "sections"}
+    assert out["header"] == expected["header"]
+    assert out["sections"] == expected["sections"]
+
+@pytest.mark.parametrize("sample", SAMPLES)
+def test_skip(tmp_path: Path, sample: str):
+    binary = _parse(sample)
+    expected = json.loads(lief.to_json(binary))
+    del expected["sections"]
+    del expected["header"]
+
+    assert _stream(tmp_path, binary, skip={"sections", "header"}) == expected
+
+def test_only_and_skip(tmp_path: Path):
+    binary = _parse("ELF/ELF64_x86-64_binary_ls.bin")
+    out = _stream(tmp_path, binary, only={"header", "sections"}, skip={"sections"})
+    assert set(out.keys()) == {"header"}
+
+    # Unknown keys are ignored
+    assert _stream(tmp_path, binary, only={"does_not_exist"}) == {}
+
+def test_object(tmp_path: Path):
+    # Objects which are not binaries fall back on the regular serialization
+    binary = _parse("ELF/ELF64_x86-64_binary_ls.bin")
+    section = binary.get_section(".text")
+    expected = json.loads(lief.to_json(section))
+    assert _stream(tmp_path, section) == expected
+
+    # ... but the config still applies to them
+    assert _stream(tmp_path, section, only={"name"}) == {"name": ".text"}
+
+    out = _stream(tmp_path, section, skip={"flags"})
+    assert set(out.keys()) == set(expected.keys()) - {"flags"}
+    assert out["name"] == expected["name"]
+
+def test_wrong_output(tmp_path: Path):
+    binary = _parse("ELF/ELF64_x86-64_binary_ls.bin")
+    assert not lief.to_json(binary, (tmp_path / "does" / "not" / "exist.json").as_posix())
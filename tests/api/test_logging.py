@@ -1,5 +1,9 @@
 import lief
+import pytest
 from pathlib import Path
+from utils import get_sample
+
+CHAINED_FIXUPS = "MachO/8119b2bd6a15b78b5c0bc2245eb63673173cb8fe9e0638f19aea7e68da668696_id.macho"
 
 def _remove_eol(string: str):
     return string.replace("\n", "").replace("\r", "")
@@ -26,3 +30,42 @@ def test_stderr(capsys):
     captured = capsys.readouterr()
     assert _remove_eol(captured.err) == "This is an errorThis is another error"
 
+
+def _module_log(tmp_path: Path, module: lief.logging.MODULE, *samples: str) -> list[str]:
+    """Parse the given samples with only ``module`` logging at the DEBUG level"""
+    out_log = tmp_path / "module.log"
+    lief.logging.disable()
+    lief.logging.set_level(module, lief.logging.LOGGING_LEVEL.DEBUG)
+    lief.logging.set_path(out_log.as_posix())
+    for sample in samples:
+        assert lief.parse(get_sample(sample)) is not None
+    lines = out_log.read_text().splitlines()
+    lief.logging.reset()
+    return lines
+
+def test_module_level(tmp_path: Path):
+    probe = tmp_path / "probe.log"
+    lief.logging.set_path(probe.as_posix())
+    lief.logging.set_level(lief.logging.LOGGING_LEVEL.DEBUG)
+    lief.logging.log(lief.logging.LOGGING_LEVEL.DEBUG, "probe")
+    debug_support = probe.read_text() == "probe\n"
+    lief.logging.reset()
+    if not debug_support:
+        pytest.skip("LIEF is compiled without the debug messages")
+
+    module = lief.logging.MODULE
+
+    # The other modules stay silent, even for the errors and the warnings
+    assert _module_log(tmp_path, module.MACHO_CHAINED_FIXUPS,
+                       "ELF/ELF64_x86-64_binary_ls.bin",
+                       "PE/PE64_x86-64_binary_mfc-application.exe",
+                       "MachO/MachO64_x86-64_binary_id.bin") == []
+
+    fixups = _module_log(tmp_path, module.MACHO_CHAINED_FIXUPS, CHAINED_FIXUPS)
+    assert any(line.startswith("fixups_version = ") for line in fixups)
+
+    # The messages of the Mach-O parser are not emitted with the ones of the
+    # chained fixups
+    macho = _module_log(tmp_path, module.MACHO, CHAINED_FIXUPS)
+    assert len(macho) > 0
+    assert not set(macho) & set(fixups)
@@ -4,10 +4,12 @@ import math
 import os
 import pathlib
 import stat
+import struct
 import subprocess
 import sys
 import pytest
 from pathlib import Path
+from typing import List, Tuple
 
 from subprocess import Popen
 from utils import is_linux, glibc_version, get_sample
@@ -258,3 +260,119 @@ def test_issue_970(tmp_path: Path):
 
     assert svd_0.auxiliary_symbols[0].name == "libcudart.so.12"
     assert svd_1.auxiliary_symbols[0].name == "libcudart.so.12"
+
+def test_relr_relocations(tmp_path: Path):
+    elf = lief.ELF.parse(get_sample("ELF/main.relr.elf"))
+    relr = {r.address for r in elf.dynamic_relocations
+            if r.encoding == lief.ELF.Relocation.ENCODING.RELR}
+    assert len(relr) > 0
+    assert all(r.is_packed and not r.has_symbol for r in elf.dynamic_relocations
+               if r.encoding == lief.ELF.Relocation.ENCODING.RELR)
+    assert all(not r.is_packed for r in elf.dynamic_relocations
+               if r.encoding == lief.ELF.Relocation.ENCODING.RELA)
+
+    relrsz = elf.get(lief.ELF.DYNAMIC_TAGS.RELRSZ).value
+
+    out = tmp_path / "main.relr.elf"
+    builder = lief.ELF.Builder(elf)
+    builder.config.force_relocate = True
+    builder.build()
+    builder.write(out.as_posix())
+
+    new = lief.ELF.parse(out.as_posix())
+    new_relr = {r.address for r in new.dynamic_relocations
+                if r.encoding == lief.ELF.Relocation.ENCODING.RELR}
+    assert new_relr == relr
+    assert new.get(lief.ELF.DYNAMIC_TAGS.RELRSZ).value <= relrsz
+
+def _sleb128(value: int) -> bytes:
+    out = bytearray()
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if (value == 0 and (byte & 0x40) == 0) or (value == -1 and (byte & 0x40) != 0):
+            out.append(byte)
+            return bytes(out)
+        out.append(byte | 0x80)
+
+def _aps2_encode(entries: List[Tuple[int, int, int]]) -> bytes:
+    """
+    Encode (r_offset, r_info, r_addend) entries in an APS2 table with one
+    group per relocation (i.e. without the grouping used by LIEF)
+    """
+    GROUP_HAS_ADDEND = 8
+    out = bytearray(b"APS2") + _sleb128(len(entries)) + _sleb128(0)
+    offset, addend = 0, 0
+    for r_offset, r_info, r_addend in entries:
+        out += _sleb128(1) + _sleb128(GROUP_HAS_ADDEND)
+        out += _sleb128(r_offset - offset) + _sleb128(r_info) + _sleb128(r_addend - addend)
+        offset, addend = r_offset, r_addend
+    return bytes(out)
+
+def _aps2_relocations(elf: lief.ELF.Binary):
+    # The builder can reorder .dynsym, so the symbols are compared by name
+    return sorted((r.address, r.type, r.addend, r.symbol.name if r.has_symbol else "")
+                  for r in elf.dynamic_relocations
+                  if r.encoding == lief.ELF.Relocation.ENCODING.ANDROID_SLEB)
+
+def test_android_packed_relocations(tmp_path: Path):
+    """
+    Convert the DT_RELA table of ls into an Android APS2 table (DT_ANDROID_RELA)
+    and check that LIEF decodes and re-encodes it
+    """
+    DT = lief.ELF.DYNAMIC_TAGS
+    sample = get_sample("ELF/ELF64_x86-64_binary_ls.bin")
+    elf = lief.ELF.parse(sample)
+    raw = bytearray(Path(sample).read_bytes())
+
+    rela_dyn = elf.get_section(".rela.dyn")
+    entries = [struct.unpack_from("<QQq", raw, rela_dyn.offset + pos)
+               for pos in range(0, rela_dyn.size, 24)]
+    dynsym = elf.dynamic_symbols
+    expected = sorted((r_offset, r_info & 0xffffffff, r_addend,
+                       dynsym[r_info >> 32].name if r_info >> 32 else "")
+                      for r_offset, r_info, r_addend in entries)
+
+    aps2 = _aps2_encode(entries)
+    assert len(aps2) <= rela_dyn.size
+    raw[rela_dyn.offset:rela_dyn.offset + rela_dyn.size] = aps2.ljust(rela_dyn.size, b"\0")
+
+    dynamic = elf.get_section(".dynamic")
+    for pos in range(dynamic.offset, dynamic.offset + dynamic.size, 16):
+        tag, _ = struct.unpack_from("<QQ", raw, pos)
+        if tag == DT.RELA.value:
+            struct.pack_into("<Q", raw, pos, DT.ANDROID_RELA.value)
+        elif tag == DT.RELASZ.value:
+            struct.pack_into("<QQ", raw, pos, DT.ANDROID_RELASZ.value, len(aps2))
+
+    android = tmp_path / "ls.aps2"
+    android.write_bytes(raw)
+
+    # Decoding
+    elf = lief.ELF.parse(android.as_posix())
+    assert elf.has(DT.ANDROID_RELA) and not elf.has(DT.RELA)
+    assert _aps2_relocations(elf) == expected
+    assert all(r.is_packed and r.is_rela for r in elf.dynamic_relocations
+               if r.encoding == lief.ELF.Relocation.ENCODING.ANDROID_SLEB)
+    assert sorted(r.info for r in elf.dynamic_relocations
+                  if r.encoding == lief.ELF.Relocation.ENCODING.ANDROID_SLEB) == \
+           sorted(r_info >> 32 for _, r_info, _ in entries)
+
+    # Re-encoding: the new relocation goes into the APS2 table
+    R_X86_64_RELATIVE = 8
+    new_reloc = (elf.get_section(".data").virtual_address, R_X86_64_RELATIVE, 0x1234, "")
+    elf.add_dynamic_relocation(lief.ELF.Relocation(new_reloc[0], new_reloc[1], new_reloc[2], True))
+
+    out = tmp_path / "ls.aps2.built"
+    builder = lief.ELF.Builder(elf)
+    builder.config.force_relocate = True
+    builder.build()
+    builder.write(out.as_posix())
+
+    new = lief.ELF.parse(out.as_posix())
+    assert not new.has(DT.RELA)
+    assert _aps2_relocations(new) == sorted(expected + [new_reloc])
+
+    dt_rela = new.get(DT.ANDROID_RELA)
+    assert bytes(new.get_content_from_virtual_address(dt_rela.value, 4)) == b"APS2"
+    assert new.get(DT.ANDROID_RELASZ).value > 0
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+import os
+import shutil
+import struct
+import subprocess
+from pathlib import Path
+from subprocess import Popen
+
+import pytest
+
+import lief
+from utils import get_compiler, is_linux, is_x86_64
+
+if not is_linux() or not is_x86_64():
+    pytest.skip("requires Linux x86-64", allow_module_level=True)
+
+COMPILER = get_compiler()
+
+HELLO_C = """\
+#include <stdio.h>
+
+struct point_t {
+  int x;
+  int y;
+};
+
+int main(int argc, char** argv) {
+  struct point_t p = {argc, 2};
+  printf("%d\\n", p.x + p.y);
+  return 0;
+}
+"""
+
+def run(cmd, cwd: Path) -> int:
+    cmd = list(map(str, cmd))
+    print("Running: {}".format(" ".join(cmd)))
+    with Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, cwd=cwd) as P:
+        stdout = P.stdout.read().decode('utf8')
+        print(stdout)
+        return P.wait()
+
+def build(tmp_path: Path) -> Path:
+    src = tmp_path / "hello.c"
+    out = tmp_path / "hello"
+    src.write_text(HELLO_C)
+    if run([COMPILER, "-g", "-o", out, src], tmp_path) != 0:
+        pytest.skip(f"{COMPILER} failed")
+    return out
+
+def compress(tmp_path: Path, infile: Path, algo: str) -> Path:
+    objcopy = shutil.which("objcopy")
+    if objcopy is None:
+        pytest.skip("objcopy not found")
+
+    out = tmp_path / f"hello.{algo}"
+    if run([objcopy, f"--compress-debug-sections={algo}", infile, out], tmp_path) != 0:
+        pytest.skip(f"objcopy does not support {algo}")
+    return out
+
+@pytest.mark.parametrize("algo, compression", [
+    ("zlib", lief.ELF.Section.COMPRESSION.ZLIB),
+    ("zstd", lief.ELF.Section.COMPRESSION.ZSTD),
+])
+def test_decompression(tmp_path: Path, algo: str, compression):
+    original = build(tmp_path)
+    compressed = compress(tmp_path, original, algo)
+
+    ref = lief.ELF.parse(original)
+    elf = lief.ELF.parse(compressed)
+
+    debug_sections = [s for s in elf.sections if s.is_compressed]
+    assert len(debug_sections) > 0
+
+    for section in debug_sections:
+        assert section.name.startswith(".debug")
+        assert section.compression == compression
+        ref_section = ref.get_section(section.name)
+        assert section.uncompressed_size == ref_section.size
+        assert bytes(section.uncompressed_content) == bytes(ref_section.content)
+
+    info = elf.get_section(".debug_info")
+    assert not ref.get_section(".debug_info").is_compressed
+    assert ref.get_section(".debug_info").compression == lief.ELF.Section.COMPRESSION.NONE
+
+    # The content is decompressed on the first access and then cached
+    first = info.uncompressed_content
+    second = info.uncompressed_content
+    assert bytes(first) == bytes(second)
+    assert bytes(info.content) != bytes(first)
+
+@pytest.mark.parametrize("algo", ["zlib", "zstd"])
+def test_rebuild(tmp_path: Path, algo: str):
+    original = build(tmp_path)
+    compressed = compress(tmp_path, original, algo)
+
+    elf = lief.ELF.parse(compressed)
+    info = elf.get_section(".debug_info")
+    str_section = elf.get_section(".debug_str")
+
+    # Same size: the recompressed content fits in place
+    new_info = bytearray(info.uncompressed_content)
+    new_info[-1] ^= 0xFF
+
+    # Random bytes do not compress: the section has to be moved
+    new_str = list(os.urandom(str_section.uncompressed_size + 0x1000))
+
+    info.uncompressed_content = list(new_info)
+    str_section.uncompressed_content = new_str
+
+    output = tmp_path / f"hello.{algo}.modified"
+    elf.write(output.as_posix())
+
+    new = lief.ELF.parse(output)
+    new_info_section = new.get_section(".debug_info")
+    new_str_section = new.get_section(".debug_str")
+
+    assert new_info_section.compression == info.compression
+    assert new_str_section.compression == str_section.compression
+
+    assert bytes(new_info_section.uncompressed_content) == bytes(new_info)
+    assert bytes(new_str_section.uncompressed_content) == bytes(new_str)
+
+    output.chmod(0o755)
+    with Popen([output.as_posix()], stdout=subprocess.PIPE, stderr=subprocess.STDOUT) as P:
+        stdout = P.stdout.read().decode('utf8')
+        assert P.wait() == 0
+        assert stdout.strip() == "3"
+
+def test_unknown_compression(tmp_path: Path):
+    original = build(tmp_path)
+    compressed = compress(tmp_path, original, "zlib")
+
+    elf = lief.ELF.parse(compressed)
+    info = elf.get_section(".debug_info")
+    assert info.is_compressed
+
+    # Elf64_Chdr.ch_type is the first field of the content
+    raw = bytearray(compressed.read_bytes())
+    struct.pack_into("<I", raw, info.file_offset, 0x42)
+    unknown = tmp_path / "hello.unknown"
+    unknown.write_bytes(raw)
+
+    elf = lief.ELF.parse(unknown)
+    info = elf.get_section(".debug_info")
+    assert info.is_compressed
+    assert len(info.uncompressed_content) == 0
@@ -257,6 +257,46 @@ def test_unwind_x86():
     assert functions[-1].name == "_fini"
 
 
+def test_function_at():
+    ld = lief.ELF.parse(get_sample("ELF/ELF64_x86-64_binary_ld.bin"))
+    functions = ld.functions
+    addresses = [f.address for f in functions]
+
+    assert addresses == sorted(addresses)
+
+    target = functions[10]
+    assert target.size == 174
+    assert ld.function_at(target.address).address == target.address
+    assert ld.function_at(target.address + 173).address == target.address
+    assert ld.function_at(0) is None
+
+    # Unknown size: the function extends up to the next one
+    assert functions[0].size == 0
+    assert ld.function_at(functions[1].address - 1).address == functions[0].address
+
+def test_function_index_invalidation():
+    ld = lief.ELF.parse(get_sample("ELF/ELF64_x86-64_binary_ld.bin"))
+    assert ld.function_at(0x10000000) is None
+
+    # The index is invalidated by the setters of the symbols
+    symbol = next(s for s in ld.symbols
+                  if s.type == lief.ELF.SYMBOL_TYPES.FUNC and s.value > 0 and s.size > 0)
+    symbol.value = 0x10000000
+    symbol.name = "lief_moved"
+
+    func = ld.function_at(0x10000000)
+    assert func is not None
+    assert func.name == "lief_moved"
+    assert func.size == symbol.size
+
+    symbol.type = lief.ELF.SYMBOL_TYPES.OBJECT
+    assert ld.function_at(0x10000000) is None
+
+    # function_at() returns a copy which outlives the index
+    assert func.name == "lief_moved"
+    assert func.address == 0x10000000
+
+
 def test_misc():
     sample = "ELF/ELF64_x86-64_binary_ld.bin"
     ld = lief.parse(get_sample(sample))
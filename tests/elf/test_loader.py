@@ -0,0 +1,79 @@
+#!/usr/bin/env python
+import lief
+import struct
+from utils import get_sample
+
+BASE = 0x7f0000000000
+
+SYMBOLIC = (
+    int(lief.ELF.RELOCATION_X86_64.GLOB_DAT),
+    int(lief.ELF.RELOCATION_X86_64.JUMP_SLOT),
+    int(lief.ELF.RELOCATION_X86_64.R64),
+)
+
+def read_u64(loader: lief.ELF.Loader, image: lief.ELF.Loader.Image, address: int) -> int:
+    return struct.unpack_from("<Q", image.content, address - loader.image_start)[0]
+
+def test_layout():
+    elf = lief.ELF.parse(get_sample("ELF/main.relr.elf"))
+    loader = lief.ELF.Loader(elf)
+    image = loader.map(BASE)
+
+    assert image.base == BASE
+    assert len(image.content) == loader.image_size
+    assert loader.image_size % loader.page_size == 0
+
+    for segment in elf.segments:
+        if segment.type != lief.ELF.SEGMENT_TYPES.LOAD:
+            continue
+        start = segment.virtual_address - loader.image_start
+        content = bytes(segment.content)
+        assert len(content) > 0
+        loaded = bytes(image.content[start:start + segment.virtual_size])
+        # .bss
+        assert all(x == 0 for x in loaded[segment.physical_size:])
+
+        # The relocations only modify the words they target
+        targets = {r.address - segment.virtual_address for r in elf.dynamic_relocations}
+        targets |= {r.address - segment.virtual_address for r in elf.pltgot_relocations}
+        for i in range(0, segment.physical_size, 8):
+            if i not in targets:
+                assert loaded[i:i + 8] == content[i:i + 8]
+
+def test_relative():
+    elf = lief.ELF.parse(get_sample("ELF/main.relr.elf"))
+    loader = lief.ELF.Loader(elf)
+    first  = loader.map(BASE)
+    second = loader.map(BASE + 0x10000)
+
+    relatives = [r for r in elf.dynamic_relocations
+                 if r.type == int(lief.ELF.RELOCATION_X86_64.RELATIVE)]
+    assert any(r.encoding == lief.ELF.Relocation.ENCODING.RELR for r in relatives)
+
+    bias = BASE - loader.image_start
+    for reloc in relatives:
+        value = read_u64(loader, first, reloc.address)
+        assert read_u64(loader, second, reloc.address) - value == 0x10000
+        if reloc.is_rela:
+            assert value == bias + reloc.addend
+
+def test_resolver():
+    elf = lief.ELF.parse(get_sample("ELF/main.relr.elf"))
+    loader = lief.ELF.Loader(elf)
+    image = loader.map(BASE)
+
+    got = [r for r in elf.relocations if r.has_symbol and r.type in SYMBOLIC]
+    assert len(got) > 0
+
+    undefined = {r.symbol.name for r in got
+                 if r.symbol.shndx == 0 and r.symbol.binding != lief.ELF.SYMBOL_BINDINGS.WEAK}
+    unresolved = {e.symbol for e in image.unresolved
+                  if e.reason == lief.ELF.Loader.REASON.SYMBOL_NOT_FOUND}
+    assert unresolved == undefined
+
+    imports = {name: 0x1000 * (i + 1) for i, name in enumerate(sorted({r.symbol.name for r in got}))}
+    loader.resolver(lambda sym: imports.get(sym.name))
+    image = loader.map(BASE)
+    assert not any(e.reason == lief.ELF.Loader.REASON.SYMBOL_NOT_FOUND for e in image.unresolved)
+    for reloc in got:
+        assert read_u64(loader, image, reloc.address) == imports[reloc.symbol.name] + reloc.addend
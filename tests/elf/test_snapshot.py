@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+import lief
+from utils import get_sample
+
+def _build(elf: lief.ELF.Binary) -> list[int]:
+    builder = lief.ELF.Builder(elf)
+    builder.build()
+    return builder.get_build()
+
+def test_restore():
+    elf = lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+    libraries = [lib.name for lib in elf.dynamic_entries if lib.tag == lief.ELF.DYNAMIC_TAGS.NEEDED]
+    sections  = [(s.name, s.virtual_address, bytes(s.content)) for s in elf.sections]
+    symbols   = [s.name for s in elf.dynamic_symbols]
+    original  = _build(elf)
+
+    snapshot = elf.snapshot()
+
+    text = elf.get_section(".text")
+    elf.add_library("libfoo.so")
+    text.content = [0xcc] * 0x100
+    elf.remove_dynamic_symbol(elf.dynamic_symbols[1])
+
+    assert elf.has_library("libfoo.so")
+
+    # The snapshot can be restored several times
+    for _ in range(2):
+        restored = snapshot.restore()
+        assert not restored.has_library("libfoo.so")
+        assert [lib.name for lib in restored.dynamic_entries if lib.tag == lief.ELF.DYNAMIC_TAGS.NEEDED] == libraries
+        assert [(s.name, s.virtual_address, bytes(s.content)) for s in restored.sections] == sections
+        assert [s.name for s in restored.dynamic_symbols] == symbols
+        assert _build(restored) == original
+
+        restored.add_section(lief.ELF.Section(".lief_snapshot"))
+        restored.get_section(".text").content = [0x90] * 0x10
+
+    # The original binary and its objects are still valid
+    assert elf.has_library("libfoo.so")
+    assert bytes(text.content[:0x100]) == b"\xcc" * 0x100
+    assert elf.get_section(".lief_snapshot") is None
+
+def test_snapshot_lifetime():
+    snapshot = lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin')).snapshot()
+    restored = snapshot.restore()
+    del snapshot
+    assert restored.get_section(".text") is not None
+    assert len(_build(restored)) > 0
+
+def test_patch_address():
+    elf = lief.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+    text = elf.get_section(".text")
+    original = bytes(text.content[:4])
+    snapshot = elf.snapshot()
+
+    # patch_address() writes through the raw content which must not be
+    # shared with the snapshot
+    elf.patch_address(text.virtual_address, [0xcc] * 4)
+    assert bytes(text.content[:4]) == b"\xcc" * 4
+    assert bytes(snapshot.restore().get_section(".text").content[:4]) == original
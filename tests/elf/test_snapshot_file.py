@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+import shutil
+from pathlib import Path
+
+import lief
+from utils import get_sample
+
+def _build(elf: lief.ELF.Binary) -> list[int]:
+    builder = lief.ELF.Builder(elf)
+    builder.build()
+    return builder.get_build()
+
+def test_save_load(tmp_path: Path):
+    source = tmp_path / "ls.bin"
+    shutil.copy(get_sample('ELF/ELF64_x86-64_binary_ls.bin'), source)
+    snapshot = tmp_path / "ls.snapshot"
+
+    elf = lief.ELF.parse(source.as_posix())
+    assert elf.save_snapshot(snapshot.as_posix())
+
+    loaded = lief.ELF.parse_snapshot(snapshot.as_posix(), source.as_posix())
+    assert loaded is not None
+
+    assert loaded.header.entrypoint == elf.header.entrypoint
+    assert [(s.name, s.virtual_address, bytes(s.content)) for s in loaded.sections] == \
+           [(s.name, s.virtual_address, bytes(s.content)) for s in elf.sections]
+    assert [(s.type, s.file_offset, len(s.sections)) for s in loaded.segments] == \
+           [(s.type, s.file_offset, len(s.sections)) for s in elf.segments]
+    assert [(s.name, s.value, str(s.symbol_version)) for s in loaded.symbols] == \
+           [(s.name, s.value, str(s.symbol_version)) for s in elf.symbols]
+    assert [(r.address, r.type, r.has_symbol and r.symbol.name) for r in loaded.relocations] == \
+           [(r.address, r.type, r.has_symbol and r.symbol.name) for r in elf.relocations]
+    assert [str(e) for e in loaded.dynamic_entries] == [str(e) for e in elf.dynamic_entries]
+    assert loaded.interpreter == elf.interpreter
+    assert loaded.gnu_hash.bloom_filters == elf.gnu_hash.bloom_filters
+
+    assert _build(loaded) == _build(elf)
+
+def test_stale(tmp_path: Path):
+    source = tmp_path / "ls.bin"
+    shutil.copy(get_sample('ELF/ELF64_x86-64_binary_ls.bin'), source)
+    snapshot = tmp_path / "ls.snapshot"
+
+    lief.ELF.parse(source.as_posix()).save_snapshot(snapshot.as_posix())
+
+    raw = bytearray(source.read_bytes())
+    raw[-1] ^= 0xff
+    source.write_bytes(raw)
+    assert lief.ELF.parse_snapshot(snapshot.as_posix(), source.as_posix()) is None
+
+def test_modified(tmp_path: Path):
+    snapshot = tmp_path / "ls.snapshot"
+
+    elf = lief.ELF.parse(get_sample('ELF/ELF64_x86-64_binary_ls.bin'))
+    text = elf.get_section(".text")
+    content = list(text.content)
+    content[0] ^= 0xff
+    text.content = content
+
+    # The content is read from the source file when loading the snapshot
+    assert elf.save_snapshot(snapshot.as_posix()) == lief.lief_errors.not_supported
+    assert not snapshot.exists()
+
+def test_format(tmp_path: Path):
+    source = tmp_path / "ls.bin"
+    shutil.copy(get_sample('ELF/ELF64_x86-64_binary_ls.bin'), source)
+    snapshot = tmp_path / "ls.snapshot"
+    snapshot.write_bytes(b"LIEFSNAP" + bytes(0x100))
+
+    assert lief.ELF.parse_snapshot(snapshot.as_posix(), source.as_posix()) is None
@@ -24,3 +24,34 @@ def test_code_signature_dir():
 
     assert hash(code_signature_dirs) > 0
     lief.MachO.LOAD_COMMAND_TYPES.LINKER_OPTIMIZATION_HINT
+
+def test_code_directory(tmp_path):
+    bin_path = Path(get_sample('MachO/MachO64_x86-64_binary_id.bin'))
+    original: lief.MachO.Binary = lief.MachO.parse(bin_path.as_posix()).at(0)
+    code_signature = original.code_signature
+
+    code_directories = list(code_signature.code_directories)
+    assert len(code_directories) > 0
+
+    cd = code_directories[0]
+    assert cd.slot_type == 0
+    assert cd.code_limit == code_signature.data_offset
+    assert cd.nb_code_slots == (cd.code_limit + cd.page_size - 1) // cd.page_size
+    assert cd.verify(bin_path.as_posix()) == []
+
+    raw = list(bin_path.read_bytes())
+    assert bytes(cd.code_hash(0)) == cd.hash(raw[:cd.page_size])
+
+    raw[cd.page_size + 1] ^= 0xff
+    assert cd.verify(raw) == [1]
+
+    # Rebuild a patched binary and regenerate the page hashes
+    original.patch_address(original.entrypoint, [0xcc])
+    config = lief.MachO.Builder.config_t()
+    config.code_signature_hashes = True
+    output = tmp_path / "id_patched.bin"
+    lief.MachO.Builder.write(original, output.as_posix(), config)
+
+    new = lief.MachO.parse(output.as_posix()).at(0)
+    for cd in new.code_signature.code_directories:
+        assert cd.verify(output.as_posix()) == []
@@ -174,6 +174,56 @@ def test_3():
     assert (rebases[23].address, rebases[23].target) == (0x6C05C, 0)
     assert (rebases[32].address, rebases[32].target) == (0x6C208, 0x4EEF9)
 
+def test_fixups_table():
+    """
+    The compact table of fixups must be consistent with the RelocationFixup
+    and the ChainedBindingInfo objects (and available with a quick parsing)
+    """
+    path = get_sample('MachO/9edfb04c55289c6c682a25211a4b30b927a86fe50b014610d04d6055bd4ac23d_crypt_and_hash.macho')
+    target = lief.MachO.parse(path).take(lief.MachO.CPU_TYPES.ARM64)
+    dyld_chained = target.dyld_chained_fixups
+    table = dyld_chained.fixups
+
+    KIND = lief.MachO.DyldChainedFixups.fixups_table_t.KIND
+    rebases = [i for i, k in enumerate(table.kind) if k in (KIND.REBASE, KIND.AUTH_REBASE)]
+    binds   = [i for i, k in enumerate(table.kind) if k in (KIND.BIND, KIND.AUTH_BIND)]
+
+    assert len(binds) == len(dyld_chained.bindings)
+    assert len(rebases) == sum(len(seg.relocations) for seg in target.segments)
+
+    relocations = {r.address: r.target for seg in target.segments for r in seg.relocations}
+    for idx in rebases:
+        assert relocations[target.imagebase + table.offset[idx]] == table.target[idx]
+
+    config = lief.MachO.ParserConfig.quick
+    quick = lief.MachO.parse(path, config).take(lief.MachO.CPU_TYPES.ARM64)
+    quick_table = quick.dyld_chained_fixups.fixups
+    assert len(quick_table) == len(table)
+    assert quick_table.offset == table.offset
+    assert quick_table.raw == table.raw
+
+def test_lazy_fixups_objects():
+    """
+    The RelocationFixup and ChainedBindingInfo objects are created on the first
+    access and they must match regardless of the parser configuration
+    """
+    path = get_sample('MachO/9edfb04c55289c6c682a25211a4b30b927a86fe50b014610d04d6055bd4ac23d_crypt_and_hash.macho')
+    target = lief.MachO.parse(path).take(lief.MachO.CPU_TYPES.ARM64)
+    quick = lief.MachO.parse(path, lief.MachO.ParserConfig.quick).take(lief.MachO.CPU_TYPES.ARM64)
+
+    # Access the bindings first on one binary and the relocations first on the other
+    bindings = [(b.address, b.library_ordinal, b.addend) for b in quick.dyld_chained_fixups.bindings]
+    relocations = [(r.address, r.target, r.size) for r in target.relocations]
+
+    assert relocations == [(r.address, r.target, r.size) for r in quick.relocations]
+    assert bindings == [(b.address, b.library_ordinal, b.addend) for b in target.dyld_chained_fixups.bindings]
+    assert len(relocations) > 0
+    assert len(bindings) > 0
+
+    for seg in quick.segments:
+        for reloc in seg.relocations:
+            assert reloc.segment.name == seg.name
+
 def test_builder(tmp_path):
     binary_name = "crypt_and_hash"
     fat = lief.MachO.parse(get_sample('MachO/9edfb04c55289c6c682a25211a4b30b927a86fe50b014610d04d6055bd4ac23d_crypt_and_hash.macho'))
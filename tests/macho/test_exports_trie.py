@@ -52,3 +52,28 @@ def test_write(tmp_path):
             assert "AES-128-CCM*-NO-TAG" in stdout
 
 
+
+def test_exports_view():
+    path = get_sample('MachO/9edfb04c55289c6c682a25211a4b30b927a86fe50b014610d04d6055bd4ac23d_crypt_and_hash.macho')
+    target = lief.MachO.parse(path).take(lief.MachO.CPU_TYPES.ARM64)
+
+    exports = target.get(lief.MachO.LOAD_COMMAND_TYPES.DYLD_EXPORTS_TRIE)
+    entries = list(target.exports_view)
+    assert len(entries) == 885
+    assert [(e.name, e.info.address) for e in entries] == \
+           [(e.symbol.name, e.address) for e in exports.exports]
+
+    main = target.find_export("_main")
+    assert main.address == 0x4550
+    assert main.kind == lief.MachO.EXPORT_SYMBOL_KINDS.REGULAR
+    assert exports.find_export("_psa_its_remove").address == 0x3DACC
+    assert isinstance(target.find_export("_mai"), lief.lief_errors)
+    assert isinstance(target.find_export("_does_not_exist"), lief.lief_errors)
+
+    # The view does not depend on the ExportInfo decoded by the parser
+    config = lief.MachO.ParserConfig()
+    config.parse_dyld_exports = False
+    target = lief.MachO.parse(path, config).take(lief.MachO.CPU_TYPES.ARM64)
+    assert len(target.get(lief.MachO.LOAD_COMMAND_TYPES.DYLD_EXPORTS_TRIE).exports) == 0
+    assert target.find_export("_main").address == 0x4550
+    assert "_psa_its_remove" in target.exports_view
@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+import shutil
+from pathlib import Path
+
+import pytest
+
+import lief
+from utils import get_sample
+
+def _exports(macho: lief.MachO.Binary):
+    return [(e.node_offset, e.flags, e.address,
+             e.symbol.name if e.has_symbol else None)
+            for e in macho.dyld_info.exports] if macho.has_dyld_info else []
+
+def _bindings(macho: lief.MachO.Binary):
+    return [(b.binding_class, b.binding_type, b.address, b.addend, b.library_ordinal,
+             b.original_offset, b.symbol.name if b.has_symbol else None,
+             b.library.name if b.has_library else None)
+            for b in macho.dyld_info.bindings] if macho.has_dyld_info else []
+
+def _rebases(macho: lief.MachO.Binary):
+    return [(r.address, r.type, r.size, r.section.name)
+            for r in macho.relocations if r.origin == lief.MachO.RELOCATION_ORIGINS.DYLDINFO]
+
+def _check(loaded: lief.MachO.Binary, macho: lief.MachO.Binary):
+    assert _exports(loaded) == _exports(macho)
+    assert _bindings(loaded) == _bindings(macho)
+    assert _rebases(loaded) == _rebases(macho)
+    assert [(s.name, s.value, s.origin) for s in loaded.symbols] == \
+           [(s.name, s.value, s.origin) for s in macho.symbols]
+
+@pytest.mark.parametrize("sample", [
+    "MachO/MachO64_x86-64_binary_id.bin",
+    "MachO/MachO64_x86-64_binary_sshd.bin",
+    "MachO/MachO64_x86-64_binary_lazy-bind-LLVM.bin",
+])
+def test_save_load(tmp_path: Path, sample: str):
+    source = tmp_path / Path(sample).name
+    shutil.copy(get_sample(sample), source)
+    snapshot = tmp_path / "macho.snapshot"
+
+    macho = lief.MachO.parse(source.as_posix()).at(0)
+    assert macho.save_snapshot(snapshot.as_posix())
+
+    loaded = lief.MachO.parse_snapshot(snapshot.as_posix(), source.as_posix())
+    assert loaded is not None
+    _check(loaded, macho)
+
+    # A loaded snapshot can be saved again
+    assert loaded.save_snapshot(snapshot.as_posix())
+
+def test_fat(tmp_path: Path):
+    source = tmp_path / "libdyld.dylib"
+    shutil.copy(get_sample("MachO/FAT_MachO_x86_x86-64_library_libdyld.dylib"), source)
+
+    fat = lief.MachO.parse(source.as_posix())
+    for idx, macho in enumerate(fat):
+        snapshot = tmp_path / f"libdyld_{idx}.snapshot"
+        assert macho.save_snapshot(snapshot.as_posix())
+
+        loaded = lief.MachO.parse_snapshot(snapshot.as_posix(), source.as_posix())
+        assert loaded is not None
+        assert loaded.fat_offset == macho.fat_offset
+        assert loaded.header.cpu_type == macho.header.cpu_type
+        _check(loaded, macho)
+
+def test_stale(tmp_path: Path):
+    source = tmp_path / "id.bin"
+    shutil.copy(get_sample("MachO/MachO64_x86-64_binary_id.bin"), source)
+    snapshot = tmp_path / "id.snapshot"
+
+    assert lief.MachO.parse(source.as_posix()).at(0).save_snapshot(snapshot.as_posix())
+
+    raw = bytearray(source.read_bytes())
+    raw[-1] ^= 0xff
+    source.write_bytes(raw)
+    assert lief.MachO.parse_snapshot(snapshot.as_posix(), source.as_posix()) is None
+
+def test_modified(tmp_path: Path):
+    snapshot = tmp_path / "id.snapshot"
+    macho = lief.MachO.parse(get_sample("MachO/MachO64_x86-64_binary_id.bin")).at(0)
+    text = macho.get_segment("__TEXT")
+    content = list(text.content)
+    content[-1] ^= 0xff
+    text.content = content
+    assert macho.save_snapshot(snapshot.as_posix()) == lief.lief_errors.not_supported
@@ -1,6 +1,9 @@
 #!/usr/bin/env python
 import json
+import struct
 import sys
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
 
 import lief
 from utils import get_sample
@@ -246,6 +249,55 @@ def test_self_signed():
     assert cert_ca.verify(cert_signer) == lief.PE.x509.VERIFICATION_FLAGS.OK
     assert cert_ca.is_trusted_by(ca_bundles) == lief.PE.x509.VERIFICATION_FLAGS.BADCERT_NOT_TRUSTED
 
+def test_trust_store():
+    ca_bundles = lief.PE.x509.parse(get_sample("pkcs7/windows-ca-bundle.pem"))
+    store = lief.PE.TrustStore(ca_bundles)
+    assert len(store) == len(ca_bundles)
+
+    avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
+    sig = avast.signatures[0]
+    cert_ca, cert_signer = sig.certificates
+
+    assert store.verify(cert_ca) == cert_ca.is_trusted_by(ca_bundles)
+    assert store.verify(cert_signer) == cert_signer.is_trusted_by(ca_bundles)
+    assert store.verify(cert_signer, [cert_ca]) == lief.PE.x509.VERIFICATION_FLAGS.BADCERT_EXPIRED
+    assert store.verify(sig) == lief.PE.x509.VERIFICATION_FLAGS.BADCERT_EXPIRED
+    assert store.cache_size == 3
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(store.verify, [cert_ca, cert_signer] * 16))
+    assert results == [store.verify(cert_ca), store.verify(cert_signer)] * 16
+    assert store.cache_size == 3
+
+    selfsigned = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_self-signed.exe"))
+    self_ca, self_signer = selfsigned.signatures[0].certificates
+    assert store.verify(self_signer) != lief.PE.x509.VERIFICATION_FLAGS.OK
+
+    store.add(self_ca)
+    assert store.cache_size == 0
+    assert store.verify(self_signer) == lief.PE.x509.VERIFICATION_FLAGS.OK
+
+    # The cache is bounded: the oldest results are evicted first
+    assert store.max_cache_size == 4096
+    store.max_cache_size = 2
+    assert store.verify(cert_ca) == cert_ca.is_trusted_by(ca_bundles)
+    assert store.verify(cert_signer) == cert_signer.is_trusted_by(ca_bundles)
+    assert store.cache_size == 2
+
+    store.max_cache_size = 0
+    assert store.cache_size == 0
+    assert store.verify(self_signer) == lief.PE.x509.VERIFICATION_FLAGS.OK
+    assert store.cache_size == 0
+
+def test_concurrent_verify():
+    selfsigned = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_self-signed.exe"))
+    cert_ca, cert_signer = selfsigned.signatures[0].certificates
+
+    # The threads share the same underlying mbedtls certificates
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda _: cert_ca.verify(cert_signer), range(64)))
+    assert all(r == lief.PE.x509.VERIFICATION_FLAGS.OK for r in results)
+
 def test_rsa_info():
     avast = lief.PE.parse(get_sample("PE/PE32_x86-64_binary_avast-free-antivirus-setup-online.exe"))
     cert_ca, cert_signer = avast.signatures[0].certificates
@@ -267,6 +319,32 @@ def test_rsa_info():
     assert P == 0
     assert Q == 0
 
+def test_truncated_certificate_table(tmp_path):
+    """
+    The entries of a certificate table which runs past the end of the file
+    are still parsed
+    """
+    sample = get_sample("PE/PE32_x86-64_binary_self-signed.exe")
+    pe = lief.PE.parse(sample)
+    cert_dir = pe.data_directory(lief.PE.DataDirectory.TYPES.CERTIFICATE_TABLE)
+    offset, size = cert_dir.rva, cert_dir.size
+
+    raw = bytearray(Path(sample).read_bytes()[:offset + size])
+    e_lfanew = struct.unpack_from("<I", raw, 0x3c)[0]
+    opt_header = e_lfanew + 4 + 20
+    magic = struct.unpack_from("<H", raw, opt_header)[0]
+    dirs = opt_header + (112 if magic == 0x20b else 96)
+    CERTIFICATE_TABLE_IDX = 4
+    struct.pack_into("<I", raw, dirs + CERTIFICATE_TABLE_IDX * 8 + 4, size + 0x100)
+
+    truncated = tmp_path / "truncated.exe"
+    truncated.write_bytes(raw)
+
+    new = lief.PE.parse(truncated.as_posix())
+    assert len(new.signatures) == len(pe.signatures) > 0
+    for lhs, rhs in zip(new.signatures, pe.signatures):
+        assert bytes(lhs.raw_der) == bytes(rhs.raw_der)
+
 def test_issue_703():
     sig: lief.PE.Signature = lief.PE.Signature.parse(get_sample("pkcs7/cert_issue_703.der"))
     assert sig.certificates[0].issuer == "CN=TxExoTiQueMoDz\\\\Tx ExoTiQueMoDz"
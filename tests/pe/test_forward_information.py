@@ -23,3 +23,42 @@ def test_basic():
     assert json_serialized["forward_information"]["library"] == "NTDLL"
     assert json_serialized["forward_information"]["function"] == "RtlInterlockedPushListSList"
 
+
+def test_find_export():
+    path = get_sample('PE/PE32_x86_library_kernel32.dll')
+    pe = lief.PE.parse(path)
+    exports = pe.get_export()
+
+    for entry in exports.entries:
+        # The name of the forwarded entries is the forwarder string
+        if not entry.name or entry.is_extern:
+            continue
+        assert exports.find_entry(entry.name).ordinal == entry.ordinal
+
+        lookup = lief.PE.find_export(path, entry.name)
+        assert lookup.ordinal == entry.ordinal
+        assert lookup.address == entry.function_rva
+        assert not lookup.is_extern
+
+        assert lief.PE.find_export(path, entry.ordinal).address == entry.function_rva
+        assert exports.find_entry_at_ordinal(entry.ordinal).name == entry.name
+
+    assert exports.find_entry("_LIEF_NOT_EXPORTED_") is None
+    assert lief.PE.find_export(path, "_LIEF_NOT_EXPORTED_") == lief.lief_errors.not_found
+
+    forwarded = [e for e in exports.entries if e.is_forwarded][0]
+    assert pe.get_function_address(forwarded.name) == lief.lief_errors.not_found
+
+def test_find_export_renamed():
+    pe = lief.PE.parse(get_sample('PE/PE32_x86_library_kernel32.dll'))
+    exports = pe.get_export()
+    entry = [e for e in exports.entries if e.name and not e.is_extern][0]
+    old_name = entry.name
+    address = entry.address
+    assert pe.get_function_address(old_name) == address
+
+    entry.name = "_LIEF_RENAMED_"
+    assert exports.find_entry("_LIEF_RENAMED_").ordinal == entry.ordinal
+    assert exports.find_entry(old_name) is None
+    assert pe.get_function_address("_LIEF_RENAMED_") == address
+    assert pe.get_function_address(old_name) == lief.lief_errors.not_found
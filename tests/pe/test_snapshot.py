@@ -0,0 +1,35 @@
+#!/usr/bin/env python
+import lief
+from utils import get_sample
+
+def _build(pe: lief.PE.Binary) -> list[int]:
+    builder = lief.PE.Builder(pe)
+    builder.build()
+    return builder.get_build()
+
+def test_restore():
+    pe = lief.parse(get_sample('PE/PE32_x86_binary_HelloWorld.exe'))
+    libraries = [imp.name for imp in pe.imports]
+    sections  = [(s.name, s.virtual_address, bytes(s.content)) for s in pe.sections]
+    original  = _build(pe)
+
+    snapshot = pe.snapshot()
+
+    section = pe.sections[0]
+    pe.add_library("user32.dll")
+    pe.add_section(lief.PE.Section([0x90] * 0x100, ".lief", 0))
+    section.content = [0xcc] * 0x10
+
+    # The snapshot can be restored several times
+    for _ in range(2):
+        restored = snapshot.restore()
+        assert [imp.name for imp in restored.imports] == libraries
+        assert [(s.name, s.virtual_address, bytes(s.content)) for s in restored.sections] == sections
+        assert _build(restored) == original
+
+        restored.add_section(lief.PE.Section(".lief_snapshot"))
+
+    # The original binary and its objects are still valid
+    assert pe.has_import("user32.dll")
+    assert bytes(section.content[:0x10]) == b"\xcc" * 0x10
+    assert pe.get_section(".lief_snapshot") is None
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+import shutil
+from pathlib import Path
+
+import pytest
+
+import lief
+from utils import get_sample
+
+def _imports(pe: lief.PE.Binary):
+    return [(imp.name, imp.import_address_table_rva,
+             [(e.name, e.data, e.iat_address, e.hint) for e in imp.entries])
+            for imp in pe.imports]
+
+def _relocations(pe: lief.PE.Binary):
+    return [(r.virtual_address, r.block_size, [(e.position, e.type) for e in r.entries])
+            for r in pe.relocations]
+
+def _exports(pe: lief.PE.Binary):
+    exp = pe.get_export()
+    return (exp.name, exp.ordinal_base, exp.timestamp,
+            [(e.name, e.ordinal, e.address, e.is_extern,
+              e.forward_information.library, e.forward_information.function)
+             for e in exp.entries])
+
+@pytest.mark.parametrize("sample", [
+    "PE/PE64_x86-64_binary_mfc-application.exe",
+    "PE/PE32_x86_library_kernel32.dll",
+])
+def test_save_load(tmp_path: Path, sample: str):
+    source = tmp_path / Path(sample).name
+    shutil.copy(get_sample(sample), source)
+    snapshot = tmp_path / "pe.snapshot"
+
+    pe = lief.PE.parse(source.as_posix())
+    assert pe.save_snapshot(snapshot.as_posix())
+
+    loaded = lief.PE.parse_snapshot(snapshot.as_posix(), source.as_posix())
+    assert loaded is not None
+
+    assert _imports(loaded) == _imports(pe)
+    assert _relocations(loaded) == _relocations(pe)
+    assert loaded.has_exports == pe.has_exports
+    if pe.has_exports:
+        assert _exports(loaded) == _exports(pe)
+
+    assert [(s.name, s.virtual_address) for s in loaded.sections] == \
+           [(s.name, s.virtual_address) for s in pe.sections]
+    assert lief.PE.get_imphash(loaded) == lief.PE.get_imphash(pe)
+
+    # A loaded snapshot can be saved again
+    assert loaded.save_snapshot(snapshot.as_posix())
+
+def test_stale(tmp_path: Path):
+    source = tmp_path / "mfc.exe"
+    shutil.copy(get_sample("PE/PE64_x86-64_binary_mfc-application.exe"), source)
+    snapshot = tmp_path / "mfc.snapshot"
+
+    assert lief.PE.parse(source.as_posix()).save_snapshot(snapshot.as_posix())
+
+    raw = bytearray(source.read_bytes())
+    raw[-1] ^= 0xff
+    source.write_bytes(raw)
+    assert lief.PE.parse_snapshot(snapshot.as_posix(), source.as_posix()) is None
+
+def test_modified(tmp_path: Path):
+    snapshot = tmp_path / "mfc.snapshot"
+    pe = lief.PE.parse(get_sample("PE/PE64_x86-64_binary_mfc-application.exe"))
+    text = pe.get_section(".text")
+    content = list(text.content)
+    content[0] ^= 0xff
+    text.content = content
+    assert pe.save_snapshot(snapshot.as_posix()) == lief.lief_errors.not_supported
+
+def test_format(tmp_path: Path):
+    elf_snapshot = tmp_path / "ls.snapshot"
+    source = tmp_path / "mfc.exe"
+    shutil.copy(get_sample("PE/PE64_x86-64_binary_mfc-application.exe"), source)
+
+    assert lief.ELF.parse(get_sample("ELF/ELF64_x86-64_binary_ls.bin")).save_snapshot(elf_snapshot.as_posix())
+    assert lief.PE.parse_snapshot(elf_snapshot.as_posix(), source.as_posix()) is None
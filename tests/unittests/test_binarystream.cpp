@@ -15,6 +15,10 @@
  */
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+#include <thread>
 
 #include "utils.hpp"
 
@@ -23,9 +27,64 @@
 #include <LIEF/BinaryStream/SpanStream.hpp>
 #include <LIEF/BinaryStream/VectorStream.hpp>
 #include <LIEF/BinaryStream/FileStream.hpp>
+#include <LIEF/BinaryStream/StreamCursor.hpp>
 
 using namespace LIEF;
 
+// Stream which is not backed by a contiguous buffer so that it goes
+// through the generic (byte-per-byte) implementation
+class GenericStream : public BinaryStream {
+  public:
+  GenericStream(const std::vector<uint8_t>& data) :
+    data_(data)
+  {}
+
+  uint64_t size() const override {
+    return data_.size();
+  }
+
+  protected:
+  result<const void*> read_at(uint64_t offset, uint64_t size) const override {
+    if (offset > data_.size() || offset + size > data_.size()) {
+      return make_error_code(lief_errors::read_error);
+    }
+    return data_.data() + offset;
+  }
+  const std::vector<uint8_t>& data_;
+};
+
+static std::vector<uint8_t> gen_strings(size_t count, bool ascii) {
+  std::mt19937 gen(0x1337);
+  std::uniform_int_distribution<int> len_dist(0, 40);
+  std::uniform_int_distribution<int> chr_dist(1, ascii ? 0x7F : 0xFF);
+  std::vector<uint8_t> data;
+  for (size_t i = 0; i < count; ++i) {
+    const int len = len_dist(gen);
+    for (int j = 0; j < len; ++j) {
+      data.push_back(chr_dist(gen));
+    }
+    data.push_back(0);
+  }
+  return data;
+}
+
+static std::vector<uint8_t> gen_leb128(size_t count) {
+  std::mt19937_64 gen(0x1337);
+  std::vector<uint8_t> data;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t value = gen() >> (gen() % 64);
+    do {
+      uint8_t byte = value & 0x7F;
+      value >>= 7;
+      if (value != 0) {
+        byte |= 0x80;
+      }
+      data.push_back(byte);
+    } while (value != 0);
+  }
+  return data;
+}
+
 TEST_CASE("lief.test.binarystream", "[lief][test][binarystream]") {
   SECTION("MemoryStream") {
     std::vector<uint8_t> buffer = {
@@ -80,3 +139,255 @@ TEST_CASE("lief.test.binarystream", "[lief][test][binarystream]") {
   }
 
 }
+
+TEST_CASE("lief.test.binarystream.fastpath", "[lief][test][binarystream]") {
+  SECTION("strings") {
+    const std::vector<uint8_t> data = gen_strings(500, /*ascii=*/false);
+    GenericStream generic(data);
+    SpanStream fast(data);
+
+    for (size_t maxsize : {~static_cast<size_t>(0), size_t(0), size_t(1), size_t(5)}) {
+      generic.setpos(0);
+      fast.setpos(0);
+      while (generic) {
+        REQUIRE(generic.peek_string(maxsize) == fast.peek_string(maxsize));
+        REQUIRE(generic.read_string() == fast.read_string());
+        REQUIRE(generic.pos() == fast.pos());
+      }
+    }
+
+    // Not null-terminated
+    const std::vector<uint8_t> raw = {'A', 'B', 'C', 'D'};
+    GenericStream generic_raw(raw);
+    SpanStream fast_raw(raw);
+    for (size_t pos = 0; pos < raw.size(); ++pos) {
+      generic_raw.setpos(pos);
+      fast_raw.setpos(pos);
+      REQUIRE(generic_raw.peek_string() == fast_raw.peek_string());
+    }
+    REQUIRE(*fast_raw.peek_string_at(0) == "ABC");
+  }
+
+  SECTION("leb128") {
+    const std::vector<uint8_t> data = gen_leb128(2000);
+    GenericStream generic(data);
+    SpanStream fast(data);
+
+    while (generic) {
+      const size_t pos = generic.pos();
+      REQUIRE(generic.read_uleb128() == fast.read_uleb128());
+      REQUIRE(generic.pos() == fast.pos());
+      generic.setpos(pos);
+      fast.setpos(pos);
+      REQUIRE(generic.read_sleb128() == fast.read_sleb128());
+      REQUIRE(generic.pos() == fast.pos());
+    }
+
+    // Truncated
+    const std::vector<uint8_t> truncated = {0x80, 0x80};
+    SpanStream fast_truncated(truncated);
+    REQUIRE(!fast_truncated.read_uleb128());
+    fast_truncated.setpos(0);
+    REQUIRE(!fast_truncated.read_sleb128());
+
+    const std::vector<uint8_t> minus_one = {0x7F};
+    SpanStream fast_minus_one(minus_one);
+    REQUIRE(static_cast<int64_t>(*fast_minus_one.read_sleb128()) == -1);
+
+    // The bits beyond the 64th are discarded
+    const std::vector<uint8_t> large = {
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+    };
+    SpanStream fast_large(large);
+    REQUIRE(*fast_large.read_uleb128() == ~static_cast<uint64_t>(0));
+    REQUIRE(fast_large.pos() == 11);
+    REQUIRE(*fast_large.read_sleb128() == 0);
+    REQUIRE(fast_large.pos() == large.size());
+  }
+
+  SECTION("mutf8") {
+    std::vector<uint8_t> data = gen_strings(200, /*ascii=*/true);
+    // 'A' + U+00E9 + U+20AC + 'B'
+    data.insert(data.end(), {'A', 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 'B', 0x00});
+    GenericStream generic(data);
+    SpanStream fast(data);
+
+    while (generic) {
+      REQUIRE(generic.read_mutf8() == fast.read_mutf8());
+      REQUIRE(generic.pos() == fast.pos());
+    }
+
+    fast.setpos(fast.size() - 8);
+    REQUIRE(*fast.read_mutf8() == "A\u00e9\u20acB");
+
+    fast.setpos(fast.size() - 8);
+    REQUIRE(*fast.read_mutf8(2) == "A\u00e9");
+  }
+}
+
+TEST_CASE("lief.test.binarystream.cursor", "[lief][test][binarystream]") {
+  SECTION("peek_xxx_at do not change the position") {
+    const std::vector<uint8_t> data = {'A', 'B', '\0', 0xE5, 0x8E, 0x26, 0x01, 0x02};
+    SpanStream stream(data);
+    stream.setpos(1);
+    REQUIRE(*stream.peek_string_at(0) == "AB");
+    REQUIRE(*stream.peek<uint8_t>(6) == 1);
+    REQUIRE(*stream.peek_conv<uint16_t>(6) == 0x0201);
+    REQUIRE(stream.peek_array<uint8_t>(6, 2) == data.data() + 6);
+    REQUIRE(*stream.peek_u16string_at(6, 1) == u"\u0201");
+    REQUIRE(stream.pos() == 1);
+  }
+
+  SECTION("read") {
+    const std::vector<uint8_t> data = {'A', 'B', '\0', 0xE5, 0x8E, 0x26, 0x01, 0x02};
+    for (bool contiguous : {true, false}) {
+      SpanStream span_stream(data);
+      GenericStream generic_stream(data);
+      const BinaryStream& stream = contiguous ? static_cast<const BinaryStream&>(span_stream) :
+                                                static_cast<const BinaryStream&>(generic_stream);
+      StreamCursor cursor(stream);
+      REQUIRE(*cursor.read_string() == "AB");
+      REQUIRE(cursor.pos() == 3);
+      REQUIRE(*cursor.read_uleb128() == 624485);
+      REQUIRE(*cursor.read<uint8_t>() == 1);
+      REQUIRE(cursor.pos() == 7);
+      REQUIRE(cursor);
+      REQUIRE(*cursor.read<uint8_t>() == 2);
+      REQUIRE(!cursor);
+      REQUIRE(!cursor.read<uint8_t>());
+      REQUIRE(cursor.pos() == data.size());
+
+      std::vector<uint8_t> out;
+      REQUIRE(cursor.peek_data(out, 3, 3));
+      REQUIRE(out == std::vector<uint8_t>{0xE5, 0x8E, 0x26});
+      REQUIRE(!cursor.peek_data(out, 6, 3));
+      REQUIRE(stream.pos() == 0);
+    }
+  }
+
+  SECTION("concurrent reads") {
+    const std::vector<uint8_t> data = gen_strings(2000, /*ascii=*/false);
+    SpanStream stream(data);
+
+    std::vector<std::string> expected;
+    for (StreamCursor cursor(stream); cursor;) {
+      expected.push_back(*cursor.read_string());
+    }
+
+    std::vector<std::vector<std::string>> results(4);
+    std::vector<std::thread> threads;
+    for (std::vector<std::string>& result : results) {
+      threads.emplace_back([&stream, &result] {
+        for (StreamCursor cursor(stream); cursor;) {
+          result.push_back(*cursor.read_string());
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    for (const std::vector<std::string>& result : results) {
+      REQUIRE(result == expected);
+    }
+    REQUIRE(stream.pos() == 0);
+  }
+}
+
+TEST_CASE("lief.test.binarystream.shared", "[lief][test][binarystream]") {
+  const std::vector<uint8_t> data = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+  SECTION("VectorStream shares its buffer") {
+    VectorStream stream(data);
+    SharedContent content;
+    REQUIRE(stream.peek_shared_data(content, 2, 3));
+    REQUIRE(content.is_shared());
+    REQUIRE(content.data() == stream.start() + 2);
+    REQUIRE(content.to_vector() == std::vector<uint8_t>{0x03, 0x04, 0x05});
+
+    REQUIRE(!stream.peek_shared_data(content, 4, 3));
+    REQUIRE(!stream.peek_shared_data(content, 7, 0x10));
+
+    // The content outlives the stream and the copy is done on write
+    SharedContent copy = content;
+    std::vector<uint8_t> moved = stream.move_content();
+    REQUIRE(moved == data);
+    REQUIRE(copy.is_shared());
+
+    copy.writable()[0] = 0xFF;
+    REQUIRE(!copy.is_shared());
+    REQUIRE(copy.to_vector() == std::vector<uint8_t>{0xFF, 0x04, 0x05});
+    REQUIRE(content.to_vector() == std::vector<uint8_t>{0x03, 0x04, 0x05});
+  }
+
+  SECTION("Other streams copy") {
+    SpanStream stream(data);
+    SharedContent content;
+    REQUIRE(stream.peek_shared_data(content, 2, 3));
+    REQUIRE(!content.is_shared());
+    REQUIRE(content.to_vector() == std::vector<uint8_t>{0x03, 0x04, 0x05});
+    REQUIRE(!stream.peek_shared_data(content, 4, 3));
+  }
+}
+
+// Micro-benchmarks of the generic implementation vs the fast paths.
+// They are hidden by default and can be run with: unittests "[benchmark]"
+TEST_CASE("lief.test.binarystream.benchmark", "[.][benchmark][binarystream]") {
+  const std::vector<uint8_t> strings = gen_strings(20000, /*ascii=*/true);
+  const std::vector<uint8_t> leb128 = gen_leb128(20000);
+
+  BENCHMARK("read_string (generic)") {
+    GenericStream stream(strings);
+    size_t count = 0;
+    while (stream) {
+      count += stream.read_string()->size();
+    }
+    return count;
+  };
+
+  BENCHMARK("read_string (contiguous)") {
+    SpanStream stream(strings);
+    size_t count = 0;
+    while (stream) {
+      count += stream.read_string()->size();
+    }
+    return count;
+  };
+
+  BENCHMARK("read_mutf8 (generic)") {
+    GenericStream stream(strings);
+    size_t count = 0;
+    while (stream) {
+      count += stream.read_mutf8()->size();
+    }
+    return count;
+  };
+
+  BENCHMARK("read_mutf8 (contiguous)") {
+    SpanStream stream(strings);
+    size_t count = 0;
+    while (stream) {
+      count += stream.read_mutf8()->size();
+    }
+    return count;
+  };
+
+  BENCHMARK("read_uleb128 (generic)") {
+    GenericStream stream(leb128);
+    uint64_t sum = 0;
+    while (stream) {
+      sum += *stream.read_uleb128();
+    }
+    return sum;
+  };
+
+  BENCHMARK("read_uleb128 (contiguous)") {
+    SpanStream stream(leb128);
+    uint64_t sum = 0;
+    while (stream) {
+      sum += *stream.read_uleb128();
+    }
+    return sum;
+  };
+}
@@ -0,0 +1,233 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_test_macros.hpp>
+
+#include "LIEF/ELF/Binary.h"
+#include "LIEF/PE/Binary.h"
+#include "LIEF/MachO/Binary.h"
+
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Section.hpp"
+#include "LIEF/ELF/Symbol.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Import.hpp"
+#include "LIEF/PE/Section.hpp"
+#include "LIEF/MachO/Binary.hpp"
+#include "LIEF/MachO/Section.hpp"
+#include "LIEF/MachO/Symbol.hpp"
+
+#include "utils.hpp"
+
+using namespace LIEF;
+
+TEST_CASE("lief.test.c_api.elf", "[lief][test][c_api][elf]") {
+  const std::string path = test::get_sample("ELF", "ELF64_x86-64_binary_ls.bin");
+
+  SECTION("lazy") {
+    Elf_Binary_t* c_elf = elf_parse_lazy(path.c_str());
+    REQUIRE(c_elf != nullptr);
+    const auto& elf = *reinterpret_cast<const ELF::Binary*>(c_elf->handler);
+
+    CHECK(c_elf->sections == nullptr);
+    CHECK(c_elf->segments == nullptr);
+    CHECK(c_elf->dynamic_entries == nullptr);
+    CHECK(c_elf->dynamic_symbols == nullptr);
+    CHECK(c_elf->static_symbols == nullptr);
+
+    const size_t nb_sections = elf_binary_nb_sections(c_elf);
+    REQUIRE(nb_sections == elf.sections().size());
+    CHECK(elf_binary_nb_segments(c_elf) == elf.segments().size());
+    CHECK(elf_binary_nb_dynamic_entries(c_elf) == elf.dynamic_entries().size());
+    CHECK(elf_binary_nb_dynamic_symbols(c_elf) == elf.dynamic_symbols().size());
+    CHECK(elf_binary_nb_static_symbols(c_elf) == elf.static_symbols().size());
+
+    for (size_t i = 0; i < nb_sections; ++i) {
+      const ELF::Section& section = elf.sections()[i];
+      Elf_Section_t c_section = {};
+      REQUIRE(elf_binary_get_section(c_elf, i, &c_section) == 1);
+      CHECK(c_section.virtual_address == section.virtual_address());
+      CHECK(c_section.size == section.size());
+      CHECK(c_section.entropy == 0.0);
+
+      // Names are borrowed from the underlying binary
+      const char* name = elf_binary_get_section_name(c_elf, i);
+      CHECK(name == section.fullname().c_str());
+      CHECK(c_section.name == name);
+
+      double entropy = -1;
+      REQUIRE(elf_binary_get_section_entropy(c_elf, i, &entropy) == 1);
+      CHECK(entropy == section.entropy());
+    }
+
+    const size_t nb_dynsym = elf_binary_nb_dynamic_symbols(c_elf);
+    for (size_t i = 0; i < nb_dynsym; ++i) {
+      const ELF::Symbol& symbol = elf.dynamic_symbols()[i];
+      Elf_Symbol_t c_symbol = {};
+      REQUIRE(elf_binary_get_dynamic_symbol(c_elf, i, &c_symbol) == 1);
+      CHECK(c_symbol.value == symbol.value());
+      CHECK(c_symbol.name == symbol.name().c_str());
+      CHECK(elf_binary_get_dynamic_symbol_name(c_elf, i) == symbol.name().c_str());
+    }
+
+    Elf_Section_t c_section = {};
+    Elf_Segment_t c_segment = {};
+    Elf_Symbol_t c_symbol = {};
+    Elf_DynamicEntry_t c_entry = {};
+    double entropy = 0;
+    CHECK(elf_binary_get_section(c_elf, nb_sections, &c_section) == 0);
+    CHECK(elf_binary_get_section_name(c_elf, nb_sections) == nullptr);
+    CHECK(elf_binary_get_section_entropy(c_elf, nb_sections, &entropy) == 0);
+    CHECK(elf_binary_get_segment(c_elf, elf_binary_nb_segments(c_elf), &c_segment) == 0);
+    CHECK(elf_binary_get_dynamic_entry(c_elf, elf_binary_nb_dynamic_entries(c_elf), &c_entry) == 0);
+    CHECK(elf_binary_get_dynamic_symbol(c_elf, nb_dynsym, &c_symbol) == 0);
+    CHECK(elf_binary_get_dynamic_symbol_name(c_elf, nb_dynsym) == nullptr);
+    CHECK(elf_binary_get_static_symbol(c_elf, elf_binary_nb_static_symbols(c_elf), &c_symbol) == 0);
+    CHECK(elf_binary_get_static_symbol_name(c_elf, elf_binary_nb_static_symbols(c_elf)) == nullptr);
+
+    elf_binary_destroy(c_elf);
+  }
+
+  SECTION("eager") {
+    // elf_parse still fills the entropy of the sections
+    Elf_Binary_t* c_elf = elf_parse(path.c_str());
+    REQUIRE(c_elf != nullptr);
+    const auto& elf = *reinterpret_cast<const ELF::Binary*>(c_elf->handler);
+    REQUIRE(c_elf->sections != nullptr);
+
+    size_t i = 0;
+    for (const ELF::Section& section : elf.sections()) {
+      REQUIRE(c_elf->sections[i] != nullptr);
+      CHECK(c_elf->sections[i]->entropy == section.entropy());
+      ++i;
+    }
+    CHECK(c_elf->sections[i] == nullptr);
+    elf_binary_destroy(c_elf);
+  }
+}
+
+TEST_CASE("lief.test.c_api.pe", "[lief][test][c_api][pe]") {
+  const std::string path = test::get_sample("PE", "PE64_x86-64_binary_mfc-application.exe");
+
+  Pe_Binary_t* c_pe = pe_parse_lazy(path.c_str());
+  REQUIRE(c_pe != nullptr);
+  const auto& pe = *reinterpret_cast<const PE::Binary*>(c_pe->handler);
+
+  CHECK(c_pe->data_directories == nullptr);
+  CHECK(c_pe->sections == nullptr);
+  CHECK(c_pe->imports == nullptr);
+
+  CHECK(pe_binary_nb_data_directories(c_pe) == pe.data_directories().size());
+
+  const size_t nb_sections = pe_binary_nb_sections(c_pe);
+  REQUIRE(nb_sections == pe.sections().size());
+  for (size_t i = 0; i < nb_sections; ++i) {
+    const PE::Section& section = pe.sections()[i];
+    Pe_Section_t c_section = {};
+    REQUIRE(pe_binary_get_section(c_pe, i, &c_section) == 1);
+    CHECK(c_section.virtual_address == section.virtual_address());
+    CHECK(c_section.entropy == 0.0);
+    CHECK(c_section.name == section.fullname().c_str());
+    CHECK(pe_binary_get_section_name(c_pe, i) == section.fullname().c_str());
+
+    double entropy = -1;
+    REQUIRE(pe_binary_get_section_entropy(c_pe, i, &entropy) == 1);
+    CHECK(entropy == section.entropy());
+  }
+
+  const size_t nb_imports = pe_binary_nb_imports(c_pe);
+  REQUIRE(nb_imports == pe.imports().size());
+  for (size_t i = 0; i < nb_imports; ++i) {
+    const PE::Import& import = pe.imports()[i];
+    CHECK(pe_binary_get_import_name(c_pe, i) == import.name().c_str());
+    CHECK(pe_binary_nb_import_entries(c_pe, i) == import.entries().size());
+  }
+
+  Pe_Section_t c_section = {};
+  Pe_DataDirectory_t c_dir = {};
+  Pe_Import_t c_import = {};
+  double entropy = 0;
+  CHECK(pe_binary_get_section(c_pe, nb_sections, &c_section) == 0);
+  CHECK(pe_binary_get_section_name(c_pe, nb_sections) == nullptr);
+  CHECK(pe_binary_get_section_entropy(c_pe, nb_sections, &entropy) == 0);
+  CHECK(pe_binary_get_data_directory(c_pe, pe_binary_nb_data_directories(c_pe), &c_dir) == 0);
+  CHECK(pe_binary_get_import(c_pe, nb_imports, &c_import) == 0);
+  CHECK(pe_binary_get_import_name(c_pe, nb_imports) == nullptr);
+  CHECK(pe_binary_nb_import_entries(c_pe, nb_imports) == 0);
+
+  pe_binary_destroy(c_pe);
+}
+
+TEST_CASE("lief.test.c_api.macho", "[lief][test][c_api][macho]") {
+  const std::string path = test::get_sample("MachO", "MachO64_x86-64_binary_id.bin");
+
+  Macho_Binary_t** c_binaries = macho_parse_lazy(path.c_str());
+  REQUIRE(c_binaries != nullptr);
+  REQUIRE(c_binaries[0] != nullptr);
+  CHECK(c_binaries[1] == nullptr);
+
+  Macho_Binary_t* c_macho = c_binaries[0];
+  const auto& macho = *reinterpret_cast<const MachO::Binary*>(c_macho->handler);
+
+  CHECK(c_macho->commands == nullptr);
+  CHECK(c_macho->symbols == nullptr);
+  CHECK(c_macho->sections == nullptr);
+  CHECK(c_macho->segments == nullptr);
+
+  CHECK(macho_binary_nb_commands(c_macho) == macho.commands().size());
+  CHECK(macho_binary_nb_segments(c_macho) == macho.segments().size());
+
+  const size_t nb_sections = macho_binary_nb_sections(c_macho);
+  REQUIRE(nb_sections == macho.sections().size());
+  for (size_t i = 0; i < nb_sections; ++i) {
+    const MachO::Section& section = macho.sections()[i];
+    Macho_Section_t c_section = {};
+    REQUIRE(macho_binary_get_section(c_macho, i, &c_section) == 1);
+    CHECK(c_section.virtual_address == section.virtual_address());
+    CHECK(c_section.entropy == 0.0);
+    CHECK(c_section.name == section.fullname().c_str());
+    CHECK(macho_binary_get_section_name(c_macho, i) == section.fullname().c_str());
+
+    double entropy = -1;
+    REQUIRE(macho_binary_get_section_entropy(c_macho, i, &entropy) == 1);
+    CHECK(entropy == section.entropy());
+  }
+
+  const size_t nb_symbols = macho_binary_nb_symbols(c_macho);
+  REQUIRE(nb_symbols == macho.symbols().size());
+  for (size_t i = 0; i < nb_symbols; ++i) {
+    const MachO::Symbol& symbol = macho.symbols()[i];
+    Macho_Symbol_t c_symbol = {};
+    REQUIRE(macho_binary_get_symbol(c_macho, i, &c_symbol) == 1);
+    CHECK(c_symbol.value == symbol.value());
+    CHECK(c_symbol.name == symbol.name().c_str());
+    CHECK(macho_binary_get_symbol_name(c_macho, i) == symbol.name().c_str());
+  }
+
+  Macho_Section_t c_section = {};
+  Macho_Segment_t c_segment = {};
+  Macho_Symbol_t c_symbol = {};
+  Macho_Command_t c_command = {};
+  double entropy = 0;
+  CHECK(macho_binary_get_section(c_macho, nb_sections, &c_section) == 0);
+  CHECK(macho_binary_get_section_name(c_macho, nb_sections) == nullptr);
+  CHECK(macho_binary_get_section_entropy(c_macho, nb_sections, &entropy) == 0);
+  CHECK(macho_binary_get_symbol(c_macho, nb_symbols, &c_symbol) == 0);
+  CHECK(macho_binary_get_symbol_name(c_macho, nb_symbols) == nullptr);
+  CHECK(macho_binary_get_segment(c_macho, macho_binary_nb_segments(c_macho), &c_segment) == 0);
+  CHECK(macho_binary_get_command(c_macho, macho_binary_nb_commands(c_macho), &c_command) == 0);
+
+  macho_binaries_destroy(c_binaries);
+}
@@ -0,0 +1,284 @@
+/* Copyright 2017 - 2023 R. Thomas
+ * Copyright 2017 - 2023 Quarkslab
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+
+#include "LIEF/OutputSink.hpp"
+#include "LIEF/ELF/Binary.hpp"
+#include "LIEF/ELF/Builder.hpp"
+#include "LIEF/ELF/Parser.hpp"
+#include "LIEF/PE/Binary.hpp"
+#include "LIEF/PE/Builder.hpp"
+#include "LIEF/PE/Parser.hpp"
+
+#include "utils.hpp"
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <unistd.h>
+#endif
+
+using namespace LIEF;
+namespace fs = std::filesystem;
+
+using range_t = std::pair<uint64_t, uint64_t>;
+
+// Sink which records the calls to write() and zeros()
+class RecordSink : public OutputSink {
+  public:
+  ok_error_t write(uint64_t offset, span<const uint8_t> data) override {
+    writes.emplace_back(offset, data.size());
+    if (content.size() < offset + data.size()) {
+      content.resize(offset + data.size());
+    }
+    std::copy(data.begin(), data.end(), content.begin() + offset);
+    return ok();
+  }
+
+  ok_error_t zeros(uint64_t offset, uint64_t size) override {
+    holes.emplace_back(offset, size);
+    return ok();
+  }
+
+  ok_error_t finalize(uint64_t size) override {
+    content.resize(size);
+    return ok();
+  }
+
+  std::vector<range_t> writes;
+  std::vector<range_t> holes;
+  std::vector<uint8_t> content;
+};
+
+static std::vector<uint8_t> read_file(const fs::path& path) {
+  std::ifstream ifs(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+}
+
+static std::vector<uint8_t> gen_data(size_t size) {
+  std::vector<uint8_t> data(size);
+  std::iota(data.begin(), data.end(), 1);
+  return data;
+}
+
+TEST_CASE("lief.test.sink.sparse", "[lief][test][sink]") {
+  static constexpr size_t PAGE = 0x1000;
+
+  // data | zeros (2 pages) | data | zeros (< 1 page)
+  std::vector<uint8_t> data(5 * PAGE + 0x10, 0);
+  std::fill_n(data.begin(), PAGE + 3, 0xAA);
+  std::fill_n(data.begin() + 4 * PAGE, PAGE, 0xBB);
+
+  RecordSink sink;
+  REQUIRE(sink.write_sparse(0x100, data));
+  REQUIRE(sink.finalize(0x100 + data.size()));
+
+  // The partially filled page is written along with the data
+  REQUIRE(sink.writes.size() == 2);
+  REQUIRE(sink.writes[0] == range_t(0x100, 2 * PAGE));
+  REQUIRE(sink.writes[1] == range_t(0x100 + 4 * PAGE, PAGE + 0x10));
+
+  REQUIRE(sink.holes.size() == 1);
+  REQUIRE(sink.holes[0] == range_t(0x100 + 2 * PAGE, 2 * PAGE));
+
+  std::vector<uint8_t> expected(0x100, 0);
+  expected.insert(expected.end(), data.begin(), data.end());
+  REQUIRE(sink.content == expected);
+
+  SECTION("zeros") {
+    // The default implementation of OutputSink::zeros() writes the zeros
+    class DefaultSink : public RecordSink {
+      public:
+      ok_error_t zeros(uint64_t offset, uint64_t size) override {
+        return OutputSink::zeros(offset, size);
+      }
+    };
+    DefaultSink dsink;
+    REQUIRE(dsink.zeros(0x10, 3 * PAGE + 1));
+    REQUIRE(dsink.writes.size() == 4);
+    REQUIRE(dsink.writes.back() == range_t(0x10 + 3 * PAGE, 1));
+    REQUIRE(dsink.content == std::vector<uint8_t>(0x11 + 3 * PAGE, 0));
+  }
+}
+
+TEST_CASE("lief.test.sink.buffer", "[lief][test][sink]") {
+  std::vector<uint8_t> buffer(0x100, 0xFF);
+  const std::vector<uint8_t> data = gen_data(0x20);
+
+  BufferSink sink(buffer);
+  REQUIRE(sink.write(0x10, data));
+  REQUIRE(sink.zeros(0x30, 0x10));
+  REQUIRE(sink.finalize(0x40));
+  REQUIRE(sink.size() == 0x40);
+
+  REQUIRE(std::equal(data.begin(), data.end(), buffer.begin() + 0x10));
+  REQUIRE(std::all_of(buffer.begin() + 0x30, buffer.begin() + 0x40,
+                      [] (uint8_t v) { return v == 0; }));
+  REQUIRE(buffer[0x40] == 0xFF);
+
+  // Out of bounds
+  REQUIRE(sink.write(0xF0, data).error() == lief_errors::data_too_large);
+  REQUIRE(sink.write(0x101, {}).error() == lief_errors::data_too_large);
+  REQUIRE(sink.zeros(0xF0, 0x20).error() == lief_errors::data_too_large);
+  REQUIRE(sink.finalize(0x101).error() == lief_errors::data_too_large);
+  REQUIRE(sink.write(0xE0, data));
+}
+
+TEST_CASE("lief.test.sink.file", "[lief][test][sink]") {
+  const fs::path path = fs::temp_directory_path() / "lief_test_file_sink.bin";
+  const std::vector<uint8_t> data = gen_data(0x20);
+  {
+    auto sink = FileSink::open(path.string());
+    REQUIRE(sink);
+    REQUIRE(sink->write(0x10, data));
+    REQUIRE(sink->zeros(0x30, 0x3000));
+    REQUIRE(sink->write(0x3030, data));
+    // The output ends with zeros that are not written
+    REQUIRE(sink->finalize(0x4000));
+  }
+
+  std::vector<uint8_t> expected(0x4000, 0);
+  std::copy(data.begin(), data.end(), expected.begin() + 0x10);
+  std::copy(data.begin(), data.end(), expected.begin() + 0x3030);
+  REQUIRE(read_file(path) == expected);
+
+  // zeros() overwrites the content that has already been written
+  {
+    auto sink = FileSink::open(path.string());
+    REQUIRE(sink);
+    REQUIRE(sink->write(0, std::vector<uint8_t>(0x3000, 0xFF)));
+    REQUIRE(sink->zeros(0x10, 0x4000));
+    REQUIRE(sink->finalize(0x4010));
+  }
+  expected.assign(0x4010, 0);
+  std::fill_n(expected.begin(), 0x10, 0xFF);
+  REQUIRE(read_file(path) == expected);
+
+  // Re-opening truncates the file
+  {
+    auto sink = FileSink::open(path.string());
+    REQUIRE(sink);
+    REQUIRE(sink->finalize(0));
+  }
+  REQUIRE(fs::file_size(path) == 0);
+  fs::remove(path);
+
+  REQUIRE(!FileSink::open((path / "does" / "not" / "exist").string()));
+}
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+TEST_CASE("lief.test.sink.pipe", "[lief][test][sink]") {
+  int fds[2] = {-1, -1};
+  REQUIRE(::pipe(fds) == 0);
+  const std::vector<uint8_t> data = gen_data(0x20);
+  {
+    // A pipe can't be written with pwrite(): the content is written
+    // sequentially and the holes are filled with zeros
+    auto sink = FileSink::open("/dev/fd/" + std::to_string(fds[1]));
+    REQUIRE(sink);
+    REQUIRE(sink->write(0x10, data));
+    REQUIRE(sink->zeros(0x30, 0x10));
+    REQUIRE(sink->write(0x50, data));
+    REQUIRE(sink->write(0x10, data).error() == lief_errors::file_error);
+    REQUIRE(sink->finalize(0x100));
+  }
+  ::close(fds[1]);
+
+  std::vector<uint8_t> output;
+  uint8_t buffer[0x100];
+  ssize_t size = 0;
+  while ((size = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+    output.insert(output.end(), buffer, buffer + size);
+  }
+  ::close(fds[0]);
+
+  std::vector<uint8_t> expected(0x100, 0);
+  std::copy(data.begin(), data.end(), expected.begin() + 0x10);
+  std::copy(data.begin(), data.end(), expected.begin() + 0x50);
+  REQUIRE(output == expected);
+}
+
+TEST_CASE("lief.test.sink.mmap", "[lief][test][sink]") {
+  const fs::path path = fs::temp_directory_path() / "lief_test_mmap_sink.bin";
+  const std::vector<uint8_t> data = gen_data(0x20);
+  {
+    auto sink = MmapSink::open(path.string(), 0x2000);
+    REQUIRE(sink);
+    REQUIRE(sink->write(0x1FE0, data));
+    REQUIRE(sink->zeros(0, 0x1000));
+    REQUIRE(sink->write(0x1FF0, data).error() == lief_errors::data_too_large);
+    REQUIRE(sink->zeros(0x1000, 0x1001).error() == lief_errors::data_too_large);
+    // The size must match the mapping
+    REQUIRE(sink->finalize(0x1000).error() == lief_errors::build_error);
+    REQUIRE(sink->finalize(0x2000));
+  }
+
+  std::vector<uint8_t> expected(0x2000, 0);
+  std::copy(data.begin(), data.end(), expected.begin() + 0x1FE0);
+  REQUIRE(read_file(path) == expected);
+  fs::remove(path);
+}
+#endif
+
+TEST_CASE("lief.test.sink.builder", "[lief][test][sink]") {
+  SECTION("ELF") {
+    std::unique_ptr<ELF::Binary> elf = ELF::Parser::parse(test::get_sample("ELF", "ELF64_x86-64_binary_ls.bin"));
+    REQUIRE(elf != nullptr);
+    elf->add_library("libfoo.so");
+
+    ELF::Builder builder(*elf);
+    builder.build();
+    const std::vector<uint8_t>& expected = builder.get_build();
+
+    RecordSink record;
+    REQUIRE(builder.write(record));
+    REQUIRE(record.content == expected);
+
+    std::vector<uint8_t> buffer(expected.size());
+    BufferSink bsink(buffer);
+    REQUIRE(builder.write(bsink));
+    REQUIRE(bsink.size() == expected.size());
+    REQUIRE(buffer == expected);
+
+    const fs::path path = fs::temp_directory_path() / "lief_test_sink_ls.elf";
+    {
+      auto fsink = FileSink::open(path.string());
+      REQUIRE(fsink);
+      REQUIRE(builder.write(*fsink));
+    }
+    REQUIRE(read_file(path) == expected);
+    fs::remove(path);
+  }
+
+  SECTION("PE") {
+    std::unique_ptr<PE::Binary> pe = PE::Parser::parse(test::get_sample("PE", "PE64_x86-64_binary_mfc-application.exe"));
+    REQUIRE(pe != nullptr);
+
+    PE::Builder builder(*pe);
+    builder.build();
+    const std::vector<uint8_t>& expected = builder.get_build();
+
+    std::vector<uint8_t> buffer(expected.size());
+    BufferSink bsink(buffer);
+    REQUIRE(builder.write(bsink));
+    REQUIRE(bsink.size() == expected.size());
+    REQUIRE(buffer == expected);
+  }
+}
@@ -27,6 +27,7 @@
 #include "LIEF/PE/ResourceData.hpp"
 #include "LIEF/PE/ResourceNode.hpp"
 #include "LIEF/PE/ResourceDirectory.hpp"
+#include "LIEF/PE/signature/Signature.hpp"
 
 #include "utils.hpp"
 
@@ -95,6 +96,34 @@ TEST_CASE("lief.test.pe", "[lief][test][pe]") {
     PE::Repro repro;
     REQUIRE(PE::Repro::classof(&repro));
   }
+
+  SECTION("signature") {
+    std::string path = test::get_sample("PE", "PE32_x86-64_binary_avast-free-antivirus-setup-online.exe");
+    std::unique_ptr<PE::Binary> bin = PE::Parser::parse(path);
+    REQUIRE(bin != nullptr);
+    REQUIRE(bin->has_signatures());
+
+    const PE::Signature& sig = *bin->signatures().begin();
+    const span<const uint8_t> raw = sig.raw_der();
+    REQUIRE(!raw.empty());
+
+    // The copies don't duplicate the DER blob
+    PE::Signature copy = sig;
+    REQUIRE(copy.raw_der().data() == raw.data());
+    REQUIRE(copy.raw_der().size() == raw.size());
+
+    const std::vector<uint8_t> expected(raw.begin(), raw.end());
+    const size_t nb_certificates = copy.certificates().size();
+
+    // The blob is owned by the signatures (not by the binary)
+    bin.reset();
+    REQUIRE(std::equal(expected.begin(), expected.end(),
+                       copy.raw_der().begin(), copy.raw_der().end()));
+    REQUIRE(copy.certificates().size() == nb_certificates);
+    for (const PE::x509& crt : copy.certificates()) {
+      REQUIRE(!crt.raw().empty());
+    }
+  }
 }
 
 